@@ -1118,6 +1118,105 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Reads a rectangular block (hyperslab) of a dataset into a preallocated array.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The start of the block in each dimension, slowest varying dimension first
+       * @param count The size of the block in each dimension, slowest varying dimension first
+       * @param data A Pointer to the PreAllocated Array of Data large enough to hold the block
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& offset,
+                                                const std::vector<hsize_t>& count,
+                                                T* data)
+      {
+        return transferPointerDatasetHyperslab(loc_id, dsetName, offset, count, data, true);
+      }
+
+      /**
+       * @brief Writes a rectangular block (hyperslab) of an existing dataset from an array.
+       * @param loc_id The parent location that contains the dataset to write
+       * @param dsetName The name of the dataset to write
+       * @param offset The start of the block in each dimension, slowest varying dimension first
+       * @param count The size of the block in each dimension, slowest varying dimension first
+       * @param data A Pointer to the data for the block
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t writePointerDatasetHyperslab(hid_t loc_id,
+                                                 const std::string& dsetName,
+                                                 const std::vector<hsize_t>& offset,
+                                                 const std::vector<hsize_t>& count,
+                                                 const T* data)
+      {
+        return transferPointerDatasetHyperslab(loc_id, dsetName, offset, count, const_cast<T*>(data), false);
+      }
+
+      /**
+       * @brief Creates an uninitialized, chunked dataset that can be filled block by block with
+       * writePointerDatasetHyperslab().
+       * @param loc_id The parent location to create the dataset in
+       * @param dsetName The name of the dataset to create
+       * @param dims The dimensions of the dataset, slowest varying dimension first
+       * @param chunkDims The chunk dimensions, slowest varying dimension first
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t createChunkedPointerDataset(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& dims,
+                                                const std::vector<hsize_t>& chunkDims)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t retErr = 0;
+        T test = static_cast<T>(0x00);
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (dims.empty() || dims.size() != chunkDims.size())
+        {
+          std::cout  << "The chunk dimensions do not match the dataset dimensions." << std::endl;
+          return -4;
+        }
+
+        hid_t sid = H5Screate_simple(static_cast<int>(dims.size()), dims.data(), nullptr);
+        if (sid < 0)
+        {
+          return sid;
+        }
+        hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+        herr_t err = H5Pset_chunk(plist, static_cast<int>(chunkDims.size()), chunkDims.data());
+        if (err < 0)
+        {
+          std::cout  << "Error setting the chunk size." << std::endl;
+          retErr = err;
+        }
+        if (retErr >= 0)
+        {
+          hid_t did = H5Dcreate(loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, plist, H5P_DEFAULT);
+          if (did < 0)
+          {
+            std::cout  << "Error creating Dataset: " << dsetName << std::endl;
+            retErr = did;
+          }
+          else
+          {
+            H5Dclose(did);
+          }
+        }
+        H5Pclose(plist);
+        H5Sclose(sid);
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
@@ -1635,6 +1734,88 @@ namespace H5Support_NAMESPACE
 
 
     private:
+      /**
+       * @brief Reads or writes a hyperslab of a dataset
+       */
+      template <typename T>
+      static herr_t transferPointerDatasetHyperslab(hid_t loc_id,
+                                                    const std::string& dsetName,
+                                                    const std::vector<hsize_t>& offset,
+                                                    const std::vector<hsize_t>& count,
+                                                    T* data,
+                                                    bool read)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t err = 0;
+        herr_t retErr = 0;
+        T test = static_cast<T>(0x00);
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (loc_id < 0)
+        {
+          std::cout  << "loc_id was Negative: This is not allowed." << std::endl;
+          return -2;
+        }
+        if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        hid_t did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+
+        hid_t fileSpace = H5Dget_space(did);
+        int rank = H5Sget_simple_extent_ndims(fileSpace);
+        if (rank < 0 || static_cast<size_t>(rank) != offset.size() || static_cast<size_t>(rank) != count.size())
+        {
+          std::cout  << "The hyperslab rank does not match the rank of the dataset." << std::endl;
+          retErr = -4;
+        }
+        else
+        {
+          err = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+          if (err < 0)
+          {
+            std::cout  << "Error selecting the hyperslab." << std::endl;
+            retErr = err;
+          }
+          else
+          {
+            hid_t memSpace = H5Screate_simple(rank, count.data(), nullptr);
+            if (read)
+            {
+              err = H5Dread(did, dataType, memSpace, fileSpace, H5P_DEFAULT, data);
+            }
+            else
+            {
+              err = H5Dwrite(did, dataType, memSpace, fileSpace, H5P_DEFAULT, data);
+            }
+            if (err < 0)
+            {
+              std::cout  << "Error " << (read ? "Reading" : "Writing") << " Data." << std::endl;
+              retErr = err;
+            }
+            H5Sclose(memSpace);
+          }
+        }
+        H5Sclose(fileSpace);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
 
   };
 
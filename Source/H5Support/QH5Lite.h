@@ -461,6 +461,47 @@ namespace H5Support_NAMESPACE
       }
 
 
+      /**
+       * @brief Reads a rectangular block (hyperslab) of a dataset into a preallocated array.
+       * @see H5Lite::readPointerDatasetHyperslab
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const std::vector<hsize_t>& offset,
+                                                const std::vector<hsize_t>& count,
+                                                T* data)
+      {
+        return H5Lite::readPointerDatasetHyperslab(loc_id, dsetName.toStdString(), offset, count, data);
+      }
+
+      /**
+       * @brief Writes a rectangular block (hyperslab) of an existing dataset from an array.
+       * @see H5Lite::writePointerDatasetHyperslab
+       */
+      template <typename T>
+      static herr_t writePointerDatasetHyperslab(hid_t loc_id,
+                                                 const QString& dsetName,
+                                                 const std::vector<hsize_t>& offset,
+                                                 const std::vector<hsize_t>& count,
+                                                 const T* data)
+      {
+        return H5Lite::writePointerDatasetHyperslab(loc_id, dsetName.toStdString(), offset, count, data);
+      }
+
+      /**
+       * @brief Creates an uninitialized, chunked dataset.
+       * @see H5Lite::createChunkedPointerDataset
+       */
+      template <typename T>
+      static herr_t createChunkedPointerDataset(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const std::vector<hsize_t>& dims,
+                                                const std::vector<hsize_t>& chunkDims)
+      {
+        return H5Lite::createChunkedPointerDataset<T>(loc_id, dsetName.toStdString(), dims, chunkDims);
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an QVector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
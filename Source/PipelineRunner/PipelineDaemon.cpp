@@ -0,0 +1,428 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <functional>
+#include <iostream>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSettings>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QUrlQuery>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QNetworkAccessManager>
+#include <QtNetwork/QNetworkReply>
+#include <QtNetwork/QNetworkRequest>
+
+#include "QtWebApp/httpserver/httplistener.h"
+
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/DataContainerArrayCache.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+#include "PipelineDaemonService.h"
+
+namespace
+{
+const QString k_DefaultHost("127.0.0.1");
+const int k_DefaultPort = 8095;
+
+// -----------------------------------------------------------------------------
+// The token file of a daemon lives in the per user data directory and is named after the port, so that
+// daemons on different ports do not share a token.
+// -----------------------------------------------------------------------------
+QString DefaultTokenFile(int port)
+{
+  return QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation) + QString("/PipelineDaemon-%1.token").arg(port);
+}
+
+// -----------------------------------------------------------------------------
+// Writes the session token to a file that only the current user may read
+// -----------------------------------------------------------------------------
+bool WriteTokenFile(const QString& filePath, const QByteArray& token)
+{
+  QFileInfo fi(filePath);
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    return false;
+  }
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  // Restrict the permissions before the token is written
+  if(!file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner))
+  {
+    file.close();
+    file.remove();
+    return false;
+  }
+  bool written = (file.write(token) == token.size());
+  file.close();
+  return written;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray ReadTokenFile(const QString& filePath)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    std::cout << "The token file '" << filePath.toStdString() << "' of the pipeline daemon could not be read" << std::endl;
+    return QByteArray();
+  }
+  return file.readAll().trimmed();
+}
+
+// -----------------------------------------------------------------------------
+// Sends a request to the daemon and blocks until the reply has finished. Every
+// chunk of the reply body is handed to the callback as soon as it arrives.
+// -----------------------------------------------------------------------------
+int SendRequest(QNetworkAccessManager& manager, const QByteArray& token, const QByteArray& method, const QUrl& url, const QByteArray& body,
+                const std::function<void(const QByteArray&)>& callback)
+{
+  QNetworkRequest request(url);
+  request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+  request.setRawHeader("Authorization", "Bearer " + token);
+  QNetworkReply* reply = manager.sendCustomRequest(request, method, body);
+
+  QByteArray pending;
+  QObject::connect(reply, &QNetworkReply::readyRead, [reply, &pending, &callback] {
+    pending.append(reply->readAll());
+    int newLine = pending.indexOf('\n');
+    while(newLine >= 0)
+    {
+      callback(pending.left(newLine));
+      pending.remove(0, newLine + 1);
+      newLine = pending.indexOf('\n');
+    }
+  });
+
+  QEventLoop loop;
+  QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
+  loop.exec();
+
+  pending.append(reply->readAll());
+  if(!pending.trimmed().isEmpty())
+  {
+    callback(pending);
+  }
+
+  int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+  if(reply->error() != QNetworkReply::NoError && status == 0)
+  {
+    std::cout << "Error contacting the pipeline daemon at " << url.toString().toStdString() << ": " << reply->errorString().toStdString() << std::endl;
+    status = -1;
+  }
+  reply->deleteLater();
+  return status;
+}
+
+// -----------------------------------------------------------------------------
+// Stand-in client: submits a pipeline to a running daemon and prints its messages
+// until the job has finished.
+// -----------------------------------------------------------------------------
+int SubmitPipeline(const QUrl& baseUrl, const QByteArray& token, const QString& pipelineFile, const QString& name)
+{
+  QFile file(pipelineFile);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    std::cout << "The pipeline file '" << pipelineFile.toStdString() << "' could not be opened" << std::endl;
+    return EXIT_FAILURE;
+  }
+  QByteArray contents = file.readAll();
+
+  QNetworkAccessManager manager;
+  QUrl submitUrl = baseUrl.resolved(QUrl("/jobs"));
+  QUrlQuery submitQuery;
+  submitQuery.addQueryItem("name", name);
+  submitUrl.setQuery(submitQuery);
+
+  QJsonObject reply;
+  int status = SendRequest(manager, token, "POST", submitUrl, contents, [&reply](const QByteArray& data) { reply = QJsonDocument::fromJson(data).object(); });
+  if(status != 201)
+  {
+    std::cout << "The pipeline was not accepted: " << reply["Error"].toString().toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  int id = reply["Id"].toInt();
+  std::cout << "Submitted job " << id << std::endl;
+
+  QUrl messagesUrl = baseUrl.resolved(QUrl(QString("/jobs/%1/messages").arg(id)));
+  QUrlQuery messagesQuery;
+  messagesQuery.addQueryItem("follow", "1");
+  messagesUrl.setQuery(messagesQuery);
+
+  QString state;
+  int errorCondition = 0;
+  SendRequest(manager, token, "GET", messagesUrl, QByteArray(), [&state, &errorCondition](const QByteArray& line) {
+    QJsonObject json = QJsonDocument::fromJson(line).object();
+    if(json.contains("State"))
+    {
+      state = json["State"].toString();
+      errorCondition = json["ErrorCondition"].toInt();
+      return;
+    }
+    QString type = json["Type"].toString();
+    if(type == "Progress")
+    {
+      return;
+    }
+    std::cout << json["Prefix"].toString().toStdString() << " " << json["Filter"].toString().toStdString() << ": " << json["Text"].toString().toStdString();
+    if(type == "Error" || type == "Warning")
+    {
+      std::cout << " (" << json["Code"].toInt() << ")";
+    }
+    std::cout << std::endl;
+  });
+
+  std::cout << "Job " << id << " " << state.toStdString() << " with error condition " << errorCondition << std::endl;
+  return (state == "Completed") ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ShutdownDaemon(const QUrl& baseUrl, const QByteArray& token)
+{
+  QNetworkAccessManager manager;
+  int status = SendRequest(manager, token, "POST", baseUrl.resolved(QUrl("/shutdown")), QByteArray(), [](const QByteArray&) {});
+  return (status == 200) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication* app = new QCoreApplication(argc, argv);
+  app->setOrganizationName("BlueQuartz Software");
+  app->setOrganizationDomain("bluequartz.net");
+  app->setApplicationName("PipelineDaemon");
+  app->setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  QString str;
+  QTextStream ss(&str);
+  ss << "Pipeline Daemon (" << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch()
+     << "): This application keeps the plugins loaded and executes pipelines that are submitted over a local HTTP connection. "
+     << "The same executable acts as a client with the --submit and --shutdown options.";
+  parser.setApplicationDescription(str);
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  QCommandLineOption hostArg(QStringList() << "host", "Address the daemon listens on. Defaults to 127.0.0.1 so that only local clients can connect.", "address");
+  parser.addOption(hostArg);
+
+  QCommandLineOption allowRemoteArg(QStringList() << "allow-remote", "Allow --host to be an address that is not a loopback address. Other machines can then submit pipelines with the token.");
+  parser.addOption(allowRemoteArg);
+
+  QCommandLineOption portArg(QStringList() << "port", QString("Port the daemon listens on. Defaults to %1.").arg(k_DefaultPort), "port");
+  parser.addOption(portArg);
+
+  QCommandLineOption workersArg(QStringList() << "w"
+                                              << "workers",
+                                "Maximum number of pipelines that execute at the same time. Defaults to the number of cores.", "count");
+  parser.addOption(workersArg);
+
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads the parallel algorithms may use. Overrides SIMPL_NUM_THREADS.", "count");
+  parser.addOption(threadsArg);
+
+  QCommandLineOption cacheSizeArg(QStringList() << "cache-size", "Number of recently read .dream3d files kept in memory. Defaults to 4, 0 disables the cache.", "count");
+  parser.addOption(cacheSizeArg);
+
+  QCommandLineOption cacheMemoryArg(QStringList() << "cache-memory", "Total memory in MB the cached files may use. Defaults to no limit.", "MB");
+  parser.addOption(cacheMemoryArg);
+
+  QCommandLineOption submitArg(QStringList() << "submit", "Submit a JSON pipeline file to a running daemon and print its messages until it finished.", "file");
+  parser.addOption(submitArg);
+
+  QCommandLineOption nameArg(QStringList() << "name", "Name of the submitted job.", "name");
+  parser.addOption(nameArg);
+
+  QCommandLineOption shutdownArg(QStringList() << "shutdown", "Stop a running daemon.");
+  parser.addOption(shutdownArg);
+
+  QCommandLineOption tokenFileArg(QStringList() << "token-file",
+                                  "File that holds the session token of the daemon. The daemon writes a new token to it when it starts and the clients read it. "
+                                  "Defaults to PipelineDaemon-<port>.token in the application data directory of the user.",
+                                  "file");
+  parser.addOption(tokenFileArg);
+
+  parser.process(*app);
+
+  QString host = parser.isSet(hostArg) ? parser.value(hostArg) : k_DefaultHost;
+  int port = parser.isSet(portArg) ? parser.value(portArg).toInt() : k_DefaultPort;
+
+  QUrl baseUrl;
+  baseUrl.setScheme("http");
+  baseUrl.setHost(host);
+  baseUrl.setPort(port);
+
+  QString tokenFile = parser.isSet(tokenFileArg) ? parser.value(tokenFileArg) : DefaultTokenFile(port);
+
+  if(parser.isSet(submitArg) || parser.isSet(shutdownArg))
+  {
+    QByteArray token = ReadTokenFile(tokenFile);
+    if(token.isEmpty())
+    {
+      return EXIT_FAILURE;
+    }
+    if(parser.isSet(submitArg))
+    {
+      return SubmitPipeline(baseUrl, token, parser.value(submitArg), parser.value(nameArg));
+    }
+    return ShutdownDaemon(baseUrl, token);
+  }
+
+  // Any process that can reach the daemon can execute code through it, so only local clients are accepted
+  // unless the user asks for something else
+  QHostAddress hostAddress(host);
+  bool loopback = (host.compare("localhost", Qt::CaseInsensitive) == 0) || hostAddress.isLoopback();
+  if(!loopback && !parser.isSet(allowRemoteArg))
+  {
+    std::cout << "The daemon only listens on loopback addresses. Use --allow-remote to listen on " << host.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Clients must present the Host they connected to, which rejects requests that a web page sends through a
+  // DNS name that resolves to the daemon
+  QStringList allowedHosts = {QString("%1:%2").arg(host).arg(port)};
+  if(hostAddress.protocol() == QAbstractSocket::IPv6Protocol)
+  {
+    allowedHosts << QString("[%1]:%2").arg(host).arg(port);
+  }
+  if(hostAddress == QHostAddress::LocalHost || hostAddress == QHostAddress::LocalHostIPv6)
+  {
+    allowedHosts << QString("localhost:%1").arg(port);
+  }
+
+  QByteArray token = PipelineDaemonService::GenerateToken();
+  if(!WriteTokenFile(tokenFile, token))
+  {
+    std::cout << "The token file '" << tokenFile.toStdString() << "' could not be written" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(parser.isSet(threadsArg))
+  {
+    ParallelExecutionContext::Instance()->setMaxThreads(parser.value(threadsArg).toInt());
+  }
+
+  DataContainerArrayCache* cache = DataContainerArrayCache::Instance();
+  if(parser.isSet(cacheSizeArg))
+  {
+    cache->setMaxEntries(parser.value(cacheSizeArg).toULongLong());
+  }
+  else if(!cache->isEnabled())
+  {
+    cache->setMaxEntries(4);
+  }
+  if(parser.isSet(cacheMemoryArg))
+  {
+    cache->setMemoryBudget(parser.value(cacheMemoryArg).toULongLong());
+  }
+
+  std::cout << "PipelineDaemon Starting. " << std::endl;
+  std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+
+  // Every plugin is loaded up front. Jobs are parsed on the connection threads and must
+  // never be the ones that trigger a plugin load.
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm, false, false);
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+  PipelineDaemonService* daemonService = new PipelineDaemonService(parser.value(workersArg).toInt(), token, allowedHosts, app);
+
+  // Configure and start the TCP listener. The listener reads its configuration from a QSettings object, which
+  // is backed by a temporary file so that the settings of the user are not modified.
+  QTemporaryFile* listenerSettingsFile = new QTemporaryFile(app);
+  if(!listenerSettingsFile->open())
+  {
+    std::cout << "The settings of the listener could not be created" << std::endl;
+    QFile::remove(tokenFile);
+    return EXIT_FAILURE;
+  }
+  listenerSettingsFile->close();
+  QSettings* listenerSettings = new QSettings(listenerSettingsFile->fileName(), QSettings::IniFormat, app);
+  listenerSettings->setValue("host", host);
+  listenerSettings->setValue("port", port);
+  listenerSettings->setValue("minThreads", "4");
+  listenerSettings->setValue("maxThreads", "100");
+  listenerSettings->setValue("readTimeout", "60000");
+  listenerSettings->setValue("maxRequestSize", "64000000");
+  listenerSettings->setValue("maxMultiPartSize", "64000000");
+  HttpListener* httpListener = new HttpListener(listenerSettings, daemonService, app);
+  if(!httpListener->isListening())
+  {
+    std::cout << "The daemon could not listen on " << host.toStdString() << ":" << port << std::endl;
+    QFile::remove(tokenFile);
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Listening on " << baseUrl.toString().toStdString() << " with " << fm->getFactories().size() << " filters" << std::endl;
+  std::cout << "The session token is in " << tokenFile.toStdString() << std::endl;
+
+  int err = app->exec();
+
+  // Stop accepting connections before the service goes away
+  httpListener->close();
+  daemonService->shutdown();
+  QFile::remove(tokenFile);
+  std::cout << "PipelineDaemon Stopped." << std::endl;
+  return err;
+}
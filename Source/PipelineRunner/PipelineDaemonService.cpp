@@ -0,0 +1,714 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineDaemonService.h"
+
+#include <functional>
+#include <random>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/DataContainerArrayCache.h"
+
+namespace
+{
+const QString k_Queued("Queued");
+const QString k_Running("Running");
+const QString k_Completed("Completed");
+const QString k_Failed("Failed");
+const QString k_Canceled("Canceled");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IsFinished(const QString& state)
+{
+  return state == k_Completed || state == k_Failed || state == k_Canceled;
+}
+
+/**
+ * @brief The DaemonJobObserver class forwards every message of a job's pipeline to the service
+ */
+class DaemonJobObserver : public Observer
+{
+public:
+  DaemonJobObserver(std::function<void(const PipelineMessage&)> func)
+  : m_Func(std::move(func))
+  {
+  }
+  ~DaemonJobObserver() override = default;
+
+  void processPipelineMessage(const PipelineMessage& pm) override
+  {
+    m_Func(pm);
+  }
+
+private:
+  std::function<void(const PipelineMessage&)> m_Func;
+};
+
+/**
+ * @brief The DaemonJobRunnable class executes a single job on a worker thread
+ */
+class DaemonJobRunnable : public QRunnable
+{
+public:
+  DaemonJobRunnable(std::function<void(int)> func, int id)
+  : m_Func(std::move(func))
+  , m_Id(id)
+  {
+  }
+  ~DaemonJobRunnable() override = default;
+
+  void run() override
+  {
+    m_Func(m_Id);
+  }
+
+private:
+  std::function<void(int)> m_Func;
+  int m_Id = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDaemonService::PipelineDaemonService(int maxWorkers, const QByteArray& token, const QStringList& allowedHosts, QObject* parent)
+: HttpRequestHandler(parent)
+, m_Token(token)
+, m_AllowedHosts(allowedHosts)
+{
+  m_WorkerPool.setMaxThreadCount(maxWorkers > 0 ? maxWorkers : QThread::idealThreadCount());
+  // Keep the worker threads alive between jobs
+  m_WorkerPool.setExpiryTimeout(-1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDaemonService::~PipelineDaemonService()
+{
+  shutdown();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineDaemonService::GenerateToken()
+{
+  std::random_device device;
+  QByteArray token;
+  for(int i = 0; i < 8; i++)
+  {
+    uint32_t value = device();
+    token.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  return token.toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDaemonService::authorize(HttpRequest& request, HttpResponse& response)
+{
+  if(!m_AllowedHosts.contains(QString::fromLatin1(request.getHeader("Host")), Qt::CaseInsensitive))
+  {
+    WriteError(response, 403, "Forbidden", QObject::tr("The Host header does not name the address of the daemon"));
+    return false;
+  }
+  if(!request.getHeader("Origin").isEmpty())
+  {
+    WriteError(response, 403, "Forbidden", QObject::tr("Requests from web pages are not accepted"));
+    return false;
+  }
+
+  // Compare every character so that the time does not reveal how much of the token matched
+  QByteArray expected = "Bearer " + m_Token;
+  QByteArray authorization = request.getHeader("Authorization").trimmed();
+  char difference = static_cast<char>(authorization.size() != expected.size());
+  for(int i = 0; i < expected.size(); i++)
+  {
+    difference |= expected[i] ^ (i < authorization.size() ? authorization[i] : 0);
+  }
+  if(m_Token.isEmpty() || difference != 0)
+  {
+    WriteError(response, 401, "Unauthorized", QObject::tr("The request does not carry the session token of the daemon"));
+    return false;
+  }
+
+  if(request.getMethod() == "POST" && !request.getHeader("Content-Type").trimmed().toLower().startsWith("application/json"))
+  {
+    WriteError(response, 415, "Unsupported Media Type", QObject::tr("POST requests must have the Content-Type application/json"));
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::service(HttpRequest& request, HttpResponse& response)
+{
+  if(!authorize(request, response))
+  {
+    return;
+  }
+
+  QByteArray method = request.getMethod();
+  QStringList path = QString::fromUtf8(request.getPath()).split('/', QString::SkipEmptyParts);
+
+  if(path.size() == 1 && path[0] == "status" && method == "GET")
+  {
+    handleStatus(response);
+    return;
+  }
+  if(path.size() == 1 && path[0] == "shutdown" && method == "POST")
+  {
+    handleShutdown(response);
+    return;
+  }
+  if(path.empty() || path[0] != "jobs")
+  {
+    WriteError(response, 404, "Not Found", QObject::tr("Unknown resource '%1'").arg(QString::fromUtf8(request.getPath())));
+    return;
+  }
+
+  if(path.size() == 1)
+  {
+    if(method == "GET")
+    {
+      handleListJobs(response);
+    }
+    else if(method == "POST")
+    {
+      handleSubmitJob(request, response);
+    }
+    else
+    {
+      WriteError(response, 405, "Method Not Allowed", QObject::tr("Jobs can only be listed or submitted"));
+    }
+    return;
+  }
+
+  bool ok = false;
+  int id = path[1].toInt(&ok);
+  if(!ok)
+  {
+    WriteError(response, 400, "Bad Request", QObject::tr("'%1' is not a valid job id").arg(path[1]));
+    return;
+  }
+
+  if(path.size() == 2 && method == "GET")
+  {
+    handleJobStatus(id, response);
+  }
+  else if(path.size() == 2 && method == "DELETE")
+  {
+    handleCancelJob(id, response);
+  }
+  else if(path.size() == 3 && path[2] == "messages" && method == "GET")
+  {
+    handleJobMessages(id, request, response);
+  }
+  else
+  {
+    WriteError(response, 404, "Not Found", QObject::tr("Unknown resource '%1'").arg(QString::fromUtf8(request.getPath())));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineDaemonService::submitJob(const QString& name, const QByteArray& pipelineJson, QString& errorMessage)
+{
+  // Parse the pipeline on the calling thread so that the client is told right away if it is invalid
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  FilterPipeline::Pointer pipeline = jsonReader->readPipelineFromString(QString::fromUtf8(pipelineJson));
+  if(nullptr == pipeline.get() || pipeline->size() == 0)
+  {
+    errorMessage = QObject::tr("The request body does not contain a valid pipeline");
+    return -1;
+  }
+
+  int id = 0;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_ShuttingDown)
+    {
+      errorMessage = QObject::tr("The daemon is shutting down");
+      return -2;
+    }
+    id = m_NextJobId++;
+    JobRecord job;
+    job.id = id;
+    job.name = name.isEmpty() ? QString("Job_%1").arg(id) : name;
+    job.state = k_Queued;
+    job.submitted = QDateTime::currentMSecsSinceEpoch();
+    job.pipeline = pipeline;
+    m_Jobs.insert(id, job);
+    trimFinishedJobs();
+  }
+
+  m_WorkerPool.start(new DaemonJobRunnable([this](int jobId) { executeJob(jobId); }, id));
+  return id;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDaemonService::cancelJob(int id)
+{
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_Jobs.find(id);
+  if(iter == m_Jobs.end())
+  {
+    return false;
+  }
+  JobRecord& job = iter.value();
+  if(IsFinished(job.state))
+  {
+    return true;
+  }
+  job.canceled = true;
+  if(job.state == k_Queued)
+  {
+    // The worker skips the job once it reaches the front of the queue
+    job.state = k_Canceled;
+    job.pipeline.reset();
+    m_JobChanged.wakeAll();
+  }
+  else if(nullptr != job.pipeline.get())
+  {
+    job.pipeline->cancelPipeline();
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::shutdown()
+{
+  QList<int> ids;
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_ShuttingDown = true;
+    ids = m_Jobs.keys();
+  }
+  for(int id : ids)
+  {
+    cancelJob(id);
+  }
+  m_WorkerPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::executeJob(int id)
+{
+  FilterPipeline::Pointer pipeline;
+  QString name;
+  {
+    QMutexLocker locker(&m_Mutex);
+    auto iter = m_Jobs.find(id);
+    if(iter == m_Jobs.end() || iter.value().canceled)
+    {
+      return;
+    }
+    iter.value().state = k_Running;
+    pipeline = iter.value().pipeline;
+    name = iter.value().name;
+    m_JobChanged.wakeAll();
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  DaemonJobObserver observer([this, id](const PipelineMessage& pm) { appendMessage(id, pm); });
+  pipeline->addMessageReceiver(&observer);
+  int err = pipeline->preflightPipeline();
+  if(err >= 0)
+  {
+    pipeline->execute();
+    err = pipeline->getErrorCondition();
+  }
+  else
+  {
+    QString ss = QObject::tr("Errors preflighting the pipeline for job '%1'").arg(name);
+    appendMessage(id, PipelineMessage::CreateErrorMessage("PipelineDaemon", "Pipeline Daemon", ss, err));
+  }
+
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_Jobs.find(id);
+  if(iter != m_Jobs.end())
+  {
+    JobRecord& job = iter.value();
+    job.errorCondition = err;
+    job.elapsedMilliseconds = timer.elapsed();
+    if(job.canceled)
+    {
+      job.state = k_Canceled;
+    }
+    else
+    {
+      job.state = (err < 0) ? k_Failed : k_Completed;
+    }
+    // Release the data of the pipeline, the messages are all that is kept of a finished job
+    job.pipeline.reset();
+  }
+  m_JobChanged.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::appendMessage(int id, const PipelineMessage& pm)
+{
+  QJsonObject json = ToJson(pm);
+  QMutexLocker locker(&m_Mutex);
+  auto iter = m_Jobs.find(id);
+  if(iter != m_Jobs.end())
+  {
+    iter.value().messages.push_back(json);
+    m_JobChanged.wakeAll();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::trimFinishedJobs()
+{
+  int finishedCount = 0;
+  for(const JobRecord& job : m_Jobs)
+  {
+    if(IsFinished(job.state))
+    {
+      finishedCount++;
+    }
+  }
+
+  // The map is ordered by id, so the oldest jobs come first
+  for(auto iter = m_Jobs.begin(); iter != m_Jobs.end() && finishedCount > k_MaxFinishedJobs;)
+  {
+    if(IsFinished(iter.value().state))
+    {
+      iter = m_Jobs.erase(iter);
+      finishedCount--;
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineDaemonService::ToJson(const PipelineMessage& pm)
+{
+  QJsonObject json;
+  switch(pm.getType())
+  {
+  case PipelineMessage::MessageType::Error:
+    json["Type"] = QString("Error");
+    break;
+  case PipelineMessage::MessageType::Warning:
+    json["Type"] = QString("Warning");
+    break;
+  case PipelineMessage::MessageType::StatusMessage:
+    json["Type"] = QString("Status");
+    break;
+  case PipelineMessage::MessageType::StandardOutputMessage:
+    json["Type"] = QString("StandardOutput");
+    break;
+  case PipelineMessage::MessageType::ProgressValue:
+    json["Type"] = QString("Progress");
+    break;
+  case PipelineMessage::MessageType::StatusMessageAndProgressValue:
+    json["Type"] = QString("StatusAndProgress");
+    break;
+  default:
+    json["Type"] = QString("Unknown");
+    break;
+  }
+  json["Filter"] = pm.getFilterHumanLabel();
+  json["ClassName"] = pm.getFilterClassName();
+  json["PipelineIndex"] = pm.getPipelineIndex();
+  json["Prefix"] = pm.getPrefix();
+  json["Text"] = pm.getText();
+  json["Code"] = pm.getCode();
+  json["Progress"] = pm.getProgressValue();
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineDaemonService::ToJson(const JobRecord& job)
+{
+  QJsonObject json;
+  json["Id"] = job.id;
+  json["Name"] = job.name;
+  json["State"] = job.state;
+  json["ErrorCondition"] = job.errorCondition;
+  json["Submitted"] = QDateTime::fromMSecsSinceEpoch(job.submitted).toString(Qt::ISODate);
+  json["ElapsedMilliseconds"] = static_cast<double>(job.elapsedMilliseconds);
+  json["MessageCount"] = job.messages.size();
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleStatus(HttpResponse& response)
+{
+  QJsonObject json;
+  json["Version"] = SIMPLib::Version::PackageComplete();
+  json["Filters"] = FilterManager::Instance()->getFactories().size();
+  json["Workers"] = m_WorkerPool.maxThreadCount();
+  json["ActiveWorkers"] = m_WorkerPool.activeThreadCount();
+
+  int queued = 0;
+  int running = 0;
+  {
+    QMutexLocker locker(&m_Mutex);
+    for(const JobRecord& job : m_Jobs)
+    {
+      queued += (job.state == k_Queued) ? 1 : 0;
+      running += (job.state == k_Running) ? 1 : 0;
+    }
+  }
+  json["QueuedJobs"] = queued;
+  json["RunningJobs"] = running;
+
+  DataContainerArrayCache* cache = DataContainerArrayCache::Instance();
+  QJsonObject cacheJson;
+  cacheJson["MaxEntries"] = static_cast<double>(cache->getMaxEntries());
+  cacheJson["Entries"] = static_cast<double>(cache->size());
+  cacheJson["Hits"] = static_cast<double>(cache->getHitCount());
+  cacheJson["Misses"] = static_cast<double>(cache->getMissCount());
+  json["Cache"] = cacheJson;
+
+  WriteJson(response, json);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleListJobs(HttpResponse& response)
+{
+  QJsonArray jobs;
+  {
+    QMutexLocker locker(&m_Mutex);
+    for(const JobRecord& job : m_Jobs)
+    {
+      jobs.append(ToJson(job));
+    }
+  }
+  QJsonObject json;
+  json["Jobs"] = jobs;
+  WriteJson(response, json);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleSubmitJob(HttpRequest& request, HttpResponse& response)
+{
+  QString errorMessage;
+  int id = submitJob(QString::fromUtf8(request.getParameter("name")), request.getBody(), errorMessage);
+  if(id < 0)
+  {
+    WriteError(response, (id == -2) ? 503 : 400, (id == -2) ? "Service Unavailable" : "Bad Request", errorMessage);
+    return;
+  }
+
+  QJsonObject json;
+  json["Id"] = id;
+  WriteJson(response, json, 201, "Created");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleJobStatus(int id, HttpResponse& response)
+{
+  QJsonObject json;
+  {
+    QMutexLocker locker(&m_Mutex);
+    auto iter = m_Jobs.find(id);
+    if(iter == m_Jobs.end())
+    {
+      locker.unlock();
+      WriteError(response, 404, "Not Found", QObject::tr("There is no job with id %1").arg(id));
+      return;
+    }
+    json = ToJson(iter.value());
+  }
+  WriteJson(response, json);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleJobMessages(int id, HttpRequest& request, HttpResponse& response)
+{
+  int since = qMax(0, request.getParameter("since").toInt());
+  QByteArray followParam = request.getParameter("follow");
+  bool follow = (followParam == "1" || followParam == "true");
+
+  QMutexLocker locker(&m_Mutex);
+  if(!m_Jobs.contains(id))
+  {
+    locker.unlock();
+    WriteError(response, 404, "Not Found", QObject::tr("There is no job with id %1").arg(id));
+    return;
+  }
+
+  if(!follow)
+  {
+    const JobRecord& job = m_Jobs[id];
+    QJsonArray messages;
+    for(int i = since; i < job.messages.size(); i++)
+    {
+      messages.append(job.messages[i]);
+    }
+    QJsonObject json = ToJson(job);
+    json["Next"] = job.messages.size();
+    json["Messages"] = messages;
+    locker.unlock();
+    WriteJson(response, json);
+    return;
+  }
+
+  // Stream the messages as one JSON document per line until the job has finished. The last
+  // line is the final status of the job.
+  response.setHeader("Content-Type", "application/x-ndjson");
+  while(true)
+  {
+    auto iter = m_Jobs.find(id);
+    if(iter == m_Jobs.end())
+    {
+      locker.unlock();
+      response.write(QByteArray(), true);
+      return;
+    }
+
+    const JobRecord& job = iter.value();
+    if(since >= job.messages.size() && !IsFinished(job.state))
+    {
+      m_JobChanged.wait(&m_Mutex, 1000);
+      continue;
+    }
+
+    QByteArray lines;
+    for(; since < job.messages.size(); since++)
+    {
+      lines.append(QJsonDocument(job.messages[since]).toJson(QJsonDocument::Compact));
+      lines.append('\n');
+    }
+    bool finished = IsFinished(job.state);
+    if(finished)
+    {
+      lines.append(QJsonDocument(ToJson(job)).toJson(QJsonDocument::Compact));
+      lines.append('\n');
+    }
+    locker.unlock();
+
+    response.write(lines, finished);
+    if(finished || !response.isConnected())
+    {
+      return;
+    }
+    locker.relock();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleCancelJob(int id, HttpResponse& response)
+{
+  if(!cancelJob(id))
+  {
+    WriteError(response, 404, "Not Found", QObject::tr("There is no job with id %1").arg(id));
+    return;
+  }
+  handleJobStatus(id, response);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::handleShutdown(HttpResponse& response)
+{
+  QJsonObject json;
+  json["State"] = QString("ShuttingDown");
+  WriteJson(response, json);
+  // The listener is owned by the main thread, so the event loop there tears everything down
+  QMetaObject::invokeMethod(QCoreApplication::instance(), "quit", Qt::QueuedConnection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::WriteJson(HttpResponse& response, const QJsonObject& json, int statusCode, const QByteArray& description)
+{
+  response.setStatus(statusCode, description);
+  response.setHeader("Content-Type", "application/json");
+  response.write(QJsonDocument(json).toJson(QJsonDocument::Compact), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDaemonService::WriteError(HttpResponse& response, int statusCode, const QByteArray& description, const QString& message)
+{
+  QJsonObject json;
+  json["Error"] = message;
+  WriteJson(response, json, statusCode, description);
+}
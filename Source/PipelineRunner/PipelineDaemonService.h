@@ -0,0 +1,206 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QStringList>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+#include <QtCore/QWaitCondition>
+
+#include "QtWebApp/httpserver/httprequesthandler.h"
+
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+/**
+ * @brief The PipelineDaemonService class is the request handler of the PipelineDaemon. It accepts
+ * pipelines over HTTP, executes them on a bounded pool of worker threads and keeps the messages that
+ * each pipeline generates so that clients can poll or stream them. The plugins are loaded once when
+ * the daemon starts and every job of the process shares them.
+ *
+ * The service understands the following requests:
+ * @li GET /status                       Daemon status, worker pool and data cache statistics
+ * @li GET /jobs                         Status of every job that the daemon still remembers
+ * @li POST /jobs?name=<name>            Queues the pipeline JSON in the body. Returns the "Id" of the job.
+ * @li GET /jobs/<id>                    Status of a single job
+ * @li GET /jobs/<id>/messages?since=<n> Messages of the job starting at index n. With follow=1 the
+ *                                       response is streamed as one JSON object per line until the job finished.
+ * @li DELETE /jobs/<id>                 Cancels a queued or running job
+ * @li POST /shutdown                    Cancels all jobs and stops the daemon
+ *
+ * All responses are JSON documents.
+ *
+ * Every request must carry the session token of the daemon in an "Authorization: Bearer <token>" header
+ * and a Host header that names the address the daemon listens on. Requests with an Origin header are
+ * rejected, because only browsers send it, and POST requests must have the Content-Type application/json.
+ * Together these checks keep web pages from submitting pipelines to the daemon through the browser.
+ */
+class PipelineDaemonService : public HttpRequestHandler
+{
+public:
+  /**
+   * @brief Constructor
+   * @param maxWorkers Maximum number of pipelines that execute at the same time. Values less than 1 use the ideal thread count.
+   * @param token Session token that every request must present
+   * @param allowedHosts Values of the Host header that are accepted, such as "127.0.0.1:8095"
+   * @param parent
+   */
+  PipelineDaemonService(int maxWorkers, const QByteArray& token, const QStringList& allowedHosts, QObject* parent = nullptr);
+  ~PipelineDaemonService() override;
+
+  /**
+   * @brief Number of finished jobs whose status and messages are kept in memory
+   */
+  static const int k_MaxFinishedJobs = 100;
+
+  /**
+   * @brief Dispatches a request to one of the handlers below. Called from the connection handler threads.
+   * @param request
+   * @param response
+   */
+  void service(HttpRequest& request, HttpResponse& response) override;
+
+  /**
+   * @brief Creates a random session token
+   * @return 64 hexadecimal characters
+   */
+  static QByteArray GenerateToken();
+
+  /**
+   * @brief Queues a pipeline for execution
+   * @param name Name used in the status of the job
+   * @param pipelineJson The pipeline in the same JSON format as a pipeline file
+   * @param errorMessage Set to a description of the problem if the pipeline could not be read
+   * @return The id of the new job or a negative value on error
+   */
+  int submitJob(const QString& name, const QByteArray& pipelineJson, QString& errorMessage);
+
+  /**
+   * @brief Cancels a queued or running job
+   * @param id
+   * @return False if there is no job with the given id
+   */
+  bool cancelJob(int id);
+
+  /**
+   * @brief Cancels every job and waits until the running jobs have stopped
+   */
+  void shutdown();
+
+protected:
+  /**
+   * @brief The JobRecord struct holds the pipeline, state and messages of a single job
+   */
+  struct JobRecord
+  {
+    int id = 0;
+    QString name;
+    QString state;
+    int errorCondition = 0;
+    qint64 submitted = 0;
+    qint64 elapsedMilliseconds = 0;
+    bool canceled = false;
+    FilterPipeline::Pointer pipeline;
+    QVector<QJsonObject> messages;
+  };
+
+  /**
+   * @brief Executes a job. Called from the worker threads.
+   * @param id
+   */
+  void executeJob(int id);
+
+  /**
+   * @brief Appends a message generated by the pipeline of a job and wakes up streaming clients
+   * @param id
+   * @param pm
+   */
+  void appendMessage(int id, const PipelineMessage& pm);
+
+  /**
+   * @brief Removes the oldest finished jobs if more than k_MaxFinishedJobs are kept. The mutex must be locked.
+   */
+  void trimFinishedJobs();
+
+  /**
+   * @brief Converts a PipelineMessage into its JSON representation
+   * @param pm
+   * @return
+   */
+  static QJsonObject ToJson(const PipelineMessage& pm);
+
+  /**
+   * @brief Converts the status of a job into its JSON representation. The mutex must be locked.
+   * @param job
+   * @return
+   */
+  static QJsonObject ToJson(const JobRecord& job);
+
+  /**
+   * @brief Checks the token, Host, Origin and Content-Type headers of a request
+   * @param request
+   * @param response Receives the error if the request is rejected
+   * @return False if the request is rejected
+   */
+  bool authorize(HttpRequest& request, HttpResponse& response);
+
+  void handleStatus(HttpResponse& response);
+  void handleListJobs(HttpResponse& response);
+  void handleSubmitJob(HttpRequest& request, HttpResponse& response);
+  void handleJobStatus(int id, HttpResponse& response);
+  void handleJobMessages(int id, HttpRequest& request, HttpResponse& response);
+  void handleCancelJob(int id, HttpResponse& response);
+  void handleShutdown(HttpResponse& response);
+
+  static void WriteJson(HttpResponse& response, const QJsonObject& json, int statusCode = 200, const QByteArray& description = "OK");
+  static void WriteError(HttpResponse& response, int statusCode, const QByteArray& description, const QString& message);
+
+private:
+  QByteArray m_Token;
+  QStringList m_AllowedHosts;
+  QThreadPool m_WorkerPool;
+  QMap<int, JobRecord> m_Jobs;
+  int m_NextJobId = 1;
+  bool m_ShuttingDown = false;
+
+  QMutex m_Mutex;
+  QWaitCondition m_JobChanged;
+
+  PipelineDaemonService(const PipelineDaemonService&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PipelineDaemonService&) = delete;        // Move assignment Not Implemented
+};
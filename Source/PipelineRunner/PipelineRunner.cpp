@@ -58,11 +58,14 @@
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineBatchRunner.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Filtering/SlabStreamingRunner.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -92,17 +95,85 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption manifestFileArg(QStringList() << "m"
+                                                   << "manifest",
+                                     "Batch manifest as a JSON file. The pipeline is run once for each job in the manifest.", "file");
+  parser.addOption(manifestFileArg);
+
+  QCommandLineOption jobsArg(QStringList() << "j"
+                                           << "jobs",
+                             "Maximum number of batch jobs to run at the same time. Defaults to the number of cores.", "count");
+  parser.addOption(jobsArg);
+
+  QCommandLineOption memoryBudgetArg(QStringList() << "memory-budget", "Total memory in MB that concurrent batch jobs may use.", "MB");
+  parser.addOption(memoryBudgetArg);
+
+  QCommandLineOption jobMemoryArg(QStringList() << "job-memory", "Estimated peak memory in MB of a single batch job.", "MB");
+  parser.addOption(jobMemoryArg);
+
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads the parallel algorithms may use. Overrides SIMPL_NUM_THREADS.", "count");
+  parser.addOption(threadsArg);
+
+  QCommandLineOption cpuAffinityArg(QStringList() << "cpu-affinity", "Cores the parallel algorithms may run on, e.g. '0-15,64-79'. Overrides SIMPL_CPU_AFFINITY.", "cores");
+  parser.addOption(cpuAffinityArg);
+
+  QCommandLineOption affinityPolicyArg(QStringList() << "affinity-policy", "How threads are pinned to the affinity cores: none, slice or core. Overrides SIMPL_AFFINITY_POLICY.", "policy");
+  parser.addOption(affinityPolicyArg);
+
+  QCommandLineOption grainSizeArg(QStringList() << "grain-size", "Minimum number of items per parallel task. Overrides SIMPL_GRAIN_SIZE.", "count");
+  parser.addOption(grainSizeArg);
+
+  QCommandLineOption fuseArg(QStringList() << "fuse", "Run consecutive element-wise filters together in a single pass over the data.");
+  parser.addOption(fuseArg);
+
+  QCommandLineOption eagerPluginsArg(QStringList() << "load-all-plugins", "Load every plugin at startup instead of only the plugins the pipeline uses.");
+  parser.addOption(eagerPluginsArg);
+
+  QCommandLineOption streamInputArg(QStringList() << "stream-input", "Run the pipeline one Z slab at a time over the cell data in this .dream3d file.", "file");
+  parser.addOption(streamInputArg);
+
+  QCommandLineOption streamOutputArg(QStringList() << "stream-output", "The .dream3d file the streamed cell data is written to.", "file");
+  parser.addOption(streamOutputArg);
+
+  QCommandLineOption streamMatrixArg(QStringList() << "stream-matrix", "Path of the streamed cell AttributeMatrix. Defaults to 'ImageDataContainer/CellData'.", "path");
+  parser.addOption(streamMatrixArg);
+
+  QCommandLineOption slabThicknessArg(QStringList() << "slab-thickness", "Number of Z slices computed per slab when streaming. Defaults to 64.", "count");
+  parser.addOption(slabThicknessArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
 
+  // Configure the process wide parallel execution context before any filter runs
+  ParallelExecutionContext* parallelContext = ParallelExecutionContext::Instance();
+  if(parser.isSet(threadsArg))
+  {
+    parallelContext->setMaxThreads(parser.value(threadsArg).toInt());
+  }
+  if(parser.isSet(cpuAffinityArg))
+  {
+    parallelContext->setCpuAffinity(ParallelExecutionContext::ParseCoreList(parser.value(cpuAffinityArg).toStdString()));
+  }
+  if(parser.isSet(affinityPolicyArg))
+  {
+    parallelContext->setAffinityPolicy(ParallelExecutionContext::ParseAffinityPolicy(parser.value(affinityPolicyArg).toStdString()));
+  }
+  if(parser.isSet(grainSizeArg))
+  {
+    parallelContext->setGrainSizeHint(parser.value(grainSizeArg).toULongLong());
+  }
+
   std::cout << "PipelineRunner Starting. " << std::endl;
   std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
 
-  // Register all the filters including trying to load those from Plugins
+  // Register all the filters. Plugins that are up to date in the plugin manifest are only
+  // loaded once the pipeline references one of their filters.
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginFilters(fm, false, !parser.isSet(eagerPluginsArg));
 
   QMetaObjectUtilities::RegisterMetaTypes();
 
@@ -143,7 +214,61 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
+  pipeline->setFuseElementwiseFilters(parser.isSet(fuseArg));
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
+
+  if(parser.isSet(manifestFileArg))
+  {
+    PipelineBatchRunner::Pointer batchRunner = PipelineBatchRunner::New();
+    batchRunner->setPipeline(pipeline);
+    batchRunner->setMaxConcurrentJobs(parser.value(jobsArg).toInt());
+    batchRunner->setMemoryBudget(parser.value(memoryBudgetArg).toLongLong());
+    batchRunner->setJobMemoryEstimate(parser.value(jobMemoryArg).toLongLong());
+
+    QString manifestFile = parser.value(manifestFileArg);
+    int jobCount = batchRunner->readManifest(manifestFile);
+    if(jobCount < 0)
+    {
+      std::cout << "An error occurred trying to read the batch manifest '" << manifestFile.toStdString() << "'. Exiting now." << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::cout << "Batch Jobs: " << jobCount << "  Concurrent Jobs: " << batchRunner->computeConcurrency() << std::endl;
+    int failedJobs = batchRunner->execute(&obs);
+
+    for(const PipelineBatchJob& job : batchRunner->getJobs())
+    {
+      std::cout << job.getName().toStdString() << "\t" << (job.getErrorCondition() < 0 ? "FAILED" : "OK") << "\t" << job.getErrorCondition() << "\t" << job.getElapsedMilliseconds() << " ms"
+                << std::endl;
+    }
+    std::cout << "Batch Complete: " << (jobCount - failedJobs) << " succeeded, " << failedJobs << " failed." << std::endl;
+    return (failedJobs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if(parser.isSet(streamInputArg))
+  {
+    SlabStreamingRunner::Pointer streamingRunner = SlabStreamingRunner::New();
+    streamingRunner->setPipeline(pipeline);
+    streamingRunner->setInputFile(parser.value(streamInputArg));
+    streamingRunner->setOutputFile(parser.value(streamOutputArg));
+    if(parser.isSet(streamMatrixArg))
+    {
+      streamingRunner->setCellAttributeMatrixPath(DataArrayPath::Deserialize(parser.value(streamMatrixArg), "/"));
+    }
+    if(parser.isSet(slabThicknessArg))
+    {
+      streamingRunner->setSlabThickness(parser.value(slabThicknessArg).toULongLong());
+    }
+
+    err = streamingRunner->execute(&obs);
+    if(err < 0)
+    {
+      std::cout << "Error Condition of Streaming Pipeline: " << err << std::endl;
+      return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+  }
+
   pipeline->addMessageReceiver(&obs);
   // Preflight the pipeline
   err = pipeline->preflightPipeline();
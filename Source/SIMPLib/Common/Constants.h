@@ -543,6 +543,18 @@ namespace SIMPL
     const QString CompiledLibraryName("CompiledLibraryName");
     const QString Version("Version");
     const QString PipelineBuilderGeomertry("PipelineBuilderGeometry");
+    const QString BatchJobs("Jobs");
+    const QString BatchJobName("Name");
+    const QString BatchJobOverrides("Overrides");
+    const QString PluginManifestVersion("SIMPLibVersion");
+    const QString PluginManifestPlugins("Plugins");
+    const QString PluginManifestFilePath("FilePath");
+    const QString PluginManifestLastModified("LastModified");
+    const QString PluginManifestFileSize("FileSize");
+    const QString PluginManifestFilters("Filters");
+    const QString PluginManifestClassName("ClassName");
+    const QString PluginManifestUuid("Uuid");
+    const QString PluginManifestHumanLabel("HumanLabel");
   }
 
 
@@ -0,0 +1,324 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Common/ProgressCounter.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QObject>
+
+#include "SIMPLib/Common/Observable.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressCounter::ProgressCounter(Observable* observable, int64_t total, const QString& title, const QString& prefix, const QString& humanLabel)
+: m_Observable(observable)
+, m_Title(title)
+, m_Prefix(prefix)
+, m_HumanLabel(humanLabel)
+, m_Value(0)
+, m_Total(0)
+, m_LastPercent(-1)
+, m_PendingPercent(-1)
+, m_EmittedPercent(-1)
+, m_Flushing(false)
+, m_Registered(false)
+{
+  setTotal(total);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressCounter::~ProgressCounter()
+{
+  if(m_Registered.load())
+  {
+    ProgressReporter::Instance()->removeCounter(this);
+  }
+  // Work that ended between two polls would otherwise never be reported
+  if(getTotal() > 0)
+  {
+    publishPercent();
+  }
+  flush();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::setValue(int64_t value)
+{
+  m_Value.store(value, std::memory_order_relaxed);
+  int64_t total = getTotal();
+  if(total > 0 && value >= total)
+  {
+    publishPercent();
+  }
+  if(m_PendingPercent.load(std::memory_order_relaxed) >= 0)
+  {
+    flush();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ProgressCounter::getValue() const
+{
+  return m_Value.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::setTotal(int64_t total)
+{
+  m_Total.store(total, std::memory_order_relaxed);
+  if(total > 0 && !m_Registered.load(std::memory_order_relaxed) && !m_Registered.exchange(true))
+  {
+    ProgressReporter::Instance()->addCounter(this);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ProgressCounter::getTotal() const
+{
+  return m_Total.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ProgressCounter::getPercent() const
+{
+  int64_t total = getTotal();
+  if(total <= 0)
+  {
+    return 0;
+  }
+  int64_t percent = (getValue() * 100) / total;
+  return static_cast<int>(std::min<int64_t>(std::max<int64_t>(percent, 0), 100));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::reset(int64_t total)
+{
+  m_Value.store(0);
+  m_LastPercent.store(-1);
+  m_PendingPercent.store(-1);
+  m_EmittedPercent.store(-1);
+  setTotal(total);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::setTitle(const QString& title)
+{
+  m_Title = title;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::setPrefix(const QString& prefix)
+{
+  m_Prefix = prefix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::setHumanLabel(const QString& humanLabel)
+{
+  m_HumanLabel = humanLabel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::flush()
+{
+  // The thread that claims m_Flushing emits; the others leave. The pending value is checked again after the
+  // claim is released, so a value that was published while another thread was emitting is not lost.
+  while(m_PendingPercent.load(std::memory_order_relaxed) >= 0 && !m_Flushing.exchange(true, std::memory_order_acquire))
+  {
+    int percent = m_PendingPercent.exchange(-1);
+    // A publisher that was overtaken may still queue its smaller value after the larger one was emitted
+    if(percent > m_EmittedPercent.load(std::memory_order_relaxed))
+    {
+      m_EmittedPercent.store(percent, std::memory_order_relaxed);
+      if(nullptr != m_Observable)
+      {
+        QString ss = m_Title + QObject::tr(" || %1% Complete").arg(percent);
+        m_Observable->notifyProgressMessage(m_Prefix, m_HumanLabel, ss, percent);
+      }
+    }
+    m_Flushing.store(false, std::memory_order_release);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::publishPercent()
+{
+  // The reporter thread may read a stale percentage while a worker publishes 100, so both the last and the
+  // pending percentage only ever grow and each percentage is published once
+  int percent = getPercent();
+  int last = m_LastPercent.load();
+  while(percent > last)
+  {
+    if(m_LastPercent.compare_exchange_weak(last, percent))
+    {
+      int pending = m_PendingPercent.load();
+      while(percent > pending && !m_PendingPercent.compare_exchange_weak(pending, percent))
+      {
+      }
+      break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressCounter::poll()
+{
+  if(getTotal() <= 0)
+  {
+    return;
+  }
+  publishPercent();
+}
+
+ProgressReporter* ProgressReporter::self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressReporter::ProgressReporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressReporter::~ProgressReporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressReporter* ProgressReporter::Instance()
+{
+  // The reporter is intentionally never destroyed so that counters owned by static
+  // objects can still unregister themselves while the process shuts down.
+  static std::once_flag flag;
+  std::call_once(flag, [] { self = new ProgressReporter(); });
+  return self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressReporter::addCounter(ProgressCounter* counter)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Counters.push_back(counter);
+  if(!m_Running)
+  {
+    m_Running = true;
+    std::thread(&ProgressReporter::run, this).detach();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressReporter::removeCounter(ProgressCounter* counter)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Counters.erase(std::remove(m_Counters.begin(), m_Counters.end(), counter), m_Counters.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressReporter::setInterval(int milliseconds)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Interval = std::max(milliseconds, 1);
+  m_Condition.notify_all();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ProgressReporter::getInterval() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Interval;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressReporter::pollCounters()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  for(ProgressCounter* counter : m_Counters)
+  {
+    counter->poll();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressReporter::run()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while(true)
+  {
+    m_Condition.wait_for(lock, std::chrono::milliseconds(m_Interval));
+    for(ProgressCounter* counter : m_Counters)
+    {
+      counter->poll();
+    }
+  }
+}
@@ -0,0 +1,219 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class Observable;
+
+/**
+ * @brief The ProgressCounter class is a low overhead way for a filter (or any other Observable)
+ * to report progress from tight loops, including loops that run on TBB worker threads.
+ *
+ * Incrementing the counter is a single relaxed atomic add. No strings are formatted and no
+ * signals are emitted on the hot path. The ProgressReporter thread polls every registered
+ * counter at a fixed rate and, if the percentage changed, flags the counter. The next call
+ * to increment() (or flush()) then emits one coalesced progress PipelineMessage through the
+ * Observable, so at most one message per polling interval is generated per counter. Reaching
+ * the total and destroying the counter emit the last percentage without waiting for a poll.
+ *
+ * Parallel loops should accumulate their work locally and call increment() once per chunk
+ * instead of once per item to avoid contention on the shared counter.
+ */
+class SIMPLib_EXPORT ProgressCounter
+{
+public:
+  /**
+   * @brief ProgressCounter
+   * @param observable The object whose notifyProgressMessage() is used to emit the messages. May be nullptr.
+   * @param total The value that corresponds to 100%
+   * @param title Text that is placed in front of the percentage, e.g. "Importing ASCII Data"
+   * @param prefix Message prefix, usually AbstractFilter::getMessagePrefix()
+   * @param humanLabel Human label, usually AbstractFilter::getHumanLabel()
+   */
+  ProgressCounter(Observable* observable, int64_t total = 0, const QString& title = QString(), const QString& prefix = QString(), const QString& humanLabel = QString());
+
+  virtual ~ProgressCounter();
+
+  /**
+   * @brief Adds the amount to the counter. Safe to call from any thread.
+   * @param amount
+   */
+  inline void increment(int64_t amount = 1)
+  {
+    int64_t value = m_Value.fetch_add(amount, std::memory_order_relaxed) + amount;
+    int64_t total = m_Total.load(std::memory_order_relaxed);
+    if(total > 0 && value >= total && value - amount < total)
+    {
+      // The loop may finish before the next poll, so the final percentage is published right away
+      publishPercent();
+    }
+    if(m_PendingPercent.load(std::memory_order_relaxed) >= 0)
+    {
+      flush();
+    }
+  }
+
+  /**
+   * @brief Sets the counter to an absolute value. Safe to call from any thread.
+   * @param value
+   */
+  void setValue(int64_t value);
+  int64_t getValue() const;
+
+  /**
+   * @brief Sets the value that corresponds to 100% and registers the counter with the
+   * ProgressReporter if that has not happened yet.
+   * @param total
+   */
+  void setTotal(int64_t total);
+  int64_t getTotal() const;
+
+  /**
+   * @brief Returns the current progress in percent
+   * @return
+   */
+  int getPercent() const;
+
+  /**
+   * @brief Resets the counter to zero with a new total
+   * @param total
+   */
+  void reset(int64_t total);
+
+  /**
+   * @brief Sets the text of the emitted messages. These should be set before the counter is used.
+   */
+  void setTitle(const QString& title);
+  void setPrefix(const QString& prefix);
+  void setHumanLabel(const QString& humanLabel);
+
+  /**
+   * @brief Emits the pending coalesced progress message, if there is one. Only one thread emits at a time; a
+   * call that finds another thread emitting returns and leaves the pending value to that thread.
+   */
+  void flush();
+
+  /**
+   * @brief Called by the ProgressReporter thread to check whether a new message should be emitted
+   */
+  void poll();
+
+private:
+  /**
+   * @brief Marks the current percentage as pending if it is larger than the last published one
+   */
+  void publishPercent();
+
+  Observable* m_Observable = nullptr;
+  QString m_Title;
+  QString m_Prefix;
+  QString m_HumanLabel;
+
+  std::atomic<int64_t> m_Value;
+  std::atomic<int64_t> m_Total;
+  std::atomic<int> m_LastPercent;
+  std::atomic<int> m_PendingPercent;
+  std::atomic<int> m_EmittedPercent;
+  std::atomic<bool> m_Flushing;
+  std::atomic<bool> m_Registered;
+
+  ProgressCounter(const ProgressCounter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ProgressCounter&) = delete;  // Move assignment Not Implemented
+};
+
+/**
+ * @brief The ProgressReporter class owns the thread that polls all active ProgressCounter
+ * objects at a fixed rate.
+ */
+class SIMPLib_EXPORT ProgressReporter
+{
+public:
+  virtual ~ProgressReporter();
+
+  /**
+   * @brief Returns the process wide reporter
+   * @return
+   */
+  static ProgressReporter* Instance();
+
+  /**
+   * @brief Registers a counter and starts the polling thread if needed
+   * @param counter
+   */
+  void addCounter(ProgressCounter* counter);
+
+  /**
+   * @brief Unregisters a counter. After this returns the reporter thread no longer touches the counter.
+   * @param counter
+   */
+  void removeCounter(ProgressCounter* counter);
+
+  /**
+   * @brief Sets the polling interval in milliseconds (default 200 ms)
+   * @param milliseconds
+   */
+  void setInterval(int milliseconds);
+  int getInterval() const;
+
+  /**
+   * @brief Polls every registered counter once on the calling thread
+   */
+  void pollCounters();
+
+protected:
+  ProgressReporter();
+
+  void run();
+
+private:
+  static ProgressReporter* self;
+
+  mutable std::mutex m_Mutex;
+  std::condition_variable m_Condition;
+  std::vector<ProgressCounter*> m_Counters;
+  bool m_Running = false;
+  int m_Interval = 200;
+
+  ProgressReporter(const ProgressReporter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ProgressReporter&) = delete;   // Move assignment Not Implemented
+};
@@ -441,6 +441,13 @@ public:     \
 * Note that in order to get the (const QString &) correct we used the '.' charater
 * to declare the type. This is required as the macro is split using spaces. When
 * then end code is generated the '.' characters will be replaced with spaces.
+*
+* Methods that run for a long time and do not call back into Python can end with
+* the RELEASE_GIL keyword. The Python global interpreter lock is then released
+* while the method executes so that other Python threads can run.
+* @code
+* PYB11_METHOD(void execute RELEASE_GIL)
+* @endcode
 */ 
 #define PYB11_METHOD(...)
 
@@ -0,0 +1,251 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/ProgressCounter.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ProgressCounterTest
+{
+public:
+  ProgressCounterTest() = default;
+  virtual ~ProgressCounterTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCounting()
+  {
+    ProgressCounter counter(nullptr, 1000);
+    DREAM3D_REQUIRE_EQUAL(counter.getTotal(), 1000)
+    DREAM3D_REQUIRE_EQUAL(counter.getPercent(), 0)
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; t++)
+    {
+      threads.emplace_back([&counter] {
+        for(int i = 0; i < 125; i++)
+        {
+          counter.increment();
+        }
+      });
+    }
+    for(auto& thread : threads)
+    {
+      thread.join();
+    }
+    DREAM3D_REQUIRE_EQUAL(counter.getValue(), 500)
+    DREAM3D_REQUIRE_EQUAL(counter.getPercent(), 50)
+
+    counter.setValue(5000);
+    DREAM3D_REQUIRE_EQUAL(counter.getPercent(), 100)
+
+    counter.reset(10);
+    DREAM3D_REQUIRE_EQUAL(counter.getValue(), 0)
+    DREAM3D_REQUIRE_EQUAL(counter.getTotal(), 10)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCoalescedMessages()
+  {
+    Observable observable;
+    std::vector<int> progressValues;
+    QString lastText;
+    QObject::connect(&observable, &Observable::filterGeneratedMessage, [&](const PipelineMessage& pm) {
+      DREAM3D_REQUIRE(pm.getType() == PipelineMessage::MessageType::StatusMessageAndProgressValue)
+      progressValues.push_back(pm.getProgressValue());
+      lastText = pm.getText();
+    });
+
+    // Slow the reporter thread down so that only the explicit polls below produce messages
+    ProgressReporter::Instance()->setInterval(60000);
+
+    ProgressCounter counter(&observable, 200, "Testing", "Prefix", "Label");
+    for(int i = 0; i < 50; i++)
+    {
+      counter.increment();
+    }
+    // Nothing is emitted until the reporter has polled the counter
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 0)
+
+    ProgressReporter::Instance()->pollCounters();
+    counter.increment();
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(progressValues[0], 25)
+    DREAM3D_REQUIRE_EQUAL(lastText, QString("Testing || 25% Complete"))
+
+    // Many increments between polls collapse into a single message
+    for(int i = 0; i < 99; i++)
+    {
+      counter.increment();
+    }
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 1)
+    ProgressReporter::Instance()->pollCounters();
+    counter.flush();
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(progressValues[1], 75)
+
+    // Reaching the total emits 100% without waiting for a poll
+    for(int i = 0; i < 50; i++)
+    {
+      counter.increment();
+    }
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(progressValues[2], 100)
+
+    // No change in percentage means no new message
+    ProgressReporter::Instance()->pollCounters();
+    counter.flush();
+    DREAM3D_REQUIRE_EQUAL(progressValues.size(), 3)
+
+    ProgressReporter::Instance()->setInterval(200);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFinalMessages()
+  {
+    Observable observable;
+    std::vector<int> progressValues;
+    QObject::connect(&observable, &Observable::filterGeneratedMessage, [&](const PipelineMessage& pm) { progressValues.push_back(pm.getProgressValue()); });
+
+    ProgressReporter::Instance()->setInterval(60000);
+
+    // A counter that is destroyed between two polls reports where it stopped. The reporter thread may still poll
+    // once while it picks up the new interval, so only the last message is checked.
+    {
+      ProgressCounter counter(&observable, 100, "Testing", "Prefix", "Label");
+      counter.setValue(30);
+    }
+    DREAM3D_REQUIRE_EQUAL(progressValues.empty(), false)
+    DREAM3D_REQUIRE_EQUAL(progressValues.back(), 30)
+    progressValues.clear();
+
+    // Workers that finish together emit 100% exactly once
+    {
+      ProgressCounter counter(&observable, 4000, "Testing", "Prefix", "Label");
+      std::vector<std::thread> threads;
+      for(int t = 0; t < 4; t++)
+      {
+        threads.emplace_back([&counter] {
+          for(int i = 0; i < 1000; i++)
+          {
+            counter.increment();
+          }
+        });
+      }
+      for(auto& thread : threads)
+      {
+        thread.join();
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(std::count(progressValues.begin(), progressValues.end(), 100), 1)
+    DREAM3D_REQUIRE_EQUAL(progressValues.back(), 100)
+
+    ProgressReporter::Instance()->setInterval(200);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPollWhileFinishing()
+  {
+    Observable observable;
+    std::vector<int> progressValues;
+    QObject::connect(&observable, &Observable::filterGeneratedMessage, [&](const PipelineMessage& pm) { progressValues.push_back(pm.getProgressValue()); });
+
+    ProgressReporter::Instance()->setInterval(60000);
+
+    // Polls that read a stale percentage while the worker publishes 100% must not emit it after 100%
+    for(int round = 0; round < 20; round++)
+    {
+      progressValues.clear();
+      {
+        ProgressCounter counter(&observable, 20000, "Testing", "Prefix", "Label");
+        std::atomic<bool> done(false);
+        std::thread worker([&counter, &done] {
+          for(int i = 0; i < 20000; i++)
+          {
+            counter.increment();
+          }
+          done = true;
+        });
+        while(!done)
+        {
+          counter.poll();
+          counter.flush();
+        }
+        worker.join();
+        counter.poll();
+        counter.flush();
+      }
+      DREAM3D_REQUIRE_EQUAL(progressValues.empty(), false)
+      DREAM3D_REQUIRE(std::is_sorted(progressValues.begin(), progressValues.end()))
+      DREAM3D_REQUIRE(std::adjacent_find(progressValues.begin(), progressValues.end()) == progressValues.end())
+      DREAM3D_REQUIRE_EQUAL(progressValues.back(), 100)
+    }
+
+    ProgressReporter::Instance()->setInterval(200);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ProgressCounterTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestCounting())
+    DREAM3D_REGISTER_TEST(TestCoalescedMessages())
+    DREAM3D_REGISTER_TEST(TestFinalMessages())
+    DREAM3D_REGISTER_TEST(TestPollWhileFinishing())
+  }
+
+private:
+  ProgressCounterTest(const ProgressCounterTest&); // Copy Constructor Not Implemented
+  void operator=(const ProgressCounterTest&);      // Move assignment Not Implemented
+};
@@ -40,6 +40,7 @@
 #include <QtCore/QVectorIterator>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ProgressCounter.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
@@ -416,9 +417,10 @@ void ArrayCalculator::execute()
 
   // Execute the RPN expression
   int totalItems = rpn.size();
+  ProgressCounter progress(this, totalItems, "Computing Operators", getMessagePrefix(), getHumanLabel());
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
   {
-    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Operator " + QString::number(rpnCount + 1) + "/" + QString::number(totalItems));
+    progress.increment();
 
     CalculatorItem::Pointer rpnItem = rpn[rpnCount];
     ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(rpnItem);
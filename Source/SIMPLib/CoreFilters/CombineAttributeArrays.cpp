@@ -42,6 +42,7 @@
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ArrayStatistics.hpp"
 
 /**
  * @brief The CombineAttributeArraysTemplatePrivate class is a templated private implementation that deals with
@@ -98,18 +99,13 @@ public:
         {
           arrayOffset += inputIDataArrays[i - 1].lock()->getNumberOfComponents();
         }
-        for(size_t j = 0; j < numTuples; j++)
+        for(int32_t k = 0; k < numDims; k++)
         {
-          for(int32_t k = 0; k < numDims; k++)
+          ArrayStatistics::MinMax<DataType> range = ArrayStatistics::FindMinMax(inputArrays[i], numTuples, numDims, nullptr, k);
+          if(range.count > 0)
           {
-            if(inputArrays[i][numDims * j + k] > maxVals[arrayOffset + k])
-            {
-              maxVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-            if(inputArrays[i][numDims * j + k] < minVals[arrayOffset + k])
-            {
-              minVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
+            maxVals[arrayOffset + k] = range.max;
+            minVals[arrayOffset + k] = range.min;
           }
         }
       }
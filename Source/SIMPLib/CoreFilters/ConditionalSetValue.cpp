@@ -123,8 +123,7 @@ template <typename T> void checkValuesFloatDouble(AbstractFilter* filter, double
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-
-template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue)
+template <typename T> void createConditionalSetValueKernel(IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue, ElementwiseKernel::Pointer& kernel)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
@@ -134,13 +133,15 @@ template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Poin
   bool* condData = condDataPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
 
-  for(size_t iter = 0; iter < numTuples; iter++)
-  {
-    if(condData[iter] == true)
+  kernel = ElementwiseKernel::New(numTuples, [inData, condData, replaceVal](size_t start, size_t end) {
+    for(size_t iter = start; iter < end; iter++)
     {
-      inData[iter] = replaceVal;
+      if(condData[iter] == true)
+      {
+        inData[iter] = replaceVal;
+      }
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -266,17 +267,33 @@ void ConditionalSetValue::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ConditionalSetValue::execute()
+ElementwiseKernel::Pointer ConditionalSetValue::createElementwiseKernel()
 {
   setErrorCondition(0);
   setWarningCondition(0);
   dataCheck();
   if(getErrorCondition() < 0)
+  {
+    return ElementwiseKernel::NullPointer();
+  }
+
+  ElementwiseKernel::Pointer kernel;
+  EXECUTE_FUNCTION_TEMPLATE(this, createConditionalSetValueKernel, m_ArrayPtr.lock(), m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue, kernel)
+  return kernel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConditionalSetValue::execute()
+{
+  ElementwiseKernel::Pointer kernel = createElementwiseKernel();
+  if(nullptr == kernel)
   {
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  kernel->execute(0, kernel->getNumberOfTuples());
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
@@ -38,12 +38,13 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementwiseKernel.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
  * @brief The ConditionalSetValue class. See [Filter documentation](@ref conditionalsetvalue) for details.
  */
-class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
+class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter, public IElementwiseFilter
 {
     Q_OBJECT
     PYB11_CREATE_BINDINGS(ConditionalSetValue SUPERCLASS AbstractFilter)
@@ -128,6 +129,11 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
      */
     void execute() override;
 
+    /**
+     * @brief createElementwiseKernel Reimplemented from @see IElementwiseFilter class
+     */
+    ElementwiseKernel::Pointer createElementwiseKernel() override;
+
     /**
     * @brief preflight Reimplemented from @see AbstractFilter class
     */
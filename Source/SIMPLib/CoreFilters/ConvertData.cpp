@@ -45,19 +45,38 @@
 #include "SIMPLib/SIMPLibVersion.h"
 
 #define CHECK_AND_CONVERT(Type, DataContainer, ScalarType, Array, AttributeMatrixName, OutputName)                                                                                                     \
-  if(false == completed)                                                                                                                                                                               \
+  if(nullptr == kernel)                                                                                                                                                                                \
   {                                                                                                                                                                                                    \
     Type::Pointer Type##Ptr = std::dynamic_pointer_cast<Type>(Array);                                                                                                                                  \
     if(nullptr != Type##Ptr)                                                                                                                                                                           \
     {                                                                                                                                                                                                  \
       QVector<size_t> dims = Array->getComponentDimensions();                                                                                                                                          \
-      Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                              \
-      completed = true;                                                                                                                                                                                \
+      kernel = Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                     \
     }                                                                                                                                                                                                  \
   }
 
 namespace Detail
 {
+/**
+ * @brief CreateConvertKernel Creates the kernel that casts every component of the input array into the output array
+ * @param input Input array
+ * @param output Output array with the same number of tuples and components
+ * @return
+ */
+template <typename InputType, typename OutputType> ElementwiseKernel::Pointer CreateConvertKernel(DataArray<InputType>* input, DataArray<OutputType>* output)
+{
+  InputType* inData = input->getPointer(0);
+  OutputType* outData = output->getPointer(0);
+  size_t numComps = static_cast<size_t>(input->getNumberOfComponents());
+
+  return ElementwiseKernel::New(input->getNumberOfTuples(), [inData, outData, numComps](size_t start, size_t end) {
+    for(size_t v = start * numComps; v < end * numComps; ++v)
+    {
+      outData[v] = static_cast<OutputType>(inData[v]);
+    }
+  });
+}
+
 template <typename T>
 /**
  * @brief ConvertData Templated function that converts an IDataArray to a given primitive type
@@ -67,110 +86,77 @@ template <typename T>
  * @param scalarType Primitive type to convert to
  * @param attributeMatrixName Name of target AttributeMatrix
  * @param name Name of converted array
+ * @return The kernel that fills the converted array
  */
-void ConvertData(AbstractFilter* filter, T* ptr, QVector<size_t> dims, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName, const QString& name)
+ElementwiseKernel::Pointer ConvertData(AbstractFilter* filter, T* ptr, QVector<size_t> dims, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName, const QString& name)
 {
   size_t voxels = ptr->getNumberOfTuples();
-  size_t size = ptr->getSize();
 
   if(scalarType == SIMPL::NumericTypes::Type::Int8)
   {
     Int8ArrayType::Pointer p = Int8ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int8_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt8)
   {
     UInt8ArrayType::Pointer p = UInt8ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint8_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int16)
   {
     Int16ArrayType::Pointer p = Int16ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int16_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt16)
   {
     UInt16ArrayType::Pointer p = UInt16ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint16_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int32)
   {
     Int32ArrayType::Pointer p = Int32ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int32_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt32)
   {
     UInt32ArrayType::Pointer p = UInt32ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint32_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int64)
   {
     Int64ArrayType::Pointer p = Int64ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int64_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt64)
   {
     UInt64ArrayType::Pointer p = UInt64ArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint64_t>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Float)
   {
     FloatArrayType::Pointer p = FloatArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<float>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Double)
   {
     DoubleArrayType::Pointer p = DoubleArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<double>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Bool)
   {
     BoolArrayType::Pointer p = BoolArrayType::CreateArray(voxels, dims, name);
     m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<bool>(ptr->getValue(v)));
-    }
+    return CreateConvertKernel(ptr, p.get());
   }
   else
   {
@@ -179,6 +165,7 @@ void ConvertData(AbstractFilter* filter, T* ptr, QVector<size_t> dims, DataConta
         QString("Error Converting DataArray '%1/%2' from type %3 to type %4").arg(attributeMatrixName).arg(ptr->getName()).arg(static_cast<int>(ptr->getType())).arg(static_cast<int>(scalarType));
     filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
   }
+  return ElementwiseKernel::NullPointer();
 }
 } // End Namespace Detail
 
@@ -334,14 +321,14 @@ void ConvertData::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ConvertData::execute()
+ElementwiseKernel::Pointer ConvertData::createElementwiseKernel()
 {
   setErrorCondition(0);
   setWarningCondition(0);
   dataCheck();
   if(getErrorCondition() < 0)
   {
-    return;
+    return ElementwiseKernel::NullPointer();
   }
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_SelectedCellArrayPath.getDataContainerName());
@@ -352,10 +339,10 @@ void ConvertData::execute()
   if (nullptr == iArray.get())
   {
     setErrorCondition(-90002);
-    return;
+    return ElementwiseKernel::NullPointer();
   }
 
-  bool completed = false;
+  ElementwiseKernel::Pointer kernel;
   CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
 
   CHECK_AND_CONVERT(UInt8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
@@ -369,6 +356,22 @@ void ConvertData::execute()
   CHECK_AND_CONVERT(DoubleArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
   CHECK_AND_CONVERT(BoolArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
 
+  return kernel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConvertData::execute()
+{
+  ElementwiseKernel::Pointer kernel = createElementwiseKernel();
+  if(nullptr == kernel)
+  {
+    return;
+  }
+
+  kernel->execute(0, kernel->getNumberOfTuples());
+
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
@@ -38,12 +38,13 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementwiseKernel.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
  * @brief The ConvertData class. See [Filter documentation](@ref convertdata) for details.
  */
-class SIMPLib_EXPORT ConvertData : public AbstractFilter
+class SIMPLib_EXPORT ConvertData : public AbstractFilter, public IElementwiseFilter
 {
     Q_OBJECT
     PYB11_CREATE_BINDINGS(ConvertData SUPERCLASS AbstractFilter)
@@ -127,6 +128,11 @@ class SIMPLib_EXPORT ConvertData : public AbstractFilter
      */
     void execute() override;
 
+    /**
+     * @brief createElementwiseKernel Reimplemented from @see IElementwiseFilter class
+     */
+    ElementwiseKernel::Pointer createElementwiseKernel() override;
+
     /**
     * @brief preflight Reimplemented from @see AbstractFilter class
     */
@@ -37,20 +37,63 @@
 
 #include <QtCore/QDateTime>
 
+#include <cmath>
 #include <limits>
-#include <random>
-#include <chrono>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#endif
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/ScalarTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Math/PhiloxRandom.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+/**
+ * @brief fillRandom Sets every element of the array to generator(u) where u is a uniform value in [0, 1)
+ * from the counter based generator. Elements 2b and 2b + 1 use the two halves of block b of the generator,
+ * so the array is the same for a given seed no matter how many threads fill it.
+ */
+template <typename T, typename GeneratorType> void fillRandom(T* rawPointer, size_t count, uint64_t seed, const GeneratorType& generator)
+{
+  auto fillBlocks = [rawPointer, count, seed, &generator](size_t begin, size_t end) {
+    uint32_t output[4];
+    for(size_t block = begin; block < end; block++)
+    {
+      PhiloxRandom::Block(seed, 0, block, output);
+      size_t i = 2 * block;
+      rawPointer[i] = generator(PhiloxRandom::ToDouble((static_cast<uint64_t>(output[1]) << 32) | output[0]));
+      if(i + 1 < count)
+      {
+        rawPointer[i + 1] = generator(PhiloxRandom::ToDouble((static_cast<uint64_t>(output[3]) << 32) | output[2]));
+      }
+    }
+  };
+
+  size_t numBlocks = (count + 1) / 2;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel())
+  {
+    context->parallelFor(tbb::blocked_range<size_t>(0, numBlocks, context->computeGrainSize(numBlocks, 4096)),
+                         [&fillBlocks](const tbb::blocked_range<size_t>& r) { fillBlocks(r.begin(), r.end()); });
+    return;
+  }
+#endif
+  fillBlocks(0, numBlocks);
+}
+} // namespace
 
 /**
 * @brief initializeArrayWithInts Initializes the array p with integers, either from the
@@ -59,7 +102,8 @@
 * unexpected results when passing anything other than an integer as a template parameter.
 * @param p The array that will be initialized
 */
-template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType)
+template <typename T>
+void initializeArrayWithInts(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType, uint64_t seed)
 {
 
   typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(outputArrayPtr);
@@ -137,16 +181,12 @@ template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArr
   {
     T rangeMin = static_cast<T>(initializationRange.first);
     T rangeMax = static_cast<T>(initializationRange.second);
+    double span = static_cast<double>(rangeMax) - static_cast<double>(rangeMin) + 1.0;
 
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_int_distribution<> distribution(rangeMin , rangeMax);
-
-    for(size_t i = 0; i < count; i++)
-    {
-      T value = static_cast<T>(distribution(generator));
-      rawPointer[i] = value;
-    }
+    fillRandom(rawPointer, count, seed, [rangeMin, rangeMax, span](double u) {
+      double value = static_cast<double>(rangeMin) + std::floor(u * span);
+      return value >= static_cast<double>(rangeMax) ? rangeMax : static_cast<T>(value);
+    });
   }
 }
 
@@ -157,7 +197,9 @@ template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArr
 * unexpected results when passing anything other than an integer as a template parameter.
 * @param p The array that will be initialized
 */
-template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType)
+template <>
+void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType,
+                                   uint64_t seed)
 {
   DataArray<bool>::Pointer array = std::dynamic_pointer_cast<DataArray<bool>>(outputArrayPtr);
   size_t count = array->getSize();
@@ -182,22 +224,7 @@ template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPt
   }
   else
   {
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_int_distribution<int32_t> distribution(0, 1);
-
-    for(size_t i = 0; i < count; i++)
-    {
-      int8_t result = static_cast<int8_t>(distribution(generator));
-      if(result == 0)
-      {
-        rawPointer[i] = false;
-      }
-      else
-      {
-        rawPointer[i] = true;
-      }
-    }
+    fillRandom(rawPointer, count, seed, [](double u) { return u >= 0.5; });
   }
 }
 
@@ -209,7 +236,7 @@ template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPt
 * parameter.
 * @param p The array that will be initialized
 */
-template <typename T> void initializeArrayWithReals(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue)
+template <typename T> void initializeArrayWithReals(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, uint64_t seed)
 {
   typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(outputArrayPtr);
   size_t count = array->getSize();
@@ -225,19 +252,10 @@ template <typename T> void initializeArrayWithReals(IDataArray::Pointer outputAr
   }
   else
   {
-    T rangeMin = static_cast<T>(initializationRange.first);
-    T rangeMax = static_cast<T>(initializationRange.second);
+    double rangeMin = initializationRange.first;
+    double rangeMax = initializationRange.second;
 
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_real_distribution<> distribution(rangeMin, rangeMax);
-
-    size_t count = array->getSize();
-    for(size_t i = 0; i < count; i++)
-    {
-      T value = distribution(generator);
-      rawPointer[i] = value;
-    }
+    fillRandom(rawPointer, count, seed, [rangeMin, rangeMax](double u) { return static_cast<T>(rangeMin + u * (rangeMax - rangeMin)); });
   }
 }
 
@@ -250,6 +268,8 @@ CreateDataArray::CreateDataArray()
 , m_NewArray("", "", "")
 , m_InitializationType(Manual)
 , m_InitializationValue("0")
+, m_UseSeed(false)
+, m_SeedValue(0)
 {
 }
 
@@ -283,7 +303,9 @@ void CreateDataArray::setupFilterParameters()
     parameter->setChoices(choices);
     QStringList linkedProps;
     linkedProps << "InitializationValue"
-                << "InitializationRange";
+                << "InitializationRange"
+                << "UseSeed"
+                << "SeedValue";
     parameter->setLinkedProperties(linkedProps);
     parameter->setEditable(false);
     parameter->setCategory(FilterParameter::Parameter);
@@ -291,6 +313,8 @@ void CreateDataArray::setupFilterParameters()
   }
   parameters.push_back(SIMPL_NEW_STRING_FP("Initialization Value", InitializationValue, FilterParameter::Parameter, CreateDataArray, Manual));
   parameters.push_back(SIMPL_NEW_RANGE_FP("Initialization Range", InitializationRange, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Seed", UseSeed, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Seed Value", SeedValue, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Created Attribute Array", NewArray, FilterParameter::CreatedArray, CreateDataArray, req));
@@ -311,6 +335,8 @@ void CreateDataArray::readFilterParameters(AbstractFilterParametersReader* reade
   setInitializationValue(reader->readString("InitializationValue", getInitializationValue()));
   setInitializationType(reader->readValue("InitializationType", getInitializationType()));
   setInitializationRange(reader->readPairOfDoubles("InitializationRange", getInitializationRange()));
+  setUseSeed(reader->readValue("UseSeed", getUseSeed()));
+  setSeedValue(reader->readValue("SeedValue", getSeedValue()));
   reader->closeFilterGroup();
 }
 
@@ -442,49 +468,51 @@ void CreateDataArray::execute()
     return;
   }
 
+  uint64_t seed = m_UseSeed ? static_cast<uint64_t>(static_cast<uint32_t>(m_SeedValue)) : PhiloxRandom::GenerateSeed();
+
   if(m_ScalarType == SIMPL::ScalarTypes::Type::Int8)
   {
-    initializeArrayWithInts<int8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int16)
   {
-    initializeArrayWithInts<int16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int32)
   {
-    initializeArrayWithInts<int32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int64)
   {
-    initializeArrayWithInts<int64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt8)
   {
-    initializeArrayWithInts<uint8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt16)
   {
-    initializeArrayWithInts<uint16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt32)
   {
-    initializeArrayWithInts<uint32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt64)
   {
-    initializeArrayWithInts<uint64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Float)
   {
-    initializeArrayWithReals<float>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue);
+    initializeArrayWithReals<float>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Double)
   {
-    initializeArrayWithReals<double>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue);
+    initializeArrayWithReals<double>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Bool)
   {
-    initializeArrayWithInts<bool>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<bool>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
 
   /* Let the GUI know we are done with this filter */
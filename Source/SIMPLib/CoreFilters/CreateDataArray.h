@@ -86,6 +86,12 @@ class SIMPLib_EXPORT CreateDataArray : public AbstractFilter
     SIMPL_FILTER_PARAMETER(FPRangePair, InitializationRange)
     Q_PROPERTY(FPRangePair InitializationRange READ getInitializationRange WRITE setInitializationRange)
 
+    SIMPL_FILTER_PARAMETER(bool, UseSeed)
+    Q_PROPERTY(bool UseSeed READ getUseSeed WRITE setUseSeed)
+
+    SIMPL_FILTER_PARAMETER(int, SeedValue)
+    Q_PROPERTY(int SeedValue READ getSeedValue WRITE setSeedValue)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -41,11 +41,14 @@
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 #include "SIMPLib/Geometry/QuadGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
@@ -92,6 +95,9 @@ CreateGeometry::CreateGeometry()
 , m_HexCellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
 , m_TreatWarningsAsErrors(false)
 , m_ArrayHandling(false)
+, m_CompactConnectivity(false)
+, m_WeldVertices(false)
+, m_WeldTolerance(0.0f)
 , m_NumVerts(0)
 {
   m_Dimensions.x = 0;
@@ -176,6 +182,12 @@ void CreateGeometry::setupFilterParameters()
     QVector<QString> choices = {"Copy Arrays", "Move Arrays"};
     parameters.push_back(SIMPL_NEW_CHOICE_FP("Array Handling", ArrayHandling, FilterParameter::Parameter, CreateGeometry, choices, false));
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Compact Connectivity", CompactConnectivity, FilterParameter::Parameter, CreateGeometry));
+  {
+    QStringList linkedProps = {"WeldTolerance"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Weld Vertices", WeldVertices, FilterParameter::Parameter, CreateGeometry, linkedProps));
+    parameters.push_back(SIMPL_NEW_FLOAT_FP("Weld Tolerance", WeldTolerance, FilterParameter::Parameter, CreateGeometry));
+  }
 
   DataContainerSelectionFilterParameter::RequirementType req;
   parameters.push_back(SIMPL_NEW_DC_SELECTION_FP("Data Container", DataContainerName, FilterParameter::RequiredArray, CreateGeometry, req));
@@ -904,9 +916,97 @@ void CreateGeometry::execute()
   }
   }
 
+  // Welding renumbers the element lists, so it also waits until they have been validated
+  if(m_WeldVertices && m_GeometryType > 1)
+  {
+    weldVertices();
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+  }
+
+  // The element lists are only narrowed once they have been validated against the shared vertex list
+  if(m_CompactConnectivity && m_GeometryType > 2)
+  {
+    IGeometry::Pointer geom = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometry();
+    if(geom->setCompactConnectivity(true) < 0)
+    {
+      QString ss = QObject::tr("The connectivity of the %1 geometry cannot be stored with 32 bit vertex indices; the 64 bit connectivity is kept").arg(geom->getGeometryTypeAsString());
+      setWarningCondition(-702);
+      notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+    }
+  }
+
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CreateGeometry::weldVertices()
+{
+  QString vertexAttrMatName;
+  QString elementAttrMatName;
+  switch(m_GeometryType)
+  {
+  case 2: // VertexGeom
+    vertexAttrMatName = getVertexAttributeMatrixName0();
+    break;
+  case 3: // EdgeGeom
+    vertexAttrMatName = getVertexAttributeMatrixName1();
+    elementAttrMatName = getEdgeAttributeMatrixName();
+    break;
+  case 4: // TriangleGeom
+    vertexAttrMatName = getVertexAttributeMatrixName2();
+    elementAttrMatName = getFaceAttributeMatrixName0();
+    break;
+  case 5: // QuadGeom
+    vertexAttrMatName = getVertexAttributeMatrixName3();
+    elementAttrMatName = getFaceAttributeMatrixName1();
+    break;
+  case 6: // TetrahedralGeom
+    vertexAttrMatName = getVertexAttributeMatrixName4();
+    elementAttrMatName = getTetCellAttributeMatrixName();
+    break;
+  case 7: // HexahedralGeom
+    vertexAttrMatName = getVertexAttributeMatrixName5();
+    elementAttrMatName = getHexCellAttributeMatrixName();
+    break;
+  default:
+    return;
+  }
+
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getDataContainerName());
+  IGeometry::Pointer geom = dc->getGeometry();
+  QVector<size_t> removedVerts;
+  QVector<size_t> removedElems;
+  if(geom->weldVertices(m_WeldTolerance, removedVerts, removedElems) < 0)
+  {
+    QString ss = QObject::tr("The vertices of the %1 geometry could not be welded").arg(geom->getGeometryTypeAsString());
+    setErrorCondition(-703);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // The attribute matrices were sized for the unwelded geometry
+  int err = MeshWelding::RemoveTuples(dc->getAttributeMatrix(vertexAttrMatName), removedVerts);
+  if(err >= 0 && !elementAttrMatName.isEmpty())
+  {
+    err = MeshWelding::RemoveTuples(dc->getAttributeMatrix(elementAttrMatName), removedElems);
+  }
+  if(err < 0)
+  {
+    QString ss = QObject::tr("The attribute matrices of the %1 geometry could not be resized after welding its vertices").arg(geom->getGeometryTypeAsString());
+    setErrorCondition(-704);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  QString ss = QObject::tr("Welding removed %1 vertices and %2 collapsed elements").arg(removedVerts.size()).arg(m_GeometryType > 2 ? removedElems.size() : 0);
+  notifyStatusMessage(getHumanLabel(), ss);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -76,6 +76,9 @@ class SIMPLib_EXPORT CreateGeometry : public AbstractFilter
   PYB11_PROPERTY(QString TetCellAttributeMatrixName READ getTetCellAttributeMatrixName WRITE setTetCellAttributeMatrixName)
   PYB11_PROPERTY(bool TreatWarningsAsErrors READ getTreatWarningsAsErrors WRITE setTreatWarningsAsErrors)
   PYB11_PROPERTY(bool ArrayHandling READ getArrayHandling WRITE setArrayHandling)
+  PYB11_PROPERTY(bool CompactConnectivity READ getCompactConnectivity WRITE setCompactConnectivity)
+  PYB11_PROPERTY(bool WeldVertices READ getWeldVertices WRITE setWeldVertices)
+  PYB11_PROPERTY(float WeldTolerance READ getWeldTolerance WRITE setWeldTolerance)
 
 public:
   SIMPL_SHARED_POINTERS(CreateGeometry)
@@ -189,6 +192,15 @@ public:
   SIMPL_FILTER_PARAMETER(bool, ArrayHandling)
   Q_PROPERTY(bool ArrayHandling READ getArrayHandling WRITE setArrayHandling)
 
+  SIMPL_FILTER_PARAMETER(bool, CompactConnectivity)
+  Q_PROPERTY(bool CompactConnectivity READ getCompactConnectivity WRITE setCompactConnectivity)
+
+  SIMPL_FILTER_PARAMETER(bool, WeldVertices)
+  Q_PROPERTY(bool WeldVertices READ getWeldVertices WRITE setWeldVertices)
+
+  SIMPL_FILTER_PARAMETER(float, WeldTolerance)
+  Q_PROPERTY(float WeldTolerance READ getWeldTolerance WRITE setWeldTolerance)
+
   QString getBoxDimensions();
   Q_PROPERTY(QString BoxDimensions READ getBoxDimensions)
 
@@ -287,6 +299,12 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Welds the vertices of the created geometry and removes the merged vertices and collapsed elements
+   * from its attribute matrices
+   */
+  void weldVertices();
+
 private:
   DEFINE_DATAARRAY_VARIABLE(float, XBounds)
   DEFINE_DATAARRAY_VARIABLE(float, YBounds)
@@ -49,6 +49,7 @@
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/DataContainerArrayCache.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
@@ -255,21 +256,38 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   setErrorCondition(0);
   setWarningCondition(0);
 
-  SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
-  connect(simplReader.get(), &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, const int& code) {
-    setErrorCondition(code);
-    notifyErrorMessage(getHumanLabel(), msg, getErrorCondition());
-  });
-
-  if (!simplReader->openFile(getInputFile()))
+  // Long running processes may keep recently read files in memory. The preflight only reads
+  // the structure of the file so it always goes to the file.
+  DataContainerArrayCache* cache = DataContainerArrayCache::Instance();
+  DataContainerArray::Pointer dca;
+  if(!getInPreflight())
   {
-    return DataContainerArray::New();
+    dca = cache->find(getInputFile(), proxy);
   }
 
-  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
-  if(dca == DataContainerArray::NullPointer())
+  if(nullptr == dca.get())
   {
-    return DataContainerArray::New();
+    SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
+    connect(simplReader.get(), &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, const int& code) {
+      setErrorCondition(code);
+      notifyErrorMessage(getHumanLabel(), msg, getErrorCondition());
+    });
+
+    if(!simplReader->openFile(getInputFile()))
+    {
+      return DataContainerArray::New();
+    }
+
+    dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
+    if(dca == DataContainerArray::NullPointer())
+    {
+      return DataContainerArray::New();
+    }
+
+    if(!getInPreflight() && getErrorCondition() >= 0)
+    {
+      cache->insert(getInputFile(), proxy, dca);
+    }
   }
 
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
@@ -40,12 +40,13 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ISlabStreamingFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
  * @brief The FindDerivatives class. See [Filter documentation](@ref findderivatives) for details.
  */
-class SIMPLib_EXPORT FindDerivatives : public AbstractFilter
+class SIMPLib_EXPORT FindDerivatives : public AbstractFilter, public ISlabStreamingFilter
 {
   Q_OBJECT
   PYB11_CREATE_BINDINGS(FindDerivatives SUPERCLASS AbstractFilter)
@@ -133,6 +134,12 @@ class SIMPLib_EXPORT FindDerivatives : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSlabHaloSize Reimplemented from @see ISlabStreamingFilter class. The cell derivatives
+     * of an ImageGeom are central differences of the neighboring cells.
+     */
+    size_t getSlabHaloSize() const override;
+
 signals:
   /**
    * @brief updateFilterParameters This is emitted when the filter requests all the latest Filter Parameters need to be
@@ -4,17 +4,23 @@
 
 #include "GenerateColorTable.h"
 
+#include <type_traits>
+#include <vector>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
+#include "SIMPLib/Utilities/ArrayStatistics.hpp"
 #include "SIMPLib/Utilities/ColorTable.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
@@ -38,7 +44,7 @@ int findRightBinIndex(T nValue, QVector<float> binPoints)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int findRightBinIndex_Binary(float nValue, QVector<float> binPoints)
+int findRightBinIndex_Binary(float nValue, const QVector<float>& binPoints)
 {
   int min = 0, max = binPoints.size() - 1;
   while (min < max)
@@ -56,74 +62,156 @@ int findRightBinIndex_Binary(float nValue, QVector<float> binPoints)
   return min;
 }
 
+// -----------------------------------------------------------------------------
+// Computes the RGB values of the color table at the normalized value nValue by interpolating between the
+// two control points that bracket it.
+// -----------------------------------------------------------------------------
+void computeColor(float nValue, const QVector<float>& binPoints, const std::vector<std::vector<double>>& controlPoints, int numControlColors, uint8_t* rgb)
+{
+  int rightBinIndex = findRightBinIndex_Binary(nValue, binPoints);
+
+  int leftBinIndex = rightBinIndex - 1;
+  if (leftBinIndex < 0)
+  {
+    leftBinIndex = 0;
+    rightBinIndex = 1;
+  }
+
+  // Find the fractional distance traveled between the beginning and end of the current color bin
+  float currFraction = 0.0f;
+  if (rightBinIndex < binPoints.size())
+  {
+    currFraction = (nValue - binPoints[leftBinIndex]) / (binPoints[rightBinIndex] - binPoints[leftBinIndex]);
+  }
+  else
+  {
+    currFraction = (nValue - binPoints[leftBinIndex]) / (1 - binPoints[leftBinIndex]);
+  }
+
+  // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
+  // to the last control color.
+  if(leftBinIndex > numControlColors - 1)
+  {
+    leftBinIndex = numControlColors - 1;
+  }
+
+  // Calculate the RGB values
+  rgb[0] = (controlPoints[leftBinIndex][1] * (1.0 - currFraction) + controlPoints[rightBinIndex][1] * currFraction) * 255;
+  rgb[1] = (controlPoints[leftBinIndex][2] * (1.0 - currFraction) + controlPoints[rightBinIndex][2] * currFraction) * 255;
+  rgb[2] = (controlPoints[leftBinIndex][3] * (1.0 - currFraction) + controlPoints[rightBinIndex][3] * currFraction) * 255;
+}
+
 /**
  * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
- * for each element in a given array of data
+ * for each element in a given array of data.
+ *
+ * If a lookup table is given, each value is mapped to one of its RGB entries. An exact lookup table
+ * has one entry for each integer value between the minimum and maximum of the array, so the value minus
+ * the minimum is the index of its color. Otherwise the lookup table samples the normalized range [0, 1]
+ * uniformly and each value uses the entry that is closest to it. Without a lookup table the color table
+ * is evaluated for every value.
  */
 template <typename T>
 class GenerateColorTableImpl
 {
 public:
-  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, QVector<float> binPoints,
-                         std::vector<std::vector<double> > controlPoints, int numControlColors, UInt8ArrayType::Pointer colorArray) :
-    m_ArrayPtr(arrayPtr),
-    m_BinPoints(binPoints),
-    m_NumControlColors(numControlColors),
-    m_ControlPoints(controlPoints),
-    m_ColorArray(colorArray)
-  {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for (int i=1; i<arrayPtr->getNumberOfTuples(); i++)
-    {
-      if (arrayPtr->getValue(i) < m_ArrayMin) { m_ArrayMin = arrayPtr->getValue(i); }
-      if (arrayPtr->getValue(i) > m_ArrayMax) { m_ArrayMax = arrayPtr->getValue(i); }
-    }
+  using ScalarType = typename std::conditional<std::is_same<T, double>::value, double, float>::type;
+
+  static const size_t k_BlockSize = 256;
+  static const size_t k_MaxExactLookupTableSize = 65536;
+
+  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, T arrayMin, T arrayMax, const QVector<float>& binPoints, const std::vector<std::vector<double>>& controlPoints,
+                         int numControlColors, const std::vector<uint8_t>& lookupTable, bool exactLookup, UInt8ArrayType::Pointer colorArray)
+  : m_ArrayPtr(arrayPtr)
+  , m_ArrayMin(arrayMin)
+  , m_ArrayMax(arrayMax)
+  , m_BinPoints(&binPoints)
+  , m_ControlPoints(&controlPoints)
+  , m_NumControlColors(numControlColors)
+  , m_LookupTable(&lookupTable)
+  , m_ExactLookup(exactLookup)
+  , m_ColorArray(colorArray)
+  {
   }
   virtual ~GenerateColorTableImpl() = default;
 
   void convert(size_t start, size_t end) const
   {
-    for (size_t i = start; i < end; i++)
+    if(m_LookupTable->empty())
     {
-      // Normalize value
-      float nValue = (static_cast<float>(m_ArrayPtr->getValue(i) - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
+      convertExact(start, end);
+    }
+    else if(m_ExactLookup)
+    {
+      convertIndexed(start, end);
+    }
+    else
+    {
+      convertNormalized(start, end);
+    }
+  }
 
-      int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
+  void convertExact(size_t start, size_t end) const
+  {
+    const T* data = m_ArrayPtr->getPointer(0);
+    uint8_t* colors = m_ColorArray->getPointer(0);
+    float range = static_cast<float>(m_ArrayMax - m_ArrayMin);
+    for(size_t i = start; i < end; i++)
+    {
+      // Normalize value
+      float nValue = range > 0.0f ? static_cast<float>(data[i] - m_ArrayMin) / range : 0.0f;
+      computeColor(nValue, *m_BinPoints, *m_ControlPoints, m_NumControlColors, colors + 3 * i);
+    }
+  }
 
-      int leftBinIndex = rightBinIndex - 1;
-      if (leftBinIndex < 0)
-      {
-        leftBinIndex = 0;
-        rightBinIndex = 1;
-      }
+  void convertIndexed(size_t start, size_t end) const
+  {
+    const T* data = m_ArrayPtr->getPointer(0);
+    const uint8_t* lookupTable = m_LookupTable->data();
+    uint8_t* colors = m_ColorArray->getPointer(0);
+    for(size_t i = start; i < end; i++)
+    {
+      const uint8_t* rgb = lookupTable + 3 * static_cast<size_t>(data[i] - m_ArrayMin);
+      colors[3 * i] = rgb[0];
+      colors[3 * i + 1] = rgb[1];
+      colors[3 * i + 2] = rgb[2];
+    }
+  }
 
-      // Find the fractional distance traveled between the beginning and end of the current color bin
-      float currFraction = 0.0f;
-      if (rightBinIndex < m_BinPoints.size())
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
-      }
-      else
+  void convertNormalized(size_t start, size_t end) const
+  {
+    const T* data = m_ArrayPtr->getPointer(0);
+    const uint8_t* lookupTable = m_LookupTable->data();
+    uint8_t* colors = m_ColorArray->getPointer(0);
+
+    const ScalarType maxIndex = static_cast<ScalarType>(m_LookupTable->size() / 3 - 1);
+    const ScalarType offset = static_cast<ScalarType>(m_ArrayMin);
+    const ScalarType range = static_cast<ScalarType>(m_ArrayMax) - offset;
+    const ScalarType scale = range > 0 ? maxIndex / range : 0;
+
+    // The indices of a block are computed first in a branch free loop that the compiler vectorizes. NaN
+    // values fail both comparisons and use the first entry.
+    int32_t indices[k_BlockSize];
+    for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
+    {
+      size_t count = end - blockStart < k_BlockSize ? end - blockStart : k_BlockSize;
+      const T* values = data + blockStart;
+      for(size_t i = 0; i < count; i++)
       {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
+        ScalarType x = (static_cast<ScalarType>(values[i]) - offset) * scale;
+        x = x > 0 ? x : 0;
+        x = x < maxIndex ? x : maxIndex;
+        indices[i] = static_cast<int32_t>(x + static_cast<ScalarType>(0.5));
       }
 
-      // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
-      // to the last control color.
-      if(leftBinIndex > m_NumControlColors - 1)
+      uint8_t* out = colors + 3 * blockStart;
+      for(size_t i = 0; i < count; i++)
       {
-        leftBinIndex = m_NumControlColors - 1;
+        const uint8_t* rgb = lookupTable + 3 * indices[i];
+        out[3 * i] = rgb[0];
+        out[3 * i + 1] = rgb[1];
+        out[3 * i + 2] = rgb[2];
       }
-
-      // Calculate the RGB values
-      unsigned char r = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
-      unsigned char g = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
-      unsigned char b = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
-
-      m_ColorArray->setComponent(i, 0, r);
-      m_ColorArray->setComponent(i, 1, g);
-      m_ColorArray->setComponent(i, 2, b);
     }
   }
 
@@ -135,11 +223,13 @@ public:
 #endif
 private:
   typename DataArray<T>::Pointer                        m_ArrayPtr;
-  QVector<float>                                        m_BinPoints;
   T                                                     m_ArrayMin;
   T                                                     m_ArrayMax;
+  const QVector<float>*                                 m_BinPoints;
+  const std::vector<std::vector<double> >*              m_ControlPoints;
   int                                                   m_NumControlColors;
-  std::vector<std::vector<double> >                     m_ControlPoints;
+  const std::vector<uint8_t>*                           m_LookupTable;
+  bool                                                  m_ExactLookup;
   UInt8ArrayType::Pointer                               m_ColorArray;
 };
 
@@ -147,7 +237,8 @@ private:
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, DataContainerArray::Pointer dca)
+void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, int lookupTableResolution,
+                        DataContainerArray::Pointer dca)
 {
   if (arrayPtr->getNumberOfTuples() <= 0) { return; }
 
@@ -185,21 +276,51 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
   UInt8ArrayType::Pointer colorArray = dca->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, tmpPath, QVector<size_t>(1, 3));
   if (colorArray.get() == nullptr) { return; }
 
+  ArrayStatistics::MinMax<T> arrayRange = ArrayStatistics::FindMinMax(arrayPtr->getPointer(0), arrayPtr->getNumberOfTuples());
+
+  // Integer arrays with a small enough range get one lookup table entry per value, which reproduces the
+  // evaluation of the color table exactly. All other arrays sample the normalized range with the
+  // requested resolution, unless the resolution is 0.
+  std::vector<uint8_t> lookupTable;
+  bool exactLookup = false;
+  if(std::is_integral<T>::value && static_cast<double>(arrayRange.max) - static_cast<double>(arrayRange.min) < static_cast<double>(GenerateColorTableImpl<T>::k_MaxExactLookupTableSize))
+  {
+    size_t numEntries = static_cast<size_t>(arrayRange.max - arrayRange.min) + 1;
+    float range = static_cast<float>(arrayRange.max - arrayRange.min);
+    lookupTable.resize(numEntries * 3);
+    for(size_t k = 0; k < numEntries; k++)
+    {
+      float nValue = range > 0.0f ? static_cast<float>(k) / range : 0.0f;
+      computeColor(nValue, binPoints, controlPoints, numControlColors, lookupTable.data() + 3 * k);
+    }
+    exactLookup = true;
+  }
+  else if(lookupTableResolution > 1)
+  {
+    size_t numEntries = static_cast<size_t>(lookupTableResolution);
+    lookupTable.resize(numEntries * 3);
+    for(size_t k = 0; k < numEntries; k++)
+    {
+      float nValue = static_cast<float>(k) / static_cast<float>(numEntries - 1);
+      computeColor(nValue, binPoints, controlPoints, numControlColors, lookupTable.data() + 3 * k);
+    }
+  }
+
+  GenerateColorTableImpl<T> impl(arrayPtr, arrayRange.min, arrayRange.max, binPoints, controlPoints, numControlColors, lookupTable, exactLookup, colorArray);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray),
-                      tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), impl);
   }
   else
 #endif
   {
-    GenerateColorTableImpl<T> serial(arrayPtr, binPoints, controlPoints, numControlColors, colorArray);
-    serial.convert(0, arrayPtr->getNumberOfTuples());
+    impl.convert(0, arrayPtr->getNumberOfTuples());
   }
 }
 
@@ -211,6 +332,7 @@ GenerateColorTable::GenerateColorTable()
 , m_SelectedPresetControlPoints(QJsonArray())
 , m_SelectedDataArrayPath(DataArrayPath("", "", ""))
 , m_RgbArrayName("")
+, m_LookupTableResolution(4096)
 {
   initialize();
 }
@@ -251,6 +373,8 @@ void GenerateColorTable::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Data Array", SelectedDataArrayPath, FilterParameter::RequiredArray, GenerateColorTable, req));
   }
 
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Lookup Table Resolution", LookupTableResolution, FilterParameter::Parameter, GenerateColorTable));
+
   parameters.push_back(SIMPL_NEW_STRING_FP("RGB Array Name", RgbArrayName, FilterParameter::CreatedArray, GenerateColorTable));
 
   setFilterParameters(parameters);
@@ -264,6 +388,14 @@ void GenerateColorTable::dataCheck()
   setErrorCondition(0);
   setWarningCondition(0);
 
+  if(getLookupTableResolution() < 0 || getLookupTableResolution() == 1)
+  {
+    QString ss = QObject::tr("The lookup table resolution (%1) must be 0 to evaluate the color table for every value or at least 2.").arg(getLookupTableResolution());
+    setErrorCondition(-10001);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
   getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedDataArrayPath());
 
   DataArrayPath tmpPath = getSelectedDataArrayPath();
@@ -298,57 +430,57 @@ void GenerateColorTable::execute()
   if (getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     DoubleArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     FloatArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     BoolArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getLookupTableResolution(), getDataContainerArray());
   }
   else
   {
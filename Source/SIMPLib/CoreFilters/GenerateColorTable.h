@@ -22,6 +22,7 @@ class SIMPLib_EXPORT GenerateColorTable : public AbstractFilter
   PYB11_PROPERTY(QJsonArray SelectedPresetControlPoints READ getSelectedPresetControlPoints WRITE setSelectedPresetControlPoints)
   PYB11_PROPERTY(DataArrayPath SelectedDataArrayPath READ getSelectedDataArrayPath WRITE setSelectedDataArrayPath)
   PYB11_PROPERTY(QString RgbArrayName READ getRgbArrayName WRITE setRgbArrayName)
+  PYB11_PROPERTY(int LookupTableResolution READ getLookupTableResolution WRITE setLookupTableResolution)
 
   public:
     SIMPL_SHARED_POINTERS(GenerateColorTable)
@@ -42,6 +43,10 @@ class SIMPLib_EXPORT GenerateColorTable : public AbstractFilter
     SIMPL_INSTANCE_PROPERTY(QString, RgbArrayName)
     Q_PROPERTY(QString RgbArrayName READ getRgbArrayName WRITE setRgbArrayName)
 
+    // Number of lookup table entries that floating point arrays are mapped through; 0 evaluates the color table for every value
+    SIMPL_INSTANCE_PROPERTY(int, LookupTableResolution)
+    Q_PROPERTY(int LookupTableResolution READ getLookupTableResolution WRITE setLookupTableResolution)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -0,0 +1,906 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "GenerateSurfaceMesh.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+// Each slab holds at least this many cells, so the slabs and therefore the vertex numbering only depend on the
+// dimensions of the image
+const size_t k_SlabCells = 65536;
+const int32_t k_ExteriorLabel = -1;
+
+/**
+ * @brief The SurfaceSlab class holds the part of the surface that is extracted from one slab of Z planes. Every vertex
+ * has a key that is unique in the whole image, so the vertices that a slab shares with the previous slab can be found
+ * in the vertex table of the previous slab. Only vertices on the first plane of a slab can be shared.
+ */
+class SurfaceSlab
+{
+public:
+  SurfaceSlab() = default;
+  virtual ~SurfaceSlab() = default;
+
+  /**
+   * @brief Returns the local id of the vertex with the given key, which is created if the slab does not have it yet
+   * @param key
+   * @param onFirstPlane Whether the vertex lies on the first plane of the slab
+   * @param computeCoords Writes the 3 coordinates of a new vertex
+   * @return
+   */
+  template <typename CoordsFunctor> int64_t addVertex(uint64_t key, bool onFirstPlane, const CoordsFunctor& computeCoords)
+  {
+    if(2 * (m_Coords.size() / 3 + 1) > m_Keys.size())
+    {
+      growTable();
+    }
+    size_t slot = findSlot(key);
+    if(m_Keys[slot] == key + 1)
+    {
+      return m_Ids[slot];
+    }
+    int64_t id = static_cast<int64_t>(m_Coords.size() / 3);
+    m_Keys[slot] = key + 1;
+    m_Ids[slot] = id;
+    m_Coords.resize(m_Coords.size() + 3);
+    computeCoords(m_Coords.data() + 3 * id);
+    if(onFirstPlane)
+    {
+      m_FirstPlaneVertices.push_back(id);
+      m_FirstPlaneKeys.push_back(key);
+    }
+    return id;
+  }
+
+  /**
+   * @brief Returns the local id of the vertex with the given key, or -1 if the slab does not have it
+   * @param key
+   * @return
+   */
+  int64_t findVertex(uint64_t key) const
+  {
+    if(m_Keys.empty())
+    {
+      return -1;
+    }
+    size_t slot = findSlot(key);
+    return (m_Keys[slot] == key + 1) ? m_Ids[slot] : -1;
+  }
+
+  /**
+   * @brief Returns the slot of the key in the open addressing table of the vertices, or the empty slot where it
+   * would be inserted. The table stores key + 1, so 0 marks an empty slot.
+   * @param key
+   * @return
+   */
+  size_t findSlot(uint64_t key) const
+  {
+    const size_t mask = m_Keys.size() - 1;
+    uint64_t hash = key * 0x9E3779B97F4A7C15ULL;
+    size_t slot = static_cast<size_t>(hash ^ (hash >> 32)) & mask;
+    while(m_Keys[slot] != 0 && m_Keys[slot] != key + 1)
+    {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  /**
+   * @brief Doubles the size of the vertex table, which is kept at most half full
+   */
+  void growTable()
+  {
+    std::vector<uint64_t> keys(std::max(2 * m_Keys.size(), static_cast<size_t>(1024)), 0);
+    std::vector<int64_t> ids(keys.size(), 0);
+    m_Keys.swap(keys);
+    m_Ids.swap(ids);
+    for(size_t i = 0; i < keys.size(); i++)
+    {
+      if(keys[i] != 0)
+      {
+        size_t slot = findSlot(keys[i] - 1);
+        m_Keys[slot] = keys[i];
+        m_Ids[slot] = ids[i];
+      }
+    }
+  }
+
+  void addTriangle(int64_t v0, int64_t v1, int64_t v2, int32_t label0, int32_t label1)
+  {
+    m_Triangles.push_back(v0);
+    m_Triangles.push_back(v1);
+    m_Triangles.push_back(v2);
+    m_FaceLabels.push_back(label0);
+    m_FaceLabels.push_back(label1);
+  }
+
+  const float* getCoords(int64_t id) const
+  {
+    return m_Coords.data() + 3 * id;
+  }
+
+  std::vector<uint64_t> m_Keys;
+  std::vector<int64_t> m_Ids;
+  std::vector<float> m_Coords;
+  std::vector<int64_t> m_Triangles;
+  std::vector<int32_t> m_FaceLabels;
+  std::vector<int64_t> m_FirstPlaneVertices;
+  std::vector<uint64_t> m_FirstPlaneKeys;
+  std::vector<int64_t> m_SharedIds; // Local id in the previous slab of each first plane vertex, or -1
+  std::vector<int64_t> m_GlobalIds;
+  int64_t m_NumOwnedVertices = 0;
+  int64_t m_VertexOffset = 0;
+  int64_t m_TriangleOffset = 0;
+};
+
+/**
+ * @brief The LabelSurfaceImpl class extracts the faces between cells with different labels and between the cells
+ * and the exterior of the image. Each face is split into 2 triangles whose vertices are the nodes of the image, so
+ * neighboring features share their boundary exactly. The normal of a face points from the cell of its first label
+ * to the cell of its second label.
+ */
+class LabelSurfaceImpl
+{
+public:
+  LabelSurfaceImpl(const int32_t* labels, const size_t dims[3], const float origin[3], const float res[3])
+  : m_Labels(labels)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      m_Dims[d] = dims[d];
+      m_Origin[d] = origin[d];
+      m_Resolution[d] = res[d];
+    }
+  }
+  virtual ~LabelSurfaceImpl() = default;
+
+  /**
+   * @brief Extracts the faces of the cells in the Z planes [zStart, zEnd). Each cell creates the faces on its minimum
+   * sides and, on the maximum sides of the image, the faces towards the exterior.
+   * @param zStart
+   * @param zEnd
+   * @param slab
+   */
+  void extract(size_t zStart, size_t zEnd, SurfaceSlab& slab) const
+  {
+    const size_t dimX = m_Dims[0];
+    const size_t dimY = m_Dims[1];
+    const size_t planeStride = dimX * dimY;
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = 0; y < dimY; y++)
+      {
+        const size_t rowStart = (z * dimY + y) * dimX;
+        for(size_t x = 0; x < dimX; x++)
+        {
+          const size_t index = rowStart + x;
+          const int32_t label = m_Labels[index];
+          const size_t node[3] = {x, y, z};
+          const int32_t neighbors[3] = {(x > 0) ? m_Labels[index - 1] : k_ExteriorLabel, (y > 0) ? m_Labels[index - dimX] : k_ExteriorLabel,
+                                        (z > 0) ? m_Labels[index - planeStride] : k_ExteriorLabel};
+          for(size_t axis = 0; axis < 3; axis++)
+          {
+            if(neighbors[axis] != label)
+            {
+              addFace(slab, zStart, axis, node, neighbors[axis], label);
+            }
+            if(node[axis] == m_Dims[axis] - 1 && label != k_ExteriorLabel)
+            {
+              size_t maxNode[3] = {x, y, z};
+              maxNode[axis]++;
+              addFace(slab, zStart, axis, maxNode, label, k_ExteriorLabel);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Adds the face that is perpendicular to the axis and whose smallest node is the given node
+   * @param slab
+   * @param zStart
+   * @param axis
+   * @param node
+   * @param minusLabel Label of the cell before the face along the axis
+   * @param plusLabel Label of the cell after the face along the axis
+   */
+  void addFace(SurfaceSlab& slab, size_t zStart, size_t axis, const size_t node[3], int32_t minusLabel, int32_t plusLabel) const
+  {
+    // The corners are ordered counter clockwise around the axis
+    const size_t u = (axis + 1) % 3;
+    const size_t v = (axis + 2) % 3;
+    int64_t ids[4] = {0, 0, 0, 0};
+    for(size_t c = 0; c < 4; c++)
+    {
+      size_t corner[3] = {node[0], node[1], node[2]};
+      corner[u] += (c == 1 || c == 2) ? 1 : 0;
+      corner[v] += (c == 2 || c == 3) ? 1 : 0;
+      uint64_t key = static_cast<uint64_t>(corner[0] + (m_Dims[0] + 1) * (corner[1] + (m_Dims[1] + 1) * corner[2]));
+      ids[c] = slab.addVertex(key, zStart > 0 && corner[2] == zStart, [this, &corner](float* coords) {
+        for(size_t d = 0; d < 3; d++)
+        {
+          coords[d] = m_Origin[d] + static_cast<float>(corner[d]) * m_Resolution[d];
+        }
+      });
+    }
+    slab.addTriangle(ids[0], ids[1], ids[2], minusLabel, plusLabel);
+    slab.addTriangle(ids[0], ids[2], ids[3], minusLabel, plusLabel);
+  }
+
+private:
+  const int32_t* m_Labels;
+  size_t m_Dims[3] = {0, 0, 0};
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+  float m_Resolution[3] = {0.0f, 0.0f, 0.0f};
+};
+
+/**
+ * @brief The IsoSurfaceImpl class extracts the iso surface of a scalar array with marching tetrahedra. The values
+ * are sampled at the cell centers and the cube between 2 x 2 x 2 neighboring cells is split into 6 tetrahedra along
+ * its main diagonal. The split is the same for all cubes, so the surface is closed wherever it does not leave the
+ * image. The vertices lie on the edges between the samples, which gives each vertex a unique key. The normals point
+ * from the values above the iso value to the values below it.
+ */
+template <typename T> class IsoSurfaceImpl
+{
+public:
+  IsoSurfaceImpl(const T* values, double isoValue, const size_t dims[3], const float origin[3], const float res[3])
+  : m_Values(values)
+  , m_IsoValue(isoValue)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      m_Dims[d] = dims[d];
+      m_Origin[d] = origin[d];
+      m_Resolution[d] = res[d];
+    }
+  }
+  virtual ~IsoSurfaceImpl() = default;
+
+  /**
+   * @brief Extracts the surface in the cubes whose lower samples lie in the Z planes [zStart, zEnd)
+   * @param zStart
+   * @param zEnd
+   * @param slab
+   */
+  void extract(size_t zStart, size_t zEnd, SurfaceSlab& slab) const
+  {
+    // The corners of the tetrahedra are bit masks of their offsets from the lower corner of the cube. Every edge of a
+    // tetrahedron goes from a corner to a corner with more bits set.
+    static const int k_Tetrahedra[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+
+    const size_t dimX = m_Dims[0];
+    const size_t dimY = m_Dims[1];
+    double values[8];
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = 0; y + 1 < dimY; y++)
+      {
+        for(size_t x = 0; x + 1 < dimX; x++)
+        {
+          const size_t cube[3] = {x, y, z};
+          int numAbove = 0;
+          for(int c = 0; c < 8; c++)
+          {
+            values[c] = static_cast<double>(m_Values[sampleIndex(cube, c)]);
+            numAbove += (values[c] > m_IsoValue) ? 1 : 0;
+          }
+          if(numAbove == 0 || numAbove == 8)
+          {
+            continue;
+          }
+          for(const int* tetrahedron : k_Tetrahedra)
+          {
+            addTetrahedron(slab, zStart, cube, tetrahedron, values);
+          }
+        }
+      }
+    }
+  }
+
+  size_t sampleIndex(const size_t cube[3], int corner) const
+  {
+    return (cube[0] + (corner & 1)) + m_Dims[0] * ((cube[1] + ((corner >> 1) & 1)) + m_Dims[1] * (cube[2] + ((corner >> 2) & 1)));
+  }
+
+  /**
+   * @brief Adds the 1 or 2 triangles of the iso surface in the tetrahedron
+   * @param slab
+   * @param zStart
+   * @param cube
+   * @param tetrahedron
+   * @param values
+   */
+  void addTetrahedron(SurfaceSlab& slab, size_t zStart, const size_t cube[3], const int tetrahedron[4], const double values[8]) const
+  {
+    int above[4] = {0, 0, 0, 0};
+    int below[4] = {0, 0, 0, 0};
+    int numAbove = 0;
+    int numBelow = 0;
+    for(int c = 0; c < 4; c++)
+    {
+      if(values[tetrahedron[c]] > m_IsoValue)
+      {
+        above[numAbove++] = tetrahedron[c];
+      }
+      else
+      {
+        below[numBelow++] = tetrahedron[c];
+      }
+    }
+    if(numAbove == 0 || numBelow == 0)
+    {
+      return;
+    }
+
+    // The triangles are oriented along the direction from the corners above the iso value to the corners below it
+    float direction[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t d = 0; d < 3; d++)
+    {
+      float aboveSum = 0.0f;
+      float belowSum = 0.0f;
+      for(int c = 0; c < numAbove; c++)
+      {
+        aboveSum += static_cast<float>((above[c] >> d) & 1);
+      }
+      for(int c = 0; c < numBelow; c++)
+      {
+        belowSum += static_cast<float>((below[c] >> d) & 1);
+      }
+      direction[d] = (belowSum / static_cast<float>(numBelow) - aboveSum / static_cast<float>(numAbove)) * m_Resolution[d];
+    }
+
+    if(numAbove == 1)
+    {
+      addTriangle(slab, direction, addVertex(slab, zStart, cube, above[0], below[0], values), addVertex(slab, zStart, cube, above[0], below[1], values),
+                  addVertex(slab, zStart, cube, above[0], below[2], values));
+    }
+    else if(numBelow == 1)
+    {
+      addTriangle(slab, direction, addVertex(slab, zStart, cube, below[0], above[0], values), addVertex(slab, zStart, cube, below[0], above[1], values),
+                  addVertex(slab, zStart, cube, below[0], above[2], values));
+    }
+    else
+    {
+      // The 4 edges between the 2 corners above and the 2 corners below form a quadrilateral
+      int64_t quad[4] = {addVertex(slab, zStart, cube, above[0], below[0], values), addVertex(slab, zStart, cube, above[0], below[1], values),
+                         addVertex(slab, zStart, cube, above[1], below[1], values), addVertex(slab, zStart, cube, above[1], below[0], values)};
+      addTriangle(slab, direction, quad[0], quad[1], quad[2]);
+      addTriangle(slab, direction, quad[0], quad[2], quad[3]);
+    }
+  }
+
+  /**
+   * @brief Returns the vertex where the iso surface crosses the edge between 2 corners of the cube
+   * @param slab
+   * @param zStart
+   * @param cube
+   * @param cornerA
+   * @param cornerB
+   * @param values
+   * @return
+   */
+  int64_t addVertex(SurfaceSlab& slab, size_t zStart, const size_t cube[3], int cornerA, int cornerB, const double values[8]) const
+  {
+    const int lower = std::min(cornerA, cornerB);
+    const int upper = std::max(cornerA, cornerB);
+    const int offset = lower ^ upper;
+    const uint64_t key = static_cast<uint64_t>(sampleIndex(cube, lower)) * 7 + static_cast<uint64_t>(offset - 1);
+    const bool onFirstPlane = zStart > 0 && cube[2] == zStart && (lower & 4) == 0 && (offset & 4) == 0;
+    return slab.addVertex(key, onFirstPlane, [&](float* coords) {
+      double t = (m_IsoValue - values[lower]) / (values[upper] - values[lower]);
+      t = (t > 0.0) ? t : 0.0;
+      t = (t < 1.0) ? t : 1.0;
+      for(size_t d = 0; d < 3; d++)
+      {
+        double position = static_cast<double>(cube[d]) + static_cast<double>((lower >> d) & 1) + 0.5 + t * static_cast<double>((offset >> d) & 1);
+        coords[d] = m_Origin[d] + static_cast<float>(position) * m_Resolution[d];
+      }
+    });
+  }
+
+  void addTriangle(SurfaceSlab& slab, const float direction[3], int64_t v0, int64_t v1, int64_t v2) const
+  {
+    const float* p0 = slab.getCoords(v0);
+    const float* p1 = slab.getCoords(v1);
+    const float* p2 = slab.getCoords(v2);
+    float a[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+    float b[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+    float normal[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    if(normal[0] * direction[0] + normal[1] * direction[1] + normal[2] * direction[2] < 0.0f)
+    {
+      std::swap(v1, v2);
+    }
+    slab.addTriangle(v0, v1, v2, 1, 0);
+  }
+
+private:
+  const T* m_Values;
+  double m_IsoValue;
+  size_t m_Dims[3] = {0, 0, 0};
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+  float m_Resolution[3] = {0.0f, 0.0f, 0.0f};
+};
+
+// -----------------------------------------------------------------------------
+// Splits the planes into slabs of a fixed thickness and extracts the surface of each slab, in parallel if the
+// execution context allows it
+// -----------------------------------------------------------------------------
+template <typename ImplType> void ExtractSlabs(const ImplType& impl, size_t numPlanes, size_t planeCells, std::vector<SurfaceSlab>& slabs)
+{
+  const size_t thickness = std::max(k_SlabCells / std::max(planeCells, static_cast<size_t>(1)), static_cast<size_t>(1));
+  slabs.resize((numPlanes + thickness - 1) / thickness);
+  GeometryHelpers::ForEachElementBlock(slabs.size(), 1, [&impl, &slabs, thickness, numPlanes](size_t start, size_t end) {
+    for(size_t s = start; s < end; s++)
+    {
+      impl.extract(s * thickness, std::min((s + 1) * thickness, numPlanes), slabs[s]);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void ExtractIsoSurface(IDataArray::Pointer inputData, double isoValue, const size_t dims[3], const float origin[3], const float res[3], std::vector<SurfaceSlab>& slabs)
+{
+  typename DataArray<T>::Pointer values = std::dynamic_pointer_cast<DataArray<T>>(inputData);
+  IsoSurfaceImpl<T> impl(values->getPointer(0), isoValue, dims, origin, res);
+  if(dims[0] > 1 && dims[1] > 1 && dims[2] > 1)
+  {
+    ExtractSlabs(impl, dims[2] - 1, dims[0] * dims[1], slabs);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Finds the vertices that each slab shares with the previous slab and numbers the slabs. The vertices of a slab
+// that the previous slab already has are not counted.
+// -----------------------------------------------------------------------------
+void NumberSlabs(std::vector<SurfaceSlab>& slabs, int64_t& numVertices, int64_t& numTriangles)
+{
+  GeometryHelpers::ForEachElementBlock(slabs.size(), 1, [&slabs](size_t start, size_t end) {
+    for(size_t s = start; s < end; s++)
+    {
+      SurfaceSlab& slab = slabs[s];
+      slab.m_SharedIds.assign(slab.m_FirstPlaneKeys.size(), -1);
+      int64_t numShared = 0;
+      for(size_t i = 0; s > 0 && i < slab.m_FirstPlaneKeys.size(); i++)
+      {
+        slab.m_SharedIds[i] = slabs[s - 1].findVertex(slab.m_FirstPlaneKeys[i]);
+        numShared += (slab.m_SharedIds[i] >= 0) ? 1 : 0;
+      }
+      slab.m_NumOwnedVertices = static_cast<int64_t>(slab.m_Coords.size() / 3) - numShared;
+    }
+  });
+
+  numVertices = 0;
+  numTriangles = 0;
+  for(SurfaceSlab& slab : slabs)
+  {
+    slab.m_VertexOffset = numVertices;
+    slab.m_TriangleOffset = numTriangles;
+    numVertices += slab.m_NumOwnedVertices;
+    numTriangles += static_cast<int64_t>(slab.m_Triangles.size() / 3);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Copies the numbered slabs into the vertex, triangle and face label lists. The memory of each slab is released as
+// soon as it is no longer needed.
+// -----------------------------------------------------------------------------
+void WriteSlabs(std::vector<SurfaceSlab>& slabs, float* vertices, int64_t* triangles, int32_t* faceLabels)
+{
+  // The owned vertices keep their order within the slab
+  GeometryHelpers::ForEachElementBlock(slabs.size(), 1, [&slabs, vertices](size_t start, size_t end) {
+    for(size_t s = start; s < end; s++)
+    {
+      SurfaceSlab& slab = slabs[s];
+      const size_t numLocal = slab.m_Coords.size() / 3;
+      slab.m_GlobalIds.assign(numLocal, 0);
+      for(size_t i = 0; i < slab.m_SharedIds.size(); i++)
+      {
+        if(slab.m_SharedIds[i] >= 0)
+        {
+          slab.m_GlobalIds[slab.m_FirstPlaneVertices[i]] = -1;
+        }
+      }
+      int64_t nextId = slab.m_VertexOffset;
+      for(size_t i = 0; i < numLocal; i++)
+      {
+        if(slab.m_GlobalIds[i] < 0)
+        {
+          continue;
+        }
+        slab.m_GlobalIds[i] = nextId;
+        std::copy(slab.m_Coords.begin() + 3 * i, slab.m_Coords.begin() + 3 * i + 3, vertices + 3 * nextId);
+        nextId++;
+      }
+      std::vector<uint64_t>().swap(slab.m_Keys);
+      std::vector<int64_t>().swap(slab.m_Ids);
+      std::vector<float>().swap(slab.m_Coords);
+    }
+  });
+
+  GeometryHelpers::ForEachElementBlock(slabs.size(), 1, [&slabs, triangles, faceLabels](size_t start, size_t end) {
+    for(size_t s = start; s < end; s++)
+    {
+      SurfaceSlab& slab = slabs[s];
+      for(size_t i = 0; i < slab.m_SharedIds.size(); i++)
+      {
+        if(slab.m_SharedIds[i] >= 0)
+        {
+          slab.m_GlobalIds[slab.m_FirstPlaneVertices[i]] = slabs[s - 1].m_GlobalIds[slab.m_SharedIds[i]];
+        }
+      }
+      int64_t* tris = triangles + 3 * slab.m_TriangleOffset;
+      for(size_t i = 0; i < slab.m_Triangles.size(); i++)
+      {
+        tris[i] = slab.m_GlobalIds[slab.m_Triangles[i]];
+      }
+      std::copy(slab.m_FaceLabels.begin(), slab.m_FaceLabels.end(), faceLabels + 2 * slab.m_TriangleOffset);
+      std::vector<int64_t>().swap(slab.m_Triangles);
+      std::vector<int32_t>().swap(slab.m_FaceLabels);
+    }
+  });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GenerateSurfaceMesh::GenerateSurfaceMesh()
+: m_SurfaceType(0)
+, m_FeatureIdsArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds)
+, m_SelectedArrayPath("", "", "")
+, m_IsoValue(0.0)
+, m_SurfaceDataContainerName(SIMPL::Defaults::TriangleDataContainerName)
+, m_VertexAttributeMatrixName(SIMPL::Defaults::VertexAttributeMatrixName)
+, m_FaceAttributeMatrixName(SIMPL::Defaults::FaceAttributeMatrixName)
+, m_FaceLabelsArrayName(SIMPL::FaceData::SurfaceMeshFaceLabels)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GenerateSurfaceMesh::~GenerateSurfaceMesh() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Surface Type");
+    parameter->setPropertyName("SurfaceType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(GenerateSurfaceMesh, this, SurfaceType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(GenerateSurfaceMesh, this, SurfaceType));
+    QVector<QString> choices = {"Label Boundaries", "Iso Surface"};
+    parameter->setChoices(choices);
+    QStringList linkedProps = {"FeatureIdsArrayPath", "SelectedArrayPath", "IsoValue"};
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_DOUBLE_FP("Iso Value", IsoValue, FilterParameter::Parameter, GenerateSurfaceMesh, 1));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::RequiredArray, GenerateSurfaceMesh, req, 0));
+  }
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Scalar Array", SelectedArrayPath, FilterParameter::RequiredArray, GenerateSurfaceMesh, req, 1));
+  }
+  parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", SurfaceDataContainerName, FilterParameter::CreatedArray, GenerateSurfaceMesh));
+  parameters.push_back(SeparatorFilterParameter::New("Vertex Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Vertex Attribute Matrix", VertexAttributeMatrixName, FilterParameter::CreatedArray, GenerateSurfaceMesh));
+  parameters.push_back(SeparatorFilterParameter::New("Face Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Attribute Matrix", FaceAttributeMatrixName, FilterParameter::CreatedArray, GenerateSurfaceMesh));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Face Labels", FaceLabelsArrayName, FilterParameter::CreatedArray, GenerateSurfaceMesh));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSurfaceType(reader->readValue("SurfaceType", getSurfaceType()));
+  setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
+  setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
+  setIsoValue(reader->readValue("IsoValue", getIsoValue()));
+  setSurfaceDataContainerName(reader->readString("SurfaceDataContainerName", getSurfaceDataContainerName()));
+  setVertexAttributeMatrixName(reader->readString("VertexAttributeMatrixName", getVertexAttributeMatrixName()));
+  setFaceAttributeMatrixName(reader->readString("FaceAttributeMatrixName", getFaceAttributeMatrixName()));
+  setFaceLabelsArrayName(reader->readString("FaceLabelsArrayName", getFaceLabelsArrayName()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::initialize()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  setCancel(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::dataCheck()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  initialize();
+
+  if(getSurfaceType() < 0 || getSurfaceType() > 1)
+  {
+    QString ss = QObject::tr("The surface type (%1) must be 0 (Label Boundaries) or 1 (Iso Surface)").arg(getSurfaceType());
+    setErrorCondition(-11910);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  DataArrayPath inputPath = (getSurfaceType() == 0) ? getFeatureIdsArrayPath() : getSelectedArrayPath();
+  ImageGeom::Pointer image = getDataContainerArray()->getPrereqGeometryFromDataContainer<ImageGeom, AbstractFilter>(this, inputPath.getDataContainerName());
+
+  IDataArray::Pointer inputArray = IDataArray::NullPointer();
+  if(getSurfaceType() == 0)
+  {
+    QVector<size_t> cDims(1, 1);
+    m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeatureIdsArrayPath(), cDims);
+    if(nullptr != m_FeatureIdsPtr.lock())
+    {
+      m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0);
+      inputArray = m_FeatureIdsPtr.lock();
+    }
+  }
+  else
+  {
+    m_InArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedArrayPath());
+    inputArray = m_InArrayPtr.lock();
+    if(nullptr != inputArray && inputArray->getNumberOfComponents() != 1)
+    {
+      QString ss = QObject::tr("The scalar array must have 1 component, but the selected array has %1 components").arg(inputArray->getNumberOfComponents());
+      setErrorCondition(-11911);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    }
+  }
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  if(inputArray->getNumberOfTuples() != image->getNumberOfElements())
+  {
+    QString ss = QObject::tr("The selected array has %1 tuples, but the Image Geometry has %2 cells").arg(inputArray->getNumberOfTuples()).arg(image->getNumberOfElements());
+    setErrorCondition(-11912);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // The size of the surface is only known once it has been extracted
+  DataContainer::Pointer dc = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, getSurfaceDataContainerName());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(0, !getInPreflight());
+  TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(0, vertices, SIMPL::Geometry::TriangleGeometry, !getInPreflight());
+  dc->setGeometry(triangleGeom);
+
+  QVector<size_t> tDims(1, 0);
+  dc->createNonPrereqAttributeMatrix(this, getVertexAttributeMatrixName(), tDims, AttributeMatrix::Type::Vertex);
+  dc->createNonPrereqAttributeMatrix(this, getFaceAttributeMatrixName(), tDims, AttributeMatrix::Type::Face);
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  QVector<size_t> cDims(1, 2);
+  DataArrayPath path(getSurfaceDataContainerName(), getFaceAttributeMatrixName(), getFaceLabelsArrayName());
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, path, 0, cDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::preflight()
+{
+  // These are the REQUIRED lines of CODE to make sure the filter behaves correctly
+  setInPreflight(true);              // Set the fact that we are preflighting.
+  emit preflightAboutToExecute();    // Emit this signal so that other widgets can do one file update
+  emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
+  dataCheck();                       // Run our DataCheck to make sure everthing is setup correctly
+  emit preflightExecuted();          // We are done preflighting this filter
+  setInPreflight(false);             // Inform the system this filter is NOT in preflight mode anymore.
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateSurfaceMesh::execute()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  DataArrayPath inputPath = (getSurfaceType() == 0) ? getFeatureIdsArrayPath() : getSelectedArrayPath();
+  ImageGeom::Pointer image = getDataContainerArray()->getDataContainer(inputPath.getDataContainerName())->getGeometryAs<ImageGeom>();
+  size_t dims[3] = {0, 0, 0};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+  std::tie(origin[0], origin[1], origin[2]) = image->getOrigin();
+  std::tie(res[0], res[1], res[2]) = image->getResolution();
+
+  std::vector<SurfaceSlab> slabs;
+  if(getSurfaceType() == 0)
+  {
+    LabelSurfaceImpl impl(m_FeatureIds, dims, origin, res);
+    ExtractSlabs(impl, dims[2], dims[0] * dims[1], slabs);
+  }
+  else
+  {
+    IDataArray::Pointer inputArray = m_InArrayPtr.lock();
+    EXECUTE_FUNCTION_TEMPLATE(this, ExtractIsoSurface, inputArray, inputArray, getIsoValue(), dims, origin, res, slabs)
+  }
+  if(getCancel() || getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  int64_t numVertices = 0;
+  int64_t numTriangles = 0;
+  NumberSlabs(slabs, numVertices, numTriangles);
+
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSurfaceDataContainerName());
+  TriangleGeom::Pointer triangleGeom = dc->getGeometryAs<TriangleGeom>();
+  triangleGeom->resizeVertexList(numVertices);
+  triangleGeom->resizeTriList(numTriangles);
+  dc->getAttributeMatrix(getVertexAttributeMatrixName())->resizeAttributeArrays(QVector<size_t>(1, static_cast<size_t>(numVertices)));
+  AttributeMatrix::Pointer faceAttrMat = dc->getAttributeMatrix(getFaceAttributeMatrixName());
+  faceAttrMat->resizeAttributeArrays(QVector<size_t>(1, static_cast<size_t>(numTriangles)));
+
+  if(numTriangles > 0)
+  {
+    Int32ArrayType::Pointer faceLabels = faceAttrMat->getAttributeArrayAs<Int32ArrayType>(getFaceLabelsArrayName());
+    WriteSlabs(slabs, triangleGeom->getVertexPointer(0), triangleGeom->getTriPointer(0), faceLabels->getPointer(0));
+  }
+
+  QString ss = QObject::tr("Extracted %1 vertices and %2 triangles").arg(numVertices).arg(numTriangles);
+  notifyStatusMessage(getHumanLabel(), ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer GenerateSurfaceMesh::newFilterInstance(bool copyFilterParameters) const
+{
+  GenerateSurfaceMesh::Pointer filter = GenerateSurfaceMesh::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getCompiledLibraryName() const
+{
+  return Core::CoreBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getBrandingString() const
+{
+  return "SIMPLib Core Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getGroupName() const
+{
+  return SIMPL::FilterGroups::CoreFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid GenerateSurfaceMesh::getUuid()
+{
+  return QUuid("{630ddfff-875d-428f-a071-05c90e29b6bc}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::GeometryFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateSurfaceMesh::getHumanLabel() const
+{
+  return "Generate Surface Mesh";
+}
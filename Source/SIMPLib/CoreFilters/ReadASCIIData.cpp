@@ -7,6 +7,7 @@
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ProgressCounter.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
@@ -534,8 +535,8 @@ void ReadASCIIData::execute()
       in.readLine();
     }
 
-    float threshold = 0.0f;
     size_t numTuples = numLines - beginIndex + 1;
+    ProgressCounter progress(this, static_cast<int64_t>(numTuples), "Importing ASCII Data", getMessagePrefix(), getHumanLabel());
 
     for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
     {
@@ -570,17 +571,7 @@ void ReadASCIIData::execute()
         }
       }
 
-      if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
-      {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
-        {
-          threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-        }
-      }
+      progress.increment();
 
       if(getCancel())
       {
@@ -0,0 +1,294 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ReorderUnstructuredGeometry.h"
+
+#include <vector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReorderUnstructuredGeometry::ReorderUnstructuredGeometry()
+: m_DataContainerName(SIMPL::Defaults::TriangleDataContainerName)
+, m_ElementOrdering(static_cast<int>(IGeometry::ElementOrdering::SpaceFillingCurve))
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReorderUnstructuredGeometry::~ReorderUnstructuredGeometry() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  {
+    QVector<QString> choices = {"Space Filling Curve", "Reverse Cuthill-McKee"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Element Ordering", ElementOrdering, FilterParameter::Parameter, ReorderUnstructuredGeometry, choices, false));
+  }
+  DataContainerSelectionFilterParameter::RequirementType req;
+  IGeometry::Types reqGeom = {IGeometry::Type::Vertex, IGeometry::Type::Edge, IGeometry::Type::Triangle, IGeometry::Type::Quad, IGeometry::Type::Tetrahedral, IGeometry::Type::Hexahedral};
+  req.dcGeometryTypes = reqGeom;
+  parameters.push_back(SIMPL_NEW_DC_SELECTION_FP("Geometry to Reorder", DataContainerName, FilterParameter::RequiredArray, ReorderUnstructuredGeometry, req));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setDataContainerName(reader->readString("DataContainerName", getDataContainerName()));
+  setElementOrdering(reader->readValue("ElementOrdering", getElementOrdering()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::initialize()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  setCancel(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::dataCheck()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  initialize();
+
+  if(getElementOrdering() < static_cast<int>(IGeometry::ElementOrdering::SpaceFillingCurve) || getElementOrdering() > static_cast<int>(IGeometry::ElementOrdering::ReverseCuthillMcKee))
+  {
+    QString ss = QObject::tr("The element ordering (%1) must be 0 (Space Filling Curve) or 1 (Reverse Cuthill-McKee)").arg(getElementOrdering());
+    setErrorCondition(-11900);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+
+  IGeometry::Pointer geom = getDataContainerArray()->getPrereqGeometryFromDataContainer<IGeometry, AbstractFilter>(this, getDataContainerName());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  IGeometry::Type geomType = geom->getGeometryType();
+  if(geomType == IGeometry::Type::Image || geomType == IGeometry::Type::RectGrid || geomType == IGeometry::Type::Unknown || geomType == IGeometry::Type::Any)
+  {
+    QString ss = QObject::tr("The elements of a %1 Geometry can not be reordered. The Geometry must be a Vertex, Edge, Triangle, Quadrilateral, Tetrahedral or Hexahedral Geometry")
+                     .arg(geom->getGeometryTypeAsString());
+    setErrorCondition(-11901);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::preflight()
+{
+  // These are the REQUIRED lines of CODE to make sure the filter behaves correctly
+  setInPreflight(true);              // Set the fact that we are preflighting.
+  emit preflightAboutToExecute();    // Emit this signal so that other widgets can do one file update
+  emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
+  dataCheck();                       // Run our DataCheck to make sure everthing is setup correctly
+  emit preflightExecuted();          // We are done preflighting this filter
+  setInPreflight(false);             // Inform the system this filter is NOT in preflight mode anymore.
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReorderUnstructuredGeometry::execute()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+  IGeometry::Pointer geom = m->getGeometry();
+
+  std::vector<int64_t> vertexOrder;
+  std::vector<int64_t> elementOrder;
+  int err = geom->reorderElements(static_cast<IGeometry::ElementOrdering>(getElementOrdering()), vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error reordering the elements of the %1 Geometry").arg(geom->getGeometryTypeAsString());
+    setErrorCondition(-11902);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // The attribute matrix that holds the element data depends on the dimension of the geometry. The elements of
+  // a Vertex Geometry are its vertices, so its vertex data is only moved once.
+  AttributeMatrix::Type elementType = AttributeMatrix::Type::Vertex;
+  switch(geom->getGeometryType())
+  {
+  case IGeometry::Type::Edge:
+    elementType = AttributeMatrix::Type::Edge;
+    break;
+  case IGeometry::Type::Triangle:
+  case IGeometry::Type::Quad:
+    elementType = AttributeMatrix::Type::Face;
+    break;
+  case IGeometry::Type::Tetrahedral:
+  case IGeometry::Type::Hexahedral:
+    elementType = AttributeMatrix::Type::Cell;
+    break;
+  default:
+    break;
+  }
+
+  QList<QString> attrMatNames = m->getAttributeMatrixNames();
+  for(const QString& attrMatName : attrMatNames)
+  {
+    if(getCancel())
+    {
+      return;
+    }
+    AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(attrMatName);
+    const std::vector<int64_t>* order = nullptr;
+    if(attrMat->getType() == AttributeMatrix::Type::Vertex && attrMat->getNumberOfTuples() == vertexOrder.size())
+    {
+      order = &vertexOrder;
+    }
+    else if(attrMat->getType() == elementType && attrMat->getNumberOfTuples() == elementOrder.size())
+    {
+      order = &elementOrder;
+    }
+    if(order == nullptr)
+    {
+      continue;
+    }
+
+    QList<QString> arrayNames = attrMat->getAttributeArrayNames();
+    for(const QString& arrayName : arrayNames)
+    {
+      MeshReordering::PermuteTuples(attrMat->getAttributeArray(arrayName), *order);
+    }
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ReorderUnstructuredGeometry::newFilterInstance(bool copyFilterParameters) const
+{
+  ReorderUnstructuredGeometry::Pointer filter = ReorderUnstructuredGeometry::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getCompiledLibraryName() const
+{
+  return Core::CoreBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getBrandingString() const
+{
+  return "SIMPLib Core Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getGroupName() const
+{
+  return SIMPL::FilterGroups::CoreFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid ReorderUnstructuredGeometry::getUuid()
+{
+  return QUuid("{1a77991f-6e75-4d05-b3b6-91f6cf02b5d5}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::GeometryFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ReorderUnstructuredGeometry::getHumanLabel() const
+{
+  return "Reorder Unstructured Geometry";
+}
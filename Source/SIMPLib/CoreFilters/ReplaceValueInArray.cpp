@@ -132,8 +132,7 @@ template <typename T> void checkValuesFloatDouble(AbstractFilter* filter, double
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-
-template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, double removeValue, double replaceValue)
+template <typename T> void createReplaceValueKernel(IDataArray::Pointer inDataPtr, double removeValue, double replaceValue, ElementwiseKernel::Pointer& kernel)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
@@ -143,13 +142,15 @@ template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Poin
   T* inData = inputArrayPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
 
-  for(size_t iter = 0; iter < numTuples; iter++)
-  {
-    if(inData[iter] == removeVal)
+  kernel = ElementwiseKernel::New(numTuples, [inData, removeVal, replaceVal](size_t start, size_t end) {
+    for(size_t iter = start; iter < end; iter++)
     {
-      inData[iter] = replaceVal;
+      if(inData[iter] == removeVal)
+      {
+        inData[iter] = replaceVal;
+      }
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -259,17 +260,33 @@ void ReplaceValueInArray::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReplaceValueInArray::execute()
+ElementwiseKernel::Pointer ReplaceValueInArray::createElementwiseKernel()
 {
   setErrorCondition(0);
   setWarningCondition(0);
   dataCheck();
   if(getErrorCondition() < 0)
+  {
+    return ElementwiseKernel::NullPointer();
+  }
+
+  ElementwiseKernel::Pointer kernel;
+  EXECUTE_FUNCTION_TEMPLATE(this, createReplaceValueKernel, m_ArrayPtr.lock(), m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue, kernel)
+  return kernel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReplaceValueInArray::execute()
+{
+  ElementwiseKernel::Pointer kernel = createElementwiseKernel();
+  if(nullptr == kernel)
   {
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_RemoveValue, m_ReplaceValue)
+  kernel->execute(0, kernel->getNumberOfTuples());
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
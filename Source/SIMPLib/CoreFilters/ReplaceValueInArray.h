@@ -38,12 +38,13 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementwiseKernel.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
  * @brief The ReplaceValueInArray class. See [Filter documentation](@ref replacevalueinarray) for details.
  */
-class SIMPLib_EXPORT ReplaceValueInArray : public AbstractFilter
+class SIMPLib_EXPORT ReplaceValueInArray : public AbstractFilter, public IElementwiseFilter
 {
     Q_OBJECT
     PYB11_CREATE_BINDINGS(ReplaceValueInArray SUPERCLASS AbstractFilter)
@@ -128,6 +129,11 @@ class SIMPLib_EXPORT ReplaceValueInArray : public AbstractFilter
      */
     void execute() override;
 
+    /**
+     * @brief createElementwiseKernel Reimplemented from @see IElementwiseFilter class
+     */
+    ElementwiseKernel::Pointer createElementwiseKernel() override;
+
     /**
     * @brief preflight Reimplemented from @see AbstractFilter class
     */
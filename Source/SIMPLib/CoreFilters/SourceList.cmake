@@ -48,6 +48,7 @@ set(_PublicFilters
   FeatureDataCSVWriter
   FindDerivatives
   GenerateColorTable
+  GenerateSurfaceMesh
   ImportAsciDataArray
   ImportHDF5Dataset
   LinkFeatureMapToElementArray
@@ -65,6 +66,7 @@ set(_PublicFilters
   RenameAttributeArray
   RenameAttributeMatrix
   RenameDataContainer
+  ReorderUnstructuredGeometry
   ReplaceValueInArray
   RequiredZThickness
   ScaleVolume
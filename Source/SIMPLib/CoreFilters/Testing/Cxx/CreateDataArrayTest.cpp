@@ -36,6 +36,8 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 
+#include <vector>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/CoreFilters/CreateDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -341,6 +343,57 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> CreateRandomArray(int seed)
+  {
+    const size_t numTuples = 10000;
+    DataArrayPath path(SIMPL::Defaults::DataContainerName, SIMPL::Defaults::AttributeMatrixName, "RandomArray");
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+    dca->addDataContainer(m);
+    AttributeMatrix::Pointer attrMatrix = AttributeMatrix::New(QVector<size_t>(1, numTuples), SIMPL::Defaults::AttributeMatrixName, AttributeMatrix::Type::Generic);
+    m->addAttributeMatrix(SIMPL::Defaults::AttributeMatrixName, attrMatrix);
+
+    CreateDataArray::Pointer filter = CreateDataArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Float);
+    filter->setNumberOfComponents(3);
+    filter->setNewArray(path);
+    filter->setInitializationType(CreateDataArray::RandomWithRange);
+    filter->setInitializationRange(FPRangePair(-2.0, 5.0));
+    filter->setUseSeed(true);
+    filter->setSeedValue(seed);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0)
+
+    FloatArrayType::Pointer array = attrMatrix->getAttributeArrayAs<FloatArrayType>(path.getDataArrayName());
+    DREAM3D_REQUIRE_VALID_POINTER(array.get())
+    DREAM3D_REQUIRE_EQUAL(array->getSize(), 3 * numTuples)
+    std::vector<float> values(array->getPointer(0), array->getPointer(0) + array->getSize());
+    for(float value : values)
+    {
+      DREAM3D_REQUIRE(value >= -2.0f && value <= 5.0f)
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRandomSeed()
+  {
+    // The same seed must give the same values, independent of how the array is split between threads
+    std::vector<float> first = CreateRandomArray(1234);
+    std::vector<float> second = CreateRandomArray(1234);
+    DREAM3D_REQUIRE(first == second)
+
+    std::vector<float> other = CreateRandomArray(4321);
+    DREAM3D_REQUIRE(first != other)
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -353,6 +406,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestCreateDataArray())
+    DREAM3D_REGISTER_TEST(TestRandomSeed())
   }
 
 private:
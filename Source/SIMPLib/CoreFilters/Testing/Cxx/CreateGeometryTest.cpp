@@ -1303,6 +1303,144 @@ public:
     testCase(createGeometry, dc, hexElementAM, IGeometry::Type::Hexahedral, daHexVert, daHexList, false, true);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CreateGeometryWeldVerticesTest()
+  {
+    // Names and Constants
+
+    static const QString k_DataContainerName("DataContainer");
+    static const QString k_TriVertexMatrixName("TriVertexMatrix");
+    static const QString k_TriElementAttributeMatrixName("TriElementMatrix");
+    static const QString k_TriVertexListDAName("TriVertexList");
+    static const QString k_TriListDAName("TriangleList");
+
+    // Create DataContainerArray
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+
+    // Create DataContainer
+
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dca->addDataContainer(dc);
+
+    // Create a triangle soup: two triangles of a square that store their shared edge twice, and a third triangle
+    // whose first two vertices are closer than the tolerance
+
+    QVector<size_t> numVerts = {9};
+    std::vector<std::vector<float>> vertices = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+                                                {0.0f, 1.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {2.001f, 0.0f, 0.0f}, {3.0f, 1.0f, 0.0f}};
+    std::vector<std::vector<int64_t>> elements = {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+
+    AttributeMatrix::Pointer triVertexAM = AttributeMatrix::New(numVerts, k_TriVertexMatrixName, AttributeMatrix::Type::Any);
+    dc->addAttributeMatrix(k_TriVertexMatrixName, triVertexAM);
+
+    AttributeMatrix::Pointer triElementAM = AttributeMatrix::New(m_Dims3, k_TriElementAttributeMatrixName, AttributeMatrix::Type::Any);
+    dc->addAttributeMatrix(k_TriElementAttributeMatrixName, triElementAM);
+
+    DataArray<float>::Pointer daTriVert = createDataArray<float>(k_TriVertexListDAName, vertices, numVerts, m_Dims3);
+    DataArray<int64_t>::Pointer daTriList = createDataArray<int64_t>(k_TriListDAName, elements, m_Dims3, m_Dims3);
+    triVertexAM->addAttributeArray(k_TriVertexListDAName, daTriVert);
+    triElementAM->addAttributeArray(k_TriListDAName, daTriList);
+
+    // Create Filter
+
+    AbstractFilter::Pointer createGeometry = createFilter();
+
+    // Set up filter
+
+    QVariant var;
+
+    var.setValue(4);
+    bool propWasSet = createGeometry->setProperty("GeometryType", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = createGeometry->setProperty("TreatWarningsAsErrors", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = createGeometry->setProperty("ArrayHandling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(k_DataContainerName);
+    propWasSet = createGeometry->setProperty("DataContainerName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    DataArrayPath dap(k_DataContainerName, k_TriVertexMatrixName, k_TriVertexListDAName);
+    var.setValue(dap);
+    propWasSet = createGeometry->setProperty("SharedVertexListArrayPath2", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    dap = DataArrayPath(k_DataContainerName, k_TriElementAttributeMatrixName, k_TriListDAName);
+    var.setValue(dap);
+    propWasSet = createGeometry->setProperty("SharedTriListArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(SIMPL::Defaults::FaceAttributeMatrixName);
+    propWasSet = createGeometry->setProperty("FaceAttributeMatrixName0", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(SIMPL::Defaults::VertexAttributeMatrixName);
+    propWasSet = createGeometry->setProperty("VertexAttributeMatrixName2", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = createGeometry->setProperty("WeldVertices", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.01f);
+    propWasSet = createGeometry->setProperty("WeldTolerance", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    createGeometry->setDataContainerArray(dca);
+    createGeometry->execute();
+    DREAM3D_REQUIRED(createGeometry->getErrorCondition(), >=, 0)
+
+    // Vertices 3, 4 and 7 are merged into 0, 2 and 6, and the third triangle collapses
+
+    TriangleGeom::Pointer triGeom = dc->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(triGeom.get())
+    DREAM3D_REQUIRE_EQUAL(triGeom->getNumberOfVertices(), 6)
+    DREAM3D_REQUIRE_EQUAL(triGeom->getNumberOfTris(), 2)
+
+    const size_t keptVerts[6] = {0, 1, 2, 5, 6, 8};
+    FloatArrayType::Pointer weldedVerts = triGeom->getVertices();
+    for(size_t v = 0; v < 6; v++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        DREAM3D_REQUIRE_EQUAL(weldedVerts->getComponent(v, d), vertices[keptVerts[v]][d])
+      }
+    }
+
+    const int64_t weldedTris[2][3] = {{0, 1, 2}, {0, 2, 3}};
+    for(size_t t = 0; t < 2; t++)
+    {
+      int64_t verts[3] = {0, 0, 0};
+      triGeom->getVertsAtTri(t, verts);
+      for(size_t k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(verts[k], weldedTris[t][k])
+      }
+    }
+
+    // The attribute matrices that were created for the geometry follow the welded sizes, while the source arrays
+    // that were copied are left untouched
+
+    AttributeMatrix::Pointer vertexAM = dc->getAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName);
+    AttributeMatrix::Pointer faceAM = dc->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(vertexAM.get())
+    DREAM3D_REQUIRE_VALID_POINTER(faceAM.get())
+    DREAM3D_REQUIRE_EQUAL(vertexAM->getNumberOfTuples(), static_cast<size_t>(triGeom->getNumberOfVertices()))
+    DREAM3D_REQUIRE_EQUAL(faceAM->getNumberOfTuples(), static_cast<size_t>(triGeom->getNumberOfTris()))
+    DREAM3D_REQUIRE_EQUAL(daTriVert->getNumberOfTuples(), 9)
+    DREAM3D_REQUIRE_EQUAL(daTriList->getNumberOfTuples(), 3)
+
+    removeGeometry(dc);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1322,6 +1460,7 @@ public:
     DREAM3D_REGISTER_TEST(CreateGeometryQuadTest())
     DREAM3D_REGISTER_TEST(CreateGeometryTetrahedralTest())
     DREAM3D_REGISTER_TEST(CreateGeometryHexahedralTest())
+    DREAM3D_REGISTER_TEST(CreateGeometryWeldVerticesTest())
   }
 
 private:
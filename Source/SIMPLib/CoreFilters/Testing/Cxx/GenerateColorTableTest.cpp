@@ -145,7 +145,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  void CheckPreset(QString presetName, QString presetFilePath, DataContainerArray::Pointer dca)
+  void CheckPreset(QString presetName, QString presetFilePath, DataContainerArray::Pointer dca, int lookupTableResolution = 0, int tolerance = 0)
   {
     // Apply Preset
     {
@@ -153,6 +153,7 @@ public:
       filter->setRgbArrayName("CI_RGB");
       filter->setSelectedDataArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ConfidenceIndex));
       filter->setSelectedPresetName(presetName);
+      filter->setLookupTableResolution(lookupTableResolution);
 
       QJsonArray presetPoints = m_PresetMap.value(filter->getSelectedPresetName());
       DREAM3D_REQUIRE(presetPoints.size() > 0)
@@ -185,7 +186,7 @@ public:
               int exemplar = list[i].toInt(&ok);
               int generated = da->getComponent(currentLine, i);
               DREAM3D_REQUIRE_EQUAL(ok, true)
-              DREAM3D_REQUIRE_EQUAL(exemplar, generated)
+              DREAM3D_REQUIRE(std::abs(exemplar - generated) <= tolerance)
             }
             currentLine++;
           }
@@ -201,10 +202,8 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  int TestGenerateColorTable()
+  DataContainerArray::Pointer CreateTestDataContainerArray()
   {
-    ReadPresets();
-
     DataContainerArray::Pointer dca = DataContainerArray::New();
     DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
     AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, 37989), SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Generic);
@@ -245,6 +244,18 @@ public:
       DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
     }
 
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestGenerateColorTable()
+  {
+    ReadPresets();
+
+    DataContainerArray::Pointer dca = CreateTestDataContainerArray();
+
     CheckPreset("Black, Blue and White", UnitTest::GenerateColorTableTest::BlackBlueWhiteFile, dca);
 
     CheckPreset("Black, Orange and White", UnitTest::GenerateColorTableTest::BlackOrangeWhiteFile, dca);
@@ -278,6 +289,78 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLookupTable()
+  {
+    ReadPresets();
+
+    DataContainerArray::Pointer dca = CreateTestDataContainerArray();
+
+    // The float values are mapped through the sampled lookup table, which stays within one intensity level of the exact colors
+    CheckPreset("Black-Body Radiation", UnitTest::GenerateColorTableTest::BlackBodyRadiationFile, dca, 4096, 1);
+
+    CheckPreset("Grayscale", UnitTest::GenerateColorTableTest::GrayscaleFile, dca, 4096, 1);
+
+    CheckPreset("jet", UnitTest::GenerateColorTableTest::JetFile, dca, 4096, 1);
+
+    CheckPreset("Rainbow Desaturated", UnitTest::GenerateColorTableTest::RainbowDesaturatedFile, dca, 4096, 1);
+
+    // Integer arrays always use one lookup table entry per value and reproduce the exact colors
+    const size_t numTuples = 10000;
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, numTuples), "IntegerData", AttributeMatrix::Type::Generic);
+    dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName)->addAttributeMatrix("IntegerData", am);
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(numTuples, "Values", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      values->setValue(i, static_cast<int32_t>((i * 7919) % 3001) - 1000);
+    }
+    am->addAttributeArray("Values", values);
+
+    QJsonArray presetPoints = m_PresetMap.value("jet");
+    DREAM3D_REQUIRE(presetPoints.size() > 0)
+
+    QVector<UInt8ArrayType::Pointer> colors;
+    for(int lookupTableResolution : {0, 4096, 16})
+    {
+      QString rgbArrayName = QString("RGB_%1").arg(lookupTableResolution);
+      GenerateColorTable::Pointer filter = GenerateColorTable::New();
+      filter->setRgbArrayName(rgbArrayName);
+      filter->setSelectedDataArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, "IntegerData", "Values"));
+      filter->setSelectedPresetName("jet");
+      filter->setSelectedPresetControlPoints(presetPoints);
+      filter->setLookupTableResolution(lookupTableResolution);
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+      UInt8ArrayType::Pointer rgb = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray(rgbArrayName));
+      DREAM3D_REQUIRE(rgb.get() != nullptr)
+      colors.push_back(rgb);
+    }
+
+    for(size_t i = 0; i < numTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(colors[0]->getValue(i), colors[1]->getValue(i))
+      DREAM3D_REQUIRE_EQUAL(colors[0]->getValue(i), colors[2]->getValue(i))
+    }
+
+    // A resolution of 1 can not sample the color table
+    {
+      GenerateColorTable::Pointer filter = GenerateColorTable::New();
+      filter->setRgbArrayName("RGB_Invalid");
+      filter->setSelectedDataArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, "IntegerData", "Values"));
+      filter->setSelectedPresetControlPoints(presetPoints);
+      filter->setLookupTableResolution(1);
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -10001)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -290,6 +373,8 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestGenerateColorTable())
+
+    DREAM3D_REGISTER_TEST(TestLookupTable())
   }
 
 private:
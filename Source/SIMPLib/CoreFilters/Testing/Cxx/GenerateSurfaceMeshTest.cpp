@@ -0,0 +1,309 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/CoreFilters/GenerateSurfaceMesh.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GenerateSurfaceMeshTest
+{
+public:
+  GenerateSurfaceMeshTest() = default;
+  virtual ~GenerateSurfaceMeshTest() = default;
+
+  // The images are large enough to be split into several slabs
+  const size_t k_LabelDims[3] = {48, 40, 100};
+  const size_t k_IsoDims[3] = {48, 48, 64};
+  const float k_Radius = 18.0f;
+
+  // -----------------------------------------------------------------------------
+  // Creates an image whose Feature Ids form blocks with a few random cells, a distance field of a sphere and an
+  // array with 3 components
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray(const size_t dims[3])
+  {
+    std::mt19937_64 generator(1234);
+    size_t numCells = dims[0] * dims[1] * dims[2];
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(dims[0], dims[1], dims[2]);
+    image->setOrigin(1.0f, -2.0f, 0.5f);
+    image->setResolution(0.5f, 0.25f, 1.0f);
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+    dc->setGeometry(image);
+
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(QVector<size_t>(1, numCells), SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer distance = FloatArrayType::CreateArray(numCells, "Distance");
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(numCells, QVector<size_t>(1, 3), "Vectors");
+    vectors->initializeWithZeros();
+    const float center[3] = {23.7f, 24.1f, 31.3f};
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          int32_t label = static_cast<int32_t>(1 + (x / 7 + y / 9 + z / 13) % 4);
+          if(generator() % 50 == 0)
+          {
+            label = static_cast<int32_t>(generator() % 6);
+          }
+          featureIds->setValue(index, label);
+
+          // The distance field is sampled in units of cells
+          float dx = static_cast<float>(x) + 0.5f - center[0];
+          float dy = static_cast<float>(y) + 0.5f - center[1];
+          float dz = static_cast<float>(z) + 0.5f - center[2];
+          distance->setValue(index, k_Radius - std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+      }
+    }
+    cellAttrMat->addAttributeArray(SIMPL::CellData::FeatureIds, featureIds);
+    cellAttrMat->addAttributeArray("Distance", distance);
+    cellAttrMat->addAttributeArray("Vectors", vectors);
+    dc->addAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName, cellAttrMat);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  GenerateSurfaceMesh::Pointer createFilter(DataContainerArray::Pointer dca, int surfaceType)
+  {
+    GenerateSurfaceMesh::Pointer filter = GenerateSurfaceMesh::New();
+    filter->setDataContainerArray(dca);
+    filter->setSurfaceType(surfaceType);
+    filter->setFeatureIdsArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds));
+    filter->setSelectedArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "Distance"));
+    filter->setIsoValue(0.0);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Returns the signed volume of the tetrahedron between the origin and the triangle
+  // -----------------------------------------------------------------------------
+  double signedVolume(TriangleGeom::Pointer triangles, int64_t triId)
+  {
+    int64_t* tri = triangles->getTriPointer(triId);
+    const float* a = triangles->getVertexPointer(tri[0]);
+    const float* b = triangles->getVertexPointer(tri[1]);
+    const float* c = triangles->getVertexPointer(tri[2]);
+    double cross[3] = {static_cast<double>(b[1]) * c[2] - static_cast<double>(b[2]) * c[1], static_cast<double>(b[2]) * c[0] - static_cast<double>(b[0]) * c[2],
+                       static_cast<double>(b[0]) * c[1] - static_cast<double>(b[1]) * c[0]};
+    return (a[0] * cross[0] + a[1] * cross[1] + a[2] * cross[2]) / 6.0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every vertex is stored once, also on the planes between the slabs
+  // -----------------------------------------------------------------------------
+  bool verticesAreUnique(TriangleGeom::Pointer triangles)
+  {
+    std::vector<std::tuple<float, float, float>> coords;
+    for(int64_t i = 0; i < triangles->getNumberOfVertices(); i++)
+    {
+      const float* vert = triangles->getVertexPointer(i);
+      coords.emplace_back(vert[0], vert[1], vert[2]);
+    }
+    std::sort(coords.begin(), coords.end());
+    return std::adjacent_find(coords.begin(), coords.end()) == coords.end();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLabelBoundaries()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(k_LabelDims);
+    GenerateSurfaceMesh::Pointer filter = createFilter(dca, 0);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    // Count the faces between different labels and towards the exterior
+    Int32ArrayType::Pointer featureIds = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName)
+                                             ->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)
+                                             ->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    const size_t strides[3] = {1, k_LabelDims[0], k_LabelDims[0] * k_LabelDims[1]};
+    int64_t numFaces = 0;
+    std::map<int32_t, double> cellCounts;
+    for(size_t z = 0; z < k_LabelDims[2]; z++)
+    {
+      for(size_t y = 0; y < k_LabelDims[1]; y++)
+      {
+        for(size_t x = 0; x < k_LabelDims[0]; x++)
+        {
+          const size_t cell[3] = {x, y, z};
+          size_t index = x + y * strides[1] + z * strides[2];
+          int32_t label = featureIds->getValue(index);
+          cellCounts[label] += 1.0;
+          for(size_t d = 0; d < 3; d++)
+          {
+            numFaces += (cell[d] == 0 || featureIds->getValue(index - strides[d]) != label) ? 1 : 0;
+            numFaces += (cell[d] == k_LabelDims[d] - 1) ? 1 : 0;
+          }
+        }
+      }
+    }
+
+    DataContainer::Pointer surface = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName);
+    TriangleGeom::Pointer triangles = surface->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfTris(), 2 * numFaces)
+    DREAM3D_REQUIRE(verticesAreUnique(triangles))
+    DREAM3D_REQUIRE_EQUAL(surface->getAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName)->getNumberOfTuples(), triangles->getNumberOfVertices())
+    AttributeMatrix::Pointer faceAttrMat = surface->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName);
+    DREAM3D_REQUIRE_EQUAL(faceAttrMat->getNumberOfTuples(), triangles->getNumberOfTris())
+
+    // The normals point from the first label to the second label, so the faces of each label enclose its cells
+    Int32ArrayType::Pointer faceLabels = faceAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::FaceData::SurfaceMeshFaceLabels);
+    std::map<int32_t, double> volumes;
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      double volume = signedVolume(triangles, i);
+      volumes[faceLabels->getComponent(i, 0)] += volume;
+      volumes[faceLabels->getComponent(i, 1)] -= volume;
+    }
+    const double cellVolume = 0.5 * 0.25 * 1.0;
+    for(const auto& count : cellCounts)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes[count.first] - count.second * cellVolume) < 1.0e-3 * count.second * cellVolume)
+    }
+    double totalVolume = static_cast<double>(k_LabelDims[0] * k_LabelDims[1] * k_LabelDims[2]) * cellVolume;
+    DREAM3D_REQUIRE(std::fabs(volumes[-1] + totalVolume) < 1.0e-3 * totalVolume)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIsoSurface()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(k_IsoDims);
+    ImageGeom::Pointer image = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName)->getGeometryAs<ImageGeom>();
+    image->setOrigin(0.0f, 0.0f, 0.0f);
+    image->setResolution(1.0f, 1.0f, 1.0f);
+    GenerateSurfaceMesh::Pointer filter = createFilter(dca, 1);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    DataContainer::Pointer surface = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName);
+    TriangleGeom::Pointer triangles = surface->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE(triangles->getNumberOfTris() > 0)
+    DREAM3D_REQUIRE(verticesAreUnique(triangles))
+
+    // The surface is closed: every edge is used once in each direction
+    std::map<std::pair<int64_t, int64_t>, int> edges;
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      int64_t* tri = triangles->getTriPointer(i);
+      for(int k = 0; k < 3; k++)
+      {
+        edges[std::make_pair(tri[k], tri[(k + 1) % 3])]++;
+        edges[std::make_pair(tri[(k + 1) % 3], tri[k])]--;
+      }
+    }
+    for(const auto& edge : edges)
+    {
+      DREAM3D_REQUIRE_EQUAL(edge.second, 0)
+    }
+
+    // The normals point out of the sphere, where the distance field is above the iso value
+    double volume = 0.0;
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      volume += signedVolume(triangles, i);
+    }
+    double sphereVolume = 4.0 / 3.0 * M_PI * k_Radius * k_Radius * k_Radius;
+    DREAM3D_REQUIRE(std::fabs(volume - sphereVolume) < 0.01 * sphereVolume)
+
+    Int32ArrayType::Pointer faceLabels =
+        surface->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName)->getAttributeArrayAs<Int32ArrayType>(SIMPL::FaceData::SurfaceMeshFaceLabels);
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(i, 0), 1)
+      DREAM3D_REQUIRE_EQUAL(faceLabels->getComponent(i, 1), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInvalidInputs()
+  {
+    size_t dims[3] = {4, 4, 4};
+    DataContainerArray::Pointer dca = createDataContainerArray(dims);
+    GenerateSurfaceMesh::Pointer filter = createFilter(dca, 2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -11910)
+
+    filter->setSurfaceType(1);
+    filter->setSelectedArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "Vectors"));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -11911)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### GenerateSurfaceMeshTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestLabelBoundaries())
+    DREAM3D_REGISTER_TEST(TestIsoSurface())
+    DREAM3D_REGISTER_TEST(TestInvalidInputs())
+  }
+
+private:
+  GenerateSurfaceMeshTest(const GenerateSurfaceMeshTest&); // Copy Constructor Not Implemented
+  void operator=(const GenerateSurfaceMeshTest&);          // Move assignment Not Implemented
+};
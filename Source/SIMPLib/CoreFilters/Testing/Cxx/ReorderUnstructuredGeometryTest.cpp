@@ -0,0 +1,274 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/CoreFilters/ReorderUnstructuredGeometry.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ReorderUnstructuredGeometryTest
+{
+public:
+  ReorderUnstructuredGeometryTest() = default;
+  virtual ~ReorderUnstructuredGeometryTest() = default;
+
+  const int64_t k_Dim = 12;
+
+  // -----------------------------------------------------------------------------
+  // Creates a triangulated grid whose vertices and triangles are stored in random order. Every vertex stores
+  // its coordinates and every triangle its centroid, so the arrays can be checked against the geometry after
+  // it was reordered.
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray()
+  {
+    std::mt19937_64 generator(5678);
+    const int64_t numVerts = (k_Dim + 1) * (k_Dim + 1);
+    const int64_t numTris = 2 * k_Dim * k_Dim;
+
+    std::vector<int64_t> vertexIds(numVerts);
+    std::vector<int64_t> triIds(numTris);
+    for(int64_t i = 0; i < numVerts; i++)
+    {
+      vertexIds[i] = i;
+    }
+    for(int64_t i = 0; i < numTris; i++)
+    {
+      triIds[i] = i;
+    }
+    std::shuffle(vertexIds.begin(), vertexIds.end(), generator);
+    std::shuffle(triIds.begin(), triIds.end(), generator);
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(numVerts);
+    for(int64_t y = 0; y <= k_Dim; y++)
+    {
+      for(int64_t x = 0; x <= k_Dim; x++)
+      {
+        float* vert = vertices->getTuplePointer(vertexIds[y * (k_Dim + 1) + x]);
+        vert[0] = static_cast<float>(x);
+        vert[1] = static_cast<float>(y);
+        vert[2] = 0.0f;
+      }
+    }
+
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(numTris, vertices, SIMPL::Geometry::TriangleGeometry);
+    int64_t count = 0;
+    for(int64_t y = 0; y < k_Dim; y++)
+    {
+      for(int64_t x = 0; x < k_Dim; x++)
+      {
+        int64_t v0 = vertexIds[y * (k_Dim + 1) + x];
+        int64_t v1 = vertexIds[y * (k_Dim + 1) + x + 1];
+        int64_t v2 = vertexIds[(y + 1) * (k_Dim + 1) + x + 1];
+        int64_t v3 = vertexIds[(y + 1) * (k_Dim + 1) + x];
+        int64_t* tri = triangles->getTriPointer(triIds[count++]);
+        tri[0] = v0;
+        tri[1] = v1;
+        tri[2] = v2;
+        tri = triangles->getTriPointer(triIds[count++]);
+        tri[0] = v0;
+        tri[1] = v2;
+        tri[2] = v3;
+      }
+    }
+
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::TriangleDataContainerName);
+    dc->setGeometry(triangles);
+
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(QVector<size_t>(1, numVerts), SIMPL::Defaults::VertexAttributeMatrixName, AttributeMatrix::Type::Vertex);
+    FloatArrayType::Pointer coords = FloatArrayType::CreateArray(numVerts, QVector<size_t>(1, 3), "Coords");
+    std::copy(vertices->getPointer(0), vertices->getPointer(0) + 3 * numVerts, coords->getPointer(0));
+    vertexAttrMat->addAttributeArray("Coords", coords);
+    dc->addAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName, vertexAttrMat);
+
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(QVector<size_t>(1, numTris), SIMPL::Defaults::FaceAttributeMatrixName, AttributeMatrix::Type::Face);
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(numTris, QVector<size_t>(1, 3), "Centroids");
+    for(int64_t i = 0; i < numTris; i++)
+    {
+      computeCentroid(triangles, i, centroids->getTuplePointer(i));
+    }
+    faceAttrMat->addAttributeArray("Centroids", centroids);
+    dc->addAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName, faceAttrMat);
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(std::make_tuple(4, 4, 4));
+    DataContainer::Pointer imageDc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+    imageDc->setGeometry(image);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addDataContainer(dc);
+    dca->addDataContainer(imageDc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void computeCentroid(TriangleGeom::Pointer triangles, int64_t triId, float* centroid)
+  {
+    int64_t* tri = triangles->getTriPointer(triId);
+    for(size_t d = 0; d < 3; d++)
+    {
+      centroid[d] = (triangles->getVertexPointer(tri[0])[d] + triangles->getVertexPointer(tri[1])[d] + triangles->getVertexPointer(tri[2])[d]) / 3.0f;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReorder(int ordering)
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName);
+    TriangleGeom::Pointer triangles = dc->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_EQUAL(triangles->findEdges(), 0)
+    int64_t numEdges = triangles->getNumberOfEdges();
+
+    ReorderUnstructuredGeometry::Pointer filter = ReorderUnstructuredGeometry::New();
+    filter->setDataContainerArray(dca);
+    filter->setDataContainerName(SIMPL::Defaults::TriangleDataContainerName);
+    filter->setElementOrdering(ordering);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    // The vertex and face data moved with the vertices and triangles
+    FloatArrayType::Pointer coords = dc->getAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>("Coords");
+    for(int64_t i = 0; i < triangles->getNumberOfVertices(); i++)
+    {
+      for(int d = 0; d < 3; d++)
+      {
+        DREAM3D_REQUIRE_EQUAL(coords->getComponent(i, d), triangles->getVertexPointer(i)[d])
+      }
+    }
+    FloatArrayType::Pointer centroids = dc->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName)->getAttributeArrayAs<FloatArrayType>("Centroids");
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      float centroid[3] = {0.0f, 0.0f, 0.0f};
+      computeCentroid(triangles, i, centroid);
+      for(int d = 0; d < 3; d++)
+      {
+        DREAM3D_REQUIRE(std::fabs(centroids->getComponent(i, d) - centroid[d]) < 1.0e-5f)
+      }
+    }
+
+    // The edges keep their order and now refer to the new vertex ids; every edge is still 1 or sqrt(2) long
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfEdges(), numEdges)
+    for(int64_t i = 0; i < numEdges; i++)
+    {
+      int64_t verts[2] = {0, 0};
+      triangles->getVertsAtEdge(i, verts);
+      float* a = triangles->getVertexPointer(verts[0]);
+      float* b = triangles->getVertexPointer(verts[1]);
+      float length = std::fabs(a[0] - b[0]) + std::fabs(a[1] - b[1]);
+      DREAM3D_REQUIRE(length == 1.0f || length == 2.0f)
+    }
+
+    // Neighboring triangles are close in memory after the reordering
+    DREAM3D_REQUIRE_EQUAL(triangles->findElementNeighbors(), 0)
+    ElementDynamicList::Pointer neighbors = triangles->getElementNeighbors();
+    int64_t bandwidth = 0;
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      uint16_t count = neighbors->getNumberOfElements(i);
+      int64_t* list = neighbors->getElementListPointer(i);
+      for(uint16_t k = 0; k < count; k++)
+      {
+        bandwidth = std::max(bandwidth, std::abs(list[k] - i));
+      }
+    }
+    DREAM3D_REQUIRE(bandwidth < triangles->getNumberOfTris() / 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSpaceFillingCurve()
+  {
+    TestReorder(static_cast<int>(IGeometry::ElementOrdering::SpaceFillingCurve));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReverseCuthillMcKee()
+  {
+    TestReorder(static_cast<int>(IGeometry::ElementOrdering::ReverseCuthillMcKee));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInvalidInputs()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray();
+    ReorderUnstructuredGeometry::Pointer filter = ReorderUnstructuredGeometry::New();
+    filter->setDataContainerArray(dca);
+
+    filter->setDataContainerName(SIMPL::Defaults::ImageDataContainerName);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -11901)
+
+    filter->setDataContainerName(SIMPL::Defaults::TriangleDataContainerName);
+    filter->setElementOrdering(2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -11900)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ReorderUnstructuredGeometryTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestSpaceFillingCurve())
+    DREAM3D_REGISTER_TEST(TestReverseCuthillMcKee())
+    DREAM3D_REGISTER_TEST(TestInvalidInputs())
+  }
+
+private:
+  ReorderUnstructuredGeometryTest(const ReorderUnstructuredGeometryTest&); // Copy Constructor Not Implemented
+  void operator=(const ReorderUnstructuredGeometryTest&);                  // Move assignment Not Implemented
+};
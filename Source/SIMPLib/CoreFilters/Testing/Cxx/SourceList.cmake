@@ -21,6 +21,7 @@ set(TEST_${SUBDIR_NAME}_NAMES
   FindDerivativesFilterTest
   FeatureDataCSVWriterTest
   GenerateColorTableTest
+  GenerateSurfaceMeshTest
   ImportAsciDataArrayTest
   ImportHDF5DatasetTest
   MultiThresholdObjectsTest
@@ -33,12 +34,14 @@ set(TEST_${SUBDIR_NAME}_NAMES
   RenameAttributeArrayTest
   RenameAttributeMatrixTest
   RenameDataContainerTest
+  ReorderUnstructuredGeometryTest
   ReplaceValueTest
   RequiredZThicknessTest
   ScaleVolumeTest
   SetOriginResolutionImageGeomTest
   SplitAttributeArrayTest
   WriteASCIIDataTest
+  WriteTriangleGeometryTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
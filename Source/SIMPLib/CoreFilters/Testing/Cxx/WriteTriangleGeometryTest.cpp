@@ -0,0 +1,312 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+
+#include "SIMPLib/CoreFilters/WriteTriangleGeometry.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class WriteTriangleGeometryTest
+{
+public:
+  WriteTriangleGeometryTest() = default;
+  virtual ~WriteTriangleGeometryTest() = default;
+
+  const int64_t k_NumVerts = 4;
+  const int64_t k_NumTris = 4;
+  const float k_Coords[12] = {0.1234567f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  const int64_t k_Tris[12] = {0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3};
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString outputFile(const QString& name)
+  {
+    return UnitTest::TestTempDir + "/WriteTriangleGeometryTest/" + name;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(outputFile("Nodes.txt"));
+    QFile::remove(outputFile("Triangles.txt"));
+    QFile::remove(outputFile("Surface.ply"));
+    QFile::remove(outputFile("Surface.stl"));
+    QFile::remove(outputFile("Compact.stl"));
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Creates a tetrahedron with outward facing triangles and 2 Face Labels per triangle
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray(bool compact)
+  {
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(k_NumVerts);
+    std::memcpy(vertices->getPointer(0), k_Coords, sizeof(k_Coords));
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(k_NumTris, vertices, SIMPL::Geometry::TriangleGeometry);
+    for(int64_t i = 0; i < 3 * k_NumTris; i++)
+    {
+      triangles->getTriPointer(0)[i] = k_Tris[i];
+    }
+    if(compact)
+    {
+      DREAM3D_REQUIRE_EQUAL(triangles->setCompactConnectivity(true), 0)
+    }
+
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::TriangleDataContainerName);
+    dc->setGeometry(triangles);
+
+    AttributeMatrix::Pointer faceAttrMat = AttributeMatrix::New(QVector<size_t>(1, k_NumTris), SIMPL::Defaults::FaceAttributeMatrixName, AttributeMatrix::Type::Face);
+    Int32ArrayType::Pointer faceLabels = Int32ArrayType::CreateArray(k_NumTris, QVector<size_t>(1, 2), SIMPL::FaceData::SurfaceMeshFaceLabels);
+    FloatArrayType::Pointer areas = FloatArrayType::CreateArray(k_NumTris, "Areas");
+    areas->initializeWithZeros();
+    for(int64_t i = 0; i < k_NumTris; i++)
+    {
+      faceLabels->setComponent(i, 0, static_cast<int32_t>(i + 1));
+      faceLabels->setComponent(i, 1, -1);
+    }
+    faceAttrMat->addAttributeArray(SIMPL::FaceData::SurfaceMeshFaceLabels, faceLabels);
+    faceAttrMat->addAttributeArray("Areas", areas);
+    dc->addAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName, faceAttrMat);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  WriteTriangleGeometry::Pointer createFilter(DataContainerArray::Pointer dca, int outputFormat, const QString& fileName)
+  {
+    WriteTriangleGeometry::Pointer filter = WriteTriangleGeometry::New();
+    filter->setDataContainerArray(dca);
+    filter->setDataContainerSelection(SIMPL::Defaults::TriangleDataContainerName);
+    filter->setOutputFormat(outputFormat);
+    filter->setOutputNodesFile(outputFile("Nodes.txt"));
+    filter->setOutputTrianglesFile(outputFile("Triangles.txt"));
+    filter->setOutputFile(outputFile(fileName));
+    filter->setWriteFaceLabels(true);
+    filter->setFaceLabelsArrayPath(DataArrayPath(SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceLabels));
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray readFile(const QString& filePath)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE(file.open(QIODevice::ReadOnly))
+    return file.readAll();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> T readValue(const QByteArray& data, int offset)
+  {
+    T value;
+    std::memcpy(&value, data.constData() + offset, sizeof(T));
+    return value;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAsciiFiles()
+  {
+    WriteTriangleGeometry::Pointer filter = createFilter(createDataContainerArray(false), 0, "");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    QList<QByteArray> nodes = readFile(outputFile("Nodes.txt")).split('\n');
+    DREAM3D_REQUIRE(nodes.contains("Node Count: 4"))
+    DREAM3D_REQUIRE_EQUAL(nodes.size(), 10)
+    DREAM3D_REQUIRE(nodes[5] == " 0.12346  0.00000  0.00000")
+    DREAM3D_REQUIRE(nodes[8] == " 0.00000  0.00000  1.00000")
+
+    QList<QByteArray> triangles = readFile(outputFile("Triangles.txt")).split('\n');
+    DREAM3D_REQUIRE(triangles.contains("Triangle Count: 4"))
+    DREAM3D_REQUIRE_EQUAL(triangles.size(), 14)
+    DREAM3D_REQUIRE(triangles[9] == "0 2 1")
+    DREAM3D_REQUIRE(triangles[12] == "1 2 3")
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBinaryPly()
+  {
+    WriteTriangleGeometry::Pointer filter = createFilter(createDataContainerArray(true), 1, "Surface.ply");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    QByteArray data = readFile(outputFile("Surface.ply"));
+    int headerEnd = data.indexOf("end_header\n") + 11;
+    DREAM3D_REQUIRE(headerEnd > 11)
+    QByteArray header = data.left(headerEnd);
+    DREAM3D_REQUIRE(header.startsWith("ply\nformat binary_little_endian 1.0\n"))
+    DREAM3D_REQUIRE(header.contains("element vertex 4\n"))
+    DREAM3D_REQUIRE(header.contains("element face 4\n"))
+    DREAM3D_REQUIRE(header.contains("property int label1\n"))
+
+    const int faceBytes = 1 + 5 * 4;
+    DREAM3D_REQUIRE_EQUAL(data.size(), headerEnd + 12 * 4 + k_NumTris * faceBytes)
+    for(int i = 0; i < 12; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readValue<float>(data, headerEnd + 4 * i), k_Coords[i])
+    }
+    int facesStart = headerEnd + 12 * 4;
+    for(int i = 0; i < k_NumTris; i++)
+    {
+      int offset = facesStart + i * faceBytes;
+      DREAM3D_REQUIRE_EQUAL(static_cast<int>(data[offset]), 3)
+      for(int j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readValue<int32_t>(data, offset + 1 + 4 * j), k_Tris[3 * i + j])
+      }
+      DREAM3D_REQUIRE_EQUAL(readValue<int32_t>(data, offset + 13), i + 1)
+      DREAM3D_REQUIRE_EQUAL(readValue<int32_t>(data, offset + 17), -1)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBinaryStl()
+  {
+    WriteTriangleGeometry::Pointer filter = createFilter(createDataContainerArray(false), 2, "Surface.stl");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    QByteArray data = readFile(outputFile("Surface.stl"));
+    DREAM3D_REQUIRE_EQUAL(data.size(), 84 + k_NumTris * 50)
+    DREAM3D_REQUIRE(!data.startsWith("solid"))
+    DREAM3D_REQUIRE_EQUAL(static_cast<int64_t>(readValue<uint32_t>(data, 80)), k_NumTris)
+    for(int i = 0; i < k_NumTris; i++)
+    {
+      int offset = 84 + i * 50;
+      const float* v0 = k_Coords + 3 * k_Tris[3 * i];
+      for(int j = 0; j < 3; j++)
+      {
+        for(int k = 0; k < 3; k++)
+        {
+          DREAM3D_REQUIRE_EQUAL(readValue<float>(data, offset + 12 + 12 * j + 4 * k), k_Coords[3 * k_Tris[3 * i + j] + k])
+        }
+      }
+
+      // The normals have unit length and point away from the inside of the tetrahedron
+      float normal[3] = {readValue<float>(data, offset), readValue<float>(data, offset + 4), readValue<float>(data, offset + 8)};
+      float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+      DREAM3D_REQUIRE(std::fabs(length - 1.0f) < 1.0e-5f)
+      float inside[3] = {0.25f - v0[0], 0.25f - v0[1], 0.25f - v0[2]};
+      DREAM3D_REQUIRE(normal[0] * inside[0] + normal[1] * inside[1] + normal[2] * inside[2] < 0.0f)
+      DREAM3D_REQUIRE_EQUAL(static_cast<int>(readValue<uint16_t>(data, offset + 48)), i + 1)
+    }
+
+    // A geometry with compact connectivity is written without expanding it
+    DataContainerArray::Pointer dca = createDataContainerArray(true);
+    filter = createFilter(dca, 2, "Compact.stl");
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    DREAM3D_REQUIRE(readFile(outputFile("Compact.stl")) == data)
+    TriangleGeom::Pointer triangles = dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE(triangles->getCompactTriangles().get() != nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInvalidInputs()
+  {
+    DataContainerArray::Pointer dca = createDataContainerArray(false);
+    WriteTriangleGeometry::Pointer filter = createFilter(dca, 1, "");
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -381)
+
+    filter->setOutputFile(outputFile("Surface.ply"));
+    filter->setFaceLabelsArrayPath(DataArrayPath(SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, "Areas"));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -384)
+
+    dca->getDataContainer(SIMPL::Defaults::TriangleDataContainerName)->getAttributeMatrix(SIMPL::Defaults::FaceAttributeMatrixName)->resizeAttributeArrays(QVector<size_t>(1, 2));
+    filter->setFaceLabelsArrayPath(DataArrayPath(SIMPL::Defaults::TriangleDataContainerName, SIMPL::Defaults::FaceAttributeMatrixName, SIMPL::FaceData::SurfaceMeshFaceLabels));
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -385)
+
+    filter->setOutputFormat(3);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -383)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### WriteTriangleGeometryTest Starting ####" << std::endl;
+
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestAsciiFiles())
+    DREAM3D_REGISTER_TEST(TestBinaryPly())
+    DREAM3D_REGISTER_TEST(TestBinaryStl())
+    DREAM3D_REGISTER_TEST(TestInvalidInputs())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  WriteTriangleGeometryTest(const WriteTriangleGeometryTest&); // Copy Constructor Not Implemented
+  void operator=(const WriteTriangleGeometryTest&);            // Move assignment Not Implemented
+};
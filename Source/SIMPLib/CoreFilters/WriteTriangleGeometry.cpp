@@ -35,20 +35,170 @@
 
 #include "WriteTriangleGeometry.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
-#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
 
 #define WRITE_EDGES_FILE 0
 
+namespace
+{
+const size_t k_ChunkElements = 1048576;
+const size_t k_FormatBlockElements = 16384;
+
+/**
+ * @brief Writes count elements to the file. The elements are formatted in chunks, and the blocks of each chunk
+ * are formatted in parallel by format(start, end, buffer), which replaces the contents of buffer with the bytes
+ * of the elements [start, end). The blocks are written in order, so the file does not depend on the number of
+ * threads, and the buffers are reused between the chunks, so the memory does not grow with the mesh.
+ * @param file
+ * @param count
+ * @param format
+ * @return false if the file could not be written
+ */
+template <typename FormatType> bool WriteElements(FILE* file, size_t count, const FormatType& format)
+{
+  std::vector<std::vector<char>> buffers(k_ChunkElements / k_FormatBlockElements);
+  for(size_t chunkStart = 0; chunkStart < count; chunkStart += k_ChunkElements)
+  {
+    size_t chunkEnd = std::min(chunkStart + k_ChunkElements, count);
+    size_t numBlocks = (chunkEnd - chunkStart + k_FormatBlockElements - 1) / k_FormatBlockElements;
+    GeometryHelpers::ForEachElementBlock(numBlocks, 1, [&](size_t start, size_t end) {
+      for(size_t b = start; b < end; b++)
+      {
+        size_t blockStart = chunkStart + b * k_FormatBlockElements;
+        format(blockStart, std::min(blockStart + k_FormatBlockElements, chunkEnd), buffers[b]);
+      }
+    });
+    for(size_t b = 0; b < numBlocks; b++)
+    {
+      if(fwrite(buffers[b].data(), 1, buffers[b].size(), file) != buffers[b].size())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Copies a value in little endian byte order to the buffer
+ * @param value
+ * @param buffer
+ * @return The position after the value
+ */
+template <typename T> char* WriteLittleEndian(T value, char* buffer)
+{
+  SIMPLib::Endian::FromSystemToLittle::convert(value);
+  std::memcpy(buffer, &value, sizeof(T));
+  return buffer + sizeof(T);
+}
+
+/**
+ * @brief Formats the triangles [start, end) as lines of 3 node ids
+ */
+template <typename L> void FormatAsciiTriangles(const L* tris, size_t start, size_t end, std::vector<char>& buffer)
+{
+  buffer.clear();
+  char line[96];
+  for(size_t i = start; i < end; i++)
+  {
+    int length = snprintf(line, sizeof(line), "%lld %lld %lld\n", static_cast<long long int>(tris[3 * i]), static_cast<long long int>(tris[3 * i + 1]),
+                          static_cast<long long int>(tris[3 * i + 2]));
+    buffer.insert(buffer.end(), line, line + length);
+  }
+}
+
+/**
+ * @brief Formats the triangles [start, end) as PLY faces, each a vertex count, 3 int vertex ids and the
+ * components of its label
+ */
+template <typename L> void FormatPlyFaces(const L* tris, const int32_t* labels, size_t numLabelComps, size_t start, size_t end, std::vector<char>& buffer)
+{
+  const size_t faceBytes = 1 + 3 * sizeof(int32_t) + numLabelComps * sizeof(int32_t);
+  buffer.resize((end - start) * faceBytes);
+  char* out = buffer.data();
+  for(size_t i = start; i < end; i++)
+  {
+    *out++ = 3;
+    for(size_t j = 0; j < 3; j++)
+    {
+      out = WriteLittleEndian(static_cast<int32_t>(tris[3 * i + j]), out);
+    }
+    for(size_t j = 0; j < numLabelComps; j++)
+    {
+      out = WriteLittleEndian(labels[numLabelComps * i + j], out);
+    }
+  }
+}
+
+/**
+ * @brief Formats the triangles [start, end) as 50 byte STL facets: the unit normal, the 3 vertices and the
+ * attribute field, which holds the low 16 bits of the first label component if labels are given
+ */
+template <typename L> void FormatStlFacets(const float* verts, const L* tris, const int32_t* labels, size_t numLabelComps, size_t start, size_t end, std::vector<char>& buffer)
+{
+  const size_t facetBytes = 12 * sizeof(float) + sizeof(uint16_t);
+  buffer.resize((end - start) * facetBytes);
+  char* out = buffer.data();
+  for(size_t i = start; i < end; i++)
+  {
+    const float* v0 = verts + 3 * tris[3 * i];
+    const float* v1 = verts + 3 * tris[3 * i + 1];
+    const float* v2 = verts + 3 * tris[3 * i + 2];
+    float a[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+    float b[3] = {v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]};
+    float normal[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    float scale = length > 0.0f ? 1.0f / length : 0.0f;
+    for(size_t j = 0; j < 3; j++)
+    {
+      out = WriteLittleEndian(normal[j] * scale, out);
+    }
+    for(const float* v : {v0, v1, v2})
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        out = WriteLittleEndian(v[j], out);
+      }
+    }
+    uint16_t attribute = (labels != nullptr) ? static_cast<uint16_t>(labels[numLabelComps * i]) : 0;
+    out = WriteLittleEndian(attribute, out);
+  }
+}
+
+/**
+ * @brief Writes the triangles of the geometry with the element writer, which is called with the 64 bit or the
+ * compact 32 bit vertex ids. A compact list is read in place instead of being expanded.
+ */
+template <typename WriterType> bool WriteTriangles(TriangleGeom* triangleGeom, const WriterType& writer)
+{
+  CompactTriList::Pointer compactTris = triangleGeom->getCompactTriangles();
+  if(compactTris.get() != nullptr)
+  {
+    return writer(compactTris->getPointer(0));
+  }
+  return writer(triangleGeom->getTriangles()->getPointer(0));
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,6 +206,10 @@ WriteTriangleGeometry::WriteTriangleGeometry()
 : m_DataContainerSelection("")
 , m_OutputNodesFile("")
 , m_OutputTrianglesFile("")
+, m_OutputFormat(0)
+, m_OutputFile("")
+, m_WriteFaceLabels(false)
+, m_FaceLabelsArrayPath("", "", "")
 {
 }
 
@@ -71,13 +225,27 @@ void WriteTriangleGeometry::setupFilterParameters()
 {
   FilterParameterVector parameters;
 
+  {
+    QVector<QString> choices = {"ASCII Nodes and Triangles Files", "Binary PLY", "Binary STL"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Output Format", OutputFormat, FilterParameter::Parameter, WriteTriangleGeometry, choices, false));
+  }
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Nodes File", OutputNodesFile, FilterParameter::Parameter, WriteTriangleGeometry));
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Triangles File", OutputTrianglesFile, FilterParameter::Parameter, WriteTriangleGeometry));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output PLY/STL File", OutputFile, FilterParameter::Parameter, WriteTriangleGeometry, "*.ply *.stl", "PLY or STL File"));
 
   {
     DataContainerSelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DC_SELECTION_FP("DataContainer", DataContainerSelection, FilterParameter::RequiredArray, WriteTriangleGeometry, req));
   }
+  {
+    QStringList linkedProps = {"FaceLabelsArrayPath"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Write Face Labels", WriteFaceLabels, FilterParameter::Parameter, WriteTriangleGeometry, linkedProps));
+  }
+  parameters.push_back(SeparatorFilterParameter::New("Face Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Face, IGeometry::Type::Triangle);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Face Labels", FaceLabelsArrayPath, FilterParameter::RequiredArray, WriteTriangleGeometry, req));
+  }
 
   setFilterParameters(parameters);
 }
@@ -91,6 +259,10 @@ void WriteTriangleGeometry::readFilterParameters(AbstractFilterParametersReader*
   setDataContainerSelection(reader->readString("DataContainerSelection", getDataContainerSelection()));
   setOutputNodesFile(reader->readString("OutputNodesFile", getOutputNodesFile()));
   setOutputTrianglesFile(reader->readString("OutputTrianglesFile", getOutputTrianglesFile()));
+  setOutputFormat(reader->readValue("OutputFormat", getOutputFormat()));
+  setOutputFile(reader->readString("OutputFile", getOutputFile()));
+  setWriteFaceLabels(reader->readValue("WriteFaceLabels", getWriteFaceLabels()));
+  setFaceLabelsArrayPath(reader->readDataArrayPath("FaceLabelsArrayPath", getFaceLabelsArrayPath()));
   reader->closeFilterGroup();
 }
 
@@ -109,16 +281,31 @@ void WriteTriangleGeometry::dataCheck()
   setErrorCondition(0);
   setWarningCondition(0);
 
-  if(true == m_OutputNodesFile.isEmpty())
+  if(m_OutputFormat < 0 || m_OutputFormat > 2)
   {
-    setErrorCondition(-380);
-    notifyErrorMessage(getHumanLabel(), "The output Nodes file needs to be set", getErrorCondition());
+    setErrorCondition(-383);
+    notifyErrorMessage(getHumanLabel(), "The Output Format must be ASCII, Binary PLY or Binary STL", getErrorCondition());
+    return;
   }
 
-  if(true == m_OutputTrianglesFile.isEmpty())
+  if(m_OutputFormat == 0)
+  {
+    if(true == m_OutputNodesFile.isEmpty())
+    {
+      setErrorCondition(-380);
+      notifyErrorMessage(getHumanLabel(), "The output Nodes file needs to be set", getErrorCondition());
+    }
+
+    if(true == m_OutputTrianglesFile.isEmpty())
+    {
+      setErrorCondition(-382);
+      notifyErrorMessage(getHumanLabel(), "The output Triangles file needs to be set", getErrorCondition());
+    }
+  }
+  else if(true == m_OutputFile.isEmpty())
   {
-    setErrorCondition(-382);
-    notifyErrorMessage(getHumanLabel(), "The output Triangles file needs to be set", getErrorCondition());
+    setErrorCondition(-381);
+    notifyErrorMessage(getHumanLabel(), "The output PLY/STL file needs to be set", getErrorCondition());
   }
 
   DataContainer::Pointer dataContainer = getDataContainerArray()->getPrereqDataContainer(this, getDataContainerSelection());
@@ -139,12 +326,34 @@ void WriteTriangleGeometry::dataCheck()
     setErrorCondition(-386);
     notifyErrorMessage(getHumanLabel(), "DataContainer Geometry missing Vertices", getErrorCondition());
   }
-  // We MUST have Triangles defined also.
-  if(nullptr == triangles->getTriangles().get())
+  // We MUST have Triangles defined also. A compact list is checked first so that it is not expanded.
+  if(nullptr == triangles->getCompactTriangles().get() && nullptr == triangles->getTriangles().get())
   {
     setErrorCondition(-387);
     notifyErrorMessage(getHumanLabel(), "DataContainer Geometry missing Triangles", getErrorCondition());
   }
+  if(getErrorCondition() < 0 || m_OutputFormat == 0 || !m_WriteFaceLabels)
+  {
+    return;
+  }
+
+  m_FaceLabelsPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getFaceLabelsArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  if(nullptr == std::dynamic_pointer_cast<Int32ArrayType>(m_FaceLabelsPtr.lock()))
+  {
+    setErrorCondition(-384);
+    notifyErrorMessage(getHumanLabel(), "The Face Labels must be a 32 bit integer array", getErrorCondition());
+    return;
+  }
+  if(m_FaceLabelsPtr.lock()->getNumberOfTuples() != static_cast<size_t>(triangles->getNumberOfTris()))
+  {
+    setErrorCondition(-385);
+    QString ss = QObject::tr("The Face Labels have %1 tuples but the Triangle Geometry has %2 triangles").arg(m_FaceLabelsPtr.lock()->getNumberOfTuples()).arg(triangles->getNumberOfTris());
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -163,48 +372,45 @@ void WriteTriangleGeometry::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void WriteTriangleGeometry::execute()
+FILE* WriteTriangleGeometry::openOutputFile(const QString& filePath)
 {
-  int err = 0;
-  setErrorCondition(err);
-
-  dataCheck();
-  if(getErrorCondition() < 0)
+  // Make sure any directory path is also available as the user may have just typed
+  // in a path without actually creating the full path
+  QFileInfo fi(filePath);
+  QDir parentPath = fi.path();
+  if(!parentPath.mkpath("."))
   {
-    return;
+    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
+    setErrorCondition(-1);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return nullptr;
   }
-  DataContainer::Pointer dataContainer = getDataContainerArray()->getPrereqDataContainer(this, getDataContainerSelection());
+  FILE* file = fopen(filePath.toLatin1().data(), "wb");
+  if(nullptr == file)
+  {
+    setErrorCondition(-100);
+    notifyErrorMessage(getHumanLabel(), QObject::tr("Error opening '%1' for writing").arg(filePath), getErrorCondition());
+  }
+  return file;
+}
 
-  TriangleGeom::Pointer triangleGeom = dataContainer->getGeometryAs<TriangleGeom>();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::writeAsciiFiles(TriangleGeom* triangleGeom)
+{
   QString geometryType = triangleGeom->getGeometryTypeAsString();
-  float* nodes = triangleGeom->getVertexPointer(0);
-  int64_t* triangles = triangleGeom->getTriPointer(0);
+  const float* nodes = triangleGeom->getVertexPointer(0);
 
   qint64 numNodes = triangleGeom->getNumberOfVertices();
   qint64 maxNodeId = numNodes - 1;
   int64_t numTriangles = triangleGeom->getNumberOfTris();
 
   // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
-  // Make sure any directory path is also available as the user may have just typed
-  // in a path without actually creating the full path
   notifyStatusMessage(getHumanLabel(), "Writing Nodes Text File");
-  QFileInfo fi(getOutputNodesFile());
-  QDir parentPath = fi.path();
-
-  if(!parentPath.mkpath("."))
-  {
-
-    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
-    setErrorCondition(-1);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  FILE* nodesFile = nullptr;
-  nodesFile = fopen(getOutputNodesFile().toLatin1().data(), "wb");
+  FILE* nodesFile = openOutputFile(getOutputNodesFile());
   if(nullptr == nodesFile)
   {
-    setErrorCondition(-100);
-    notifyErrorMessage(getHumanLabel(), "Error opening Nodes file for writing", -100);
     return;
   }
   fprintf(nodesFile, "# All lines starting with '#' are comments\n");
@@ -212,29 +418,28 @@ void WriteTriangleGeometry::execute()
   fprintf(nodesFile, "# DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
   fprintf(nodesFile, "# Node Data is X Y Z space delimited.\n");
   fprintf(nodesFile, "Node Count: %lld\n", numNodes);
-  for(int i = 0; i < numNodes; i++)
+  bool written = WriteElements(nodesFile, static_cast<size_t>(numNodes), [nodes](size_t start, size_t end, std::vector<char>& buffer) {
+    buffer.clear();
+    char line[128];
+    for(size_t i = start; i < end; i++)
+    {
+      int length = snprintf(line, sizeof(line), "%8.5f %8.5f %8.5f\n", nodes[i * 3], nodes[i * 3 + 1], nodes[i * 3 + 2]);
+      buffer.insert(buffer.end(), line, line + length);
+    }
+  });
+  fclose(nodesFile);
+  if(!written)
   {
-    fprintf(nodesFile, "%8.5f %8.5f %8.5f\n", nodes[i * 3], nodes[i * 3 + 1], nodes[i * 3 + 2]);
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), "Error writing the Nodes file", getErrorCondition());
+    return;
   }
-  fclose(nodesFile);
 
   // ++++++++++++++ Write the Triangles File +++++++++++++++++++++++++++++++++++++++++++
   notifyStatusMessage(getHumanLabel(), "Writing Triangles Text File");
-  QFileInfo triFI(getOutputTrianglesFile());
-  parentPath = triFI.path();
-  if(!parentPath.mkpath("."))
-  {
-
-    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
-    setErrorCondition(-1);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  FILE* triFile = fopen(getOutputTrianglesFile().toLatin1().data(), "wb");
+  FILE* triFile = openOutputFile(getOutputTrianglesFile());
   if(nullptr == triFile)
   {
-    setErrorCondition(-100);
-    notifyErrorMessage(getHumanLabel(), "Error opening Triangles file for writing", -100);
     return;
   }
 
@@ -248,17 +453,155 @@ void WriteTriangleGeometry::execute()
   fprintf(triFile, "Max Node Id: %lld\n", maxNodeId);
   fprintf(triFile, "Triangle Count: %lld\n", (long long int)(numTriangles));
 
-  int n1, n2, n3;
-  for(int64_t j = 0; j < numTriangles; ++j)
+  written = WriteTriangles(triangleGeom, [=](const auto* tris) {
+    return WriteElements(triFile, static_cast<size_t>(numTriangles), [tris](size_t start, size_t end, std::vector<char>& buffer) { FormatAsciiTriangles(tris, start, end, buffer); });
+  });
+  fclose(triFile);
+  if(!written)
   {
-    n1 = triangles[j * 3];
-    n2 = triangles[j * 3 + 1];
-    n3 = triangles[j * 3 + 2];
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), "Error writing the Triangles file", getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::writePlyFile(TriangleGeom* triangleGeom)
+{
+  const float* nodes = triangleGeom->getVertexPointer(0);
+  size_t numNodes = static_cast<size_t>(triangleGeom->getNumberOfVertices());
+  size_t numTriangles = static_cast<size_t>(triangleGeom->getNumberOfTris());
 
-    fprintf(triFile, "%d %d %d\n", n1, n2, n3);
+  // The vertex ids of a face are stored as 32 bit integers
+  if(numNodes > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+  {
+    setErrorCondition(-388);
+    notifyErrorMessage(getHumanLabel(), "A PLY file can not reference more than 2147483647 vertices", getErrorCondition());
+    return;
   }
 
-  fclose(triFile);
+  Int32ArrayType::Pointer faceLabels = m_WriteFaceLabels ? std::dynamic_pointer_cast<Int32ArrayType>(m_FaceLabelsPtr.lock()) : Int32ArrayType::NullPointer();
+  const int32_t* labels = (faceLabels.get() != nullptr) ? faceLabels->getPointer(0) : nullptr;
+  size_t numLabelComps = (faceLabels.get() != nullptr) ? static_cast<size_t>(faceLabels->getNumberOfComponents()) : 0;
+
+  notifyStatusMessage(getHumanLabel(), "Writing PLY File");
+  FILE* file = openOutputFile(getOutputFile());
+  if(nullptr == file)
+  {
+    return;
+  }
+  fprintf(file, "ply\n");
+  fprintf(file, "format binary_little_endian 1.0\n");
+  fprintf(file, "comment DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
+  fprintf(file, "element vertex %llu\n", static_cast<unsigned long long int>(numNodes));
+  fprintf(file, "property float x\n");
+  fprintf(file, "property float y\n");
+  fprintf(file, "property float z\n");
+  fprintf(file, "element face %llu\n", static_cast<unsigned long long int>(numTriangles));
+  fprintf(file, "property list uchar int vertex_indices\n");
+  for(size_t j = 0; j < numLabelComps; j++)
+  {
+    fprintf(file, "property int label%llu\n", static_cast<unsigned long long int>(j));
+  }
+  fprintf(file, "end_header\n");
+
+  bool written = WriteElements(file, numNodes, [nodes](size_t start, size_t end, std::vector<char>& buffer) {
+    buffer.resize((end - start) * 3 * sizeof(float));
+    char* out = buffer.data();
+    for(size_t i = 3 * start; i < 3 * end; i++)
+    {
+      out = WriteLittleEndian(nodes[i], out);
+    }
+  });
+  written = written && WriteTriangles(triangleGeom, [=](const auto* tris) {
+    return WriteElements(file, numTriangles, [=](size_t start, size_t end, std::vector<char>& buffer) { FormatPlyFaces(tris, labels, numLabelComps, start, end, buffer); });
+  });
+  fclose(file);
+  if(!written)
+  {
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), "Error writing the PLY file", getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::writeStlFile(TriangleGeom* triangleGeom)
+{
+  const float* nodes = triangleGeom->getVertexPointer(0);
+  size_t numTriangles = static_cast<size_t>(triangleGeom->getNumberOfTris());
+
+  // The number of facets is stored as a 32 bit integer
+  if(numTriangles > static_cast<size_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    setErrorCondition(-389);
+    notifyErrorMessage(getHumanLabel(), "An STL file can not hold more than 4294967295 triangles", getErrorCondition());
+    return;
+  }
+
+  Int32ArrayType::Pointer faceLabels = m_WriteFaceLabels ? std::dynamic_pointer_cast<Int32ArrayType>(m_FaceLabelsPtr.lock()) : Int32ArrayType::NullPointer();
+  const int32_t* labels = (faceLabels.get() != nullptr) ? faceLabels->getPointer(0) : nullptr;
+  size_t numLabelComps = (faceLabels.get() != nullptr) ? static_cast<size_t>(faceLabels->getNumberOfComponents()) : 0;
+
+  notifyStatusMessage(getHumanLabel(), "Writing STL File");
+  FILE* file = openOutputFile(getOutputFile());
+  if(nullptr == file)
+  {
+    return;
+  }
+
+  // The 80 byte header must not start with "solid", which marks an ASCII STL file
+  char header[80];
+  std::memset(header, 0, sizeof(header));
+  snprintf(header, sizeof(header), "DREAM.3D Version %s", SIMPLib::Version::Complete().toLatin1().constData());
+  char count[sizeof(uint32_t)];
+  WriteLittleEndian(static_cast<uint32_t>(numTriangles), count);
+  bool written = (fwrite(header, 1, sizeof(header), file) == sizeof(header)) && (fwrite(count, 1, sizeof(count), file) == sizeof(count));
+  written = written && WriteTriangles(triangleGeom, [=](const auto* tris) {
+    return WriteElements(file, numTriangles, [=](size_t start, size_t end, std::vector<char>& buffer) { FormatStlFacets(nodes, tris, labels, numLabelComps, start, end, buffer); });
+  });
+  fclose(file);
+  if(!written)
+  {
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), "Error writing the STL file", getErrorCondition());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::execute()
+{
+  int err = 0;
+  setErrorCondition(err);
+
+  dataCheck();
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  DataContainer::Pointer dataContainer = getDataContainerArray()->getPrereqDataContainer(this, getDataContainerSelection());
+  TriangleGeom::Pointer triangleGeom = dataContainer->getGeometryAs<TriangleGeom>();
+
+  switch(m_OutputFormat)
+  {
+  case 1:
+    writePlyFile(triangleGeom.get());
+    break;
+  case 2:
+    writeStlFile(triangleGeom.get());
+    break;
+  default:
+    writeAsciiFiles(triangleGeom.get());
+    break;
+  }
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
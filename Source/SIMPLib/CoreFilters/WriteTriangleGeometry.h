@@ -43,6 +43,7 @@
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
@@ -59,6 +60,10 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
     PYB11_PROPERTY(QString DataContainerSelection READ getDataContainerSelection WRITE setDataContainerSelection)
     PYB11_PROPERTY(QString OutputNodesFile READ getOutputNodesFile WRITE setOutputNodesFile)
     PYB11_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
+    PYB11_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
+    PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+    PYB11_PROPERTY(bool WriteFaceLabels READ getWriteFaceLabels WRITE setWriteFaceLabels)
+    PYB11_PROPERTY(DataArrayPath FaceLabelsArrayPath READ getFaceLabelsArrayPath WRITE setFaceLabelsArrayPath)
 
   public:
     SIMPL_SHARED_POINTERS(WriteTriangleGeometry)
@@ -76,6 +81,22 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
     SIMPL_FILTER_PARAMETER(QString, OutputTrianglesFile)
     Q_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
 
+    /**
+     * @brief OutputFormat 0 writes the ASCII Nodes and Triangles files, 1 writes a binary PLY file and 2 writes
+     * a binary STL file
+     */
+    SIMPL_FILTER_PARAMETER(int, OutputFormat)
+    Q_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
+
+    SIMPL_FILTER_PARAMETER(QString, OutputFile)
+    Q_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
+
+    SIMPL_FILTER_PARAMETER(bool, WriteFaceLabels)
+    Q_PROPERTY(bool WriteFaceLabels READ getWriteFaceLabels WRITE setWriteFaceLabels)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, FaceLabelsArrayPath)
+    Q_PROPERTY(DataArrayPath FaceLabelsArrayPath READ getFaceLabelsArrayPath WRITE setFaceLabelsArrayPath)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -177,11 +198,40 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
      */
     void initialize();
 
+    /**
+     * @brief Creates the parent directory of the file and opens it for binary writing
+     * @param filePath
+     * @return The file or a null pointer after an error was set
+     */
+    FILE* openOutputFile(const QString& filePath);
+
+    /**
+     * @brief Writes the ASCII Nodes and Triangles files
+     * @param triangleGeom
+     */
+    void writeAsciiFiles(TriangleGeom* triangleGeom);
+
+    /**
+     * @brief Writes a binary little endian PLY file with the selected Face Labels as face properties
+     * @param triangleGeom
+     */
+    void writePlyFile(TriangleGeom* triangleGeom);
+
+    /**
+     * @brief Writes a binary STL file with the first component of the selected Face Labels in the attribute
+     * field of each facet
+     * @param triangleGeom
+     */
+    void writeStlFile(TriangleGeom* triangleGeom);
+
 
   public:
     WriteTriangleGeometry(const WriteTriangleGeometry&) = delete; // Copy Constructor Not Implemented
     WriteTriangleGeometry(WriteTriangleGeometry&&) = delete;      // Move Constructor Not Implemented
     WriteTriangleGeometry& operator=(const WriteTriangleGeometry&) = delete; // Copy Assignment Not Implemented
     WriteTriangleGeometry& operator=(WriteTriangleGeometry&&) = delete;      // Move Assignment
+
+  private:
+    DEFINE_IDATAARRAY_WEAKPTR(FaceLabels)
 };
 
@@ -444,7 +444,7 @@ class NeighborList : public IDataArray
 
       for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
       {
-        m_Array[destTupleOffset + i] = source->getList(i);
+        m_Array[destTupleOffset + i - srcTupleOffset] = source->getList(i);
       }
       return true;
 
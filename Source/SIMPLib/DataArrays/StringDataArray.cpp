@@ -354,7 +354,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
 
   for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    m_Array[destTupleOffset + i - srcTupleOffset] = source->getValue(i);
   }
   return true;
 }
@@ -91,7 +91,7 @@ class SIMPLib_EXPORT AbstractFilter : public Observable
   PYB11_PROPERTY(int PipelineIndex READ getPipelineIndex WRITE setPipelineIndex)
 
   PYB11_METHOD(void generateHtmlSummary)
-  PYB11_METHOD(void execute)
+  PYB11_METHOD(void execute RELEASE_GIL)
   PYB11_METHOD(void preflight)
   PYB11_METHOD(void setDataContainerArray)
   
@@ -0,0 +1,125 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ElementwiseKernel class holds the per-tuple work of a filter whose execute() is a
+ * pure element-wise map: tuple i of every array it writes depends only on tuple i of the arrays
+ * it reads. The FilterPipeline can run the kernels of consecutive element-wise filters together,
+ * one cache sized tile at a time, so the data is streamed through memory once instead of once
+ * per filter.
+ *
+ * The kernel function is called with half open tuple ranges [start, end) and may be called
+ * concurrently for disjoint ranges.
+ */
+class SIMPLib_EXPORT ElementwiseKernel
+{
+public:
+  SIMPL_SHARED_POINTERS(ElementwiseKernel)
+  SIMPL_TYPE_MACRO(ElementwiseKernel)
+
+  using KernelFunction = std::function<void(size_t, size_t)>;
+
+  /**
+   * @brief Creates a new kernel
+   * @param numTuples The number of tuples the kernel iterates over
+   * @param function The function that processes a range of tuples
+   * @return
+   */
+  static Pointer New(size_t numTuples, const KernelFunction& function);
+
+  virtual ~ElementwiseKernel();
+
+  /**
+   * @brief Returns the number of tuples the kernel iterates over
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Processes the tuples in the range [start, end)
+   * @param start
+   * @param end
+   */
+  void execute(size_t start, size_t end) const;
+
+protected:
+  ElementwiseKernel(size_t numTuples, const KernelFunction& function);
+
+private:
+  size_t m_NumberOfTuples = 0;
+  KernelFunction m_Function;
+
+public:
+  ElementwiseKernel(const ElementwiseKernel&) = delete;            // Copy Constructor Not Implemented
+  ElementwiseKernel(ElementwiseKernel&&) = delete;                 // Move Constructor Not Implemented
+  ElementwiseKernel& operator=(const ElementwiseKernel&) = delete; // Copy Assignment Not Implemented
+  ElementwiseKernel& operator=(ElementwiseKernel&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The IElementwiseFilter class is implemented by filters that can hand their work to the
+ * FilterPipeline as an ElementwiseKernel.
+ */
+class SIMPLib_EXPORT IElementwiseFilter
+{
+public:
+  virtual ~IElementwiseFilter();
+
+  /**
+   * @brief Performs the same checks and array allocations that execute() performs and returns
+   * the kernel that does the rest of the work. Running the returned kernel over all tuples must
+   * give the same result as calling execute().
+   *
+   * If an error occurs the error condition is set and a nullptr is returned. A nullptr may also be
+   * returned without an error if the current settings can not be run as a kernel; in that case the
+   * filter must not have modified the DataContainerArray so that execute() can be called instead.
+   * @return
+   */
+  virtual ElementwiseKernel::Pointer createElementwiseKernel() = 0;
+
+protected:
+  IElementwiseFilter();
+
+public:
+  IElementwiseFilter(const IElementwiseFilter&) = delete;            // Copy Constructor Not Implemented
+  IElementwiseFilter(IElementwiseFilter&&) = delete;                 // Move Constructor Not Implemented
+  IElementwiseFilter& operator=(const IElementwiseFilter&) = delete; // Copy Assignment Not Implemented
+  IElementwiseFilter& operator=(IElementwiseFilter&&) = delete;      // Move Assignment Not Implemented
+};
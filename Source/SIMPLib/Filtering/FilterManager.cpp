@@ -35,8 +35,11 @@
 
 #include "FilterManager.h"
 
+#include <QtCore/QMutexLocker>
+
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/CorePlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
 FilterManager* FilterManager::self = nullptr;
 
@@ -44,6 +47,7 @@ FilterManager* FilterManager::self = nullptr;
 //
 // -----------------------------------------------------------------------------
 FilterManager::FilterManager()
+: m_Mutex(QMutex::Recursive)
 {
   Q_ASSERT_X(!self, "FilterManager", "there should be only one FilterManager object");
   FilterManager::self = this;
@@ -95,6 +99,8 @@ void FilterManager::RegisterKnownFilters(FilterManager* /* fm */)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories()
 {
+  QMutexLocker locker(&m_Mutex);
+  loadDeferredPlugins();
   return m_Factories;
 }
 
@@ -103,6 +109,8 @@ FilterManager::Collection FilterManager::getFactories()
 // -----------------------------------------------------------------------------
 void FilterManager::printFactoryNames()
 {
+  QMutexLocker locker(&m_Mutex);
+  loadDeferredPlugins();
   for(Collection::iterator iter = m_Factories.begin(); iter != m_Factories.end(); ++iter)
   {
     qDebug() << "Name: " << iter.key() << "\n";
@@ -114,6 +122,8 @@ void FilterManager::printFactoryNames()
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 {
+  QMutexLocker locker(&m_Mutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -132,6 +142,8 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName, const QString& subGroupName)
 {
+  QMutexLocker locker(&m_Mutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
   for(FilterManager::Collection::iterator factoryIter = m_Factories.begin(); factoryIter != m_Factories.end(); ++factoryIter)
   {
@@ -149,9 +161,19 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName,
 // -----------------------------------------------------------------------------
 void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
+  QMutexLocker locker(&m_Mutex);
   // std::cout << this << " - Registering Filter: " << name.toStdString() << std::endl;
   m_Factories[name] = factory;
+  m_ClassNameFactories[name] = factory;
   m_UuidFactories[factory->getUuid()] = factory;
+
+  // When several filters share a human label the one with the lowest class name wins, which
+  // is the one a search in class name order would find first.
+  QHash<QString, IFilterFactory::Pointer>::iterator humanIter = m_HumanNameFactories.find(factory->getFilterHumanLabel());
+  if(humanIter == m_HumanNameFactories.end() || humanIter.value()->getFilterClassName().compare(name) >= 0)
+  {
+    m_HumanNameFactories[factory->getFilterHumanLabel()] = factory;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -200,26 +222,31 @@ QSet<QString> FilterManager::getSubGroupNames(const QString& groupName)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName) const
+IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName)
 {
-  if(m_Factories.contains(filterName))
+  QMutexLocker locker(&m_Mutex);
+  IFilterFactory::Pointer factory = m_ClassNameFactories.value(filterName);
+  if(nullptr == factory.get() && m_DeferredClassNames.contains(filterName))
   {
-    return m_Factories[filterName];
+    loadDeferredPlugin(m_DeferredClassNames.value(filterName));
+    factory = m_ClassNameFactories.value(filterName);
   }
-  return IFilterFactory::NullPointer();
+  return factory;
 }
 
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) const
+IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid)
 {
-  if(m_UuidFactories.contains(uuid))
+  QMutexLocker locker(&m_Mutex);
+  IFilterFactory::Pointer factory = m_UuidFactories.value(uuid);
+  if(nullptr == factory.get() && m_DeferredUuids.contains(uuid))
   {
-    return m_UuidFactories[uuid];
+    loadDeferredPlugin(m_DeferredUuids.value(uuid));
+    factory = m_UuidFactories.value(uuid);
   }
-  return IFilterFactory::NullPointer();
+  return factory;
 }
 
 // -----------------------------------------------------------------------------
@@ -227,17 +254,82 @@ IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) con
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromHumanName(const QString& humanName)
 {
-  IFilterFactory::Pointer Factory;
+  QMutexLocker locker(&m_Mutex);
+  // A deferred plugin may provide a filter with the same label and a lower class name
+  if(m_DeferredHumanNames.contains(humanName))
+  {
+    loadDeferredPlugin(m_DeferredHumanNames.value(humanName));
+  }
+  return m_HumanNameFactories.value(humanName);
+}
 
-  for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::addDeferredPlugin(const PluginManifest::PluginEntry& entry)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_DeferredPlugins.insert(entry.filePath);
+  for(const PluginManifest::FilterEntry& filter : entry.filters)
   {
-    IFilterFactory::Pointer filterFactory = factory.value();
-    if(nullptr != filterFactory.get() && filterFactory->getFilterHumanLabel().compare(humanName) == 0)
-    {
-      Factory = filterFactory;
-      break;
-    }
+    m_DeferredClassNames[filter.className] = entry.filePath;
+    m_DeferredUuids[filter.uuid] = entry.filePath;
+    m_DeferredHumanNames[filter.humanLabel] = entry.filePath;
   }
-  return Factory;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugins()
+{
+  QMutexLocker locker(&m_Mutex);
+  for(const QString& pluginPath : m_DeferredPlugins.toList())
+  {
+    loadDeferredPlugin(pluginPath);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterManager::getDeferredPluginCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_DeferredPlugins.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<QString> FilterManager::getLoadedFactoryNames() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Factories.keys();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugin(const QString& pluginPath)
+{
+  if(!m_DeferredPlugins.remove(pluginPath))
+  {
+    return;
+  }
+
+  SIMPLibPluginLoader::LoadPlugin(pluginPath, this, nullptr, true);
+
+  for(QHash<QString, QString>::iterator iter = m_DeferredClassNames.begin(); iter != m_DeferredClassNames.end();)
+  {
+    iter = (iter.value() == pluginPath) ? m_DeferredClassNames.erase(iter) : iter + 1;
+  }
+  for(QHash<QUuid, QString>::iterator iter = m_DeferredUuids.begin(); iter != m_DeferredUuids.end();)
+  {
+    iter = (iter.value() == pluginPath) ? m_DeferredUuids.erase(iter) : iter + 1;
+  }
+  for(QHash<QString, QString>::iterator iter = m_DeferredHumanNames.begin(); iter != m_DeferredHumanNames.end();)
+  {
+    iter = (iter.value() == pluginPath) ? m_DeferredHumanNames.erase(iter) : iter + 1;
+  }
+}
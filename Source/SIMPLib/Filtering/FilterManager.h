@@ -35,19 +35,27 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QMap>
 #include <QtCore/QMapIterator>
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QUuid>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/IFilterFactory.hpp"
+#include "SIMPLib/Plugin/PluginManifest.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
  * @brief The FilterManager class manages instances of filters and is mainly used to instantiate
  * an instance of a filter given its human label or class name. This class uses the Factory design
  * pattern.
+ *
+ * Plugins may be registered as deferred plugins from a PluginManifest. A deferred plugin is only
+ * loaded when one of its filters is looked up, or when the complete set of factories is requested.
+ * The lookup methods may therefore be called from several threads at once.
  */
 class SIMPLib_EXPORT FilterManager
 {
@@ -133,14 +141,14 @@ public:
    * @param filterName
    * @return
    */
-  IFilterFactory::Pointer getFactoryFromClassName(const QString& filterName) const; 
+  IFilterFactory::Pointer getFactoryFromClassName(const QString& filterName);
 
   /**
    * @brief getFactoryFromClassName Returns a FilterFactory for a given filter
    * @param filterName
    * @return
    */
-  IFilterFactory::Pointer getFactoryFromUuid(const QUuid& uuid) const;
+  IFilterFactory::Pointer getFactoryFromUuid(const QUuid& uuid);
   
   /**
    * @brief getFactoryFromClassNameHumanName For a given human label, the FilterFactory is given
@@ -149,12 +157,53 @@ public:
    */
   IFilterFactory::Pointer getFactoryFromHumanName(const QString& humanName);
 
+  /**
+   * @brief addDeferredPlugin Registers the filters of a plugin that has not been loaded yet. The
+   * plugin is loaded the first time one of its filters is looked up.
+   * @param entry The manifest entry of the plugin
+   */
+  void addDeferredPlugin(const PluginManifest::PluginEntry& entry);
+
+  /**
+   * @brief loadDeferredPlugins Loads every plugin that is still deferred
+   */
+  void loadDeferredPlugins();
+
+  /**
+   * @brief getDeferredPluginCount Returns the number of plugins that have not been loaded yet
+   * @return
+   */
+  int getDeferredPluginCount() const;
+
+  /**
+   * @brief getLoadedFactoryNames Returns the class names of the factories that are registered
+   * without loading any deferred plugin
+   * @return
+   */
+  QList<QString> getLoadedFactoryNames() const;
+
 protected:
   FilterManager();
 
+  /**
+   * @brief loadDeferredPlugin Loads a deferred plugin, which registers its filters
+   * @param pluginPath
+   */
+  void loadDeferredPlugin(const QString& pluginPath);
+
 private:
   Collection m_Factories;
-  UuidCollection m_UuidFactories;
+  QHash<QString, IFilterFactory::Pointer> m_ClassNameFactories;
+  QHash<QUuid, IFilterFactory::Pointer> m_UuidFactories;
+  QHash<QString, IFilterFactory::Pointer> m_HumanNameFactories;
+
+  QSet<QString> m_DeferredPlugins;
+  QHash<QString, QString> m_DeferredClassNames;
+  QHash<QUuid, QString> m_DeferredUuids;
+  QHash<QString, QString> m_DeferredHumanNames;
+
+  // Looking up a deferred filter loads its plugin, so lookups modify the collections
+  mutable QMutex m_Mutex;
   
   static FilterManager* self;
 
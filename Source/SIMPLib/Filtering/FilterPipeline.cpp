@@ -35,6 +35,8 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
@@ -43,15 +45,65 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#endif
+
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+// Number of tuples each fused kernel processes before the next kernel runs. Small enough that the
+// arrays touched by a handful of kernels stay in cache between kernels.
+const size_t k_FusionTileSize = 16384;
+
+/**
+ * @brief The FusedKernelsImpl class runs a set of element-wise kernels one tile at a time
+ */
+class FusedKernelsImpl
+{
+public:
+  FusedKernelsImpl(const QVector<ElementwiseKernel::Pointer>& kernels)
+  : m_Kernels(kernels)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t tileStart = start; tileStart < end; tileStart += k_FusionTileSize)
+    {
+      size_t tileEnd = std::min(tileStart + k_FusionTileSize, end);
+      for(const ElementwiseKernel::Pointer& kernel : m_Kernels)
+      {
+        kernel->execute(tileStart, tileEnd);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<ElementwiseKernel::Pointer>& m_Kernels;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 FilterPipeline::FilterPipeline()
 : QObject()
 , m_ErrorCondition(0)
+, m_FuseElementwiseFilters(false)
 , m_Cancel(false)
 , m_PipelineName("")
 , m_Dca(nullptr)
+, m_NumberOfFusedGroups(0)
+, m_NumberOfFusedKernels(0)
 {
 }
 
@@ -94,6 +146,7 @@ FilterPipeline::Pointer FilterPipeline::deepCopy()
   // Convert from JSon
   FilterPipeline::Pointer copy = FilterPipeline::New();
   copy->fromJson(json);
+  copy->setFuseElementwiseFilters(getFuseElementwiseFilters());
 
   return copy;
 }
@@ -630,6 +683,8 @@ DataContainerArray::Pointer FilterPipeline::execute()
   connectSignalsSlots();
 
   m_Dca = DataContainerArray::New();
+  m_NumberOfFusedGroups = 0;
+  m_NumberOfFusedKernels = 0;
 
   // Start looping through the Pipeline
   float progress = 0.0f;
@@ -663,9 +718,36 @@ DataContainerArray::Pointer FilterPipeline::execute()
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
       setCurrentFilter(*filter);
-      filt->execute();
-      disconnectFilterNotifications((*filter).get());
-      filt->setDataContainerArray(DataContainerArray::NullPointer());
+
+      ElementwiseKernel::Pointer kernel;
+      bool kernelFailed = false;
+      IElementwiseFilter* elementwiseFilter = dynamic_cast<IElementwiseFilter*>(filt.get());
+      if(getFuseElementwiseFilters() && nullptr != elementwiseFilter)
+      {
+        kernel = elementwiseFilter->createElementwiseKernel();
+        kernelFailed = (nullptr == kernel && filt->getErrorCondition() < 0);
+      }
+
+      if(nullptr != kernel)
+      {
+        if(!m_FusedKernels.isEmpty() && m_FusedKernels.front()->getNumberOfTuples() != kernel->getNumberOfTuples())
+        {
+          executeFusedFilters();
+        }
+        m_FusedFilters.push_back(filt);
+        m_FusedKernels.push_back(kernel);
+      }
+      else
+      {
+        // Everything that is not fused depends on the results of the pending kernels
+        executeFusedFilters();
+        if(!kernelFailed)
+        {
+          filt->execute();
+        }
+        disconnectFilterNotifications((*filter).get());
+        filt->setDataContainerArray(DataContainerArray::NullPointer());
+      }
       err = filt->getErrorCondition();
       if(err < 0)
       {
@@ -689,15 +771,22 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
     if(this->getCancel() == true)
     {
+      executeFusedFilters();
       // Clear cancel filter state
       filt->setCancel(false);
       break;
     }
 
     // Emit that the filter is completed for those objects that care, even the disabled ones.
-    emit filt->filterCompleted(filt.get());
+    // Fused filters are completed once their kernels have run.
+    if(!m_FusedFilters.contains(filt))
+    {
+      emit filt->filterCompleted(filt.get());
+    }
   }
 
+  executeFusedFilters();
+
   emit pipelineFinished();
 
   disconnectSignalsSlots();
@@ -708,6 +797,43 @@ DataContainerArray::Pointer FilterPipeline::execute()
   return m_Dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::executeFusedFilters()
+{
+  if(!m_FusedKernels.isEmpty())
+  {
+    size_t numTuples = m_FusedKernels.front()->getNumberOfTuples();
+    m_NumberOfFusedGroups++;
+    m_NumberOfFusedKernels += m_FusedKernels.size();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
+    if(doParallel)
+    {
+      ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<size_t>(0, numTuples, k_FusionTileSize), FusedKernelsImpl(m_FusedKernels));
+    }
+    else
+#endif
+    {
+      FusedKernelsImpl serial(m_FusedKernels);
+      serial.compute(0, numTuples);
+    }
+  }
+
+  for(const AbstractFilter::Pointer& filt : m_FusedFilters)
+  {
+    filt->notifyStatusMessage(filt->getHumanLabel(), "Complete");
+    disconnectFilterNotifications(filt.get());
+    filt->setDataContainerArray(DataContainerArray::NullPointer());
+    emit filt->filterCompleted(filt.get());
+  }
+
+  m_FusedFilters.clear();
+  m_FusedKernels.clear();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
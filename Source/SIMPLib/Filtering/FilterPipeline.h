@@ -44,6 +44,7 @@
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/ElementwiseKernel.h"
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
@@ -67,7 +68,7 @@ class SIMPLib_EXPORT FilterPipeline : public QObject
   PYB11_PROPERTY(bool Cancel READ getCancel WRITE setCancel)
   PYB11_PROPERTY(QString Name READ getName WRITE setName)
   
-  PYB11_METHOD(DataContainerArray::Pointer run)
+  PYB11_METHOD(DataContainerArray::Pointer run RELEASE_GIL)
   PYB11_METHOD(void preflightPipeline)
   PYB11_METHOD(void pushFront ARGS AbstractFilter)
   PYB11_METHOD(void pushBack ARGS AbstractFilter)
@@ -90,6 +91,24 @@ public:
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief When enabled, consecutive filters that implement IElementwiseFilter and iterate over the
+   * same number of tuples are executed together in a single tiled, multi-threaded pass instead of
+   * one full pass over the data per filter. The results are identical. Off by default.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, FuseElementwiseFilters)
+
+  /**
+   * @brief The number of fused passes the last call to execute() ran. Each pass runs the kernels of one
+   * group of consecutive element-wise filters.
+   */
+  SIMPL_GET_PROPERTY(int, NumberOfFusedGroups)
+
+  /**
+   * @brief The number of filters whose kernels the last call to execute() ran in fused passes
+   */
+  SIMPL_GET_PROPERTY(int, NumberOfFusedKernels)
+
   /**
    * @brief Cancel the operation
    */
@@ -233,9 +252,20 @@ private:
 
   DataContainerArray::Pointer m_Dca;
 
+  QList<AbstractFilter::Pointer> m_FusedFilters;
+  QVector<ElementwiseKernel::Pointer> m_FusedKernels;
+  int m_NumberOfFusedGroups;
+  int m_NumberOfFusedKernels;
+
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Runs the pending kernels of the fused filters in one pass over the data and
+   * completes those filters
+   */
+  void executeFusedFilters();
+
   FilterPipeline(const FilterPipeline&) = delete; // Copy Constructor Not Implemented
   void operator=(const FilterPipeline&) = delete; // Move assignment Not Implemented
 };
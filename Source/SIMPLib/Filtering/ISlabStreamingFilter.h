@@ -0,0 +1,67 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ISlabStreamingFilter class is implemented by filters that operate on the cell data of
+ * an ImageGeom through a bounded stencil and can therefore be run on one Z slab of the volume at a
+ * time by the SlabStreamingRunner. The halo size is the number of Z slices on each side of a slab
+ * the filter has to see in order to compute the interior slices of that slab exactly as it would
+ * for the whole volume. Filters that implement IElementwiseFilter are streamable with a halo of 0
+ * and do not need to implement this interface.
+ */
+class SIMPLib_EXPORT ISlabStreamingFilter
+{
+public:
+  virtual ~ISlabStreamingFilter() = default;
+
+  /**
+   * @brief Returns the number of Z slices the filter reads on either side of the slice it computes
+   * @return
+   */
+  virtual size_t getSlabHaloSize() const = 0;
+
+protected:
+  ISlabStreamingFilter() = default;
+
+public:
+  ISlabStreamingFilter(const ISlabStreamingFilter&) = delete;            // Copy Constructor Not Implemented
+  ISlabStreamingFilter(ISlabStreamingFilter&&) = delete;                 // Move Constructor Not Implemented
+  ISlabStreamingFilter& operator=(const ISlabStreamingFilter&) = delete; // Copy Assignment Not Implemented
+  ISlabStreamingFilter& operator=(ISlabStreamingFilter&&) = delete;      // Move Assignment Not Implemented
+};
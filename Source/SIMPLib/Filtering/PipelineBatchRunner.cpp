@@ -0,0 +1,357 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineBatchRunner.h"
+
+#include <functional>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+#include <hdf5.h>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/Observer.h"
+
+namespace
+{
+/**
+ * @brief The BatchJobObserver class tags each message with the name of the job that
+ * generated it and forwards it to the observer that was given to the runner.
+ */
+class BatchJobObserver : public Observer
+{
+public:
+  BatchJobObserver(const QString& jobName, IObserver* obs, QMutex* mutex)
+  : m_JobName(jobName)
+  , m_Observer(obs)
+  , m_Mutex(mutex)
+  {
+  }
+  ~BatchJobObserver() override = default;
+
+  void processPipelineMessage(const PipelineMessage& pm) override
+  {
+    if(nullptr == m_Observer)
+    {
+      return;
+    }
+    PipelineMessage msg = pm;
+    msg.setFilterHumanLabel(QString("[%1] %2").arg(m_JobName).arg(pm.getFilterHumanLabel()));
+    QMutexLocker locker(m_Mutex);
+    m_Observer->processPipelineMessage(msg);
+  }
+
+private:
+  QString m_JobName;
+  IObserver* m_Observer = nullptr;
+  QMutex* m_Mutex = nullptr;
+};
+
+/**
+ * @brief The BatchJobRunnable class executes a single job of the batch on a QThreadPool thread
+ */
+class BatchJobRunnable : public QRunnable
+{
+public:
+  BatchJobRunnable(std::function<void(int)> func, int index)
+  : m_Func(std::move(func))
+  , m_Index(index)
+  {
+  }
+  ~BatchJobRunnable() override = default;
+
+  void run() override
+  {
+    m_Func(m_Index);
+  }
+
+private:
+  std::function<void(int)> m_Func;
+  int m_Index = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchJob::PipelineBatchJob()
+: m_Name("")
+, m_ErrorCondition(0)
+, m_ElapsedMilliseconds(0)
+, m_Completed(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchJob::~PipelineBatchJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchRunner::PipelineBatchRunner()
+: m_Pipeline(FilterPipeline::NullPointer())
+, m_MaxConcurrentJobs(0)
+, m_MemoryBudget(0)
+, m_JobMemoryEstimate(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchRunner::~PipelineBatchRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchRunner::readManifest(const QString& filePath)
+{
+  QFile inputFile(filePath);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    return -1;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(inputFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError)
+  {
+    return -2;
+  }
+  return readManifest(doc.object());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchRunner::readManifest(const QJsonObject& json)
+{
+  QJsonValue jobsValue = json[SIMPL::Settings::BatchJobs];
+  if(!jobsValue.isArray())
+  {
+    return -3;
+  }
+
+  QJsonArray jobsArray = jobsValue.toArray();
+  QMutexLocker locker(&m_JobsMutex);
+  for(int i = 0; i < jobsArray.size(); i++)
+  {
+    QJsonObject jobObj = jobsArray[i].toObject();
+    PipelineBatchJob job;
+    job.setName(jobObj[SIMPL::Settings::BatchJobName].toString(QString("Job_%1").arg(m_Jobs.size())));
+    job.setOverrides(jobObj[SIMPL::Settings::BatchJobOverrides].toObject());
+    m_Jobs.push_back(job);
+  }
+  return jobsArray.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::addJob(const PipelineBatchJob& job)
+{
+  QMutexLocker locker(&m_JobsMutex);
+  m_Jobs.push_back(job);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchRunner::JobContainerType PipelineBatchRunner::getJobs() const
+{
+  QMutexLocker locker(&m_JobsMutex);
+  return m_Jobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchRunner::computeConcurrency() const
+{
+  int concurrency = m_MaxConcurrentJobs;
+  if(concurrency < 1)
+  {
+    concurrency = QThread::idealThreadCount();
+  }
+
+  if(m_MemoryBudget > 0 && m_JobMemoryEstimate > 0)
+  {
+    qint64 memoryLimited = m_MemoryBudget / m_JobMemoryEstimate;
+    if(memoryLimited < concurrency)
+    {
+      concurrency = static_cast<int>(memoryLimited);
+    }
+  }
+
+#ifndef H5_HAVE_THREADSAFE
+  // A non thread safe HDF5 library can not be entered from more than a single
+  // thread, so the jobs are run one after another.
+  concurrency = 1;
+#endif
+
+  if(concurrency > m_Jobs.size())
+  {
+    concurrency = m_Jobs.size();
+  }
+  if(concurrency < 1)
+  {
+    concurrency = 1;
+  }
+  return concurrency;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer PipelineBatchRunner::createJobPipeline(const PipelineBatchJob& job) const
+{
+  if(nullptr == m_Pipeline.get())
+  {
+    return FilterPipeline::NullPointer();
+  }
+
+  FilterPipeline::Pointer jobPipeline = FilterPipeline::New();
+  jobPipeline->setName(job.getName());
+  jobPipeline->setFuseElementwiseFilters(m_Pipeline->getFuseElementwiseFilters());
+
+  QJsonObject overrides = job.getOverrides();
+  FilterPipeline::FilterContainerType& container = m_Pipeline->getFilterContainer();
+  for(int i = 0; i < container.size(); i++)
+  {
+    AbstractFilter::Pointer filter = container[i]->newFilterInstance(true);
+    if(nullptr == filter.get())
+    {
+      return FilterPipeline::NullPointer();
+    }
+    filter->setEnabled(container[i]->getEnabled());
+
+    QJsonObject filterOverrides = overrides[QString::number(i)].toObject();
+    if(!filterOverrides.isEmpty())
+    {
+      filter->setEnabled(filterOverrides[SIMPL::Settings::FilterEnabled].toBool(filter->getEnabled()));
+      filter->readFilterParameters(filterOverrides);
+    }
+    jobPipeline->pushBack(filter);
+  }
+
+  return jobPipeline;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::executeJob(int index, IObserver* obs)
+{
+  PipelineBatchJob job;
+  {
+    QMutexLocker locker(&m_JobsMutex);
+    job = m_Jobs[index];
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  BatchJobObserver jobObserver(job.getName(), obs, &m_ObserverMutex);
+  int err = 0;
+  FilterPipeline::Pointer jobPipeline = createJobPipeline(job);
+  if(nullptr == jobPipeline.get())
+  {
+    err = -70000;
+    QString ss = QObject::tr("The pipeline for job '%1' could not be created from the template pipeline").arg(job.getName());
+    jobObserver.processPipelineMessage(PipelineMessage::CreateErrorMessage(getNameOfClass(), "Batch Job", ss, err));
+  }
+  else
+  {
+    jobPipeline->addMessageReceiver(&jobObserver);
+    err = jobPipeline->preflightPipeline();
+    if(err >= 0)
+    {
+      jobPipeline->execute();
+      err = jobPipeline->getErrorCondition();
+    }
+    else
+    {
+      QString ss = QObject::tr("Errors preflighting the pipeline for job '%1'").arg(job.getName());
+      jobObserver.processPipelineMessage(PipelineMessage::CreateErrorMessage(getNameOfClass(), "Batch Job", ss, err));
+    }
+  }
+
+  job.setErrorCondition(err);
+  job.setElapsedMilliseconds(timer.elapsed());
+  job.setCompleted(true);
+
+  QString ss = QObject::tr("Job %1 of %2 finished in %3 ms with error condition %4").arg(index + 1).arg(m_Jobs.size()).arg(job.getElapsedMilliseconds()).arg(err);
+  jobObserver.processPipelineMessage(PipelineMessage::CreateStatusMessage(getNameOfClass(), "Batch Job", ss));
+
+  QMutexLocker locker(&m_JobsMutex);
+  m_Jobs[index] = job;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchRunner::execute(IObserver* obs)
+{
+  if(nullptr == m_Pipeline.get())
+  {
+    return m_Jobs.size();
+  }
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(computeConcurrency());
+
+  for(int i = 0; i < m_Jobs.size(); i++)
+  {
+    pool.start(new BatchJobRunnable([this, obs](int index) { executeJob(index, obs); }, i));
+  }
+  pool.waitForDone();
+
+  int failed = 0;
+  for(const PipelineBatchJob& job : getJobs())
+  {
+    if(!job.getCompleted() || job.getErrorCondition() < 0)
+    {
+      failed++;
+    }
+  }
+  return failed;
+}
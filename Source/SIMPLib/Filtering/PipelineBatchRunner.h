@@ -0,0 +1,202 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/SIMPLib.h"
+
+class IObserver;
+
+/**
+ * @brief The PipelineBatchJob class holds the parameter overrides and the resulting
+ * status of a single job executed by the PipelineBatchRunner.
+ */
+class SIMPLib_EXPORT PipelineBatchJob
+{
+public:
+  PipelineBatchJob();
+  virtual ~PipelineBatchJob();
+
+  PipelineBatchJob(const PipelineBatchJob&) = default;
+  PipelineBatchJob& operator=(const PipelineBatchJob&) = default;
+
+  /**
+   * @brief Name used when reporting the status of this job
+   */
+  SIMPL_INSTANCE_PROPERTY(QString, Name)
+
+  /**
+   * @brief Filter parameter overrides keyed by the zero based index of the filter in the pipeline.
+   * Each value is a JSON object of the same form that the pipeline file uses for that filter.
+   */
+  SIMPL_INSTANCE_PROPERTY(QJsonObject, Overrides)
+
+  /**
+   * @brief Error condition of the pipeline after the job ran. 0 means success.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
+
+  /**
+   * @brief Wall clock time in milliseconds that the job took to execute
+   */
+  SIMPL_INSTANCE_PROPERTY(qint64, ElapsedMilliseconds)
+
+  /**
+   * @brief True once the job has been executed by the runner
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, Completed)
+};
+
+/**
+ * @brief The PipelineBatchRunner class executes the same pipeline over many sets of
+ * filter parameter overrides. The template pipeline is parsed once; each job receives
+ * its own copy of every filter through AbstractFilter::newFilterInstance(true) with the
+ * job's overrides applied on top. Jobs are executed concurrently on a thread pool whose
+ * size is bounded by both a thread budget and a memory budget.
+ *
+ * The manifest file is a JSON document of the form:
+ * @code
+ * {
+ *   "Jobs": [
+ *     { "Name": "Specimen_001", "Overrides": { "0": { "InputFile": "/data/001.dream3d" }, "4": { "OutputFile": "/out/001.dream3d" } } },
+ *     ...
+ *   ]
+ * }
+ * @endcode
+ */
+class SIMPLib_EXPORT PipelineBatchRunner
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineBatchRunner)
+  SIMPL_TYPE_MACRO(PipelineBatchRunner)
+  SIMPL_STATIC_NEW_MACRO(PipelineBatchRunner)
+
+  virtual ~PipelineBatchRunner();
+
+  using JobContainerType = QVector<PipelineBatchJob>;
+
+  /**
+   * @brief The pipeline that each job is instantiated from
+   */
+  SIMPL_INSTANCE_PROPERTY(FilterPipeline::Pointer, Pipeline)
+
+  /**
+   * @brief Maximum number of jobs that may execute at the same time. Values less than 1
+   * use the ideal thread count of the machine.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, MaxConcurrentJobs)
+
+  /**
+   * @brief Total amount of memory in MB that all concurrent jobs may use. 0 means no limit.
+   */
+  SIMPL_INSTANCE_PROPERTY(qint64, MemoryBudget)
+
+  /**
+   * @brief Estimated peak memory in MB that a single job requires. 0 means unknown.
+   */
+  SIMPL_INSTANCE_PROPERTY(qint64, JobMemoryEstimate)
+
+  /**
+   * @brief Reads the list of jobs from a JSON manifest file.
+   * @param filePath Path to the manifest file
+   * @return Negative value on error, otherwise the number of jobs that were read
+   */
+  int readManifest(const QString& filePath);
+
+  /**
+   * @brief Parses the list of jobs from a JSON manifest object
+   * @param json
+   * @return Negative value on error, otherwise the number of jobs that were read
+   */
+  int readManifest(const QJsonObject& json);
+
+  /**
+   * @brief Appends a job to the list of jobs
+   * @param job
+   */
+  void addJob(const PipelineBatchJob& job);
+
+  /**
+   * @brief Returns the current list of jobs along with their status
+   * @return
+   */
+  JobContainerType getJobs() const;
+
+  /**
+   * @brief Computes how many jobs are allowed to execute at the same time given the
+   * thread and memory budgets.
+   * @return
+   */
+  int computeConcurrency() const;
+
+  /**
+   * @brief Creates the pipeline for a single job by copying each filter of the template
+   * pipeline and applying the job's overrides.
+   * @param job
+   * @return
+   */
+  FilterPipeline::Pointer createJobPipeline(const PipelineBatchJob& job) const;
+
+  /**
+   * @brief Executes all jobs and blocks until every job has completed.
+   * @param obs Optional observer that receives all messages from every job. The
+   * observer is called from the worker threads but never by two threads at once.
+   * @return The number of jobs that failed
+   */
+  int execute(IObserver* obs = nullptr);
+
+protected:
+  PipelineBatchRunner();
+
+  /**
+   * @brief Executes the job at the given index. Called from the worker threads.
+   * @param index
+   * @param obs
+   */
+  void executeJob(int index, IObserver* obs);
+
+private:
+  JobContainerType m_Jobs;
+  mutable QMutex m_JobsMutex;
+  QMutex m_ObserverMutex;
+
+  PipelineBatchRunner(const PipelineBatchRunner&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PipelineBatchRunner&) = delete;      // Move assignment Not Implemented
+};
@@ -0,0 +1,480 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SlabStreamingRunner.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/H5Utilities.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Common/ProgressCounter.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/Filtering/ElementwiseKernel.h"
+#include "SIMPLib/Filtering/ISlabStreamingFilter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+
+namespace
+{
+const QString k_HumanLabel("Slab Streaming");
+
+/**
+ * @brief The SlabStreamingObserver class tags each message with the slab that generated it
+ * and forwards it to the observer that was given to the runner.
+ */
+class SlabStreamingObserver : public Observer
+{
+public:
+  SlabStreamingObserver(IObserver* obs)
+  : m_Observer(obs)
+  {
+  }
+  ~SlabStreamingObserver() override = default;
+
+  void setSlabLabel(const QString& label)
+  {
+    m_SlabLabel = label;
+  }
+
+  void processPipelineMessage(const PipelineMessage& pm) override
+  {
+    if(nullptr == m_Observer)
+    {
+      return;
+    }
+    PipelineMessage msg = pm;
+    if(!m_SlabLabel.isEmpty())
+    {
+      msg.setFilterHumanLabel(QString("[%1] %2").arg(m_SlabLabel).arg(pm.getFilterHumanLabel()));
+    }
+    m_Observer->processPipelineMessage(msg);
+  }
+
+private:
+  IObserver* m_Observer = nullptr;
+  QString m_SlabLabel;
+};
+
+/**
+ * @brief Builds the HDF5 offset and count of a range of Z slices of a cell array. The dataset
+ * dimensions are the reversed tuple dimensions followed by the reversed component dimensions.
+ */
+void slabSelection(size_t dims[3], const QVector<size_t>& cDims, size_t zOffset, size_t zCount, std::vector<hsize_t>& offset, std::vector<hsize_t>& count)
+{
+  offset = {zOffset, 0, 0};
+  count = {zCount, dims[1], dims[0]};
+  for(int i = cDims.size() - 1; i >= 0; i--)
+  {
+    offset.push_back(0);
+    count.push_back(cDims[i]);
+  }
+}
+
+/**
+ * @brief Reads the Z slices [zOffset, zOffset + zCount) of a cell array into a new array of the slab AttributeMatrix
+ */
+template <typename T>
+void readSlab(IDataArray::Pointer prototype, hid_t amGid, size_t dims[3], size_t zOffset, size_t zCount, AttributeMatrix::Pointer attrMat, int& err)
+{
+  QVector<size_t> tDims = {dims[0], dims[1], zCount};
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(tDims, prototype->getComponentDimensions(), prototype->getName(), true);
+
+  std::vector<hsize_t> offset;
+  std::vector<hsize_t> count;
+  slabSelection(dims, prototype->getComponentDimensions(), zOffset, zCount, offset, count);
+  err = QH5Lite::readPointerDatasetHyperslab(amGid, array->getName(), offset, count, array->getPointer(0));
+  if(err >= 0)
+  {
+    attrMat->addAttributeArray(array->getName(), array);
+  }
+}
+
+/**
+ * @brief Creates the chunked dataset that holds the full volume of a streamed array along with
+ * the attributes that DataContainerReader expects.
+ */
+template <typename T>
+void createVolumeDataset(IDataArray::Pointer slabArray, hid_t amGid, size_t dims[3], size_t chunkZ, int& err)
+{
+  DataArray<T>* array = dynamic_cast<DataArray<T>*>(slabArray.get());
+  QVector<size_t> cDims = array->getComponentDimensions();
+
+  std::vector<hsize_t> offset;
+  std::vector<hsize_t> volumeDims;
+  std::vector<hsize_t> chunkDims;
+  slabSelection(dims, cDims, 0, dims[2], offset, volumeDims);
+  slabSelection(dims, cDims, 0, chunkZ, offset, chunkDims);
+  err = QH5Lite::createChunkedPointerDataset<T>(amGid, array->getName(), volumeDims, chunkDims);
+  if(err >= 0)
+  {
+    QVector<size_t> tDims = {dims[0], dims[1], dims[2]};
+    err = H5DataArrayWriter::writeDataArrayAttributes(amGid, array, tDims, cDims);
+  }
+}
+
+/**
+ * @brief Writes the core slices of a slab array into the volume dataset. haloZ is the number of
+ * halo slices in front of the core slices of the slab array.
+ */
+template <typename T>
+void writeSlab(IDataArray::Pointer slabArray, hid_t amGid, size_t dims[3], size_t haloZ, size_t zOffset, size_t zCount, int& err)
+{
+  DataArray<T>* array = dynamic_cast<DataArray<T>*>(slabArray.get());
+
+  std::vector<hsize_t> offset;
+  std::vector<hsize_t> count;
+  slabSelection(dims, array->getComponentDimensions(), zOffset, zCount, offset, count);
+  size_t sliceSize = dims[0] * dims[1] * static_cast<size_t>(array->getNumberOfComponents());
+  err = QH5Lite::writePointerDatasetHyperslab(amGid, array->getName(), offset, count, array->getPointer(haloZ * sliceSize));
+}
+
+/**
+ * @brief Returns true if the array is stored as a single primitive DataArray that can be read and
+ * written one slab at a time
+ */
+bool isStreamableArrayType(const QString& objType)
+{
+  return objType.startsWith("DataArray<");
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SlabStreamingRunner::SlabStreamingRunner()
+: m_Pipeline(FilterPipeline::NullPointer())
+, m_InputFile("")
+, m_OutputFile("")
+, m_CellAttributeMatrixPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "")
+, m_SlabThickness(64)
+, m_ErrorCondition(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SlabStreamingRunner::~SlabStreamingRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SlabStreamingRunner::computeHaloSize()
+{
+  if(nullptr == m_Pipeline.get())
+  {
+    return -1;
+  }
+
+  size_t halo = 0;
+  for(const AbstractFilter::Pointer& filter : m_Pipeline->getFilterContainer())
+  {
+    if(!filter->getEnabled() || nullptr != dynamic_cast<IElementwiseFilter*>(filter.get()))
+    {
+      continue;
+    }
+    ISlabStreamingFilter* streamingFilter = dynamic_cast<ISlabStreamingFilter*>(filter.get());
+    if(nullptr == streamingFilter)
+    {
+      QString ss = QObject::tr("The filter '%1' can not be executed one slab at a time").arg(filter->getHumanLabel());
+      notifyErrorMessage(k_HumanLabel, ss, -72001);
+      return -72001;
+    }
+    halo += streamingFilter->getSlabHaloSize();
+  }
+  return static_cast<int>(halo);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SlabStreamingRunner::execute(IObserver* obs)
+{
+  SlabStreamingObserver observer(obs);
+  connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), &observer, SLOT(processPipelineMessage(const PipelineMessage&)));
+  m_ErrorCondition = 0;
+
+  if(nullptr == m_Pipeline.get())
+  {
+    m_ErrorCondition = -72000;
+    notifyErrorMessage(k_HumanLabel, "No pipeline was set", m_ErrorCondition);
+    return m_ErrorCondition;
+  }
+  int halo = computeHaloSize();
+  if(halo < 0)
+  {
+    m_ErrorCondition = halo;
+    return m_ErrorCondition;
+  }
+  if(m_SlabThickness < 1)
+  {
+    m_ErrorCondition = -72002;
+    notifyErrorMessage(k_HumanLabel, "The slab thickness must be at least 1", m_ErrorCondition);
+    return m_ErrorCondition;
+  }
+
+  QString dcName = m_CellAttributeMatrixPath.getDataContainerName();
+  QString amName = m_CellAttributeMatrixPath.getAttributeMatrixName();
+
+  // Open the input volume and read its geometry
+  hid_t inputFileId = QH5Utilities::openFile(m_InputFile, true);
+  if(inputFileId < 0)
+  {
+    m_ErrorCondition = -72003;
+    notifyErrorMessage(k_HumanLabel, QObject::tr("The input file '%1' could not be opened").arg(m_InputFile), m_ErrorCondition);
+    return m_ErrorCondition;
+  }
+  H5ScopedFileSentinel inputSentinel(&inputFileId, true);
+
+  QString dcPath = SIMPL::StringConstants::DataContainerGroupName + "/" + dcName;
+  hid_t inputDcGid = H5Gopen(inputFileId, dcPath.toLatin1().data(), H5P_DEFAULT);
+  inputSentinel.addGroupId(&inputDcGid);
+  hid_t inputAmGid = inputDcGid < 0 ? -1 : H5Gopen(inputDcGid, amName.toLatin1().data(), H5P_DEFAULT);
+  inputSentinel.addGroupId(&inputAmGid);
+  if(inputAmGid < 0)
+  {
+    m_ErrorCondition = -72004;
+    notifyErrorMessage(k_HumanLabel, QObject::tr("The AttributeMatrix '%1' does not exist in the input file").arg(m_CellAttributeMatrixPath.serialize("/")), m_ErrorCondition);
+    return m_ErrorCondition;
+  }
+
+  QString geometryTypeName;
+  QH5Lite::readStringAttribute(inputDcGid, SIMPL::Geometry::Geometry, SIMPL::Geometry::GeometryTypeName, geometryTypeName);
+  DataContainer::Pointer volumeDc = DataContainer::New(dcName);
+  if(geometryTypeName == SIMPL::Geometry::ImageGeometry)
+  {
+    volumeDc->readMeshDataFromHDF5(inputDcGid, true);
+  }
+  ImageGeom::Pointer volumeGeom = volumeDc->getGeometryAs<ImageGeom>();
+  if(nullptr == volumeGeom.get())
+  {
+    m_ErrorCondition = -72005;
+    notifyErrorMessage(k_HumanLabel, QObject::tr("The DataContainer '%1' does not have an ImageGeometry").arg(dcName), m_ErrorCondition);
+    return m_ErrorCondition;
+  }
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {1.0f, 1.0f, 1.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = volumeGeom->getDimensions();
+  volumeGeom->getResolution(res);
+  volumeGeom->getOrigin(origin);
+  QVector<size_t> volumeTDims = {dims[0], dims[1], dims[2]};
+
+  // Collect the cell arrays that will be streamed
+  QList<QString> datasetNames;
+  QH5Utilities::getGroupObjects(inputAmGid, H5Utilities::H5Support_DATASET, datasetNames);
+  QVector<IDataArray::Pointer> inputArrays;
+  for(const QString& name : datasetNames)
+  {
+    QString objType;
+    int version = 0;
+    QVector<size_t> tDims;
+    QVector<size_t> cDims;
+    if(H5DataArrayReader::ReadRequiredAttributes(inputAmGid, name, objType, version, tDims, cDims) < 0 || !isStreamableArrayType(objType))
+    {
+      notifyWarningMessage(k_HumanLabel, QObject::tr("The array '%1' is not a DataArray and will not be streamed").arg(name), -72006);
+      continue;
+    }
+    if(tDims != volumeTDims)
+    {
+      m_ErrorCondition = -72007;
+      notifyErrorMessage(k_HumanLabel, QObject::tr("The tuple dimensions of the array '%1' do not match the dimensions of the ImageGeometry").arg(name), m_ErrorCondition);
+      return m_ErrorCondition;
+    }
+    IDataArray::Pointer prototype = H5DataArrayReader::ReadIDataArray(inputAmGid, name, true);
+    if(nullptr != prototype.get())
+    {
+      inputArrays.push_back(prototype);
+    }
+  }
+
+  hid_t outputFileId = -1;
+  H5ScopedFileSentinel outputSentinel(&outputFileId, true);
+  hid_t outputAmGid = -1;
+  outputSentinel.addGroupId(&outputAmGid);
+  QList<QString> outputNames;
+
+  size_t numSlabs = (dims[2] + m_SlabThickness - 1) / m_SlabThickness;
+  ProgressCounter progress(this, static_cast<int64_t>(numSlabs), "Streaming Slabs", "", k_HumanLabel);
+  for(size_t slab = 0; slab < numSlabs; slab++)
+  {
+    size_t coreStart = slab * m_SlabThickness;
+    size_t coreEnd = std::min(coreStart + m_SlabThickness, dims[2]);
+    size_t readStart = coreStart > static_cast<size_t>(halo) ? coreStart - halo : 0;
+    size_t readEnd = std::min(coreEnd + halo, dims[2]);
+    size_t slabZ = readEnd - readStart;
+    observer.setSlabLabel(QObject::tr("Slab %1/%2").arg(slab + 1).arg(numSlabs));
+
+    // Build the DataContainerArray that holds the padded slab
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(dcName);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(volumeGeom->getName());
+    image->setDimensions(dims[0], dims[1], slabZ);
+    image->setResolution(res);
+    image->setOrigin(origin[0], origin[1], origin[2] + static_cast<float>(readStart) * res[2]);
+    dc->setGeometry(image);
+    dca->addDataContainer(dc);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New({dims[0], dims[1], slabZ}, amName, AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(amName, attrMat);
+
+    for(const IDataArray::Pointer& prototype : inputArrays)
+    {
+      int err = TemplateHelpers::Errors::UnsupportedType;
+      EXECUTE_FUNCTION_TEMPLATE(this, readSlab, prototype, prototype, inputAmGid, dims, readStart, slabZ, attrMat, err)
+      if(err < 0)
+      {
+        m_ErrorCondition = -72008;
+        notifyErrorMessage(k_HumanLabel, QObject::tr("Error reading the slab of the array '%1'").arg(prototype->getName()), m_ErrorCondition);
+        return m_ErrorCondition;
+      }
+    }
+
+    // Run the filters on the slab
+    for(const AbstractFilter::Pointer& filter : m_Pipeline->getFilterContainer())
+    {
+      if(!filter->getEnabled())
+      {
+        continue;
+      }
+      filter->setDataContainerArray(dca);
+      connect(filter.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), &observer, SLOT(processPipelineMessage(const PipelineMessage&)));
+      filter->execute();
+      disconnect(filter.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), &observer, SLOT(processPipelineMessage(const PipelineMessage&)));
+      filter->setDataContainerArray(DataContainerArray::NullPointer());
+      if(filter->getErrorCondition() < 0)
+      {
+        m_ErrorCondition = filter->getErrorCondition();
+        return m_ErrorCondition;
+      }
+    }
+
+    attrMat = dca->getAttributeMatrix(m_CellAttributeMatrixPath);
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != dims[0] * dims[1] * slabZ)
+    {
+      m_ErrorCondition = -72009;
+      notifyErrorMessage(k_HumanLabel, "The pipeline removed or resized the streamed AttributeMatrix", m_ErrorCondition);
+      return m_ErrorCondition;
+    }
+
+    if(0 == slab)
+    {
+      // The pipeline is written first since it creates the file along with the version attributes
+      QFile::remove(m_OutputFile);
+      H5FilterParametersWriter::Pointer writer = H5FilterParametersWriter::New();
+      int err = writer->writePipelineToFile(m_Pipeline, m_OutputFile, SIMPL::StringConstants::PipelineGroupName);
+      outputFileId = err < 0 ? -1 : QH5Utilities::openFile(m_OutputFile, false);
+      if(outputFileId < 0)
+      {
+        m_ErrorCondition = -72010;
+        notifyErrorMessage(k_HumanLabel, QObject::tr("The output file '%1' could not be created").arg(m_OutputFile), m_ErrorCondition);
+        return m_ErrorCondition;
+      }
+
+      // An empty copy of the cell AttributeMatrix carries the volume tuple dimensions
+      DataContainer::Pointer outputDc = DataContainer::New(dcName);
+      outputDc->setGeometry(volumeGeom);
+      outputDc->addAttributeMatrix(amName, AttributeMatrix::New(volumeTDims, amName, AttributeMatrix::Type::Cell));
+      err = QH5Utilities::createGroupsFromPath(dcPath, outputFileId);
+      hid_t outputDcGid = err < 0 ? -1 : H5Gopen(outputFileId, dcPath.toLatin1().data(), H5P_DEFAULT);
+      H5ScopedGroupSentinel dcSentinel(&outputDcGid, false);
+      if(outputDcGid < 0 || outputDc->writeAttributeMatricesToHDF5(outputDcGid) < 0 || outputDc->writeMeshToHDF5(outputDcGid, false) < 0)
+      {
+        m_ErrorCondition = -72011;
+        notifyErrorMessage(k_HumanLabel, "Error writing the DataContainer to the output file", m_ErrorCondition);
+        return m_ErrorCondition;
+      }
+      outputAmGid = H5Gopen(outputDcGid, amName.toLatin1().data(), H5P_DEFAULT);
+
+      size_t chunkZ = std::min(m_SlabThickness, dims[2]);
+      for(const QString& name : attrMat->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = attrMat->getAttributeArray(name);
+        if(!isStreamableArrayType(array->getFullNameOfClass()))
+        {
+          notifyWarningMessage(k_HumanLabel, QObject::tr("The array '%1' is not a DataArray and will not be written").arg(name), -72012);
+          continue;
+        }
+        err = TemplateHelpers::Errors::UnsupportedType;
+        EXECUTE_FUNCTION_TEMPLATE(this, createVolumeDataset, array, array, outputAmGid, dims, chunkZ, err)
+        if(err < 0)
+        {
+          m_ErrorCondition = -72013;
+          notifyErrorMessage(k_HumanLabel, QObject::tr("Error creating the dataset for the array '%1'").arg(name), m_ErrorCondition);
+          return m_ErrorCondition;
+        }
+        outputNames.push_back(name);
+      }
+    }
+
+    // Only the core slices are written; the halo slices belong to the neighboring slabs
+    for(const QString& name : outputNames)
+    {
+      IDataArray::Pointer array = attrMat->getAttributeArray(name);
+      if(nullptr == array.get())
+      {
+        m_ErrorCondition = -72014;
+        notifyErrorMessage(k_HumanLabel, QObject::tr("The array '%1' is missing from slab %2").arg(name).arg(slab + 1), m_ErrorCondition);
+        return m_ErrorCondition;
+      }
+      int err = TemplateHelpers::Errors::UnsupportedType;
+      EXECUTE_FUNCTION_TEMPLATE(this, writeSlab, array, array, outputAmGid, dims, coreStart - readStart, coreStart, coreEnd - coreStart, err)
+      if(err < 0)
+      {
+        m_ErrorCondition = -72015;
+        notifyErrorMessage(k_HumanLabel, QObject::tr("Error writing slab %1 of the array '%2'").arg(slab + 1).arg(name), m_ErrorCondition);
+        return m_ErrorCondition;
+      }
+    }
+
+    progress.increment();
+  }
+
+  observer.setSlabLabel(QString());
+  notifyStatusMessage(k_HumanLabel, QObject::tr("Streamed %1 slabs with a halo of %2 slices").arg(numSlabs).arg(halo));
+  return m_ErrorCondition;
+}
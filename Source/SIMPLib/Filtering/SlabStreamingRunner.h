@@ -0,0 +1,121 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/SIMPLib.h"
+
+class IObserver;
+
+/**
+ * @brief The SlabStreamingRunner class executes a pipeline over the cell data of an ImageGeom that is
+ * too large to be held in memory at once. The volume is read from a .dream3d file one slab of Z slices
+ * at a time; each slab is padded with the halo slices the filters need, the filters of the pipeline are
+ * executed on the padded slab, and the interior slices of every array in the cell AttributeMatrix are
+ * written into chunked datasets of the output .dream3d file. Peak memory is therefore bounded by the
+ * size of a single padded slab instead of the size of the volume.
+ *
+ * Every enabled filter of the pipeline must either implement IElementwiseFilter (halo of 0) or
+ * ISlabStreamingFilter, and must only read and write arrays of the streamed cell AttributeMatrix. Only
+ * DataArray based arrays are streamed; other arrays of the AttributeMatrix are skipped with a warning.
+ */
+class SIMPLib_EXPORT SlabStreamingRunner : public Observable
+{
+  Q_OBJECT
+
+public:
+  SIMPL_SHARED_POINTERS(SlabStreamingRunner)
+  SIMPL_TYPE_MACRO_SUPER(SlabStreamingRunner, Observable)
+  SIMPL_STATIC_NEW_MACRO(SlabStreamingRunner)
+
+  ~SlabStreamingRunner() override;
+
+  /**
+   * @brief The pipeline that is executed on each slab. The pipeline must not read or write files itself.
+   */
+  SIMPL_INSTANCE_PROPERTY(FilterPipeline::Pointer, Pipeline)
+
+  /**
+   * @brief The .dream3d file that holds the input volume
+   */
+  SIMPL_INSTANCE_STRING_PROPERTY(InputFile)
+
+  /**
+   * @brief The .dream3d file that the streamed cell AttributeMatrix is written to. Any existing file is replaced.
+   */
+  SIMPL_INSTANCE_STRING_PROPERTY(OutputFile)
+
+  /**
+   * @brief Path to the cell AttributeMatrix of the ImageGeom DataContainer that is streamed
+   */
+  SIMPL_INSTANCE_PROPERTY(DataArrayPath, CellAttributeMatrixPath)
+
+  /**
+   * @brief Number of Z slices that each slab computes, not counting the halo slices
+   */
+  SIMPL_INSTANCE_PROPERTY(size_t, SlabThickness)
+
+  /**
+   * @brief Error condition of the last execution. 0 means success.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
+
+  /**
+   * @brief Computes the number of halo slices each slab needs, which is the sum of the halo sizes of all
+   * enabled filters since each filter reads the output of the previous one.
+   * @return The halo size or a negative value if a filter of the pipeline can not be streamed. In that
+   * case an error message naming the filter is emitted.
+   */
+  int computeHaloSize();
+
+  /**
+   * @brief Executes the pipeline one slab at a time and blocks until every slab has been written.
+   * @param obs Optional observer that receives all messages. Messages generated by the filters are
+   * tagged with the index of the slab that was being executed.
+   * @return The error condition
+   */
+  int execute(IObserver* obs = nullptr);
+
+protected:
+  SlabStreamingRunner();
+
+private:
+  SlabStreamingRunner(const SlabStreamingRunner&) = delete; // Copy Constructor Not Implemented
+  void operator=(const SlabStreamingRunner&) = delete;      // Move assignment Not Implemented
+};
@@ -42,6 +42,12 @@
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/ConditionalSetValue.h"
+#include "SIMPLib/CoreFilters/ConvertData.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
@@ -154,6 +160,114 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunElementwisePipeline(bool fuse)
+  {
+    const size_t numTuples = 100000;
+    const DataArrayPath intsPath("DataContainer", "CellData", "Ints");
+    const DataArrayPath maskPath("DataContainer", "CellData", "Mask");
+    const DataArrayPath floatsPath("DataContainer", "CellData", "Floats");
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->setFuseElementwiseFilters(fuse);
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, static_cast<double>(numTuples)))));
+    pipeline->pushBack(createAm);
+
+    CreateDataArray::Pointer createInts = CreateDataArray::New();
+    createInts->setScalarType(SIMPL::ScalarTypes::Type::Int32);
+    createInts->setNumberOfComponents(1);
+    createInts->setNewArray(intsPath);
+    createInts->setInitializationType(CreateDataArray::RandomWithRange);
+    createInts->setInitializationRange(FPRangePair(0.0, 9.0));
+    pipeline->pushBack(createInts);
+
+    CreateDataArray::Pointer createMask = CreateDataArray::New();
+    createMask->setScalarType(SIMPL::ScalarTypes::Type::Bool);
+    createMask->setNumberOfComponents(1);
+    createMask->setNewArray(maskPath);
+    createMask->setInitializationType(CreateDataArray::RandomWithRange);
+    createMask->setInitializationRange(FPRangePair(0.0, 1.0));
+    pipeline->pushBack(createMask);
+
+    // The following four filters are element-wise and are fused into one pass when requested
+    ReplaceValueInArray::Pointer replaceInts = ReplaceValueInArray::New();
+    replaceInts->setSelectedArray(intsPath);
+    replaceInts->setRemoveValue(5.0);
+    replaceInts->setReplaceValue(100.0);
+    pipeline->pushBack(replaceInts);
+
+    ConvertData::Pointer convert = ConvertData::New();
+    convert->setSelectedCellArrayPath(intsPath);
+    convert->setScalarType(SIMPL::NumericTypes::Type::Float);
+    convert->setOutputArrayName(floatsPath.getDataArrayName());
+    pipeline->pushBack(convert);
+
+    ConditionalSetValue::Pointer conditional = ConditionalSetValue::New();
+    conditional->setSelectedArrayPath(floatsPath);
+    conditional->setConditionalArrayPath(maskPath);
+    conditional->setReplaceValue(-1.0);
+    pipeline->pushBack(conditional);
+
+    ReplaceValueInArray::Pointer replaceFloats = ReplaceValueInArray::New();
+    replaceFloats->setSelectedArray(floatsPath);
+    replaceFloats->setRemoveValue(100.0);
+    replaceFloats->setReplaceValue(50.0);
+    pipeline->pushBack(replaceFloats);
+
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0)
+
+    // All four element-wise filters run over the same tuples, so they share a single pass
+    DREAM3D_REQUIRE_EQUAL(pipeline->getNumberOfFusedGroups(), fuse ? 1 : 0)
+    DREAM3D_REQUIRE_EQUAL(pipeline->getNumberOfFusedKernels(), fuse ? 4 : 0)
+
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(intsPath);
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    Int32ArrayType::Pointer ints = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(intsPath.getDataArrayName()));
+    BoolArrayType::Pointer mask = std::dynamic_pointer_cast<BoolArrayType>(am->getAttributeArray(maskPath.getDataArrayName()));
+    FloatArrayType::Pointer floats = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray(floatsPath.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(ints.get())
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_VALID_POINTER(floats.get())
+    DREAM3D_REQUIRE_EQUAL(floats->getNumberOfTuples(), numTuples)
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t value = ints->getValue(i);
+      DREAM3D_REQUIRE(value != 5)
+
+      float expected = static_cast<float>(value);
+      if(mask->getValue(i))
+      {
+        expected = -1.0f;
+      }
+      else if(value == 100)
+      {
+        expected = 50.0f;
+      }
+      DREAM3D_REQUIRE_EQUAL(floats->getValue(i), expected)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementwiseFusion()
+  {
+    RunElementwisePipeline(false);
+    RunElementwisePipeline(true);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -168,6 +282,7 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestElementwiseFusion());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
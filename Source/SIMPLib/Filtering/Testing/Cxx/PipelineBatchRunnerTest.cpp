@@ -0,0 +1,177 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineBatchRunner.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PipelineBatchRunnerTest
+{
+public:
+  PipelineBatchRunnerTest() = default;
+  virtual ~PipelineBatchRunnerTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateTemplatePipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer first = CreateDataContainer::New();
+    first->setDataContainerName("First");
+    pipeline->pushBack(first);
+
+    CreateDataContainer::Pointer second = CreateDataContainer::New();
+    second->setDataContainerName("Second");
+    pipeline->pushBack(second);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject CreateManifest(int numJobs)
+  {
+    QJsonArray jobs;
+    for(int i = 0; i < numJobs; i++)
+    {
+      QJsonObject filterOverride;
+      filterOverride["DataContainerName"] = QString("Job_DC_%1").arg(i);
+      QJsonObject overrides;
+      overrides["1"] = filterOverride;
+
+      QJsonObject job;
+      job[SIMPL::Settings::BatchJobName] = QString("Job %1").arg(i);
+      job[SIMPL::Settings::BatchJobOverrides] = overrides;
+      jobs.append(job);
+    }
+
+    QJsonObject manifest;
+    manifest[SIMPL::Settings::BatchJobs] = jobs;
+    return manifest;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReadManifest()
+  {
+    PipelineBatchRunner::Pointer runner = PipelineBatchRunner::New();
+    int count = runner->readManifest(CreateManifest(5));
+    DREAM3D_REQUIRE_EQUAL(count, 5)
+    DREAM3D_REQUIRE_EQUAL(runner->getJobs().size(), 5)
+    DREAM3D_REQUIRE_EQUAL(runner->getJobs()[3].getName(), QString("Job 3"))
+
+    count = runner->readManifest(QJsonObject());
+    DREAM3D_REQUIRE(count < 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestJobPipelineOverrides()
+  {
+    PipelineBatchRunner::Pointer runner = PipelineBatchRunner::New();
+    FilterPipeline::Pointer pipeline = CreateTemplatePipeline();
+    runner->setPipeline(pipeline);
+    runner->readManifest(CreateManifest(2));
+
+    FilterPipeline::Pointer jobPipeline = runner->createJobPipeline(runner->getJobs()[1]);
+    DREAM3D_REQUIRE_VALID_POINTER(jobPipeline.get())
+    DREAM3D_REQUIRE_EQUAL(jobPipeline->size(), 2)
+
+    CreateDataContainer::Pointer first = std::dynamic_pointer_cast<CreateDataContainer>(jobPipeline->getFilterContainer()[0]);
+    CreateDataContainer::Pointer second = std::dynamic_pointer_cast<CreateDataContainer>(jobPipeline->getFilterContainer()[1]);
+    DREAM3D_REQUIRE_VALID_POINTER(first.get())
+    DREAM3D_REQUIRE_VALID_POINTER(second.get())
+    DREAM3D_REQUIRE_EQUAL(first->getDataContainerName(), QString("First"))
+    DREAM3D_REQUIRE_EQUAL(second->getDataContainerName(), QString("Job_DC_1"))
+
+    // The template pipeline must not be modified by the job overrides
+    CreateDataContainer::Pointer templateSecond = std::dynamic_pointer_cast<CreateDataContainer>(pipeline->getFilterContainer()[1]);
+    DREAM3D_REQUIRE_EQUAL(templateSecond->getDataContainerName(), QString("Second"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExecuteBatch()
+  {
+    PipelineBatchRunner::Pointer runner = PipelineBatchRunner::New();
+    runner->setPipeline(CreateTemplatePipeline());
+    runner->setMaxConcurrentJobs(4);
+    runner->setMemoryBudget(1024);
+    runner->setJobMemoryEstimate(512);
+    runner->readManifest(CreateManifest(8));
+
+    DREAM3D_REQUIRE(runner->computeConcurrency() <= 2)
+
+    int failed = runner->execute();
+    DREAM3D_REQUIRE_EQUAL(failed, 0)
+    for(const PipelineBatchJob& job : runner->getJobs())
+    {
+      DREAM3D_REQUIRE_EQUAL(job.getCompleted(), true)
+      DREAM3D_REQUIRE_EQUAL(job.getErrorCondition(), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineBatchRunnerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestReadManifest());
+    DREAM3D_REGISTER_TEST(TestJobPipelineOverrides());
+    DREAM3D_REGISTER_TEST(TestExecuteBatch());
+  }
+
+private:
+  PipelineBatchRunnerTest(const PipelineBatchRunnerTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineBatchRunnerTest&);          // Move assignment Not Implemented
+};
@@ -0,0 +1,259 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/FindDerivatives.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/SlabStreamingRunner.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class SlabStreamingRunnerTest
+{
+public:
+  SlabStreamingRunnerTest() = default;
+  virtual ~SlabStreamingRunnerTest() = default;
+
+  const size_t k_XDim = 6;
+  const size_t k_YDim = 5;
+  const size_t k_ZDim = 17;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString inputFile()
+  {
+    return UnitTest::TestTempDir + QString("/SlabStreamingRunnerTest_Input.dream3d");
+  }
+  QString outputFile()
+  {
+    return UnitTest::TestTempDir + QString("/SlabStreamingRunnerTest_Output.dream3d");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(inputFile());
+    QFile::remove(outputFile());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataArrayPath cellPath(const QString& arrayName)
+  {
+    return DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, arrayName);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateVolume()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(k_XDim, k_YDim, k_ZDim);
+    image->setResolution(0.5f, 0.25f, 2.0f);
+    image->setOrigin(1.0f, 2.0f, 3.0f);
+    dc->setGeometry(image);
+    dca->addDataContainer(dc);
+
+    QVector<size_t> tDims = {k_XDim, k_YDim, k_ZDim};
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(attrMat->getName(), attrMat);
+
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Values", true);
+    FloatArrayType::Pointer field = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Field", true);
+    for(size_t i = 0; i < values->getNumberOfTuples(); i++)
+    {
+      values->setValue(i, static_cast<int32_t>((i * 37) % 11));
+      field->setValue(i, std::sin(static_cast<float>(i) * 0.1f) * static_cast<float>(i % 7));
+    }
+    attrMat->addAttributeArray(values->getName(), values);
+    attrMat->addAttributeArray(field->getName(), field);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateStreamingPipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    ReplaceValueInArray::Pointer replace = ReplaceValueInArray::New();
+    replace->setSelectedArray(cellPath("Values"));
+    replace->setRemoveValue(0.0);
+    replace->setReplaceValue(-5.0);
+    pipeline->pushBack(replace);
+
+    FindDerivatives::Pointer derivatives = FindDerivatives::New();
+    derivatives->setSelectedArrayPath(cellPath("Field"));
+    derivatives->setDerivativesArrayPath(cellPath("Gradient"));
+    pipeline->pushBack(derivatives);
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestComputeHaloSize()
+  {
+    SlabStreamingRunner::Pointer runner = SlabStreamingRunner::New();
+    FilterPipeline::Pointer pipeline = CreateStreamingPipeline();
+    runner->setPipeline(pipeline);
+    DREAM3D_REQUIRE_EQUAL(runner->computeHaloSize(), 1)
+
+    FindDerivatives::Pointer derivatives = FindDerivatives::New();
+    derivatives->setSelectedArrayPath(cellPath("Gradient"));
+    derivatives->setDerivativesArrayPath(cellPath("SecondDerivatives"));
+    pipeline->pushBack(derivatives);
+    DREAM3D_REQUIRE_EQUAL(runner->computeHaloSize(), 2)
+
+    pipeline->pushBack(CreateDataContainer::New());
+    DREAM3D_REQUIRE(runner->computeHaloSize() < 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareDataset(hid_t amGid, typename DataArray<T>::Pointer expected)
+  {
+    QString objType;
+    int version = 0;
+    QVector<size_t> tDims;
+    QVector<size_t> cDims;
+    int err = H5DataArrayReader::ReadRequiredAttributes(amGid, expected->getName(), objType, version, tDims, cDims);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(objType, expected->getFullNameOfClass())
+    DREAM3D_REQUIRE(tDims == QVector<size_t>({k_XDim, k_YDim, k_ZDim}))
+    DREAM3D_REQUIRE(cDims == expected->getComponentDimensions())
+
+    std::vector<T> values;
+    err = QH5Lite::readVectorDataset(amGid, expected->getName(), values);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(values.size(), expected->getSize())
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      DREAM3D_REQUIRE(std::fabs(static_cast<double>(values[i]) - static_cast<double>(expected->getValue(i))) < 1.0E-6)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStreamedPipeline()
+  {
+    DataContainerArray::Pointer dca = CreateVolume();
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(inputFile());
+    writer->setWriteXdmfFile(false);
+    writer->execute();
+    DREAM3D_REQUIRE(writer->getErrorCondition() >= 0)
+
+    // The in memory result of the same filters is the reference
+    FilterPipeline::Pointer reference = CreateStreamingPipeline();
+    for(const AbstractFilter::Pointer& filter : reference->getFilterContainer())
+    {
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRE(filter->getErrorCondition() >= 0)
+    }
+
+    SlabStreamingRunner::Pointer runner = SlabStreamingRunner::New();
+    runner->setPipeline(CreateStreamingPipeline());
+    runner->setInputFile(inputFile());
+    runner->setOutputFile(outputFile());
+    runner->setCellAttributeMatrixPath(cellPath(""));
+    runner->setSlabThickness(4);
+    int err = runner->execute();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    hid_t fileId = QH5Utilities::openFile(outputFile(), true);
+    DREAM3D_REQUIRE(fileId > 0)
+    H5ScopedFileSentinel sentinel(&fileId, true);
+    QString amPath = SIMPL::StringConstants::DataContainerGroupName + "/" + SIMPL::Defaults::ImageDataContainerName + "/" + SIMPL::Defaults::CellAttributeMatrixName;
+    hid_t amGid = H5Gopen(fileId, amPath.toLatin1().data(), H5P_DEFAULT);
+    sentinel.addGroupId(&amGid);
+    DREAM3D_REQUIRE(amGid > 0)
+
+    AttributeMatrix::Pointer attrMat = dca->getAttributeMatrix(cellPath(""));
+    CompareDataset<int32_t>(amGid, attrMat->getAttributeArrayAs<Int32ArrayType>("Values"));
+    CompareDataset<float>(amGid, attrMat->getAttributeArrayAs<FloatArrayType>("Field"));
+    CompareDataset<double>(amGid, attrMat->getAttributeArrayAs<DoubleArrayType>("Gradient"));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SlabStreamingRunnerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestComputeHaloSize());
+    DREAM3D_REGISTER_TEST(TestStreamedPipeline());
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  SlabStreamingRunnerTest(const SlabStreamingRunnerTest&); // Copy Constructor Not Implemented
+  void operator=(const SlabStreamingRunnerTest&);          // Move assignment Not Implemented
+};
@@ -46,15 +46,20 @@
 
 #include "SIMPLib/Geometry/EdgeGeom.h"
 
+#include <limits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 
 /**
  * @brief The FindEdgeDerivativesImpl class implements a threaded algorithm that computes the
@@ -135,11 +140,12 @@ EdgeGeom::EdgeGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = EdgeGeom::CreateSharedVertexList(0);
   m_EdgeList = EdgeGeom::CreateSharedEdgeList(0);
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
   m_EdgesContainingVert = ElementDynamicList::NullPointer();
   m_EdgeNeighbors = ElementDynamicList::NullPointer();
   m_EdgeCentroids = FloatArrayType::NullPointer();
   m_EdgeSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -190,13 +196,45 @@ EdgeGeom::Pointer EdgeGeom::CreateGeometry(SharedEdgeList::Pointer edges, Shared
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+EdgeGeom::Pointer EdgeGeom::CreateGeometry(CompactEdgeList::Pointer edges, SharedVertexList::Pointer vertices, const QString& name)
+{
+  if(name.isEmpty() == true)
+  {
+    return EdgeGeom::NullPointer();
+  }
+  if(vertices.get() == nullptr)
+  {
+    return EdgeGeom::NullPointer();
+  }
+  if(edges.get() == nullptr)
+  {
+    return EdgeGeom::NullPointer();
+  }
+  EdgeGeom* d = new EdgeGeom();
+  d->setVertices(vertices);
+  d->setCompactEdges(edges);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void EdgeGeom::initializeWithZeros()
 {
   m_VertexList->initializeWithZeros();
-  m_EdgeList->initializeWithZeros();
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    m_CompactEdgeList->initializeWithZeros();
+  }
+  else
+  {
+    m_EdgeList->initializeWithZeros();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -229,7 +267,7 @@ void EdgeGeom::addAttributeMatrix(const QString& name, AttributeMatrix::Pointer
 // -----------------------------------------------------------------------------
 size_t EdgeGeom::getNumberOfElements()
 {
-  return m_EdgeList->getNumberOfTuples();
+  return static_cast<size_t>(getNumberOfEdges());
 }
 
 // -----------------------------------------------------------------------------
@@ -238,7 +276,14 @@ size_t EdgeGeom::getNumberOfElements()
 int EdgeGeom::findElementsContainingVert()
 {
   m_EdgesContainingVert = ElementDynamicList::New();
-  GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_EdgeList, m_EdgesContainingVert, getNumberOfVertices());
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t, uint32_t>(m_CompactEdgeList, m_EdgesContainingVert, getNumberOfVertices());
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_EdgeList, m_EdgesContainingVert, getNumberOfVertices());
+  }
   if(m_EdgesContainingVert.get() == nullptr)
   {
     return -1;
@@ -285,7 +330,14 @@ int EdgeGeom::findElementNeighbors()
     }
   }
   m_EdgeNeighbors = ElementDynamicList::New();
-  err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_EdgeList, m_EdgesContainingVert, m_EdgeNeighbors, IGeometry::Type::Edge);
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t, uint32_t>(m_CompactEdgeList, m_EdgesContainingVert, m_EdgeNeighbors, IGeometry::Type::Edge);
+  }
+  else
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_EdgeList, m_EdgesContainingVert, m_EdgeNeighbors, IGeometry::Type::Edge);
+  }
   if(m_EdgeNeighbors.get() == nullptr)
   {
     err = -1;
@@ -324,7 +376,14 @@ int EdgeGeom::findElementCentroids()
 {
   QVector<size_t> cDims(1, 3);
   m_EdgeCentroids = FloatArrayType::CreateArray(getNumberOfElements(), cDims, SIMPL::StringConstants::EdgeCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_EdgeList, m_VertexList, m_EdgeCentroids);
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindElementCentroids<uint32_t>(m_CompactEdgeList, m_VertexList, m_EdgeCentroids);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_EdgeList, m_VertexList, m_EdgeCentroids);
+  }
   if(m_EdgeCentroids.get() == nullptr)
   {
     return -1;
@@ -431,7 +490,7 @@ void EdgeGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   int64_t numEdges = getNumberOfEdges();
 
   if(observable)
@@ -440,14 +499,13 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numEdges), FindEdgeDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<int64_t>(0, numEdges), FindEdgeDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -457,6 +515,66 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EdgeGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  IDataArray::Pointer elements = (m_CompactEdgeList.get() != nullptr) ? IDataArray::Pointer(m_CompactEdgeList) : IDataArray::Pointer(m_EdgeList);
+  int err = MeshReordering::ReorderMesh(this, m_VertexList, elements, {}, ordering, vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EdgeGeom::setCompactConnectivity(bool compact)
+{
+  if(compact && getNumberOfVertices() > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    return -1;
+  }
+  if(!GeometryHelpers::Connectivity::SetCompactStorage(compact, m_EdgeList, m_CompactEdgeList))
+  {
+    return -1;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool EdgeGeom::getCompactConnectivity()
+{
+  return (m_CompactEdgeList.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EdgeGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  IDataArray::Pointer elements = (m_CompactEdgeList.get() != nullptr) ? IDataArray::Pointer(m_CompactEdgeList) : IDataArray::Pointer(m_EdgeList);
+  int err = MeshWelding::WeldMesh(m_VertexList, elements, tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -482,6 +600,15 @@ int EdgeGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
     }
   }
 
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactEdgeList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_EdgeCentroids.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_EdgeCentroids);
@@ -541,7 +668,7 @@ int EdgeGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFileName)
   }
   out << "    <Topology TopologyType=\"Polyline\" NodesPerElement=\"2\" NumberOfElements=\"" << getNumberOfEdges() << "\">"
       << "\n";
-  out << "      <DataItem Format=\"HDF\" NumberType=\"Int\" Dimensions=\"" << getNumberOfEdges() << " 2\">"
+  out << "      <DataItem Format=\"HDF\" " << GeometryHelpers::GeomIO::XdmfConnectivityNumberType(getCompactConnectivity()) << " Dimensions=\"" << getNumberOfEdges() << " 2\">"
       << "\n";
   out << "        " << hdfFileName << ":/DataContainers/" << dcName << "/" << SIMPL::Geometry::Geometry << "/" << SIMPL::Geometry::SharedEdgeList << "\n";
   out << "      </DataItem>"
@@ -605,12 +732,14 @@ int EdgeGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
-  SharedEdgeList::Pointer edges = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedEdgeList>(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err);
-  if(edges.get() == nullptr || vertices.get() == nullptr)
+  SharedEdgeList::Pointer edges = SharedEdgeList::NullPointer();
+  CompactEdgeList::Pointer compactEdges = CompactEdgeList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err, edges, compactEdges);
+  if((edges.get() == nullptr && compactEdges.get() == nullptr) || vertices.get() == nullptr)
   {
     return -1;
   }
-  size_t numEdges = edges->getNumberOfTuples();
+  size_t numEdges = (compactEdges.get() != nullptr) ? compactEdges->getNumberOfTuples() : edges->getNumberOfTuples();
   size_t numVerts = vertices->getNumberOfTuples();
   FloatArrayType::Pointer edgeCentroids = GeometryHelpers::GeomIO::ReadListFromHDF5<FloatArrayType>(SIMPL::StringConstants::EdgeCentroids, parentId, preflight, err);
   if(err < 0 && err != -2)
@@ -636,6 +765,10 @@ int EdgeGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 
   setVertices(vertices);
   setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    setCompactEdges(compactEdges);
+  }
   setElementCentroids(edgeCentroids);
   setElementSizes(edgeSizes);
   setElementNeighbors(edgeNeighbors);
@@ -650,14 +783,15 @@ int EdgeGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 IGeometry::Pointer EdgeGeom::deepCopy(bool forceNoAllocate)
 {
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
+  CompactEdgeList::Pointer compactEdges = std::dynamic_pointer_cast<CompactEdgeList>((m_CompactEdgeList.get() == nullptr) ? nullptr : m_CompactEdgeList->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementNeighbors = std::dynamic_pointer_cast<ElementDynamicList>((getElementNeighbors().get() == nullptr) ? nullptr : getElementNeighbors()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
-  EdgeGeom::Pointer copy = EdgeGeom::CreateGeometry(edges, verts, getName());
+  EdgeGeom::Pointer copy = (compactEdges.get() != nullptr) ? EdgeGeom::CreateGeometry(compactEdges, verts, getName()) : EdgeGeom::CreateGeometry(edges, verts, getName());
 
   copy->setElementsContainingVert(elementsContainingVert);
   copy->setElementNeighbors(elementNeighbors);
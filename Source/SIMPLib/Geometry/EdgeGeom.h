@@ -69,6 +69,15 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     static Pointer CreateGeometry(SharedEdgeList::Pointer edges, SharedVertexList::Pointer vertices, const QString& name);
 
+    /**
+     * @brief CreateGeometry
+     * @param edges Edges with 32 bit vertex Ids
+     * @param vertices
+     * @param name
+     * @return
+     */
+    static Pointer CreateGeometry(CompactEdgeList::Pointer edges, SharedVertexList::Pointer vertices, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedVertexOps
 // -----------------------------------------------------------------------------
@@ -150,12 +159,26 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
 
     /**
      * @brief getEdges
-     * @return
+     * @return The edges with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedEdgeList::Pointer getEdges();
 
     /**
-     * @brief setVerts
+     * @brief setCompactEdges Stores the edges with 32 bit vertex Ids and releases the 64 bit list.
+     * getEdges() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param edges
+     */
+    void setCompactEdges(CompactEdgeList::Pointer edges);
+
+    /**
+     * @brief getCompactEdges
+     * @return The edges if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactEdgeList::Pointer getCompactEdges();
+
+    /**
+     * @brief setVertsAtEdge Stores the edges with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param edgeId
      * @param verts
      */
@@ -179,7 +202,7 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
     /**
      * @brief getEdgePointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the edges are stored with 32 bit vertex Ids
      */
     int64_t* getEdgePointer(int64_t i);
 
@@ -292,6 +315,37 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -366,6 +420,7 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
+    CompactEdgeList::Pointer m_CompactEdgeList;
     ElementDynamicList::Pointer m_EdgesContainingVert;
     ElementDynamicList::Pointer m_EdgeNeighbors;
     FloatArrayType::Pointer m_EdgeCentroids;
@@ -33,8 +33,18 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_sort.h>
+#endif
 
 #include <QtCore/QString>
 
@@ -47,6 +57,7 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 /**
 * @brief This file contains a namespace with classes for manipulating IGeometry objects
@@ -119,6 +130,37 @@ public:
     return std::dynamic_pointer_cast<ListType>(mesh);
   }
 
+  /**
+   * @brief Reads a shared list that was written with either 64 bit or compact 32 bit vertex Ids. At most one
+   * of list and compactList is valid on return.
+   * @param listName
+   * @param parentId
+   * @param preflight
+   * @param err Set to -2 if the list does not exist and to -1 if it can not be read or has another type
+   * @param list
+   * @param compactList
+   */
+  static void ReadConnectivityListFromHDF5(const QString& listName, hid_t parentId, bool preflight, herr_t& err, Int64ArrayType::Pointer& list, UInt32ArrayType::Pointer& compactList)
+  {
+    IDataArray::Pointer data = ReadListFromHDF5<IDataArray>(listName, parentId, preflight, err);
+    list = std::dynamic_pointer_cast<Int64ArrayType>(data);
+    compactList = std::dynamic_pointer_cast<UInt32ArrayType>(data);
+    if(data.get() != nullptr && list.get() == nullptr && compactList.get() == nullptr)
+    {
+      err = -1;
+    }
+  }
+
+  /**
+   * @brief Returns the Xdmf number type attributes of a shared list with 64 bit or compact 32 bit vertex Ids
+   * @param compact
+   * @return
+   */
+  static QString XdmfConnectivityNumberType(bool compact)
+  {
+    return compact ? QString("NumberType=\"UInt\" Precision=\"4\"") : QString("NumberType=\"Int\"");
+  }
+
   /**
    * @brief ReadMetaDataFromHDF5
    * @param parentId
@@ -255,8 +297,75 @@ public:
   }
 };
 
+/**
+ * @brief Runs func(start, end) over blocks of the range [0, count), in parallel if the ParallelExecutionContext
+ * allows it. The functor is called concurrently and must only write to the elements of its block.
+ * @param count
+ * @param minimumGrain The smallest number of elements that are worth a task
+ * @param func
+ */
+template <typename FunctorType> void ForEachElementBlock(size_t count, size_t minimumGrain, const FunctorType& func)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel() && count > minimumGrain)
+  {
+    context->parallelFor(tbb::blocked_range<size_t>(0, count, context->computeGrainSize(count, minimumGrain)), [&func](const tbb::blocked_range<size_t>& r) { func(r.begin(), r.end()); });
+    return;
+  }
+#endif
+  if(count > 0)
+  {
+    func(0, count);
+  }
+}
+
+/**
+ * @brief Runs func(i) for every index i in [0, count), over the blocks of ForEachElementBlock(). Suited to
+ * loops whose iterations are expensive on their own, such as spatial queries.
+ * @param count
+ * @param minimumGrain The smallest number of indices that are worth a task
+ * @param func
+ */
+template <typename FunctorType> void ForEachElement(size_t count, size_t minimumGrain, const FunctorType& func)
+{
+  ForEachElementBlock(count, minimumGrain, [&func](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      func(i);
+    }
+  });
+}
+
+/**
+ * @brief A sort key paired with the Id of the element, vertex or point it belongs to
+ */
+using KeyedId = std::pair<uint64_t, int64_t>;
+
+/**
+ * @brief Sorts the keys by key and then by Id, in parallel if the ParallelExecutionContext allows it. The Ids make
+ * all entries distinct, so the order does not depend on the number of threads.
+ * @param keys
+ * @param minimumGrain The smallest number of keys that are worth sorting in parallel
+ */
+inline void SortKeyedIds(std::vector<KeyedId>& keys, size_t minimumGrain)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel() && keys.size() > minimumGrain)
+  {
+    context->execute([&keys] { tbb::parallel_sort(keys.begin(), keys.end()); });
+    return;
+  }
+#endif
+  std::sort(keys.begin(), keys.end());
+}
+
 /**
  * @brief The Connectivity class
+ *
+ * The element, edge and face lists may hold 64 bit or compact 32 bit vertex Ids. Unshared lists and dynamic
+ * lists always hold 64 bit Ids.
  */
 class Connectivity
 {
@@ -264,13 +373,16 @@ public:
   Connectivity() = default;
   virtual ~Connectivity() = default;
 
+  static const size_t k_MinimumGrain = 16384;
+
   /**
    * @brief FindElementsContainingVert
-   * @param elemList
+   * @param elemList The element list, with vertex Ids of type L
    * @param dynamicList
    * @param numVerts
    */
-  template <typename T, typename K> static void FindElementsContainingVert(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer dynamicList, size_t numVerts)
+  template <typename T, typename K, typename L = K>
+  static void FindElementsContainingVert(typename DataArray<L>::Pointer elemList, typename DynamicListArray<T, K>::Pointer dynamicList, size_t numVerts)
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
@@ -283,7 +395,7 @@ public:
     typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, "_INTERNAL_USE_ONLY_Vertices");
     linkLocPtr->initializeWithValue(0);
     K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
+    L* verts = nullptr;
 
     // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
     // Traverse data to determine number of uses of each point
@@ -311,14 +423,14 @@ public:
 
   /**
    * @brief FindElementNeighbors
-   * @param elemList
+   * @param elemList The element list, with vertex Ids of type L
    * @param elemsContainingVert
    * @param dynamicList This should be an empty DynamicListArray object. It is not
    * it <b>WILL</b> be cleared and reallocated.
    * @return
    */
-  template <typename T, typename K>
-  static int FindElementNeighbors(typename DataArray<K>::Pointer elemList, typename DynamicListArray<T, K>::Pointer elemsContainingVert, typename DynamicListArray<T, K>::Pointer dynamicList,
+  template <typename T, typename K, typename L = K>
+  static int FindElementNeighbors(typename DataArray<L>::Pointer elemList, typename DynamicListArray<T, K>::Pointer elemsContainingVert, typename DynamicListArray<T, K>::Pointer dynamicList,
                                   IGeometry::Type geometryType)
   {
     size_t numElems = elemList->getNumberOfTuples();
@@ -378,7 +490,7 @@ public:
     for(size_t t = 0; t < numElems; ++t)
     {
       //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
+      L* seedElem = elemList->getTuplePointer(t);
       for(size_t v = 0; v < numVertsPerElem; ++v)
       {
         //   qDebug() << " vert " << v << "\n";
@@ -396,7 +508,7 @@ public:
             continue;
           } // We already added this element so loop again
           //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
+          L* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
           size_t vCount = 0;
           // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
           // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
@@ -496,7 +608,7 @@ public:
     typename std::set<std::pair<T, T>>::iterator setIter;
     edgeList->resize(edgeSet.size());
     T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    size_t index = 0;
 
     for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
     {
@@ -541,7 +653,7 @@ public:
     typename std::set<std::pair<T, T>>::iterator setIter;
     edgeList->resize(edgeSet.size());
     T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    size_t index = 0;
 
     for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
     {
@@ -596,7 +708,7 @@ public:
     typename std::set<std::pair<T, T>>::iterator setIter;
     edgeList->resize(edgeSet.size());
     T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    size_t index = 0;
 
     for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
     {
@@ -639,7 +751,7 @@ public:
     typename std::set<std::tuple<T, T, T>>::iterator setIter;
     faceList->resize(faceSet.size());
     T* uFaces = faceList->getPointer(0);
-    T index = 0;
+    size_t index = 0;
 
     for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
     {
@@ -686,7 +798,7 @@ public:
     typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
     faceList->resize(faceSet.size());
     T* uFaces = faceList->getPointer(0);
-    T index = 0;
+    size_t index = 0;
 
     for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
     {
@@ -703,7 +815,7 @@ public:
    * @param elemList
    * @param edgeList
    */
-  template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, typename K = T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<K>::Pointer edgeList)
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
@@ -765,8 +877,8 @@ public:
     }
 
     edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
+    K* bEdges = edgeList->getPointer(0);
+    size_t index = 0;
 
     for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
     {
@@ -781,7 +893,7 @@ public:
   * @param tetList
   * @param edgeList
   */
-  template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, typename K = T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<K>::Pointer edgeList)
   {
     size_t numElems = tetList->getNumberOfTuples();
 
@@ -823,8 +935,8 @@ public:
     }
 
     edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
+    K* bEdges = edgeList->getPointer(0);
+    size_t index = 0;
 
     for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
     {
@@ -839,7 +951,7 @@ public:
   * @param hexList
   * @param edgeList
   */
-  template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, typename K = T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<K>::Pointer edgeList)
   {
     size_t numElems = hexList->getNumberOfTuples();
 
@@ -891,8 +1003,8 @@ public:
     }
 
     edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
+    K* bEdges = edgeList->getPointer(0);
+    size_t index = 0;
 
     for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
     {
@@ -907,7 +1019,7 @@ public:
    * @param tetList
    * @param edgeList
    */
-  template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
+  template <typename T, typename K = T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<K>::Pointer faceList)
   {
     size_t numElems = tetList->getNumberOfTuples();
 
@@ -947,8 +1059,8 @@ public:
     }
 
     faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+    K* uFaces = faceList->getPointer(0);
+    size_t index = 0;
 
     for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
     {
@@ -964,7 +1076,7 @@ public:
   * @param hexList
   * @param edgeList
   */
-  template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
+  template <typename T, typename K = T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<K>::Pointer faceList)
   {
     size_t numElems = hexList->getNumberOfTuples();
 
@@ -1007,8 +1119,8 @@ public:
     }
 
     faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+    K* uFaces = faceList->getPointer(0);
+    size_t index = 0;
 
     for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
     {
@@ -1019,10 +1131,96 @@ public:
       ++index;
     }
   }
+
+  /**
+   * @brief Checks whether the vertex Ids of one element can be stored in a compact 32 bit list
+   * @param verts
+   * @param numVerts
+   * @return true if every vertex Id is non-negative and fits in 32 bits
+   */
+  static bool FitsCompactStorage(const int64_t* verts, size_t numVerts)
+  {
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      if(verts[i] < 0 || verts[i] > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Copies a connectivity list into a list with another type of vertex Ids
+   * @param list
+   * @return The copy, or a null pointer if a vertex Id does not fit in the type K
+   */
+  template <typename T, typename K> static typename DataArray<K>::Pointer ConvertList(typename DataArray<T>::Pointer list)
+  {
+    typename DataArray<K>::Pointer converted = DataArray<K>::CreateArray(list->getNumberOfTuples(), list->getComponentDimensions(), list->getName(), list->isAllocated());
+    if(!list->isAllocated())
+    {
+      return converted;
+    }
+    const T* src = list->getPointer(0);
+    K* dest = converted->getPointer(0);
+    std::atomic<bool> valid(true);
+    ForEachElementBlock(list->getSize(), k_MinimumGrain, [=, &valid](size_t start, size_t end) {
+      bool blockValid = true;
+      for(size_t i = start; i < end; i++)
+      {
+        dest[i] = static_cast<K>(src[i]);
+        blockValid = blockValid && (static_cast<T>(dest[i]) == src[i]);
+      }
+      if(!blockValid)
+      {
+        valid = false;
+      }
+    });
+    if(!valid)
+    {
+      return DataArray<K>::NullPointer();
+    }
+    return converted;
+  }
+
+  /**
+   * @brief Moves a shared list between its 64 bit and its compact 32 bit storage. At most one of list and
+   * compactList is valid on return. Compacting leaves both lists untouched if a vertex Id is negative or does
+   * not fit in 32 bits.
+   * @param compact
+   * @param list
+   * @param compactList
+   * @return true if the list is stored with the requested width or neither list is valid
+   */
+  static bool SetCompactStorage(bool compact, Int64ArrayType::Pointer& list, UInt32ArrayType::Pointer& compactList)
+  {
+    if(compact && list.get() != nullptr)
+    {
+      UInt32ArrayType::Pointer converted = ConvertList<int64_t, uint32_t>(list);
+      if(converted.get() == nullptr)
+      {
+        return false;
+      }
+      compactList = converted;
+      list = Int64ArrayType::NullPointer();
+    }
+    else if(!compact && compactList.get() != nullptr)
+    {
+      list = ConvertList<uint32_t, int64_t>(compactList);
+      compactList = UInt32ArrayType::NullPointer();
+    }
+    return true;
+  }
 };
 
 /**
  * @brief The Topology class
+ *
+ * The measures of tetrahedra and hexahedra are computed in tiles of k_TileSize elements. The coordinates of
+ * the vertices of a tile are first gathered into one contiguous array per vertex and axis, which turns the
+ * arithmetic on the tile into loops over contiguous memory that the compiler vectorizes. The arithmetic
+ * itself is the same as for a single element, so the results do not depend on the tiling.
  */
 class Topology
 {
@@ -1030,6 +1228,56 @@ public:
   Topology() = default;
   virtual ~Topology() = default;
 
+  static const size_t k_TileSize = 64;
+  static const size_t k_MinimumGrain = 1024;
+
+  /**
+   * @brief Gathers the vertex coordinates of count elements starting at element start into a tile with one
+   * row of k_TileSize values per vertex and axis
+   * @param elems The vertex ids of all elements, N per element
+   * @param start
+   * @param count
+   * @param vertex
+   * @param tile
+   */
+  template <typename T, size_t N> static void GatherTile(const T* elems, size_t start, size_t count, const float* vertex, float (&tile)[N][3][k_TileSize])
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      const T* elem = elems + N * (start + i);
+      for(size_t v = 0; v < N; v++)
+      {
+        const float* coords = vertex + 3 * elem[v];
+        tile[v][0][i] = coords[0];
+        tile[v][1][i] = coords[1];
+        tile[v][2][i] = coords[2];
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the determinant of the edge vectors (b - a, c - a, d - a) of the tetrahedron (a, b, c, d)
+   * of element i of a tile, evaluated in the same order as MatrixMath::Determinant3x3
+   * @param tile
+   * @param i
+   * @param a
+   * @param b
+   * @param c
+   * @param d
+   * @return
+   */
+  template <size_t N> static inline float TetDeterminant(const float (&tile)[N][3][k_TileSize], size_t i, size_t a, size_t b, size_t c, size_t d)
+  {
+    float g[3][3];
+    for(size_t r = 0; r < 3; r++)
+    {
+      g[r][0] = tile[b][r][i] - tile[a][r][i];
+      g[r][1] = tile[c][r][i] - tile[a][r][i];
+      g[r][2] = tile[d][r][i] - tile[a][r][i];
+    }
+    return (g[0][0] * (g[1][1] * g[2][2] - g[1][2] * g[2][1])) - (g[0][1] * (g[1][0] * g[2][2] - g[1][2] * g[2][0])) + (g[0][2] * (g[1][0] * g[2][1] - g[1][1] * g[2][0]));
+  }
+
   /**
    * @brief FindElementCentroids
    * @param elemList
@@ -1040,24 +1288,27 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
+    const size_t numDims = 3;
     float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
+    const T* elems = elemList->getPointer(0);
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+    ForEachElementBlock(numElems, k_MinimumGrain, [=](size_t start, size_t end) {
+      for(size_t j = start; j < end; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertPos = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
+        const T* Elem = elems + numVertsPerElem * j;
+        for(size_t i = 0; i < numDims; i++)
         {
-          vertPos += vertex[3 * Elem[k] + i];
+          float vertPos = 0.0;
+          for(size_t k = 0; k < numVertsPerElem; k++)
+          {
+            vertPos += vertex[3 * Elem[k] + i];
+          }
+          vertPos /= static_cast<float>(numVertsPerElem);
+          elementCentroids[numDims * j + i] = vertPos;
         }
-        vertPos /= static_cast<float>(numVertsPerElem);
-        elementCentroids[numDims * j + i] = vertPos;
       }
-    }
+    });
   }
 
   /**
@@ -1068,89 +1319,71 @@ public:
    */
   template <typename T> static void Find2DElementAreas(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer areas)
   {
-    float nx, ny, nz;
-    int32_t projection;
-
     size_t numElems = elemList->getNumberOfTuples();
     int64_t numVertsPerElem = static_cast<int64_t>(elemList->getNumberOfComponents());
     if(numVertsPerElem < 3)
     {
       return;
     }
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* elemAreas = areas->getPointer(0);
-    float normal[3] = {0.0f, 0.0f, 0.0f};
-    std::vector<float> coords(3 * numVertsPerElem, 0.0f);
-    float vert0[3] = {0.0f, 0.0f, 0.0f};
-    float vert1[3] = {0.0f, 0.0f, 0.0f};
-    float vert2[3] = {0.0f, 0.0f, 0.0f};
+    const T* elems = elemList->getPointer(0);
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      float area = 0.0f;
-      T* elem = elemList->getTuplePointer(i);
+    ForEachElementBlock(numElems, k_MinimumGrain, [=](size_t start, size_t end) {
+      float nx, ny, nz;
+      int32_t projection;
+      float normal[3] = {0.0f, 0.0f, 0.0f};
+      std::vector<float> coords(3 * numVertsPerElem, 0.0f);
 
-      // Create a contiguous vertex coordinates list
-      // This simplifies the pointer arithmetic a bit
-      for(int64_t j = 0; j < numVertsPerElem; j++)
+      for(size_t i = start; i < end; i++)
       {
-        std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coords.begin() + (3 * j));
-      }
+        float area = 0.0f;
+        const T* elem = elems + numVertsPerElem * i;
 
-      float* coordinates = coords.data();
-      GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
-      MatrixMath::Normalize3x1(normal);
+        // Create a contiguous vertex coordinates list
+        // This simplifies the pointer arithmetic a bit
+        for(int64_t j = 0; j < numVertsPerElem; j++)
+        {
+          std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coords.begin() + (3 * j));
+        }
 
-      nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
-      ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
-      nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
-      projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+        float* coordinates = coords.data();
+        GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
+        MatrixMath::Normalize3x1(normal);
 
-      for(int64_t j = 0; j < numVertsPerElem; j++)
-      {
-        std::copy(coordinates + (3 * j), coordinates + (3 * j + 3), vert0);
-        std::copy(coordinates + (3 * ((j + 1) % numVertsPerElem)), coordinates + (3 * ((j + 1) % numVertsPerElem) + 3), vert1);
-        std::copy(coordinates + (3 * ((j + 2) % numVertsPerElem)), coordinates + (3 * ((j + 2) % numVertsPerElem) + 3), vert2);
+        nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
+        ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
+        nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
+        projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+
+        // The two coordinates of the projection plane
+        int64_t u = (projection == 0) ? 1 : 0;
+        int64_t v = (projection == 2) ? 1 : 2;
+        for(int64_t j = 0; j < numVertsPerElem; j++)
+        {
+          area += coordinates[3 * ((j + 1) % numVertsPerElem) + u] * (coordinates[3 * ((j + 2) % numVertsPerElem) + v] - coordinates[3 * j + v]);
+        }
 
         switch(projection)
         {
         case 0:
         {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 1] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
+          area /= (2.0f * nx);
+          break;
         }
         case 1:
         {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
+          area /= (2.0f * ny);
+          break;
         }
         case 2:
         {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 1] - coordinates[3 * j + 1]);
-          continue;
+          area /= (2.0f * nz);
         }
         }
+        elemAreas[i] = fabsf(area);
       }
-
-      switch(projection)
-      {
-      case 0:
-      {
-        area /= (2.0f * nx);
-        break;
-      }
-      case 1:
-      {
-        area /= (2.0f * ny);
-        break;
-      }
-      case 2:
-      {
-        area /= (2.0f * nz);
-      }
-      }
-      elemAreas[i] = fabsf(area);
-    }
+    });
   }
 
   /**
@@ -1162,23 +1395,23 @@ public:
   template <typename T> static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* volumePtr = volumes->getPointer(0);
+    const T* tets = tetList->getPointer(0);
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-      volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-    }
+    ForEachElementBlock(numTets, k_MinimumGrain, [=](size_t start, size_t end) {
+      float tile[4][3][k_TileSize];
+      for(size_t tileStart = start; tileStart < end; tileStart += k_TileSize)
+      {
+        size_t count = std::min(end - tileStart, k_TileSize);
+        GatherTile(tets, tileStart, count, vertex, tile);
+        float* out = volumePtr + tileStart;
+        for(size_t i = 0; i < count; i++)
+        {
+          out[i] = TetDeterminant(tile, i, 0, 1, 2, 3) / 6.0f;
+        }
+      }
+    });
   }
 
   /**
@@ -1190,63 +1423,31 @@ public:
   template <typename T> static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
     float* volumePtr = volumes->getPointer(0);
+    const T* hexas = hexList->getPointer(0);
 
-    for(size_t i = 0; i < numHexas; i++)
-    {
-      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
-      std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
-
-      // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
-      subTets[0][0] = hex[0];
-      subTets[0][1] = hex[1];
-      subTets[0][2] = hex[3];
-      subTets[0][3] = hex[4];
-
-      // Second tetrahedron from hexahedron vertices (1, 4, 5, 6);
-      subTets[1][0] = hex[1];
-      subTets[1][1] = hex[4];
-      subTets[1][2] = hex[5];
-      subTets[1][3] = hex[6];
-
-      // Third tetrahedron from hexahedron vertices (1, 4, 6, 3);
-      subTets[2][0] = hex[1];
-      subTets[2][1] = hex[3];
-      subTets[2][2] = hex[6];
-      subTets[2][3] = hex[3];
-
-      // Fourth tetrahedron from hexahedron vertices (1, 3, 6, 2);
-      subTets[3][0] = hex[1];
-      subTets[3][1] = hex[3];
-      subTets[3][2] = hex[6];
-      subTets[3][3] = hex[2];
-
-      // Fifth tetrahedron from hexahedron vertices (3, 6, 7, 4);
-      subTets[4][0] = hex[3];
-      subTets[4][1] = hex[6];
-      subTets[4][2] = hex[7];
-      subTets[4][3] = hex[4];
-
-      float volume = 0.0f;
-
-      for(auto&& tet : subTets)
+    // Subdivide each hexahedron into 5 tetrahedra & sum their volumes: (0, 1, 3, 4), (1, 4, 5, 6),
+    // (1, 4, 6, 3), (1, 3, 6, 2) and (3, 6, 7, 4)
+    ForEachElementBlock(numHexas, k_MinimumGrain, [=](size_t start, size_t end) {
+      float tile[8][3][k_TileSize];
+      for(size_t tileStart = start; tileStart < end; tileStart += k_TileSize)
       {
-        float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-        float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-        float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-        float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-        float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                  {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                   {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-        volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+        size_t count = std::min(end - tileStart, k_TileSize);
+        GatherTile(hexas, tileStart, count, vertex, tile);
+        float* out = volumePtr + tileStart;
+        for(size_t i = 0; i < count; i++)
+        {
+          float volume = 0.0f;
+          volume += TetDeterminant(tile, i, 0, 1, 3, 4) / 6.0f;
+          volume += TetDeterminant(tile, i, 1, 4, 5, 6) / 6.0f;
+          volume += TetDeterminant(tile, i, 1, 4, 6, 3) / 6.0f;
+          volume += TetDeterminant(tile, i, 1, 3, 6, 2) / 6.0f;
+          volume += TetDeterminant(tile, i, 3, 6, 7, 4) / 6.0f;
+          out[i] = volume;
+        }
       }
-
-      volumePtr[i] = volume;
-    }
+    });
   }
 
   /**
@@ -1257,25 +1458,25 @@ public:
   */
   template <typename T> static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
-	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
-	  float* jacobianPtr = jacobians->getPointer(0);
-
-	  for (size_t i = 0; i < numTets; i++)
-	  {
-		  T* tet = tetList->getTuplePointer(i);
-		  //get vert positions
-		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
-		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
-		  float vert2[3] = { vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2] };
-		  float vert3[3] = { vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2] };
-		  //build jacobian matrix
-		  float vertMatrix[3][3] = { { vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0] },
-		  { vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1] },
-		  { vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2] } };
-		  //find jacobian, which is determinant of the jacobian matrix
-		  jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
-	  }
+    size_t numTets = tetList->getNumberOfTuples();
+    const float* vertex = vertices->getPointer(0);
+    float* jacobianPtr = jacobians->getPointer(0);
+    const T* tets = tetList->getPointer(0);
+
+    ForEachElementBlock(numTets, k_MinimumGrain, [=](size_t start, size_t end) {
+      float tile[4][3][k_TileSize];
+      for(size_t tileStart = start; tileStart < end; tileStart += k_TileSize)
+      {
+        size_t count = std::min(end - tileStart, k_TileSize);
+        GatherTile(tets, tileStart, count, vertex, tile);
+        float* out = jacobianPtr + tileStart;
+        for(size_t i = 0; i < count; i++)
+        {
+          // The jacobian is the determinant of the jacobian matrix
+          out[i] = TetDeterminant(tile, i, 0, 1, 2, 3);
+        }
+      }
+    });
   }
 
   /**
@@ -1286,51 +1487,64 @@ public:
   */
   template <typename T> static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
-	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
-	  float* minAnglesPtr = minAngles->getPointer(0);
-
-	  for (size_t i = 0; i < numTets; i++)
-	  {
-		  T* tet = tetList->getTuplePointer(i);
-		  //get vert positions
-		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
-		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
-		  float vert2[3] = { vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2] };
-		  float vert3[3] = { vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2] };
-		  //find 5 edges needed to find 4 face normals
-		  float v10[3] = { (vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2]) };
-		  float v20[3] = { (vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2]) };
-		  float v30[3] = { (vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2]) };
-		  float v21[3] = { (vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2]) };
-		  float v31[3] = { (vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2]) };
-		  //find 4 face-to-face normals
-		  float norm1[3] = { (v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0]) };
-		  float norm2[3] = { (v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0]) };
-		  float norm3[3] = { (v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0]) };
-		  float norm4[3] = { (v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0]) };
-		  //find the magnitudes of each normal
-		  float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
-		  float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
-		  float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
-		  float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
-		  //find angles between faces
-		  float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
-		  float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
-		  float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
-		  float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
-		  float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
-		  float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
-		  //find the maximum ang value, which will be the minimum angle after the acos
-		  float minAng = ang1;
-		  if (ang2 > minAng) { minAng = ang2; }
-		  if (ang3 > minAng) { minAng = ang3; }
-		  if (ang4 > minAng) { minAng = ang4; }
-		  if (ang5 > minAng) { minAng = ang5; }
-		  if (ang6 > minAng) { minAng = ang6; }
-
-		  minAnglesPtr[i] = SIMPLib::Constants::k_180OverPi * acosf(minAng);
-	  }
+    size_t numTets = tetList->getNumberOfTuples();
+    const float* vertex = vertices->getPointer(0);
+    float* minAnglesPtr = minAngles->getPointer(0);
+    const T* tets = tetList->getPointer(0);
+
+    ForEachElementBlock(numTets, k_MinimumGrain, [=](size_t start, size_t end) {
+      float tile[4][3][k_TileSize];
+      float maxCosines[k_TileSize];
+      for(size_t tileStart = start; tileStart < end; tileStart += k_TileSize)
+      {
+        size_t count = std::min(end - tileStart, k_TileSize);
+        GatherTile(tets, tileStart, count, vertex, tile);
+        for(size_t i = 0; i < count; i++)
+        {
+          float v10[3], v20[3], v30[3], v21[3], v31[3];
+          for(size_t r = 0; r < 3; r++)
+          {
+            // find 5 edges needed to find 4 face normals
+            v10[r] = tile[1][r][i] - tile[0][r][i];
+            v20[r] = tile[2][r][i] - tile[0][r][i];
+            v30[r] = tile[3][r][i] - tile[0][r][i];
+            v21[r] = tile[2][r][i] - tile[1][r][i];
+            v31[r] = tile[3][r][i] - tile[1][r][i];
+          }
+          // find 4 face-to-face normals
+          float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
+          float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
+          float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
+          float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
+          // find the magnitudes of each normal
+          float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
+          float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
+          float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
+          float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
+          // find angles between faces
+          float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
+          float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
+          float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
+          float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
+          float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
+          float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
+          // find the maximum ang value, which will be the minimum angle after the acos
+          float minAng = ang1;
+          minAng = ang2 > minAng ? ang2 : minAng;
+          minAng = ang3 > minAng ? ang3 : minAng;
+          minAng = ang4 > minAng ? ang4 : minAng;
+          minAng = ang5 > minAng ? ang5 : minAng;
+          minAng = ang6 > minAng ? ang6 : minAng;
+          maxCosines[i] = minAng;
+        }
+
+        float* out = minAnglesPtr + tileStart;
+        for(size_t i = 0; i < count; i++)
+        {
+          out[i] = SIMPLib::Constants::k_180OverPi * acosf(maxCosines[i]);
+        }
+      }
+    });
   }
 };
 
@@ -1354,27 +1568,30 @@ public:
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const K* vertArray = inVertexArray->getPointer(0);
     float* elemArray = outElemArray->getPointer(0);
+    const T* elems = elemList->getPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t numDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+    ForEachElementBlock(numElems, Topology::k_MinimumGrain, [=](size_t start, size_t end) {
+      for(size_t j = start; j < end; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
+        const T* Elem = elems + numVertsPerElem * j;
+        for(size_t i = 0; i < numDims; i++)
         {
-          vertValue += vertArray[numDims * Elem[k] + i];
+          float vertValue = 0.0;
+          for(size_t k = 0; k < numVertsPerElem; k++)
+          {
+            vertValue += vertArray[numDims * Elem[k] + i];
+          }
+          vertValue /= static_cast<float>(numVertsPerElem);
+          elemArray[numDims * j + i] = vertValue;
         }
-        vertValue /= static_cast<float>(numVertsPerElem);
-        elemArray[numDims * j + i] = vertValue;
       }
-    }
+    });
   }
 
   /**
@@ -1392,48 +1609,47 @@ public:
     Q_ASSERT(outElemArray->getNumberOfTuples() == elemList->getNumberOfTuples());
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const K* vertArray = inVertexArray->getPointer(0);
     float* elemArray = outElemArray->getPointer(0);
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    const float* elementCentroids = centroids->getPointer(0);
+    const float* vertex = vertices->getPointer(0);
+    const T* elems = elemList->getPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t cDims = inVertexArray->getNumberOfComponents();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
-
-    // Vector to hold vertex-centroid distances, 4 per cell
-    std::vector<float> vertCentDist(numElems * numVertsPerElem);
+    const size_t numDims = 3;
 
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* Elem = elemList->getTuplePointer(i);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    ForEachElementBlock(numElems, Topology::k_MinimumGrain, [=](size_t start, size_t end) {
+      // Vertex-centroid distances of the current element
+      std::vector<float> vertCentDist(numVertsPerElem);
+      for(size_t j = start; j < end; j++)
       {
-        for(size_t k = 0; k < numDims; k++)
+        const T* Elem = elems + numVertsPerElem * j;
+        for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertCentDist[numVertsPerElem * i + j] += (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]) * (vertex[numDims * Elem[j] + k] - elementCentroids[numDims * i + k]);
+          float dist = 0.0f;
+          for(size_t d = 0; d < numDims; d++)
+          {
+            dist += (vertex[numDims * Elem[k] + d] - elementCentroids[numDims * j + d]) * (vertex[numDims * Elem[k] + d] - elementCentroids[numDims * j + d]);
+          }
+          vertCentDist[k] = sqrtf(dist);
         }
-        vertCentDist[numVertsPerElem * i + j] = sqrtf(vertCentDist[numVertsPerElem * i + j]);
-      }
-    }
 
-    for(size_t i = 0; i < cDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
-      {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        float sumDist = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
+        for(size_t i = 0; i < cDims; i++)
         {
-          vertValue += vertArray[cDims * Elem[k] + i] * vertCentDist[numVertsPerElem * j + k];
-          sumDist += vertCentDist[numVertsPerElem * j + k];
+          float vertValue = 0.0;
+          float sumDist = 0.0;
+          for(size_t k = 0; k < numVertsPerElem; k++)
+          {
+            vertValue += vertArray[cDims * Elem[k] + i] * vertCentDist[k];
+            sumDist += vertCentDist[k];
+          }
+          vertValue /= static_cast<float>(sumDist);
+          elemArray[cDims * j + i] = vertValue;
         }
-        vertValue /= static_cast<float>(sumDist);
-        elemArray[cDims * j + i] = vertValue;
       }
-    }
+    });
   }
 
   template <typename T, typename K, typename L, typename M>
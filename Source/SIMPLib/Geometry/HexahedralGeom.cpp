@@ -11,15 +11,20 @@
 
 #include "SIMPLib/Geometry/HexahedralGeom.h"
 
+#include <limits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 
 /**
  * @brief The FindHexDerivativesImpl class implements a threaded algorithm that computes the
@@ -100,15 +105,18 @@ HexahedralGeom::HexahedralGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = HexahedralGeom::CreateSharedVertexList(0);
   m_HexList = HexahedralGeom::CreateSharedHexList(0);
+  m_CompactHexList = CompactHexList::NullPointer();
   m_QuadList = SharedQuadList::NullPointer();
+  m_CompactQuadList = CompactQuadList::NullPointer();
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
   m_UnsharedQuadList = SharedQuadList::NullPointer();
   m_HexasContainingVert = ElementDynamicList::NullPointer();
   m_HexNeighbors = ElementDynamicList::NullPointer();
   m_HexCentroids = FloatArrayType::NullPointer();
   m_HexSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -159,13 +167,45 @@ HexahedralGeom::Pointer HexahedralGeom::CreateGeometry(SharedHexList::Pointer he
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HexahedralGeom::Pointer HexahedralGeom::CreateGeometry(CompactHexList::Pointer hexas, SharedVertexList::Pointer vertices, const QString& name)
+{
+  if(name.isEmpty() == true)
+  {
+    return NullPointer();
+  }
+  if(vertices.get() == nullptr)
+  {
+    return HexahedralGeom::NullPointer();
+  }
+  if(hexas.get() == nullptr)
+  {
+    return HexahedralGeom::NullPointer();
+  }
+  HexahedralGeom* d = new HexahedralGeom();
+  d->setVertices(vertices);
+  d->setCompactHexahedra(hexas);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void HexahedralGeom::initializeWithZeros()
 {
   m_VertexList->initializeWithZeros();
-  m_HexList->initializeWithZeros();
+  if(m_CompactHexList.get() != nullptr)
+  {
+    m_CompactHexList->initializeWithZeros();
+  }
+  else
+  {
+    m_HexList->initializeWithZeros();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -208,7 +248,7 @@ void HexahedralGeom::addAttributeMatrix(const QString& name, AttributeMatrix::Po
 // -----------------------------------------------------------------------------
 size_t HexahedralGeom::getNumberOfElements()
 {
-  return m_HexList->getNumberOfTuples();
+  return static_cast<size_t>(getNumberOfHexas());
 }
 
 // -----------------------------------------------------------------------------
@@ -216,7 +256,14 @@ size_t HexahedralGeom::getNumberOfElements()
 // -----------------------------------------------------------------------------
 int HexahedralGeom::findEdges()
 {
-  m_EdgeList = CreateSharedEdgeList(0);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    CompactEdgeList::Pointer edges = CompactEdgeList::CreateArray(0, QVector<size_t>(1, 2), SIMPL::Geometry::SharedEdgeList);
+    GeometryHelpers::Connectivity::FindHexEdges<uint32_t>(m_CompactHexList, edges);
+    setCompactEdges(edges);
+    return 1;
+  }
+  setEdges(CreateSharedEdgeList(0));
   GeometryHelpers::Connectivity::FindHexEdges<int64_t>(m_HexList, m_EdgeList);
   if(m_EdgeList.get() == nullptr)
   {
@@ -231,6 +278,7 @@ int HexahedralGeom::findEdges()
 void HexahedralGeom::deleteEdges()
 {
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -238,7 +286,14 @@ void HexahedralGeom::deleteEdges()
 // -----------------------------------------------------------------------------
 int HexahedralGeom::findFaces()
 {
-  m_QuadList = CreateSharedQuadList(0);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    CompactQuadList::Pointer quads = CompactQuadList::CreateArray(0, QVector<size_t>(1, 4), SIMPL::Geometry::SharedQuadList);
+    GeometryHelpers::Connectivity::FindHexFaces<uint32_t>(m_CompactHexList, quads);
+    setCompactQuads(quads);
+    return 1;
+  }
+  setQuads(CreateSharedQuadList(0));
   GeometryHelpers::Connectivity::FindHexFaces<int64_t>(m_HexList, m_QuadList);
   if(m_QuadList.get() == nullptr)
   {
@@ -253,6 +308,7 @@ int HexahedralGeom::findFaces()
 void HexahedralGeom::deleteFaces()
 {
   m_QuadList = SharedTriList::NullPointer();
+  m_CompactQuadList = CompactQuadList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -261,7 +317,14 @@ void HexahedralGeom::deleteFaces()
 int HexahedralGeom::findElementsContainingVert()
 {
   m_HexasContainingVert = ElementDynamicList::New();
-  GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_HexList, m_HexasContainingVert, getNumberOfVertices());
+  if(m_CompactHexList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t, uint32_t>(m_CompactHexList, m_HexasContainingVert, getNumberOfVertices());
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_HexList, m_HexasContainingVert, getNumberOfVertices());
+  }
   if(m_HexasContainingVert.get() == nullptr)
   {
     return -1;
@@ -308,7 +371,14 @@ int HexahedralGeom::findElementNeighbors()
     }
   }
   m_HexNeighbors = ElementDynamicList::New();
-  err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_HexList, m_HexasContainingVert, m_HexNeighbors, IGeometry::Type::Hexahedral);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t, uint32_t>(m_CompactHexList, m_HexasContainingVert, m_HexNeighbors, IGeometry::Type::Hexahedral);
+  }
+  else
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_HexList, m_HexasContainingVert, m_HexNeighbors, IGeometry::Type::Hexahedral);
+  }
   if(m_HexNeighbors.get() == nullptr)
   {
     return -1;
@@ -347,7 +417,14 @@ int HexahedralGeom::findElementCentroids()
 {
   QVector<size_t> cDims(1, 3);
   m_HexCentroids = FloatArrayType::CreateArray(getNumberOfHexas(), cDims, SIMPL::StringConstants::HexCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_HexList, m_VertexList, m_HexCentroids);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindElementCentroids<uint32_t>(m_CompactHexList, m_VertexList, m_HexCentroids);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_HexList, m_VertexList, m_HexCentroids);
+  }
   if(m_HexCentroids.get() == nullptr)
   {
     return -1;
@@ -387,7 +464,14 @@ int HexahedralGeom::findElementSizes()
 {
   QVector<size_t> cDims(1, 1);
   m_HexSizes = FloatArrayType::CreateArray(getNumberOfHexas(), cDims, SIMPL::StringConstants::HexVolumes);
-  GeometryHelpers::Topology::FindHexVolumes<int64_t>(m_HexList, m_VertexList, m_HexSizes);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindHexVolumes<uint32_t>(m_CompactHexList, m_VertexList, m_HexSizes);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindHexVolumes<int64_t>(m_HexList, m_VertexList, m_HexSizes);
+  }
   if(m_HexSizes.get() == nullptr)
   {
     return -1;
@@ -426,7 +510,14 @@ int HexahedralGeom::findUnsharedEdges()
 {
   QVector<size_t> cDims(1, 2);
   m_UnsharedEdgeList = SharedEdgeList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedEdgeList);
-  GeometryHelpers::Connectivity::FindUnsharedHexEdges<int64_t>(m_HexList, m_UnsharedEdgeList);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges<uint32_t, int64_t>(m_CompactHexList, m_UnsharedEdgeList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges<int64_t>(m_HexList, m_UnsharedEdgeList);
+  }
   if(m_UnsharedEdgeList.get() == nullptr)
   {
     return -1;
@@ -465,7 +556,14 @@ int HexahedralGeom::findUnsharedFaces()
 {
   QVector<size_t> cDims(1, 4);
   m_UnsharedQuadList = SharedQuadList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedFaceList);
-  GeometryHelpers::Connectivity::FindUnsharedHexFaces<int64_t>(m_HexList, m_UnsharedQuadList);
+  if(m_CompactHexList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces<uint32_t, int64_t>(m_CompactHexList, m_UnsharedQuadList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces<int64_t>(m_HexList, m_UnsharedQuadList);
+  }
   if(m_UnsharedQuadList.get() == nullptr)
   {
     return -1;
@@ -556,7 +654,7 @@ void HexahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   int64_t numHexas = getNumberOfHexas();
 
   if(observable)
@@ -565,14 +663,13 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numHexas), FindHexDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<int64_t>(0, numHexas), FindHexDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -582,6 +679,73 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HexahedralGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  IDataArray::Pointer elements = (m_CompactHexList.get() != nullptr) ? IDataArray::Pointer(m_CompactHexList) : IDataArray::Pointer(m_HexList);
+  int err = MeshReordering::ReorderMesh(this, m_VertexList, elements, {m_EdgeList, m_CompactEdgeList, m_UnsharedEdgeList, m_QuadList, m_CompactQuadList, m_UnsharedQuadList}, ordering, vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HexahedralGeom::setCompactConnectivity(bool compact)
+{
+  if(compact && getNumberOfVertices() > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    return -1;
+  }
+  if(!GeometryHelpers::Connectivity::SetCompactStorage(compact, m_HexList, m_CompactHexList))
+  {
+    return -1;
+  }
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_EdgeList, m_CompactEdgeList);
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_QuadList, m_CompactQuadList);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool HexahedralGeom::getCompactConnectivity()
+{
+  return (m_CompactHexList.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HexahedralGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  IDataArray::Pointer elements = (m_CompactHexList.get() != nullptr) ? IDataArray::Pointer(m_CompactHexList) : IDataArray::Pointer(m_HexList);
+  int err = MeshWelding::WeldMesh(m_VertexList, elements, tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  // The derived lists refer to the old vertex ids and may contain collapsed entries
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteFaces();
+  deleteUnsharedFaces();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -607,6 +771,15 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
     }
   }
 
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactEdgeList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_QuadList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList);
@@ -616,6 +789,15 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
     }
   }
 
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactQuadList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_HexList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_HexList);
@@ -625,6 +807,15 @@ int HexahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writ
     }
   }
 
+  if(m_CompactHexList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactHexList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_UnsharedEdgeList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
@@ -702,7 +893,7 @@ int HexahedralGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFileN
   }
   out << "    <Topology TopologyType=\"Hexahedron\" NumberOfElements=\"" << getNumberOfHexas() << "\">"
       << "\n";
-  out << "      <DataItem Format=\"HDF\" NumberType=\"Int\" Dimensions=\"" << getNumberOfHexas() << " 8\">"
+  out << "      <DataItem Format=\"HDF\" " << GeometryHelpers::GeomIO::XdmfConnectivityNumberType(getCompactConnectivity()) << " Dimensions=\"" << getNumberOfHexas() << " 8\">"
       << "\n";
   out << "        " << hdfFileName << ":/DataContainers/" << dcName << "/" << SIMPL::Geometry::Geometry << "/" << SIMPL::Geometry::SharedHexList << "\n";
   out << "      </DataItem>"
@@ -765,14 +956,18 @@ int HexahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
-  SharedHexList::Pointer hexas = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedHexList>(SIMPL::Geometry::SharedHexList, parentId, preflight, err);
-  if(hexas.get() == nullptr || vertices.get() == nullptr)
+  SharedHexList::Pointer hexas = SharedHexList::NullPointer();
+  CompactHexList::Pointer compactHexas = CompactHexList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedHexList, parentId, preflight, err, hexas, compactHexas);
+  if((hexas.get() == nullptr && compactHexas.get() == nullptr) || vertices.get() == nullptr)
   {
     return -1;
   }
-  size_t numHexas = hexas->getNumberOfTuples();
+  size_t numHexas = (compactHexas.get() != nullptr) ? compactHexas->getNumberOfTuples() : hexas->getNumberOfTuples();
   size_t numVerts = vertices->getNumberOfTuples();
-  SharedQuadList::Pointer quads = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedQuadList>(SIMPL::Geometry::SharedQuadList, parentId, preflight, err);
+  SharedQuadList::Pointer quads = SharedQuadList::NullPointer();
+  CompactQuadList::Pointer compactQuads = CompactQuadList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedQuadList, parentId, preflight, err, quads, compactQuads);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -782,7 +977,9 @@ int HexahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
   {
     return -1;
   }
-  SharedEdgeList::Pointer edges = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedEdgeList>(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err);
+  SharedEdgeList::Pointer edges = SharedEdgeList::NullPointer();
+  CompactEdgeList::Pointer compactEdges = CompactEdgeList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err, edges, compactEdges);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -815,9 +1012,21 @@ int HexahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 
   setVertices(vertices);
   setHexahedra(hexas);
+  if(compactHexas.get() != nullptr)
+  {
+    setCompactHexahedra(compactHexas);
+  }
   setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    setCompactEdges(compactEdges);
+  }
   setUnsharedEdges(bEdges);
   setQuads(quads);
+  if(compactQuads.get() != nullptr)
+  {
+    setCompactQuads(compactQuads);
+  }
   setUnsharedFaces(bQuads);
   setElementCentroids(hexCentroids);
   setElementSizes(hexSizes);
@@ -832,11 +1041,14 @@ int HexahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer HexahedralGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedHexList::Pointer hexas = std::dynamic_pointer_cast<SharedHexList>((getHexahedra().get() == nullptr) ? nullptr : getHexahedra()->deepCopy(forceNoAllocate));
+  SharedHexList::Pointer hexas = std::dynamic_pointer_cast<SharedHexList>((m_HexList.get() == nullptr) ? nullptr : m_HexList->deepCopy(forceNoAllocate));
+  CompactHexList::Pointer compactHexas = std::dynamic_pointer_cast<CompactHexList>((m_CompactHexList.get() == nullptr) ? nullptr : m_CompactHexList->deepCopy(forceNoAllocate));
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((getQuads().get() == nullptr) ? nullptr : getQuads()->deepCopy(forceNoAllocate));
+  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((m_QuadList.get() == nullptr) ? nullptr : m_QuadList->deepCopy(forceNoAllocate));
+  CompactQuadList::Pointer compactQuads = std::dynamic_pointer_cast<CompactQuadList>((m_CompactQuadList.get() == nullptr) ? nullptr : m_CompactQuadList->deepCopy(forceNoAllocate));
   SharedQuadList::Pointer unsharedQuads = std::dynamic_pointer_cast<SharedQuadList>((getUnsharedFaces().get() == nullptr) ? nullptr : getUnsharedFaces()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
+  CompactEdgeList::Pointer compactEdges = std::dynamic_pointer_cast<CompactEdgeList>((m_CompactEdgeList.get() == nullptr) ? nullptr : m_CompactEdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -844,11 +1056,19 @@ IGeometry::Pointer HexahedralGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
-  HexahedralGeom::Pointer copy = HexahedralGeom::CreateGeometry(hexas, verts, getName());
+  HexahedralGeom::Pointer copy = (compactHexas.get() != nullptr) ? HexahedralGeom::CreateGeometry(compactHexas, verts, getName()) : HexahedralGeom::CreateGeometry(hexas, verts, getName());
 
   copy->setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    copy->setCompactEdges(compactEdges);
+  }
   copy->setUnsharedEdges(unsharedEdges);
   copy->setQuads(quads);
+  if(compactQuads.get() != nullptr)
+  {
+    copy->setCompactQuads(compactQuads);
+  }
   copy->setUnsharedFaces(unsharedQuads);
   copy->setElementsContainingVert(elementsContainingVert);
   copy->setElementNeighbors(elementNeighbors);
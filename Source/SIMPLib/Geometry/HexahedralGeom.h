@@ -35,6 +35,15 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
      */
     static Pointer CreateGeometry(SharedHexList::Pointer hexas, SharedVertexList::Pointer vertices, const QString& name);
 
+    /**
+     * @brief CreateGeometry
+     * @param hexas Hexahedra with 32 bit vertex Ids
+     * @param vertices
+     * @param name
+     * @return
+     */
+    static Pointer CreateGeometry(CompactHexList::Pointer hexas, SharedVertexList::Pointer vertices, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedVertexOps
 // -----------------------------------------------------------------------------
@@ -57,6 +66,19 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
      */
     static SharedEdgeList::Pointer CreateSharedEdgeList(int64_t numEdges, bool allocate = true);
 
+    /**
+     * @brief setCompactEdges Stores the edges with 32 bit vertex Ids and releases the 64 bit list.
+     * getEdges() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param edges
+     */
+    void setCompactEdges(CompactEdgeList::Pointer edges);
+
+    /**
+     * @brief getCompactEdges
+     * @return The edges if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactEdgeList::Pointer getCompactEdges();
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedQuadOps
 // -----------------------------------------------------------------------------
@@ -82,12 +104,26 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
 
     /**
      * @brief getQuads
-     * @return
+     * @return The quads with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedQuadList::Pointer getQuads();
 
     /**
-     * @brief setVertsAtQuad
+     * @brief setCompactQuads Stores the quads with 32 bit vertex Ids and releases the 64 bit list.
+     * getQuads() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param quads
+     */
+    void setCompactQuads(CompactQuadList::Pointer quads);
+
+    /**
+     * @brief getCompactQuads
+     * @return The quads if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactQuadList::Pointer getCompactQuads();
+
+    /**
+     * @brief setVertsAtQuad Stores the quads with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param quadId
      * @param verts
      */
@@ -113,7 +149,7 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
     /**
      * @brief getPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the quads are stored with 32 bit vertex Ids
      */
     int64_t* getQuadPointer(int64_t i);
 
@@ -148,12 +184,26 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
 
    /**
     * @brief getHexahedra
-    * @return
+    * @return The hexahedra with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+    * copy, and writing to it does not change the geometry
     */
     SharedHexList::Pointer getHexahedra();
 
     /**
-     * @brief setVertsAtHex
+     * @brief setCompactHexahedra Stores the hexahedra with 32 bit vertex Ids and releases the 64 bit list.
+     * getHexahedra() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param hexas
+     */
+    void setCompactHexahedra(CompactHexList::Pointer hexas);
+
+    /**
+     * @brief getCompactHexahedra
+     * @return The hexahedra if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactHexList::Pointer getCompactHexahedra();
+
+    /**
+     * @brief setVertsAtHex Stores the hexahedra with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param hexId
      * @param verts
      */
@@ -181,7 +231,7 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
     /**
      * @brief getHexPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the hexahedra are stored with 32 bit vertex Ids
      */
     int64_t* getHexPointer(int64_t i);
 
@@ -294,6 +344,37 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -394,12 +475,13 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
 
     /**
      * @brief getEdges
-     * @return
+     * @return The edges with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedEdgeList::Pointer getEdges() override;
 
     /**
-     * @brief setVerts
+     * @brief setVertsAtEdge Stores the edges with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param edgeId
      * @param verts
      */
@@ -423,7 +505,7 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
     /**
      * @brief getEdgePointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the edges are stored with 32 bit vertex Ids
      */
     int64_t* getEdgePointer(int64_t i) override;
 
@@ -536,10 +618,13 @@ class SIMPLib_EXPORT HexahedralGeom : public IGeometry3D
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
+    CompactEdgeList::Pointer m_CompactEdgeList;
     SharedEdgeList::Pointer m_UnsharedEdgeList;
     SharedQuadList::Pointer m_QuadList;
+    CompactQuadList::Pointer m_CompactQuadList;
     SharedQuadList::Pointer m_UnsharedQuadList;
     SharedHexList::Pointer m_HexList;
+    CompactHexList::Pointer m_CompactHexList;
     ElementDynamicList::Pointer m_HexasContainingVert;
     ElementDynamicList::Pointer m_HexNeighbors;
     FloatArrayType::Pointer m_HexCentroids;
@@ -45,6 +45,7 @@
 IGeometry::IGeometry()
 : m_TimeValue(0.0f)
 , m_EnableTimeSeries(false)
+, m_ProgressCounter(this)
 {
 }
 
@@ -90,22 +91,11 @@ QString IGeometry::getGeometryTypeAsString()
 // -----------------------------------------------------------------------------
 void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
 {
-  m_Mutex.lock();
-
-  m_ProgressCounter += counter;
-
-  int64_t progIncrement = max / 100;
-  int64_t prog = 1;
-
-  if(m_ProgressCounter > prog)
+  if(m_ProgressCounter.getTotal() != max)
   {
-    int64_t progressInt = static_cast<int64_t>((static_cast<float>(m_ProgressCounter) / max) * 100.0f);
-    QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
-    notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
-    prog += progIncrement;
+    m_ProgressCounter.setTotal(max);
   }
-
-  m_Mutex.unlock();
+  m_ProgressCounter.increment(counter);
 }
 
 // -----------------------------------------------------------------------------
@@ -114,6 +104,7 @@ void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
 void IGeometry::setMessagePrefix(const QString& name)
 {
   m_MessagePrefix = name;
+  m_ProgressCounter.setPrefix(name);
 }
 
 // -----------------------------------------------------------------------------
@@ -130,6 +121,7 @@ QString IGeometry::getMessagePrefix()
 void IGeometry::setMessageTitle(const QString& title)
 {
   m_MessageTitle = title;
+  m_ProgressCounter.setTitle(title);
 }
 
 // -----------------------------------------------------------------------------
@@ -146,6 +138,7 @@ QString IGeometry::getMessageTitle()
 void IGeometry::setMessageLabel(const QString& label)
 {
   m_MessageLabel = label;
+  m_ProgressCounter.setHumanLabel(label);
 }
 
 // -----------------------------------------------------------------------------
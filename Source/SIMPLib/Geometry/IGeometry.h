@@ -35,11 +35,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QMutex>
 #include <QtCore/QMap>
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Common/ProgressCounter.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/DynamicListArray.hpp"
@@ -59,6 +62,12 @@ typedef Int64ArrayType SharedQuadList;
 typedef Int64ArrayType SharedTetList;
 typedef Int64ArrayType SharedHexList;
 typedef Int64ArrayType SharedFaceList;
+typedef UInt32ArrayType CompactEdgeList;
+typedef UInt32ArrayType CompactTriList;
+typedef UInt32ArrayType CompactQuadList;
+typedef UInt32ArrayType CompactTetList;
+typedef UInt32ArrayType CompactHexList;
+typedef UInt32ArrayType CompactFaceList;
 typedef UInt16Int64DynamicListArray ElementDynamicList;
 
 /**
@@ -131,6 +140,15 @@ class SIMPLib_EXPORT IGeometry : public Observable
       Any = 4294967295U
     };
 
+    /**
+     * @brief The ElementOrdering enum selects how reorderElements() numbers the elements
+     */
+    enum class ElementOrdering : EnumType
+    {
+      SpaceFillingCurve = 0, // Sort the element centroids along a Hilbert curve
+      ReverseCuthillMcKee = 1 // Reduce the id distance between neighboring elements
+    };
+
     using VtkCellTypes = QVector <VtkCellType>;
     using Types = QVector<Type>;
 
@@ -246,6 +264,45 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable) = 0;
 
+    /**
+     * @brief Renumbers the vertices along a space filling curve and the elements with the given ordering so
+     * that neighboring elements and vertices are stored close to each other. The element based connectivity
+     * and measures of the geometry are deleted. Attribute arrays of the vertices and elements must be permuted
+     * with the returned orders, for example with MeshReordering::PermuteTuples().
+     * @param ordering
+     * @param vertexOrder Receives the old id of each new vertex
+     * @param elementOrder Receives the old id of each new element
+     * @return 0 on success, negative if the geometry can not be reordered
+     */
+    virtual int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) = 0;
+
+    /**
+     * @brief Stores the shared element, edge and face lists of the geometry with 32 bit vertex Ids, which halves
+     * their memory, or expands them back to 64 bit Ids. The unshared lists and the element based connectivity
+     * always use 64 bit Ids.
+     * @param compact
+     * @return 0 on success, negative if the geometry has no shared lists or its vertex Ids do not fit in 32 bits
+     */
+    virtual int setCompactConnectivity(bool compact) = 0;
+
+    /**
+     * @brief Returns true if the element list of the geometry is stored with 32 bit vertex Ids
+     * @return
+     */
+    virtual bool getCompactConnectivity() = 0;
+
+    /**
+     * @brief Merges the vertices that lie within the tolerance of each other, renumbers the elements and removes
+     * the elements that collapsed. The element based connectivity and measures and the lists derived from the
+     * vertices are deleted. Attribute arrays of the vertices and elements must be trimmed with the returned ids,
+     * for example with MeshWelding::RemoveTuples().
+     * @param tolerance Largest distance between two merged vertices; 0 only merges identical vertices
+     * @param removedVertices Receives the ids of the removed vertices in ascending order
+     * @param removedElements Receives the ids of the removed elements in ascending order
+     * @return 0 on success, negative if the geometry has no vertex list
+     */
+    virtual int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) = 0;
+
 // -----------------------------------------------------------------------------
 // Generic
 // -----------------------------------------------------------------------------
@@ -409,11 +466,11 @@ class SIMPLib_EXPORT IGeometry : public Observable
 
     AttributeMatrixMap_t m_AttributeMatrices;
 
-    QMutex m_Mutex;
-    int64_t m_ProgressCounter;
+    ProgressCounter m_ProgressCounter;
 
     /**
-     * @brief sendThreadSafeProgressMessage
+     * @brief sendThreadSafeProgressMessage Adds the counter to the progress of the current operation. Messages
+     * are coalesced by the ProgressCounter so this may be called frequently from any thread.
      * @param counter
      * @param max
      */
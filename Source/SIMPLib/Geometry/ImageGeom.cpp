@@ -45,184 +45,101 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#include <algorithm>
+#include <cstddef>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying image
+ * derivative of an arbitrary dimensional field on the underlying image.
+ *
+ * The cells of an image are equally spaced along each axis, so the derivatives are finite differences
+ * scaled by the inverse resolution: central differences in the interior of the image and one sided
+ * differences on its faces. Axes with a single cell have a derivative of 0. The boundary cases are
+ * resolved once per row, which leaves a branch free loop over the interior cells of the row that the
+ * compiler vectorizes. Rows are processed in tiles that span all of the requested planes so that the
+ * neighboring planes of a tile are still cached when the next plane is computed.
  */
 class FindImageDerivativesImpl
 {
 public:
+  static const size_t k_TileBytes = 256 * 1024;
+
   FindImageDerivativesImpl(ImageGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
   : m_Image(image)
   , m_Field(field)
   , m_Derivatives(derivs)
   {
+    std::tie(m_Dims[0], m_Dims[1], m_Dims[2]) = m_Image->getDimensions();
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(res[0], res[1], res[2]) = m_Image->getResolution();
+
+    // Axes with a single cell do not contribute to the Jacobian. If the Jacobian is singular all
+    // derivatives are 0.
+    double spacing[3] = {1.0, 1.0, 1.0};
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(m_Dims[i] > 1)
+      {
+        spacing[i] = static_cast<double>(res[i]);
+      }
+    }
+    bool singular = (spacing[0] * spacing[1] * spacing[2] == 0.0);
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_InvSpacing[i] = (singular || m_Dims[i] == 1) ? 0.0 : 1.0 / spacing[i];
+    }
   }
   virtual ~FindImageDerivativesImpl() = default;
 
+  /**
+   * @brief Returns the number of rows of a tile for rows of the given number of cells
+   * @param numComps
+   * @param rowLength
+   * @return
+   */
+  static size_t ComputeTileRows(int32_t numComps, size_t rowLength)
+  {
+    size_t rowBytes = std::max(rowLength * static_cast<size_t>(numComps) * sizeof(double), static_cast<size_t>(1));
+    return std::max(k_TileBytes / (3 * rowBytes), static_cast<size_t>(1));
+  }
+
   void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
   {
-    double xp[3] = {0.0, 0.0, 0.0};
-    double xm[3] = {0.0, 0.0, 0.0};
-    double factor = 0.0;
-    double xxi, yxi, zxi, xeta, yeta, zeta, xzeta, yzeta, zzeta;
-    xxi = yxi = zxi = xeta = yeta = zeta = xzeta = yzeta = zzeta = 0;
-    double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
-    aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
-    size_t index = 0;
     int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
-    std::vector<double> plusValues(numComps);
-    std::vector<double> minusValues(numComps);
-    std::vector<double> dValuesdXi(numComps);
-    std::vector<double> dValuesdEta(numComps);
-    std::vector<double> dValuesdZeta(numComps);
-
-    size_t dims[3] = {0, 0, 0};
-    std::tie(dims[0], dims[1], dims[2]) = m_Image->getDimensions();
+    size_t tileRows = ComputeTileRows(numComps, xEnd - xStart);
 
     int64_t counter = 0;
     size_t totalElements = m_Image->getNumberOfElements();
     int64_t progIncrement = static_cast<int64_t>(totalElements / 100);
 
-    for(size_t z = zStart; z < zEnd; z++)
+    for(size_t yTileStart = yStart; yTileStart < yEnd; yTileStart += tileRows)
     {
-      for(size_t y = yStart; y < yEnd; y++)
+      size_t yTileEnd = std::min(yTileStart + tileRows, yEnd);
+      for(size_t z = zStart; z < zEnd; z++)
       {
-        for(size_t x = xStart; x < xEnd; x++)
+        for(size_t y = yTileStart; y < yTileEnd; y++)
         {
-          //  Xi derivatives (X)
-          if(dims[0] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == (dims[0] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xxi = factor * (xp[0] - xm[0]);
-          yxi = factor * (xp[1] - xm[1]);
-          zxi = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdXi[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Eta derivatives (Y)
-          if(dims[1] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == (dims[1] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xeta = factor * (xp[0] - xm[0]);
-          yeta = factor * (xp[1] - xm[1]);
-          zeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdEta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Zeta derivatives (Z)
-          if(dims[2] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == (dims[2] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xzeta = factor * (xp[0] - xm[0]);
-          yzeta = factor * (xp[1] - xm[1]);
-          zzeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdZeta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          // Now calculate the Jacobian.  Grids occasionally have
-          // singularities, or points where the Jacobian is infinite (the
-          // inverse is zero).  For these cases, we'll set the Jacobian to
-          // zero, which will result in a zero derivative.
-          aj = xxi * yeta * zzeta + yxi * zeta * xzeta + zxi * xeta * yzeta - zxi * yeta * xzeta - yxi * xeta * zzeta - xxi * zeta * yzeta;
-          if(aj != 0.0)
-          {
-            aj = 1.0 / aj;
-          }
-
-          //  Xi metrics
-          xix = aj * (yeta * zzeta - zeta * yzeta);
-          xiy = -aj * (xeta * zzeta - zeta * xzeta);
-          xiz = aj * (xeta * yzeta - yeta * xzeta);
-
-          //  Eta metrics
-          etax = -aj * (yxi * zzeta - zxi * yzeta);
-          etay = aj * (xxi * zzeta - zxi * xzeta);
-          etaz = -aj * (xxi * yzeta - yxi * xzeta);
-
-          //  Zeta metrics
-          zetax = aj * (yxi * zeta - zxi * yeta);
-          zetay = -aj * (xxi * zeta - zxi * xeta);
-          zetaz = aj * (xxi * yeta - yxi * xeta);
-
-          // Compute the actual derivatives
-          index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
-          }
+          computeRow(z, y, xStart, xEnd, numComps);
 
+          counter += static_cast<int64_t>(xEnd - xStart);
           if(counter > progIncrement)
           {
             m_Image->sendThreadSafeProgressMessage(counter, totalElements);
             counter = 0;
           }
-          counter++;
         }
       }
     }
@@ -235,141 +152,118 @@ public:
   }
 #endif
 
-  void computeIndices(int32_t differenceType, int32_t directionType, size_t& index1, size_t& index2, size_t dims[3], size_t x, size_t y, size_t z, double xp[3], double xm[3]) const
-
+  /**
+   * @brief Computes the derivatives of the cells [xStart, xEnd) of a row of the image
+   * @param z
+   * @param y
+   * @param xStart
+   * @param xEnd
+   * @param numComps
+   */
+  void computeRow(size_t z, size_t y, size_t xStart, size_t xEnd, int32_t numComps) const
   {
-    size_t tmpIndex1 = 0;
-    size_t tmpIndex2 = 0;
-
-    switch(directionType)
-    {
-    case XDirection:
+    const size_t nComps = static_cast<size_t>(numComps);
+    const size_t rowStride = m_Dims[0] * nComps;
+    const size_t planeStride = m_Dims[1] * rowStride;
+    const double* row = m_Field->getPointer(0) + z * planeStride + y * rowStride;
+    double* derivs = m_Derivatives->getPointer(0) + (z * planeStride + y * rowStride) * 3;
+
+    const double* yPlus = nullptr;
+    const double* yMinus = nullptr;
+    double yFactor = 0.0;
+    findNeighbors(y, m_Dims[1], rowStride, row, m_InvSpacing[1], yPlus, yMinus, yFactor);
+
+    const double* zPlus = nullptr;
+    const double* zMinus = nullptr;
+    double zFactor = 0.0;
+    findNeighbors(z, m_Dims[2], planeStride, row, m_InvSpacing[2], zPlus, zMinus, zFactor);
+
+    // Split the row into its first cell, the interior cells and its last cell
+    const size_t dimX = m_Dims[0];
+    if(dimX == 1)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = x + 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(tmpIndex1, y, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x + 1;
-        tmpIndex2 = x - 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(tmpIndex2, y, z, xm);
-      }
-      break;
+      computeSpan(row, 0, 0, yPlus, yMinus, zPlus, zMinus, derivs, nComps, 0, 1, 0.0, yFactor, zFactor);
+      return;
     }
-    case YDirection:
+    size_t interiorStart = std::max(xStart, static_cast<size_t>(1));
+    size_t interiorEnd = std::min(xEnd, dimX - 1);
+    if(xStart == 0)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, tmpIndex1, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        tmpIndex2 = y - 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, tmpIndex2, z, xm);
-      }
-      break;
+      computeSpan(row, numComps, 0, yPlus, yMinus, zPlus, zMinus, derivs, nComps, 0, 1, m_InvSpacing[0], yFactor, zFactor);
     }
-    case ZDirection:
+    if(interiorStart < interiorEnd)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, y, tmpIndex1, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        tmpIndex2 = z - 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, tmpIndex2, xm);
-      }
-      break;
+      computeSpan(row, numComps, -numComps, yPlus, yMinus, zPlus, zMinus, derivs, nComps, interiorStart, interiorEnd, 0.5 * m_InvSpacing[0], yFactor, zFactor);
     }
-    default:
+    if(xEnd == dimX)
     {
-      break;
-    }
+      computeSpan(row, 0, -numComps, yPlus, yMinus, zPlus, zMinus, derivs, nComps, dimX - 1, dimX, m_InvSpacing[0], yFactor, zFactor);
     }
   }
 
-  void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
+  /**
+   * @brief Selects the neighbors of a row along the y or z axis and the factor of their difference
+   * @param index Index of the row along the axis
+   * @param dim Number of cells along the axis
+   * @param stride Distance between neighboring rows along the axis
+   * @param row
+   * @param invSpacing
+   * @param plus
+   * @param minus
+   * @param factor
+   */
+  static void findNeighbors(size_t index, size_t dim, size_t stride, const double* row, double invSpacing, const double*& plus, const double*& minus, double& factor)
   {
-    size_t index1 = 0;
-    size_t index2 = 0;
-
-    factor = 1.0;
-
-    if(differenceType == TwoDimensional)
+    plus = row;
+    minus = row;
+    factor = invSpacing;
+    if(dim == 1)
     {
-      for(size_t i = 0; i < 3; i++)
-      {
-        xp[i] = xm[i] = 0.0;
-      }
-      xp[directionType] = 1.0;
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = minusValues[i] = 0.0;
-      }
+      factor = 0.0;
+      return;
     }
-    else
+    if(index > 0)
     {
-      computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
-      }
+      minus = row - stride;
+    }
+    if(index < dim - 1)
+    {
+      plus = row + stride;
     }
+    if(index > 0 && index < dim - 1)
+    {
+      factor = 0.5 * invSpacing;
+    }
+  }
 
-    if(differenceType == Centered)
+  /**
+   * @brief Computes the derivatives of the cells [xStart, xEnd) of a row. Element i of each of the row
+   * arrays belongs to the same cell and component.
+   * @param row
+   * @param xPlus Offset from an element of the row to its forward neighbor along x
+   * @param xMinus Offset from an element of the row to its backward neighbor along x
+   * @param yPlus
+   * @param yMinus
+   * @param zPlus
+   * @param zMinus
+   * @param derivs
+   * @param nComps
+   * @param xStart
+   * @param xEnd
+   * @param xFactor
+   * @param yFactor
+   * @param zFactor
+   */
+  static void computeSpan(const double* row, ptrdiff_t xPlus, ptrdiff_t xMinus, const double* yPlus, const double* yMinus, const double* zPlus, const double* zMinus, double* derivs,
+                          size_t nComps, size_t xStart, size_t xEnd, double xFactor, double yFactor, double zFactor)
+  {
+    ptrdiff_t start = static_cast<ptrdiff_t>(xStart * nComps);
+    ptrdiff_t end = static_cast<ptrdiff_t>(xEnd * nComps);
+    for(ptrdiff_t i = start; i < end; i++)
     {
-      factor = 0.5;
+      derivs[3 * i] = (row[i + xPlus] - row[i + xMinus]) * xFactor;
+      derivs[3 * i + 1] = (yPlus[i] - yMinus[i]) * yFactor;
+      derivs[3 * i + 2] = (zPlus[i] - zMinus[i]) * zFactor;
     }
   }
 
@@ -377,21 +271,80 @@ private:
   ImageGeom* m_Image;
   DoubleArrayType::Pointer m_Field;
   DoubleArrayType::Pointer m_Derivatives;
+  size_t m_Dims[3] = {0, 0, 0};
+  double m_InvSpacing[3] = {0.0, 0.0, 0.0};
+};
 
-  enum FiniteDifferenceType_t
+/**
+ * @brief The ComputeImageCellIndicesImpl class implements a threaded algorithm that finds the cell of
+ * the image that contains each of a list of points.
+ *
+ * The cell coordinates are computed with the reciprocal resolution and clamped before they are converted
+ * to integers, so the loop over the points is free of data dependent branches. Points on
+ * the upper faces of the image belong to the last cell. Points outside of the image (and NaN coordinates)
+ * receive the index -1.
+ */
+class ComputeImageCellIndicesImpl
+{
+public:
+  ComputeImageCellIndicesImpl(const size_t dims[3], const float res[3], const float origin[3], const float* coords, int64_t* indices, uint8_t* outOfBounds)
+  : m_Coords(coords)
+  , m_Indices(indices)
+  , m_OutOfBounds(outOfBounds)
   {
-    TwoDimensional = 0,
-    LeftSide,
-    RightSide,
-    Centered
-  };
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_Origin[i] = origin[i];
+      m_InvRes[i] = 1.0f / res[i];
+      m_MaxCell[i] = static_cast<float>(dims[i] - 1);
+      m_Extent[i] = static_cast<float>(dims[i]);
+    }
+    m_Strides[0] = 1;
+    m_Strides[1] = static_cast<int64_t>(dims[0]);
+    m_Strides[2] = static_cast<int64_t>(dims[0] * dims[1]);
+  }
+  virtual ~ComputeImageCellIndicesImpl() = default;
 
-  enum DirectionType_t
+  void compute(size_t start, size_t end) const
   {
-    XDirection = 0,
-    YDirection,
-    ZDirection
-  };
+    for(size_t i = start; i < end; i++)
+    {
+      const float* p = m_Coords + 3 * i;
+      int64_t index = 0;
+      int32_t inside = 1;
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        float c = (p[axis] - m_Origin[axis]) * m_InvRes[axis];
+        inside &= static_cast<int32_t>(c >= 0.0f) & static_cast<int32_t>(c <= m_Extent[axis]);
+        c = c > 0.0f ? c : 0.0f;
+        c = c < m_MaxCell[axis] ? c : m_MaxCell[axis];
+        index += static_cast<int64_t>(c) * m_Strides[axis];
+      }
+      // All bits are set for points outside of the image, which turns the index into -1
+      m_Indices[i] = index | (static_cast<int64_t>(inside) - 1);
+      if(nullptr != m_OutOfBounds)
+      {
+        m_OutOfBounds[i] = static_cast<uint8_t>(1 - inside);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Coords;
+  int64_t* m_Indices;
+  uint8_t* m_OutOfBounds;
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+  float m_InvRes[3] = {0.0f, 0.0f, 0.0f};
+  float m_MaxCell[3] = {0.0f, 0.0f, 0.0f};
+  float m_Extent[3] = {0.0f, 0.0f, 0.0f};
+  int64_t m_Strides[3] = {0, 0, 0};
 };
 
 // -----------------------------------------------------------------------------
@@ -417,7 +370,7 @@ ImageGeom::ImageGeom()
   m_Origin[1] = 0.0f;
   m_Origin[2] = 0.0f;
   m_VoxelSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -878,7 +831,7 @@ void ImageGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -888,23 +841,19 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / init.default_num_threads();
-
-  if(grain == 0) // This can happen if dims[2] > number of processors
-  {
-    grain = 1;
-  }
+  // Each task works on a slab of planes that is split into tiles of rows; the rows are never split
+  size_t grain = ParallelExecutionContext::Instance()->computeGrainSize(dims[2]);
+  size_t tileRows = FindImageDerivativesImpl::ComputeTileRows(field->getNumberOfComponents(), dims[0]);
 
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindImageDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], tileRows, 0, dims[0], dims[0]),
+                                                      FindImageDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -914,6 +863,47 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ImageGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  // The elements of a structured grid are implicitly ordered
+  (void)ordering;
+  vertexOrder.clear();
+  elementOrder.clear();
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ImageGeom::setCompactConnectivity(bool compact)
+{
+  // The elements of a structured grid are implicit, so there is no connectivity to compact
+  return compact ? -1 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageGeom::getCompactConnectivity()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ImageGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  // The vertices of a structured grid are implicit
+  (void)tolerance;
+  removedVertices.clear();
+  removedElements.clear();
+  return -1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1166,3 +1156,40 @@ ImageGeom::ErrorType ImageGeom::computeCellIndex(float coords[3], size_t& index)
   }
   return err;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageGeom::computeCellIndices(const float* coords, size_t numPoints, int64_t* indices, uint8_t* outOfBounds) const
+{
+  bool valid = true;
+  for(size_t i = 0; i < 3; i++)
+  {
+    valid = valid && m_Dimensions[i] > 0 && m_Resolution[i] > 0.0f;
+  }
+  if(!valid)
+  {
+    std::fill(indices, indices + numPoints, -1);
+    if(nullptr != outOfBounds)
+    {
+      std::fill(outOfBounds, outOfBounds + numPoints, 1);
+    }
+    return numPoints;
+  }
+
+  ComputeImageCellIndicesImpl impl(m_Dimensions, m_Resolution, m_Origin, coords, indices, outOfBounds);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel())
+  {
+    context->parallelFor(tbb::blocked_range<size_t>(0, numPoints, context->computeGrainSize(numPoints, 4096)), impl);
+  }
+  else
+#endif
+  {
+    impl.compute(0, numPoints);
+  }
+
+  return static_cast<size_t>(std::count(indices, indices + numPoints, -1));
+}
@@ -224,6 +224,37 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -344,6 +375,18 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     */
     ErrorType computeCellIndex(float coords[3], size_t& index);
 
+    /**
+     * @brief computeCellIndices Computes the index of the cell that contains each of the points. This
+     * is the batched version of computeCellIndex() and runs multi-threaded over the points. Points on the
+     * upper faces of the image belong to the last cell.
+     * @param coords numPoints x 3 coordinates
+     * @param numPoints
+     * @param indices Receives the index into a cell array for each point or -1 if the point is outside of the image
+     * @param outOfBounds Receives 1 for each point outside of the image and 0 otherwise. May be nullptr.
+     * @return The number of points outside of the image
+     */
+    size_t computeCellIndices(const float* coords, size_t numPoints, int64_t* indices, uint8_t* outOfBounds = nullptr) const;
+
   protected:
 
     ImageGeom();
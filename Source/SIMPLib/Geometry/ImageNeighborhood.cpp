@@ -0,0 +1,248 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLib/Geometry/ImageNeighborhood.h"
+
+#include <tuple>
+
+#include "SIMPLib/Geometry/IGeometryGrid.h"
+
+namespace
+{
+const size_t k_NumCases = 64;
+
+// The 26 neighbor directions as x, y, z offsets: the 6 face neighbors, the 12 edge neighbors and the 8
+// vertex neighbors. Within each group the opposite of direction i is direction (groupSize - 1 - i).
+const int k_Directions[ImageNeighborhood::k_MaxNeighbors][3] = {
+    {0, 0, -1},  {0, -1, 0},  {-1, 0, 0},  {1, 0, 0},   {0, 1, 0},    {0, 0, 1},
+
+    {0, -1, -1}, {-1, 0, -1}, {1, 0, -1},  {0, 1, -1},  {-1, -1, 0},  {1, -1, 0},
+    {-1, 1, 0},  {1, 1, 0},   {0, -1, 1},  {-1, 0, 1},  {1, 0, 1},    {0, 1, 1},
+
+    {-1, -1, -1}, {1, -1, -1}, {-1, 1, -1}, {1, 1, -1}, {-1, -1, 1}, {1, -1, 1}, {-1, 1, 1}, {1, 1, 1}};
+
+// -----------------------------------------------------------------------------
+// Resolves the offset of a neighbor along one axis for a cell in the given axis case. Returns false if the
+// neighbor is outside of the image and must be skipped.
+// -----------------------------------------------------------------------------
+bool ResolveAxisOffset(int delta, size_t axisCase, size_t dim, ImageNeighborhood::BoundaryPolicy policy, int64_t& offset)
+{
+  offset = delta;
+  bool outside = (delta < 0 && (axisCase == 0 || axisCase == 3)) || (delta > 0 && (axisCase == 2 || axisCase == 3));
+  if(!outside)
+  {
+    return true;
+  }
+  switch(policy)
+  {
+  case ImageNeighborhood::BoundaryPolicy::Skip:
+    return false;
+  case ImageNeighborhood::BoundaryPolicy::Clamp:
+    offset = 0;
+    return true;
+  case ImageNeighborhood::BoundaryPolicy::Periodic:
+    offset = delta < 0 ? static_cast<int64_t>(dim) - 1 : 1 - static_cast<int64_t>(dim);
+    return true;
+  }
+  return false;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::ImageNeighborhood(size_t xDim, size_t yDim, size_t zDim, Connectivity connectivity, BoundaryPolicy policy)
+: m_Connectivity(connectivity)
+, m_BoundaryPolicy(policy)
+{
+  m_Dims[0] = xDim;
+  m_Dims[1] = yDim;
+  m_Dims[2] = zDim;
+  buildCases();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::~ImageNeighborhood() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::Pointer ImageNeighborhood::New(size_t xDim, size_t yDim, size_t zDim, Connectivity connectivity, BoundaryPolicy policy)
+{
+  return Pointer(new ImageNeighborhood(xDim, yDim, zDim, connectivity, policy));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::Pointer ImageNeighborhood::New(const IGeometryGrid* grid, Connectivity connectivity, BoundaryPolicy policy)
+{
+  if(nullptr == grid)
+  {
+    return NullPointer();
+  }
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = grid->getDimensions();
+  return New(dims[0], dims[1], dims[2], connectivity, policy);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageNeighborhood::GetDirection(size_t direction, int offset[3])
+{
+  offset[0] = k_Directions[direction][0];
+  offset[1] = k_Directions[direction][1];
+  offset[2] = k_Directions[direction][2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageNeighborhood::GetOppositeDirection(size_t direction)
+{
+  if(direction < 6)
+  {
+    return 5 - direction;
+  }
+  if(direction < 18)
+  {
+    return 6 + 17 - direction;
+  }
+  return 18 + 25 - direction;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::Connectivity ImageNeighborhood::getConnectivity() const
+{
+  return m_Connectivity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::BoundaryPolicy ImageNeighborhood::getBoundaryPolicy() const
+{
+  return m_BoundaryPolicy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageNeighborhood::getDimensions(size_t dims[3]) const
+{
+  dims[0] = m_Dims[0];
+  dims[1] = m_Dims[1];
+  dims[2] = m_Dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageNeighborhood::getNumberOfElements() const
+{
+  return m_Dims[0] * m_Dims[1] * m_Dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageNeighborhood::getNumberOfDirections() const
+{
+  return static_cast<size_t>(m_Connectivity);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageNeighborhood::Neighbors ImageNeighborhood::getNeighbors(size_t x, size_t y, size_t z) const
+{
+  Neighbors neighbors;
+  neighbors.x = x;
+  neighbors.y = y;
+  neighbors.z = z;
+  neighbors.index = (z * m_Dims[1] + y) * m_Dims[0] + x;
+  setCase(neighbors, AxisCase(x, m_Dims[0]) + 4 * (AxisCase(y, m_Dims[1]) + 4 * AxisCase(z, m_Dims[2])));
+  return neighbors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageNeighborhood::computeTileRows(size_t bytesPerElement) const
+{
+  size_t rowBytes = std::max(m_Dims[0] * bytesPerElement, static_cast<size_t>(1));
+  size_t rows = k_TileBytes / (3 * rowBytes);
+  // Leave room for the halo row on each side of the tile
+  return rows > 3 ? rows - 2 : 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageNeighborhood::buildCases()
+{
+  m_Offsets.assign(k_NumCases * k_MaxNeighbors, 0);
+  m_Directions.assign(k_NumCases * k_MaxNeighbors, 0);
+
+  const int64_t strides[3] = {1, static_cast<int64_t>(m_Dims[0]), static_cast<int64_t>(m_Dims[0] * m_Dims[1])};
+  const size_t numDirections = getNumberOfDirections();
+  for(size_t caseIndex = 0; caseIndex < k_NumCases; caseIndex++)
+  {
+    const size_t axisCases[3] = {caseIndex % 4, (caseIndex / 4) % 4, caseIndex / 16};
+    size_t count = 0;
+    for(size_t d = 0; d < numDirections; d++)
+    {
+      int64_t offset = 0;
+      bool valid = true;
+      for(size_t axis = 0; axis < 3 && valid; axis++)
+      {
+        int64_t axisOffset = 0;
+        valid = ResolveAxisOffset(k_Directions[d][axis], axisCases[axis], m_Dims[axis], m_BoundaryPolicy, axisOffset);
+        offset += axisOffset * strides[axis];
+      }
+      if(valid)
+      {
+        m_Offsets[caseIndex * k_MaxNeighbors + count] = offset;
+        m_Directions[caseIndex * k_MaxNeighbors + count] = static_cast<uint8_t>(d);
+        count++;
+      }
+    }
+    m_Counts[caseIndex] = count;
+  }
+}
@@ -0,0 +1,342 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range2d.h>
+#endif
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+class IGeometryGrid;
+
+/**
+ * @brief The ImageNeighborhood class visits every cell of an image (or rectilinear grid) together with the
+ * linear indices of its face, edge or vertex connected neighbors. Filters that work on voxel neighborhoods
+ * (derivatives, smoothing, erosion/dilation, neighbor counting, ...) only supply a kernel that is called with
+ * the neighbors of one cell; the index math, the boundary handling, the tiling and the threading are done here.
+ *
+ * The neighbors of a cell only depend on whether the cell lies on the lower face, in the interior or on the
+ * upper face of the image along each axis (or whether the axis has a single cell). The neighbor offsets for
+ * each of these cases are computed once when the neighborhood is created, so the kernel is called without any
+ * per cell bounds checks; the interior cells of a row all share the same offsets. Neighbors outside of the
+ * image are resolved by the boundary policy.
+ *
+ * forEach() processes the rows of the image in tiles of rows that span all planes, so that the neighboring
+ * rows (the halo) of the rows in a tile are still cached when the next plane is processed. The tiles are
+ * distributed over the threads of the ParallelExecutionContext.
+ *
+ * The directions are ordered so that the 6 face neighbors come first, followed by the 12 edge neighbors and
+ * the 8 vertex neighbors. Each connectivity therefore uses a prefix of the direction list.
+ */
+class SIMPLib_EXPORT ImageNeighborhood
+{
+public:
+  SIMPL_SHARED_POINTERS(ImageNeighborhood)
+  SIMPL_TYPE_MACRO(ImageNeighborhood)
+
+  static const size_t k_MaxNeighbors = 26;
+  static const size_t k_TileBytes = 256 * 1024;
+
+  /**
+   * @brief The neighbors of a cell that share a face, an edge or a vertex with it
+   */
+  enum class Connectivity : int
+  {
+    Face = 6,
+    Edge = 18,
+    Vertex = 26
+  };
+
+  /**
+   * @brief How neighbors that lie outside of the image are handled
+   */
+  enum class BoundaryPolicy : int
+  {
+    Skip = 0,    //!< The neighbor is left out
+    Clamp = 1,   //!< The neighbor is replaced by the closest cell of the image, which may be the cell itself
+    Periodic = 2 //!< The neighbor wraps around to the opposite side of the image
+  };
+
+  /**
+   * @brief The Neighbors struct is passed to the kernel for each cell
+   */
+  struct Neighbors
+  {
+    size_t index = 0; //!< Linear index of the cell
+    size_t x = 0;
+    size_t y = 0;
+    size_t z = 0;
+    size_t count = 0;                    //!< Number of neighbors
+    const int64_t* offsets = nullptr;    //!< Offset of the linear index of each neighbor from index
+    const uint8_t* directions = nullptr; //!< Direction of each neighbor, see GetDirection()
+
+    size_t size() const
+    {
+      return count;
+    }
+
+    /**
+     * @brief Returns the linear index of neighbor k
+     * @param k
+     * @return
+     */
+    size_t operator[](size_t k) const
+    {
+      return static_cast<size_t>(static_cast<int64_t>(index) + offsets[k]);
+    }
+
+    /**
+     * @brief Returns the direction of neighbor k
+     * @param k
+     * @return
+     */
+    size_t direction(size_t k) const
+    {
+      return directions[k];
+    }
+  };
+
+  /**
+   * @brief Creates the neighborhood for an image with the given number of cells along each axis
+   * @param xDim
+   * @param yDim
+   * @param zDim
+   * @param connectivity
+   * @param policy
+   * @return
+   */
+  static Pointer New(size_t xDim, size_t yDim, size_t zDim, Connectivity connectivity = Connectivity::Face, BoundaryPolicy policy = BoundaryPolicy::Skip);
+
+  /**
+   * @brief Creates the neighborhood for the cells of an ImageGeom or RectGridGeom
+   * @param grid
+   * @param connectivity
+   * @param policy
+   * @return A null pointer if the grid is null
+   */
+  static Pointer New(const IGeometryGrid* grid, Connectivity connectivity = Connectivity::Face, BoundaryPolicy policy = BoundaryPolicy::Skip);
+
+  virtual ~ImageNeighborhood();
+
+  /**
+   * @brief Returns the offset of a direction along each axis
+   * @param direction
+   * @param offset Receives -1, 0 or 1 for each axis
+   */
+  static void GetDirection(size_t direction, int offset[3]);
+
+  /**
+   * @brief Returns the direction that points the opposite way
+   * @param direction
+   * @return
+   */
+  static size_t GetOppositeDirection(size_t direction);
+
+  Connectivity getConnectivity() const;
+  BoundaryPolicy getBoundaryPolicy() const;
+
+  /**
+   * @brief Returns the number of cells along each axis
+   * @param dims
+   */
+  void getDimensions(size_t dims[3]) const;
+
+  /**
+   * @brief Returns the number of cells of the image
+   * @return
+   */
+  size_t getNumberOfElements() const;
+
+  /**
+   * @brief Returns the number of neighbors of a cell that has all of its neighbors inside of the image
+   * @return
+   */
+  size_t getNumberOfDirections() const;
+
+  /**
+   * @brief Returns the neighbors of a single cell
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  Neighbors getNeighbors(size_t x, size_t y, size_t z) const;
+
+  /**
+   * @brief Returns the number of rows of a tile so that the rows of a tile and their halo in three consecutive
+   * planes fit into k_TileBytes
+   * @param bytesPerElement Number of bytes that the kernel reads per cell
+   * @return
+   */
+  size_t computeTileRows(size_t bytesPerElement) const;
+
+  /**
+   * @brief Calls kernel(const Neighbors&) for every cell of the image. The kernel is called concurrently from
+   * several threads, so it must only write to data that belongs to the cell it is called for.
+   * @param kernel
+   * @param bytesPerElement Number of bytes that the kernel reads per cell. It only affects the tile size.
+   */
+  template <typename KernelType> void forEach(const KernelType& kernel, size_t bytesPerElement = sizeof(float)) const
+  {
+    size_t tileRows = computeTileRows(bytesPerElement);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+    if(context->getUseParallel())
+    {
+      size_t zGrain = context->computeGrainSize(m_Dims[2]);
+      context->parallelFor(tbb::blocked_range2d<size_t, size_t>(0, m_Dims[2], zGrain, 0, m_Dims[1], tileRows), [this, &kernel, tileRows](const tbb::blocked_range2d<size_t, size_t>& r) {
+        forEachInRange(kernel, r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end(), tileRows);
+      });
+      return;
+    }
+#endif
+    forEachInRange(kernel, 0, m_Dims[2], 0, m_Dims[1], tileRows);
+  }
+
+  /**
+   * @brief Calls the kernel for the cells of the rows [yStart, yEnd) in the planes [zStart, zEnd) on the
+   * calling thread
+   * @param kernel
+   * @param zStart
+   * @param zEnd
+   * @param yStart
+   * @param yEnd
+   * @param tileRows Number of rows that are processed in all planes before moving on to the next rows
+   */
+  template <typename KernelType> void forEachInRange(const KernelType& kernel, size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t tileRows) const
+  {
+    tileRows = std::max(tileRows, static_cast<size_t>(1));
+    const size_t dimX = m_Dims[0];
+    for(size_t yTileStart = yStart; yTileStart < yEnd; yTileStart += tileRows)
+    {
+      size_t yTileEnd = std::min(yTileStart + tileRows, yEnd);
+      for(size_t z = zStart; z < zEnd; z++)
+      {
+        for(size_t y = yTileStart; y < yTileEnd; y++)
+        {
+          size_t rowCase = 4 * (AxisCase(y, m_Dims[1]) + 4 * AxisCase(z, m_Dims[2]));
+          Neighbors neighbors;
+          neighbors.y = y;
+          neighbors.z = z;
+          neighbors.index = (z * m_Dims[1] + y) * dimX;
+
+          if(dimX == 1)
+          {
+            setCase(neighbors, rowCase + 3);
+            kernel(neighbors);
+            continue;
+          }
+
+          setCase(neighbors, rowCase);
+          kernel(neighbors);
+
+          // Every interior cell of the row has the same neighbor offsets
+          setCase(neighbors, rowCase + 1);
+          size_t rowStart = neighbors.index;
+          for(size_t x = 1; x < dimX - 1; x++)
+          {
+            neighbors.x = x;
+            neighbors.index = rowStart + x;
+            kernel(neighbors);
+          }
+
+          setCase(neighbors, rowCase + 2);
+          neighbors.x = dimX - 1;
+          neighbors.index = rowStart + dimX - 1;
+          kernel(neighbors);
+        }
+      }
+    }
+  }
+
+protected:
+  ImageNeighborhood(size_t xDim, size_t yDim, size_t zDim, Connectivity connectivity, BoundaryPolicy policy);
+
+  /**
+   * @brief Returns the position of a cell along an axis: 0 on the lower face, 1 in the interior, 2 on the
+   * upper face or 3 if the axis has a single cell
+   * @param i
+   * @param dim
+   * @return
+   */
+  static size_t AxisCase(size_t i, size_t dim)
+  {
+    if(dim == 1)
+    {
+      return 3;
+    }
+    if(i == 0)
+    {
+      return 0;
+    }
+    return i == dim - 1 ? 2 : 1;
+  }
+
+  /**
+   * @brief Points the neighbors to the offsets of a case
+   * @param neighbors
+   * @param caseIndex xCase + 4 * (yCase + 4 * zCase)
+   */
+  void setCase(Neighbors& neighbors, size_t caseIndex) const
+  {
+    neighbors.count = m_Counts[caseIndex];
+    neighbors.offsets = m_Offsets.data() + caseIndex * k_MaxNeighbors;
+    neighbors.directions = m_Directions.data() + caseIndex * k_MaxNeighbors;
+  }
+
+  /**
+   * @brief Computes the neighbor offsets of all 64 cases
+   */
+  void buildCases();
+
+private:
+  size_t m_Dims[3] = {0, 0, 0};
+  Connectivity m_Connectivity = Connectivity::Face;
+  BoundaryPolicy m_BoundaryPolicy = BoundaryPolicy::Skip;
+
+  size_t m_Counts[64];
+  std::vector<int64_t> m_Offsets;
+  std::vector<uint8_t> m_Directions;
+
+  ImageNeighborhood(const ImageNeighborhood&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ImageNeighborhood&) = delete;    // Move assignment Not Implemented
+};
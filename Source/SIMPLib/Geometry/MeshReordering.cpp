@@ -0,0 +1,472 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLib/Geometry/MeshReordering.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+
+namespace
+{
+const size_t k_MinimumGrain = 4096;
+const int k_MaxPeripheralSearches = 8;
+
+using KeyedId = GeometryHelpers::KeyedId; // Sort key and element id
+
+// -----------------------------------------------------------------------------
+// Replaces every id of a 64 bit or compact 32 bit vertex list by its new id
+// -----------------------------------------------------------------------------
+template <typename T> void RenumberTypedIds(typename DataArray<T>::Pointer list, const std::vector<int64_t>& newIds)
+{
+  T* ids = list->getPointer(0);
+  const int64_t numIds = static_cast<int64_t>(newIds.size());
+  GeometryHelpers::ForEachElementBlock(list->getSize(), k_MinimumGrain, [=, &newIds](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t id = static_cast<int64_t>(ids[i]);
+      if(id >= 0 && id < numIds)
+      {
+        ids[i] = static_cast<T>(newIds[id]);
+      }
+    }
+  });
+}
+
+/**
+ * @brief The LevelStructure class runs breadth first searches over the elements that are not numbered yet.
+ * Each search is stamped, so the visited flags never have to be cleared.
+ */
+class LevelStructure
+{
+public:
+  LevelStructure(ElementDynamicList* neighbors, size_t numElements)
+  : m_Neighbors(neighbors)
+  , m_Stamps(numElements, 0)
+  {
+    m_Queue.reserve(numElements);
+  }
+
+  /**
+   * @brief Visits the component of the root level by level
+   * @param root
+   * @param numbered Elements that must not be visited
+   * @return The number of levels
+   */
+  size_t search(int64_t root, const std::vector<uint8_t>& numbered)
+  {
+    m_Stamp++;
+    m_Queue.clear();
+    m_Queue.push_back(root);
+    m_Stamps[root] = m_Stamp;
+    size_t numLevels = 0;
+    size_t levelStart = 0;
+    while(levelStart < m_Queue.size())
+    {
+      size_t levelEnd = m_Queue.size();
+      m_LastLevelStart = levelStart;
+      for(size_t q = levelStart; q < levelEnd; q++)
+      {
+        int64_t elem = m_Queue[q];
+        uint16_t count = m_Neighbors->getNumberOfElements(elem);
+        int64_t* list = m_Neighbors->getElementListPointer(elem);
+        for(uint16_t k = 0; k < count; k++)
+        {
+          int64_t neighbor = list[k];
+          if(neighbor >= 0 && static_cast<size_t>(neighbor) < m_Stamps.size() && m_Stamps[neighbor] != m_Stamp && numbered[neighbor] == 0)
+          {
+            m_Stamps[neighbor] = m_Stamp;
+            m_Queue.push_back(neighbor);
+          }
+        }
+      }
+      levelStart = levelEnd;
+      numLevels++;
+    }
+    return numLevels;
+  }
+
+  /**
+   * @brief Returns the element of the last level of the previous search with the fewest neighbors
+   * @return
+   */
+  int64_t findMinimumDegreeInLastLevel() const
+  {
+    int64_t best = m_Queue[m_LastLevelStart];
+    for(size_t q = m_LastLevelStart + 1; q < m_Queue.size(); q++)
+    {
+      if(m_Neighbors->getNumberOfElements(m_Queue[q]) < m_Neighbors->getNumberOfElements(best))
+      {
+        best = m_Queue[q];
+      }
+    }
+    return best;
+  }
+
+private:
+  ElementDynamicList* m_Neighbors;
+  std::vector<uint32_t> m_Stamps;
+  uint32_t m_Stamp = 0;
+  std::vector<int64_t> m_Queue;
+  size_t m_LastLevelStart = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReordering::MeshReordering() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReordering::~MeshReordering() = default;
+
+// -----------------------------------------------------------------------------
+// Skilling's transpose algorithm ("Programming the Hilbert curve", 2004): the coordinates are converted in
+// place into the transposed Hilbert index, whose bits are then interleaved into the key.
+// -----------------------------------------------------------------------------
+uint64_t MeshReordering::HilbertKey(uint32_t x, uint32_t y, uint32_t z, int bits)
+{
+  uint32_t X[3] = {x, y, z};
+  const uint32_t M = 1u << (bits - 1);
+
+  // Inverse undo
+  for(uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    uint32_t P = Q - 1;
+    for(int i = 0; i < 3; i++)
+    {
+      if((X[i] & Q) != 0)
+      {
+        X[0] ^= P;
+      }
+      else
+      {
+        uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  X[1] ^= X[0];
+  X[2] ^= X[1];
+  uint32_t t = 0;
+  for(uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    if((X[2] & Q) != 0)
+    {
+      t ^= Q - 1;
+    }
+  }
+  X[0] ^= t;
+  X[1] ^= t;
+  X[2] ^= t;
+
+  uint64_t key = 0;
+  for(int b = bits - 1; b >= 0; b--)
+  {
+    key = (key << 3) | (static_cast<uint64_t>((X[0] >> b) & 1) << 2) | (static_cast<uint64_t>((X[1] >> b) & 1) << 1) | static_cast<uint64_t>((X[2] >> b) & 1);
+  }
+  return key;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> MeshReordering::FindHilbertOrder(const float* coords, size_t numPoints)
+{
+  std::vector<int64_t> order(numPoints, 0);
+  if(numPoints == 0)
+  {
+    return order;
+  }
+
+  // NaN coordinates fail the comparisons and are ignored by the bounds
+  float minCoords[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float maxCoords[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      float c = coords[3 * i + d];
+      minCoords[d] = c < minCoords[d] ? c : minCoords[d];
+      maxCoords[d] = c > maxCoords[d] ? c : maxCoords[d];
+    }
+  }
+
+  // The same scale is used for all axes so that the curve visits cubes instead of stretched boxes
+  float extent = 0.0f;
+  for(size_t d = 0; d < 3; d++)
+  {
+    extent = std::max(extent, maxCoords[d] - minCoords[d]);
+  }
+  const float maxCell = static_cast<float>((1u << k_HilbertBits) - 1);
+  const float scale = (extent > 0.0f && extent <= std::numeric_limits<float>::max()) ? maxCell / extent : 0.0f;
+
+  std::vector<KeyedId> keys(numPoints);
+  GeometryHelpers::ForEachElementBlock(numPoints, k_MinimumGrain, [&](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      uint32_t cell[3] = {0, 0, 0};
+      for(size_t d = 0; d < 3; d++)
+      {
+        float c = (coords[3 * i + d] - minCoords[d]) * scale;
+        c = c > 0.0f ? c : 0.0f;
+        c = c < maxCell ? c : maxCell;
+        cell[d] = static_cast<uint32_t>(c);
+      }
+      keys[i] = KeyedId(HilbertKey(cell[0], cell[1], cell[2]), static_cast<int64_t>(i));
+    }
+  });
+  GeometryHelpers::SortKeyedIds(keys, k_MinimumGrain);
+
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> MeshReordering::FindReverseCuthillMcKeeOrder(ElementDynamicList::Pointer neighbors, size_t numElements)
+{
+  std::vector<int64_t> order;
+  order.reserve(numElements);
+  if(neighbors.get() == nullptr || neighbors->size() < numElements)
+  {
+    for(size_t i = 0; i < numElements; i++)
+    {
+      order.push_back(static_cast<int64_t>(i));
+    }
+    return order;
+  }
+
+  // Candidate start elements, by increasing number of neighbors
+  std::vector<KeyedId> byDegree(numElements);
+  for(size_t i = 0; i < numElements; i++)
+  {
+    byDegree[i] = KeyedId(neighbors->getNumberOfElements(i), static_cast<int64_t>(i));
+  }
+  std::sort(byDegree.begin(), byDegree.end());
+
+  std::vector<uint8_t> numbered(numElements, 0);
+  LevelStructure levels(neighbors.get(), numElements);
+  std::vector<KeyedId> adjacent;
+  for(const KeyedId& candidate : byDegree)
+  {
+    int64_t root = candidate.second;
+    if(numbered[root] != 0)
+    {
+      continue;
+    }
+
+    // Move the root to a pseudo-peripheral element of its component (George and Liu)
+    size_t eccentricity = levels.search(root, numbered);
+    for(int s = 0; s < k_MaxPeripheralSearches; s++)
+    {
+      int64_t next = levels.findMinimumDegreeInLastLevel();
+      size_t nextEccentricity = levels.search(next, numbered);
+      if(nextEccentricity <= eccentricity)
+      {
+        break;
+      }
+      root = next;
+      eccentricity = nextEccentricity;
+    }
+
+    // Cuthill-McKee: number the component breadth first, visiting the neighbors of each element by
+    // increasing number of neighbors
+    size_t head = order.size();
+    order.push_back(root);
+    numbered[root] = 1;
+    while(head < order.size())
+    {
+      int64_t elem = order[head++];
+      uint16_t count = neighbors->getNumberOfElements(elem);
+      int64_t* list = neighbors->getElementListPointer(elem);
+      adjacent.clear();
+      for(uint16_t k = 0; k < count; k++)
+      {
+        int64_t neighbor = list[k];
+        if(neighbor >= 0 && static_cast<size_t>(neighbor) < numElements && numbered[neighbor] == 0)
+        {
+          numbered[neighbor] = 1;
+          adjacent.push_back(KeyedId(neighbors->getNumberOfElements(neighbor), neighbor));
+        }
+      }
+      std::sort(adjacent.begin(), adjacent.end());
+      for(const KeyedId& a : adjacent)
+      {
+        order.push_back(a.second);
+      }
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> MeshReordering::InvertOrder(const std::vector<int64_t>& order)
+{
+  std::vector<int64_t> newIds(order.size(), -1);
+  for(size_t i = 0; i < order.size(); i++)
+  {
+    newIds[order[i]] = static_cast<int64_t>(i);
+  }
+  return newIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool MeshReordering::PermuteTuples(IDataArray::Pointer array, const std::vector<int64_t>& order)
+{
+  if(array.get() == nullptr || array->getNumberOfTuples() != order.size())
+  {
+    return false;
+  }
+  if(order.empty() || !array->isAllocated())
+  {
+    return true;
+  }
+
+  IDataArray::Pointer source = array->deepCopy();
+
+  // Neighbor lists, string arrays and other arrays that do not store their values contiguously are
+  // copied tuple by tuple through the IDataArray interface
+  if(array->getVoidPointer(0) == nullptr || std::dynamic_pointer_cast<StringDataArray>(array).get() != nullptr)
+  {
+    for(size_t i = 0; i < order.size(); i++)
+    {
+      if(!array->copyFromArray(i, source, static_cast<size_t>(order[i]), 1))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const size_t tupleBytes = array->getTypeSize() * static_cast<size_t>(array->getNumberOfComponents());
+  const uint8_t* src = static_cast<const uint8_t*>(source->getVoidPointer(0));
+  uint8_t* dest = static_cast<uint8_t*>(array->getVoidPointer(0));
+  GeometryHelpers::ForEachElementBlock(order.size(), k_MinimumGrain, [=, &order](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      std::memcpy(dest + i * tupleBytes, src + static_cast<size_t>(order[i]) * tupleBytes, tupleBytes);
+    }
+  });
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReordering::RenumberIds(IDataArray::Pointer list, const std::vector<int64_t>& newIds)
+{
+  if(list.get() == nullptr || !list->isAllocated())
+  {
+    return;
+  }
+  if(Int64ArrayType::Pointer ids = std::dynamic_pointer_cast<Int64ArrayType>(list))
+  {
+    RenumberTypedIds<int64_t>(ids, newIds);
+  }
+  else if(UInt32ArrayType::Pointer compactIds = std::dynamic_pointer_cast<UInt32ArrayType>(list))
+  {
+    RenumberTypedIds<uint32_t>(compactIds, newIds);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MeshReordering::ReorderMesh(IGeometry* geom, SharedVertexList::Pointer vertices, IDataArray::Pointer elements, const QVector<IDataArray::Pointer>& derivedLists,
+                                IGeometry::ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  if(geom == nullptr || vertices.get() == nullptr || elements.get() == nullptr)
+  {
+    return -1;
+  }
+  size_t numVerts = vertices->getNumberOfTuples();
+  size_t numElems = elements->getNumberOfTuples();
+
+  // The element order is found before anything is moved, since the centroids and neighbors are computed
+  // from the current numbering
+  if(ordering == IGeometry::ElementOrdering::ReverseCuthillMcKee)
+  {
+    int err = geom->findElementNeighbors();
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = FindReverseCuthillMcKeeOrder(geom->getElementNeighbors(), numElems);
+  }
+  else
+  {
+    int err = geom->findElementCentroids();
+    if(err < 0)
+    {
+      return err;
+    }
+    FloatArrayType::Pointer centroids = geom->getElementCentroids();
+    if(centroids.get() == nullptr || centroids->getNumberOfTuples() != numElems)
+    {
+      return -1;
+    }
+    elementOrder = FindHilbertOrder(centroids->getPointer(0), numElems);
+  }
+  vertexOrder = FindHilbertOrder(vertices->getPointer(0), numVerts);
+
+  std::vector<int64_t> newVertexIds = InvertOrder(vertexOrder);
+  PermuteTuples(vertices, vertexOrder);
+  PermuteTuples(elements, elementOrder);
+  RenumberIds(elements, newVertexIds);
+  for(const IDataArray::Pointer& list : derivedLists)
+  {
+    RenumberIds(list, newVertexIds);
+  }
+  return 0;
+}
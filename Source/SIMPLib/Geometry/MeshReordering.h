@@ -0,0 +1,142 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The MeshReordering class renumbers the vertices and elements of unstructured geometries so that
+ * elements and vertices that are close in space are also close in memory. Meshes that are imported or
+ * generated often store their elements in an arbitrary order, which makes every vertex gather and adjacency
+ * walk of the downstream algorithms miss the cache.
+ *
+ * Vertices are sorted along a 3D Hilbert curve. Elements are either sorted along the Hilbert curve through
+ * their centroids or numbered with the reverse Cuthill-McKee algorithm on the element neighbor graph, which
+ * minimizes the distance between the ids of neighboring elements.
+ *
+ * An order is a vector that holds the old id of each new id. All functions apply the same order convention.
+ */
+class SIMPLib_EXPORT MeshReordering
+{
+public:
+  SIMPL_SHARED_POINTERS(MeshReordering)
+  SIMPL_TYPE_MACRO(MeshReordering)
+
+  virtual ~MeshReordering();
+
+  static const int k_HilbertBits = 21;
+
+  /**
+   * @brief Returns the distance along a 3D Hilbert curve of the cell (x, y, z) of a grid with 2^bits cells
+   * along each axis
+   * @param x
+   * @param y
+   * @param z
+   * @param bits Number of bits per coordinate, at most k_HilbertBits
+   * @return
+   */
+  static uint64_t HilbertKey(uint32_t x, uint32_t y, uint32_t z, int bits = k_HilbertBits);
+
+  /**
+   * @brief Sorts numPoints x 3 coordinates along a Hilbert curve through their bounding box
+   * @param coords
+   * @param numPoints
+   * @return The order of the points
+   */
+  static std::vector<int64_t> FindHilbertOrder(const float* coords, size_t numPoints);
+
+  /**
+   * @brief Numbers the elements with the reverse Cuthill-McKee algorithm. Each connected component of the
+   * neighbor graph starts at a pseudo-peripheral element.
+   * @param neighbors The element neighbors, for example from IGeometry::findElementNeighbors()
+   * @param numElements
+   * @return The order of the elements
+   */
+  static std::vector<int64_t> FindReverseCuthillMcKeeOrder(ElementDynamicList::Pointer neighbors, size_t numElements);
+
+  /**
+   * @brief Returns the new id of each old id of the order
+   * @param order
+   * @return
+   */
+  static std::vector<int64_t> InvertOrder(const std::vector<int64_t>& order);
+
+  /**
+   * @brief Moves the tuples of the array into the order. Works with any kind of array, including neighbor
+   * lists and string arrays.
+   * @param array
+   * @param order Must have one entry for each tuple of the array
+   * @return false if the array does not have as many tuples as the order
+   */
+  static bool PermuteTuples(IDataArray::Pointer array, const std::vector<int64_t>& order);
+
+  /**
+   * @brief Replaces every id of the list by its new id
+   * @param list A vertex list of a geometry, such as the triangles or the unshared edges, with either 64 bit
+   * or compact 32 bit ids. May be null.
+   * @param newIds
+   */
+  static void RenumberIds(IDataArray::Pointer list, const std::vector<int64_t>& newIds);
+
+  /**
+   * @brief Reorders the vertices and elements of an unstructured geometry. The vertices are sorted along a
+   * Hilbert curve and the elements with the requested ordering; the element list is permuted and renumbered.
+   * Lists that are derived from the vertices (shared and unshared edges and faces) keep their order and
+   * are renumbered, so attributes that are stored for them remain valid. The caller must delete the element
+   * based connectivity and measures of the geometry.
+   * @param geom The geometry that owns the lists; used to find the element centroids or neighbors
+   * @param vertices
+   * @param elements
+   * @param derivedLists
+   * @param ordering
+   * @param vertexOrder Receives the order of the vertices
+   * @param elementOrder Receives the order of the elements
+   * @return 0 on success, negative if the lists are missing or the element centroids or neighbors could not be found
+   */
+  static int ReorderMesh(IGeometry* geom, SharedVertexList::Pointer vertices, IDataArray::Pointer elements, const QVector<IDataArray::Pointer>& derivedLists,
+                         IGeometry::ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder);
+
+protected:
+  MeshReordering();
+
+private:
+  MeshReordering(const MeshReordering&) = delete; // Copy Constructor Not Implemented
+  void operator=(const MeshReordering&) = delete; // Move assignment Not Implemented
+};
@@ -0,0 +1,442 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLib/Geometry/MeshWelding.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+
+namespace
+{
+const size_t k_MinimumGrain = 4096;
+const double k_MaxCellCoordinate = 4.0e18;
+
+using KeyedId = GeometryHelpers::KeyedId; // Cell hash and vertex id
+
+// -----------------------------------------------------------------------------
+// Mixes the three coordinates of a cell into its hash. Cells that collide share a bucket, which only costs
+// a few extra distance tests.
+// -----------------------------------------------------------------------------
+uint64_t HashCell(const int64_t cell[3])
+{
+  uint64_t h = static_cast<uint64_t>(cell[0]) * 0x9E3779B97F4A7C15ULL;
+  h ^= static_cast<uint64_t>(cell[1]) * 0xC2B2AE3D27D4EB4FULL;
+  h ^= static_cast<uint64_t>(cell[2]) * 0x165667B19E3779F9ULL;
+  h ^= h >> 31;
+  h *= 0xBF58476D1CE4E5B9ULL;
+  h ^= h >> 29;
+  return h;
+}
+
+/**
+ * @brief The FindWeldParentsImpl class finds the vertex with the smallest id within the tolerance of each
+ * vertex, its parent. The parent of a vertex that does not have a smaller neighbor is the vertex itself.
+ *
+ * The cells of the grid are twice as large as the tolerance, so all vertices within the tolerance of a point
+ * lie in the 2 x 2 x 2 cells around the corner of its cell that is closest to it. The sorted keys are indexed
+ * by an open addressing table that maps each cell hash to its range of keys.
+ */
+class FindWeldParentsImpl
+{
+public:
+  FindWeldParentsImpl(const float* coords, float tolerance, const std::vector<KeyedId>& keys, std::vector<int64_t>& parents)
+  : m_Coords(coords)
+  , m_Exact(!(tolerance > 0.0f))
+  , m_ToleranceSquared(tolerance * tolerance)
+  , m_InvCellSize(tolerance > 0.0f ? 0.5 / static_cast<double>(tolerance) : 0.0)
+  , m_Keys(keys)
+  , m_Parents(parents)
+  {
+  }
+  virtual ~FindWeldParentsImpl() = default;
+
+  /**
+   * @brief Returns the cell of the point and, in tolerance mode, the direction of the neighboring cell along each
+   * axis that may contain vertices within the tolerance. In exact mode the cell is the bit pattern of the
+   * coordinates, with negative zeros folded into positive ones, so only identical points share a cell.
+   * @param point
+   * @param cell
+   * @param side
+   */
+  void findCell(const float* point, int64_t cell[3], int64_t side[3]) const
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      if(m_Exact)
+      {
+        float value = (point[d] == 0.0f) ? 0.0f : point[d];
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        cell[d] = static_cast<int64_t>(bits);
+        side[d] = 0;
+      }
+      else
+      {
+        // Non finite coordinates end up in the outermost cells and are never within the tolerance
+        double u = static_cast<double>(point[d]) * m_InvCellSize;
+        double c = std::floor(u);
+        c = (c > -k_MaxCellCoordinate) ? c : -k_MaxCellCoordinate;
+        c = (c < k_MaxCellCoordinate) ? c : k_MaxCellCoordinate;
+        cell[d] = static_cast<int64_t>(c);
+        side[d] = (u - c < 0.5) ? -1 : 1;
+      }
+    }
+  }
+
+  /**
+   * @brief Computes the cell hash of the points [start, end)
+   * @param keys
+   * @param start
+   * @param end
+   */
+  void hash(std::vector<KeyedId>& keys, size_t start, size_t end) const
+  {
+    int64_t cell[3] = {0, 0, 0};
+    int64_t side[3] = {0, 0, 0};
+    for(size_t i = start; i < end; i++)
+    {
+      findCell(m_Coords + 3 * i, cell, side);
+      keys[i] = KeyedId(HashCell(cell), static_cast<int64_t>(i));
+    }
+  }
+
+  /**
+   * @brief Builds the table of buckets from the sorted keys. The table is at most half full, so the linear
+   * probing in findBucket() stays short.
+   */
+  void buildBuckets()
+  {
+    size_t numBuckets = 0;
+    for(size_t i = 0; i < m_Keys.size(); i++)
+    {
+      if(i == 0 || m_Keys[i].first != m_Keys[i - 1].first)
+      {
+        numBuckets++;
+      }
+    }
+    size_t tableSize = 1;
+    while(tableSize < 2 * numBuckets)
+    {
+      tableSize *= 2;
+    }
+    m_Mask = tableSize - 1;
+    m_Buckets.assign(tableSize, Bucket());
+
+    size_t start = 0;
+    while(start < m_Keys.size())
+    {
+      uint64_t hash = m_Keys[start].first;
+      size_t end = start + 1;
+      while(end < m_Keys.size() && m_Keys[end].first == hash)
+      {
+        end++;
+      }
+      size_t slot = static_cast<size_t>(hash) & m_Mask;
+      while(m_Buckets[slot].start != m_Buckets[slot].end)
+      {
+        slot = (slot + 1) & m_Mask;
+      }
+      m_Buckets[slot] = Bucket{hash, start, end};
+      start = end;
+    }
+  }
+
+  /**
+   * @brief Finds the parents of the points [start, end)
+   * @param start
+   * @param end
+   */
+  void find(size_t start, size_t end) const
+  {
+    int64_t cell[3] = {0, 0, 0};
+    int64_t side[3] = {0, 0, 0};
+    int64_t neighbor[3] = {0, 0, 0};
+    const int64_t numCells = m_Exact ? 1 : 8;
+    for(size_t i = start; i < end; i++)
+    {
+      const float* point = m_Coords + 3 * i;
+      int64_t parent = static_cast<int64_t>(i);
+      findCell(point, cell, side);
+      for(int64_t n = 0; n < numCells; n++)
+      {
+        neighbor[0] = cell[0] + ((n & 1) != 0 ? side[0] : 0);
+        neighbor[1] = cell[1] + ((n & 2) != 0 ? side[1] : 0);
+        neighbor[2] = cell[2] + ((n & 4) != 0 ? side[2] : 0);
+        parent = searchBucket(HashCell(neighbor), point, parent);
+      }
+      m_Parents[i] = parent;
+    }
+  }
+
+  /**
+   * @brief Returns the smallest id of the bucket below the current parent whose point is within the tolerance,
+   * or the current parent if there is none. The ids of a bucket are sorted, so the search stops at the first match.
+   * @param hash
+   * @param point
+   * @param parent
+   * @return
+   */
+  int64_t searchBucket(uint64_t hash, const float* point, int64_t parent) const
+  {
+    size_t slot = static_cast<size_t>(hash) & m_Mask;
+    while(m_Buckets[slot].start != m_Buckets[slot].end && m_Buckets[slot].hash != hash)
+    {
+      slot = (slot + 1) & m_Mask;
+    }
+    const Bucket& bucket = m_Buckets[slot];
+    for(size_t k = bucket.start; k < bucket.end && m_Keys[k].second < parent; k++)
+    {
+      const float* other = m_Coords + 3 * m_Keys[k].second;
+      if(m_Exact)
+      {
+        if(other[0] == point[0] && other[1] == point[1] && other[2] == point[2])
+        {
+          return m_Keys[k].second;
+        }
+        continue;
+      }
+      float dx = other[0] - point[0];
+      float dy = other[1] - point[1];
+      float dz = other[2] - point[2];
+      if(dx * dx + dy * dy + dz * dz <= m_ToleranceSquared)
+      {
+        return m_Keys[k].second;
+      }
+    }
+    return parent;
+  }
+
+private:
+  struct Bucket
+  {
+    uint64_t hash = 0;
+    size_t start = 0;
+    size_t end = 0;
+  };
+
+  const float* m_Coords;
+  bool m_Exact;
+  float m_ToleranceSquared;
+  double m_InvCellSize;
+  const std::vector<KeyedId>& m_Keys;
+  std::vector<int64_t>& m_Parents;
+  std::vector<Bucket> m_Buckets;
+  size_t m_Mask = 0;
+};
+
+// -----------------------------------------------------------------------------
+// Marks the elements of a 64 bit or compact 32 bit vertex list that reference a vertex more than once
+// -----------------------------------------------------------------------------
+template <typename T> QVector<size_t> FindTypedDegenerateElements(typename DataArray<T>::Pointer elements)
+{
+  const size_t numElems = elements->getNumberOfTuples();
+  const size_t numVertsPerElem = static_cast<size_t>(elements->getNumberOfComponents());
+  const T* ids = elements->getPointer(0);
+  std::vector<uint8_t> degenerate(numElems, 0);
+  uint8_t* flags = degenerate.data();
+  GeometryHelpers::ForEachElementBlock(numElems, k_MinimumGrain, [=](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      const T* elem = ids + i * numVertsPerElem;
+      for(size_t a = 0; a < numVertsPerElem && flags[i] == 0; a++)
+      {
+        for(size_t b = a + 1; b < numVertsPerElem; b++)
+        {
+          if(elem[a] == elem[b])
+          {
+            flags[i] = 1;
+            break;
+          }
+        }
+      }
+    }
+  });
+
+  QVector<size_t> degenerateIds;
+  for(size_t i = 0; i < numElems; i++)
+  {
+    if(degenerate[i] != 0)
+    {
+      degenerateIds.push_back(i);
+    }
+  }
+  return degenerateIds;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshWelding::MeshWelding() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshWelding::~MeshWelding() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int64_t> MeshWelding::FindWeldedIds(const float* coords, size_t numPoints, float tolerance, size_t& numWelded)
+{
+  std::vector<int64_t> parents(numPoints, 0);
+  std::vector<KeyedId> keys(numPoints);
+  FindWeldParentsImpl impl(coords, tolerance, keys, parents);
+
+  GeometryHelpers::ForEachElementBlock(numPoints, k_MinimumGrain, [&impl, &keys](size_t start, size_t end) { impl.hash(keys, start, end); });
+  GeometryHelpers::SortKeyedIds(keys, k_MinimumGrain);
+  impl.buildBuckets();
+  GeometryHelpers::ForEachElementBlock(numPoints, k_MinimumGrain, [&impl](size_t start, size_t end) { impl.find(start, end); });
+
+  // Every parent has a smaller id than its child, so a single pass in id order collapses the chains and numbers
+  // the kept vertices
+  std::vector<int64_t> newIds(numPoints, 0);
+  int64_t nextId = 0;
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    int64_t parent = parents[i];
+    if(parent == static_cast<int64_t>(i))
+    {
+      newIds[i] = nextId++;
+    }
+    else
+    {
+      newIds[i] = newIds[parent];
+    }
+  }
+  numWelded = static_cast<size_t>(nextId);
+  return newIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> MeshWelding::FindDegenerateElements(IDataArray::Pointer elements)
+{
+  if(elements.get() == nullptr || !elements->isAllocated())
+  {
+    return QVector<size_t>();
+  }
+  if(Int64ArrayType::Pointer ids = std::dynamic_pointer_cast<Int64ArrayType>(elements))
+  {
+    return FindTypedDegenerateElements<int64_t>(ids);
+  }
+  if(UInt32ArrayType::Pointer compactIds = std::dynamic_pointer_cast<UInt32ArrayType>(elements))
+  {
+    return FindTypedDegenerateElements<uint32_t>(compactIds);
+  }
+  return QVector<size_t>();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MeshWelding::WeldMesh(SharedVertexList::Pointer vertices, IDataArray::Pointer elements, float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  removedVertices.clear();
+  removedElements.clear();
+  if(vertices.get() == nullptr || vertices->getNumberOfComponents() != 3)
+  {
+    return -1;
+  }
+
+  size_t numVerts = vertices->getNumberOfTuples();
+  size_t numWelded = 0;
+  std::vector<int64_t> newIds = FindWeldedIds(vertices->getPointer(0), numVerts, tolerance, numWelded);
+  if(numWelded < numVerts)
+  {
+    // The kept vertices are numbered in id order, so a vertex is kept if its new id is the next one
+    removedVertices.reserve(static_cast<int>(numVerts - numWelded));
+    int64_t nextId = 0;
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      if(newIds[i] == nextId)
+      {
+        nextId++;
+      }
+      else
+      {
+        removedVertices.push_back(i);
+      }
+    }
+    if(vertices->eraseTuples(removedVertices) < 0)
+    {
+      return -2;
+    }
+    MeshReordering::RenumberIds(elements, newIds);
+  }
+
+  if(elements.get() != nullptr)
+  {
+    removedElements = FindDegenerateElements(elements);
+    if(elements->eraseTuples(removedElements) < 0)
+    {
+      return -3;
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MeshWelding::RemoveTuples(AttributeMatrix::Pointer attrMat, QVector<size_t>& ids)
+{
+  if(attrMat.get() == nullptr)
+  {
+    return -1;
+  }
+  if(ids.isEmpty())
+  {
+    return 0;
+  }
+  size_t numTuples = attrMat->getNumberOfTuples();
+  size_t newNumTuples = (static_cast<size_t>(ids.size()) < numTuples) ? numTuples - static_cast<size_t>(ids.size()) : 0;
+  QList<QString> names = attrMat->getAttributeArrayNames();
+  for(const QString& name : names)
+  {
+    if(attrMat->getAttributeArray(name)->eraseTuples(ids) < 0)
+    {
+      return -2;
+    }
+  }
+  attrMat->setTupleDimensions(QVector<size_t>(1, newNumTuples));
+  return 0;
+}
@@ -0,0 +1,113 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The MeshWelding class merges the vertices of unstructured geometries that lie within a tolerance of
+ * each other. Meshes that are imported from formats without a shared vertex list, such as STL, store every
+ * vertex once per element, so neighboring elements do not share any vertex ids and the connectivity of the
+ * geometry can not be found.
+ *
+ * The vertices are bucketed into a hashed grid with cells twice as large as the tolerance, so each vertex is
+ * only compared against the vertices of the 8 cells around its closest cell corner. Each vertex is merged into the vertex with the
+ * smallest id within the tolerance and chains of merged vertices collapse into their first vertex, which makes
+ * the result independent of the number of threads. The kept vertices keep their coordinates and their relative
+ * order.
+ */
+class SIMPLib_EXPORT MeshWelding
+{
+public:
+  SIMPL_SHARED_POINTERS(MeshWelding)
+  SIMPL_TYPE_MACRO(MeshWelding)
+
+  virtual ~MeshWelding();
+
+  /**
+   * @brief Finds the vertices that are merged when welding numPoints x 3 coordinates
+   * @param coords
+   * @param numPoints
+   * @param tolerance Largest distance between two merged vertices. A tolerance <= 0 only merges vertices with
+   * identical coordinates.
+   * @param numWelded Receives the number of vertices that are kept
+   * @return The new id of each vertex
+   */
+  static std::vector<int64_t> FindWeldedIds(const float* coords, size_t numPoints, float tolerance, size_t& numWelded);
+
+  /**
+   * @brief Finds the elements that reference the same vertex more than once. Such an element is degenerate even if
+   * its remaining vertices still span a positive area or volume, for example a quadrilateral that became a triangle,
+   * since it is no longer a valid element of its geometry type.
+   * @param elements A vertex list of a geometry with either 64 bit or compact 32 bit ids
+   * @return The ids of the degenerate elements in ascending order
+   */
+  static QVector<size_t> FindDegenerateElements(IDataArray::Pointer elements);
+
+  /**
+   * @brief Welds the vertices of a mesh. The merged vertices are removed from the vertex list, the element list
+   * is renumbered and the elements that collapsed are removed from it. Lists that are derived from the vertices,
+   * such as the shared edges, are not updated.
+   * @param vertices
+   * @param elements The element list with either 64 bit or compact 32 bit ids. May be null for point clouds.
+   * @param tolerance
+   * @param removedVertices Receives the ids of the removed vertices in ascending order
+   * @param removedElements Receives the ids of the removed elements in ascending order
+   * @return 0 on success, negative if the vertex list is missing
+   */
+  static int WeldMesh(SharedVertexList::Pointer vertices, IDataArray::Pointer elements, float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements);
+
+  /**
+   * @brief Removes the tuples from every array of the attribute matrix, for example the ids that are returned
+   * by IGeometry::weldVertices()
+   * @param attrMat
+   * @param ids Tuple ids in ascending order
+   * @return 0 on success, negative if an array could not be resized
+   */
+  static int RemoveTuples(AttributeMatrix::Pointer attrMat, QVector<size_t>& ids);
+
+protected:
+  MeshWelding();
+
+private:
+  MeshWelding(const MeshWelding&) = delete;    // Copy Constructor Not Implemented
+  void operator=(const MeshWelding&) = delete; // Move assignment Not Implemented
+};
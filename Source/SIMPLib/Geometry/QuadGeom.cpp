@@ -46,17 +46,22 @@
 
 #include "SIMPLib/Geometry/QuadGeom.h"
 
+#include <limits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #if defined SIMPL_USE_EIGEN
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #endif
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 
 /**
  * @brief The FindQuadDerivativesImpl class implements a threaded algorithm that computes the
@@ -136,13 +141,15 @@ QuadGeom::QuadGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = QuadGeom::CreateSharedVertexList(0);
   m_QuadList = QuadGeom::CreateSharedQuadList(0);
+  m_CompactQuadList = CompactQuadList::NullPointer();
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
   m_QuadsContainingVert = ElementDynamicList::NullPointer();
   m_QuadNeighbors = ElementDynamicList::NullPointer();
   m_QuadCentroids = FloatArrayType::NullPointer();
   m_QuadSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -193,13 +200,45 @@ QuadGeom::Pointer QuadGeom::CreateGeometry(SharedQuadList::Pointer quads, Shared
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QuadGeom::Pointer QuadGeom::CreateGeometry(CompactQuadList::Pointer quads, SharedVertexList::Pointer vertices, const QString& name)
+{
+  if(name.isEmpty() == true)
+  {
+    return NullPointer();
+  }
+  if(vertices.get() == nullptr)
+  {
+    return QuadGeom::NullPointer();
+  }
+  if(quads.get() == nullptr)
+  {
+    return QuadGeom::NullPointer();
+  }
+  QuadGeom* d = new QuadGeom();
+  d->setVertices(vertices);
+  d->setCompactQuads(quads);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void QuadGeom::initializeWithZeros()
 {
   m_VertexList->initializeWithZeros();
-  m_QuadList->initializeWithZeros();
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    m_CompactQuadList->initializeWithZeros();
+  }
+  else
+  {
+    m_QuadList->initializeWithZeros();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -236,7 +275,7 @@ void QuadGeom::addAttributeMatrix(const QString& name, AttributeMatrix::Pointer
 // -----------------------------------------------------------------------------
 size_t QuadGeom::getNumberOfElements()
 {
-  return m_QuadList->getNumberOfTuples();
+  return static_cast<size_t>(getNumberOfQuads());
 }
 
 // -----------------------------------------------------------------------------
@@ -244,7 +283,14 @@ size_t QuadGeom::getNumberOfElements()
 // -----------------------------------------------------------------------------
 int QuadGeom::findEdges()
 {
-  m_EdgeList = CreateSharedEdgeList(0);
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    CompactEdgeList::Pointer edges = CompactEdgeList::CreateArray(0, QVector<size_t>(1, 2), SIMPL::Geometry::SharedEdgeList);
+    GeometryHelpers::Connectivity::Find2DElementEdges<uint32_t>(m_CompactQuadList, edges);
+    setCompactEdges(edges);
+    return 1;
+  }
+  setEdges(CreateSharedEdgeList(0));
   GeometryHelpers::Connectivity::Find2DElementEdges<int64_t>(m_QuadList, m_EdgeList);
   if(m_EdgeList.get() == nullptr)
   {
@@ -259,6 +305,7 @@ int QuadGeom::findEdges()
 void QuadGeom::deleteEdges()
 {
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -267,7 +314,14 @@ void QuadGeom::deleteEdges()
 int QuadGeom::findElementsContainingVert()
 {
   m_QuadsContainingVert = ElementDynamicList::New();
-  GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_QuadList, m_QuadsContainingVert, getNumberOfVertices());
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t, uint32_t>(m_CompactQuadList, m_QuadsContainingVert, getNumberOfVertices());
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_QuadList, m_QuadsContainingVert, getNumberOfVertices());
+  }
   if(m_QuadsContainingVert.get() == nullptr)
   {
     return -1;
@@ -314,7 +368,14 @@ int QuadGeom::findElementNeighbors()
     }
   }
   m_QuadNeighbors = ElementDynamicList::New();
-  err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_QuadList, m_QuadsContainingVert, m_QuadNeighbors, IGeometry::Type::Quad);
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t, uint32_t>(m_CompactQuadList, m_QuadsContainingVert, m_QuadNeighbors, IGeometry::Type::Quad);
+  }
+  else
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_QuadList, m_QuadsContainingVert, m_QuadNeighbors, IGeometry::Type::Quad);
+  }
   if(m_QuadNeighbors.get() == nullptr)
   {
     return -1;
@@ -353,7 +414,14 @@ int QuadGeom::findElementCentroids()
 {
   QVector<size_t> cDims(1, 3);
   m_QuadCentroids = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_QuadList, m_VertexList, m_QuadCentroids);
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindElementCentroids<uint32_t>(m_CompactQuadList, m_VertexList, m_QuadCentroids);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_QuadList, m_VertexList, m_QuadCentroids);
+  }
   if(m_QuadCentroids.get() == nullptr)
   {
     return -1;
@@ -392,7 +460,14 @@ int QuadGeom::findElementSizes()
 {
   QVector<size_t> cDims(1, 1);
   m_QuadSizes = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadAreas);
-  GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_QuadList, m_VertexList, m_QuadSizes);
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::Find2DElementAreas<uint32_t>(m_CompactQuadList, m_VertexList, m_QuadSizes);
+  }
+  else
+  {
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_QuadList, m_VertexList, m_QuadSizes);
+  }
   if(m_QuadSizes.get() == nullptr)
   {
     return -1;
@@ -431,7 +506,14 @@ int QuadGeom::findUnsharedEdges()
 {
   QVector<size_t> cDims(1, 2);
   m_UnsharedEdgeList = SharedEdgeList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedEdgeList);
-  GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(m_QuadList, m_UnsharedEdgeList);
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<uint32_t, int64_t>(m_CompactQuadList, m_UnsharedEdgeList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(m_QuadList, m_UnsharedEdgeList);
+  }
   if(m_UnsharedEdgeList.get() == nullptr)
   {
     return -1;
@@ -499,7 +581,7 @@ void QuadGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   int64_t numQuads = getNumberOfQuads();
 
   if(observable)
@@ -508,14 +590,13 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -525,6 +606,70 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  IDataArray::Pointer elements = (m_CompactQuadList.get() != nullptr) ? IDataArray::Pointer(m_CompactQuadList) : IDataArray::Pointer(m_QuadList);
+  int err = MeshReordering::ReorderMesh(this, m_VertexList, elements, {m_EdgeList, m_CompactEdgeList, m_UnsharedEdgeList}, ordering, vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::setCompactConnectivity(bool compact)
+{
+  if(compact && getNumberOfVertices() > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    return -1;
+  }
+  if(!GeometryHelpers::Connectivity::SetCompactStorage(compact, m_QuadList, m_CompactQuadList))
+  {
+    return -1;
+  }
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_EdgeList, m_CompactEdgeList);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool QuadGeom::getCompactConnectivity()
+{
+  return (m_CompactQuadList.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  IDataArray::Pointer elements = (m_CompactQuadList.get() != nullptr) ? IDataArray::Pointer(m_CompactQuadList) : IDataArray::Pointer(m_QuadList);
+  int err = MeshWelding::WeldMesh(m_VertexList, elements, tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  // The derived lists refer to the old vertex ids and may contain collapsed entries
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -550,6 +695,15 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
     }
   }
 
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactEdgeList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_QuadList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_QuadList);
@@ -559,6 +713,15 @@ int QuadGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeXdmf)
     }
   }
 
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactQuadList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_UnsharedEdgeList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
@@ -626,7 +789,7 @@ int QuadGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFileName)
   }
   out << "    <Topology TopologyType=\"Quadrilateral\" NumberOfElements=\"" << getNumberOfQuads() << "\">"
       << "\n";
-  out << "      <DataItem Format=\"HDF\" NumberType=\"Int\" Dimensions=\"" << getNumberOfQuads() << " 4\">"
+  out << "      <DataItem Format=\"HDF\" " << GeometryHelpers::GeomIO::XdmfConnectivityNumberType(getCompactConnectivity()) << " Dimensions=\"" << getNumberOfQuads() << " 4\">"
       << "\n";
   out << "        " << hdfFileName << ":/DataContainers/" << dcName << "/" << SIMPL::Geometry::Geometry << "/" << SIMPL::Geometry::SharedQuadList << "\n";
   out << "      </DataItem>"
@@ -690,14 +853,18 @@ int QuadGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
-  SharedQuadList::Pointer quads = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedQuadList>(SIMPL::Geometry::SharedQuadList, parentId, preflight, err);
-  if(quads.get() == nullptr || vertices.get() == nullptr)
+  SharedQuadList::Pointer quads = SharedQuadList::NullPointer();
+  CompactQuadList::Pointer compactQuads = CompactQuadList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedQuadList, parentId, preflight, err, quads, compactQuads);
+  if((quads.get() == nullptr && compactQuads.get() == nullptr) || vertices.get() == nullptr)
   {
     return -1;
   }
-  size_t numQuads = quads->getNumberOfTuples();
+  size_t numQuads = (compactQuads.get() != nullptr) ? compactQuads->getNumberOfTuples() : quads->getNumberOfTuples();
   size_t numVerts = vertices->getNumberOfTuples();
-  SharedEdgeList::Pointer edges = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedEdgeList>(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err);
+  SharedEdgeList::Pointer edges = SharedEdgeList::NullPointer();
+  CompactEdgeList::Pointer compactEdges = CompactEdgeList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err, edges, compactEdges);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -731,8 +898,16 @@ int QuadGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 
   setVertices(vertices);
   setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    setCompactEdges(compactEdges);
+  }
   setUnsharedEdges(bEdges);
   setQuads(quads);
+  if(compactQuads.get() != nullptr)
+  {
+    setCompactQuads(compactQuads);
+  }
   setElementCentroids(quadCentroids);
   setElementSizes(quadSizes);
   setElementNeighbors(quadNeighbors);
@@ -746,9 +921,11 @@ int QuadGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer QuadGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((getQuads().get() == nullptr) ? nullptr : getQuads()->deepCopy(forceNoAllocate));
+  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((m_QuadList.get() == nullptr) ? nullptr : m_QuadList->deepCopy(forceNoAllocate));
+  CompactQuadList::Pointer compactQuads = std::dynamic_pointer_cast<CompactQuadList>((m_CompactQuadList.get() == nullptr) ? nullptr : m_CompactQuadList->deepCopy(forceNoAllocate));
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
+  CompactEdgeList::Pointer compactEdges = std::dynamic_pointer_cast<CompactEdgeList>((m_CompactEdgeList.get() == nullptr) ? nullptr : m_CompactEdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -756,9 +933,13 @@ IGeometry::Pointer QuadGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
-  QuadGeom::Pointer copy = QuadGeom::CreateGeometry(quads, verts, getName());
+  QuadGeom::Pointer copy = (compactQuads.get() != nullptr) ? QuadGeom::CreateGeometry(compactQuads, verts, getName()) : QuadGeom::CreateGeometry(quads, verts, getName());
 
   copy->setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    copy->setCompactEdges(compactEdges);
+  }
   copy->setUnsharedEdges(unsharedEdges);
   copy->setElementsContainingVert(elementsContainingVert);
   copy->setElementNeighbors(elementNeighbors);
@@ -69,6 +69,15 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     static Pointer CreateGeometry(SharedQuadList::Pointer quads, SharedVertexList::Pointer vertices, const QString& name);
 
+    /**
+     * @brief CreateGeometry
+     * @param quads Quads with 32 bit vertex Ids
+     * @param vertices
+     * @param name
+     * @return
+     */
+    static Pointer CreateGeometry(CompactQuadList::Pointer quads, SharedVertexList::Pointer vertices, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedVertexOps
 // -----------------------------------------------------------------------------
@@ -91,6 +100,19 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     static SharedEdgeList::Pointer CreateSharedEdgeList(int64_t numEdges, bool allocate = true);
 
+    /**
+     * @brief setCompactEdges Stores the edges with 32 bit vertex Ids and releases the 64 bit list.
+     * getEdges() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param edges
+     */
+    void setCompactEdges(CompactEdgeList::Pointer edges);
+
+    /**
+     * @brief getCompactEdges
+     * @return The edges if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactEdgeList::Pointer getCompactEdges();
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedQuadOps
 // -----------------------------------------------------------------------------
@@ -116,12 +138,26 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
 
     /**
      * @brief getQuads
-     * @return
+     * @return The quads with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedQuadList::Pointer getQuads();
 
     /**
-     * @brief setVertsAtQuad
+     * @brief setCompactQuads Stores the quads with 32 bit vertex Ids and releases the 64 bit list.
+     * getQuads() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param quads
+     */
+    void setCompactQuads(CompactQuadList::Pointer quads);
+
+    /**
+     * @brief getCompactQuads
+     * @return The quads if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactQuadList::Pointer getCompactQuads();
+
+    /**
+     * @brief setVertsAtQuad Stores the quads with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param quadId
      * @param verts
      */
@@ -147,7 +183,7 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
     /**
      * @brief getPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the quads are stored with 32 bit vertex Ids
      */
     int64_t* getQuadPointer(int64_t i);
 
@@ -260,6 +296,37 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -360,12 +427,13 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
 
     /**
      * @brief getEdges
-     * @return
+     * @return The edges with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedEdgeList::Pointer getEdges() override;
 
     /**
-     * @brief setVerts
+     * @brief setVertsAtEdge Stores the edges with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param edgeId
      * @param verts
      */
@@ -389,7 +457,7 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
     /**
      * @brief getEdgePointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the edges are stored with 32 bit vertex Ids
      */
     int64_t* getEdgePointer(int64_t i) override;
 
@@ -469,8 +537,10 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
+    CompactEdgeList::Pointer m_CompactEdgeList;
     SharedEdgeList::Pointer m_UnsharedEdgeList;
     SharedQuadList::Pointer m_QuadList;
+    CompactQuadList::Pointer m_CompactQuadList;
     ElementDynamicList::Pointer m_QuadsContainingVert;
     ElementDynamicList::Pointer m_QuadNeighbors;
     FloatArrayType::Pointer m_QuadCentroids;
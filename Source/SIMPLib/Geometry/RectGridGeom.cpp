@@ -45,13 +45,18 @@
 
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
+#include <algorithm>
+#include <vector>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
@@ -394,6 +399,137 @@ private:
   };
 };
 
+/**
+ * @brief The RectGridAxisLocator class finds the cell along one axis of a rectilinear grid that contains a
+ * coordinate. The range of the bounds is split into as many uniform bins as there are cells and each bin
+ * stores the first cell that overlaps it, so a lookup only has to search the few cells that overlap the
+ * bin of the coordinate instead of all bounds.
+ */
+class RectGridAxisLocator
+{
+public:
+  RectGridAxisLocator(const float* bounds, size_t numCells)
+  : m_Bounds(bounds)
+  , m_NumCells(numCells)
+  , m_Min(bounds[0])
+  , m_Max(bounds[numCells])
+  , m_BinStart(numCells + 1, 0)
+  {
+    float binWidth = (m_Max - m_Min) / static_cast<float>(numCells);
+    m_InvBinWidth = binWidth > 0.0f ? 1.0f / binWidth : 0.0f;
+
+    size_t cell = 0;
+    for(size_t k = 0; k < numCells; k++)
+    {
+      float binStart = m_Min + static_cast<float>(k) * binWidth;
+      while(cell < numCells - 1 && m_Bounds[cell + 1] <= binStart)
+      {
+        cell++;
+      }
+      m_BinStart[k] = cell;
+    }
+    m_BinStart[numCells] = numCells - 1;
+  }
+  virtual ~RectGridAxisLocator() = default;
+
+  /**
+   * @brief Returns the cell that contains the coordinate or -1 if the coordinate is outside of the bounds.
+   * The upper bound belongs to the last cell.
+   * @param value
+   * @return
+   */
+  int64_t findCell(float value) const
+  {
+    if(!(value >= m_Min && value <= m_Max))
+    {
+      return -1;
+    }
+    size_t first = 0;
+    size_t last = m_NumCells - 1;
+    if(m_InvBinWidth > 0.0f)
+    {
+      size_t bin = std::min(static_cast<size_t>((value - m_Min) * m_InvBinWidth), m_NumCells - 1);
+      first = m_BinStart[bin];
+      last = m_BinStart[bin + 1];
+    }
+    size_t cell = static_cast<size_t>(std::upper_bound(m_Bounds + first + 1, m_Bounds + last + 1, value) - m_Bounds) - 1;
+
+    // Rounding of the bin may miss the cell by one; fall back to a search of all bounds
+    if(m_Bounds[cell] > value || (cell < m_NumCells - 1 && m_Bounds[cell + 1] <= value))
+    {
+      cell = static_cast<size_t>(std::upper_bound(m_Bounds + 1, m_Bounds + m_NumCells, value) - m_Bounds) - 1;
+    }
+    return static_cast<int64_t>(cell);
+  }
+
+private:
+  const float* m_Bounds;
+  size_t m_NumCells;
+  float m_Min;
+  float m_Max;
+  float m_InvBinWidth = 0.0f;
+  std::vector<size_t> m_BinStart;
+};
+
+/**
+ * @brief The ComputeRectGridCellIndicesImpl class implements a threaded algorithm that finds the cell of
+ * the rectilinear grid that contains each of a list of points. Points outside of the grid receive the
+ * index -1.
+ */
+class ComputeRectGridCellIndicesImpl
+{
+public:
+  ComputeRectGridCellIndicesImpl(const RectGridAxisLocator* locators[3], const size_t dims[3], const float* coords, int64_t* indices, uint8_t* outOfBounds)
+  : m_Coords(coords)
+  , m_Indices(indices)
+  , m_OutOfBounds(outOfBounds)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_Locators[i] = locators[i];
+    }
+    m_Strides[0] = 1;
+    m_Strides[1] = static_cast<int64_t>(dims[0]);
+    m_Strides[2] = static_cast<int64_t>(dims[0] * dims[1]);
+  }
+  virtual ~ComputeRectGridCellIndicesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const float* p = m_Coords + 3 * i;
+      int64_t index = 0;
+      bool inside = true;
+      for(size_t axis = 0; axis < 3 && inside; axis++)
+      {
+        int64_t cell = m_Locators[axis]->findCell(p[axis]);
+        inside = cell >= 0;
+        index += cell * m_Strides[axis];
+      }
+      m_Indices[i] = inside ? index : -1;
+      if(nullptr != m_OutOfBounds)
+      {
+        m_OutOfBounds[i] = inside ? 0 : 1;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const RectGridAxisLocator* m_Locators[3] = {nullptr, nullptr, nullptr};
+  const float* m_Coords;
+  int64_t* m_Indices;
+  uint8_t* m_OutOfBounds;
+  int64_t m_Strides[3] = {0, 0, 0};
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -415,7 +551,7 @@ RectGridGeom::RectGridGeom()
   m_yBounds = FloatArrayType::NullPointer();
   m_zBounds = FloatArrayType::NullPointer();
   m_VoxelSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -926,7 +1062,7 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -936,20 +1072,15 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / init.default_num_threads();
-  if(grain == 0)
-  {
-    grain = 1;
-  }
+  size_t grain = ParallelExecutionContext::Instance()->computeGrainSize(dims[2]);
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindRectGridDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
+                                                      FindRectGridDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -959,6 +1090,89 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RectGridGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  // The elements of a structured grid are implicitly ordered
+  (void)ordering;
+  vertexOrder.clear();
+  elementOrder.clear();
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RectGridGeom::setCompactConnectivity(bool compact)
+{
+  // The elements of a structured grid are implicit, so there is no connectivity to compact
+  return compact ? -1 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RectGridGeom::getCompactConnectivity()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RectGridGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  // The vertices of a structured grid are implicit
+  (void)tolerance;
+  removedVertices.clear();
+  removedElements.clear();
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t RectGridGeom::computeCellIndices(const float* coords, size_t numPoints, int64_t* indices, uint8_t* outOfBounds) const
+{
+  FloatArrayType::Pointer bounds[3] = {m_xBounds, m_yBounds, m_zBounds};
+  bool valid = true;
+  for(size_t i = 0; i < 3; i++)
+  {
+    valid = valid && m_Dimensions[i] > 0 && nullptr != bounds[i].get() && bounds[i]->getNumberOfTuples() == m_Dimensions[i] + 1;
+  }
+  if(!valid)
+  {
+    std::fill(indices, indices + numPoints, -1);
+    if(nullptr != outOfBounds)
+    {
+      std::fill(outOfBounds, outOfBounds + numPoints, 1);
+    }
+    return numPoints;
+  }
+
+  RectGridAxisLocator xLocator(bounds[0]->getPointer(0), m_Dimensions[0]);
+  RectGridAxisLocator yLocator(bounds[1]->getPointer(0), m_Dimensions[1]);
+  RectGridAxisLocator zLocator(bounds[2]->getPointer(0), m_Dimensions[2]);
+  const RectGridAxisLocator* locators[3] = {&xLocator, &yLocator, &zLocator};
+  ComputeRectGridCellIndicesImpl impl(locators, m_Dimensions, coords, indices, outOfBounds);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel())
+  {
+    context->parallelFor(tbb::blocked_range<size_t>(0, numPoints, context->computeGrainSize(numPoints, 4096)), impl);
+  }
+  else
+#endif
+  {
+    impl.compute(0, numPoints);
+  }
+
+  return static_cast<size_t>(std::count(indices, indices + numPoints, -1));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -168,6 +168,37 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -236,6 +267,18 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
     void getCoords(size_t x, size_t y, size_t z, double coords[3]) override;
     void getCoords(size_t idx, double coords[3]) override;
 
+    /**
+     * @brief computeCellIndices Computes the index of the cell that contains each of the points. The
+     * cells along each axis are found from the bounds with a binned search. Runs multi-threaded over
+     * the points. Points on the upper bounds of the grid belong to the last cell.
+     * @param coords numPoints x 3 coordinates
+     * @param numPoints
+     * @param indices Receives the index into a cell array for each point or -1 if the point is outside of the grid
+     * @param outOfBounds Receives 1 for each point outside of the grid and 0 otherwise. May be nullptr.
+     * @return The number of points outside of the grid
+     */
+    size_t computeCellIndices(const float* coords, size_t numPoints, int64_t* indices, uint8_t* outOfBounds = nullptr) const;
+
   protected:
 
     RectGridGeom();
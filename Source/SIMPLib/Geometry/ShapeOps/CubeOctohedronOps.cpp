@@ -34,6 +34,10 @@
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "CubeOctohedronOps.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 float root3 = static_cast<float>(sqrt(3.0));
@@ -60,14 +64,14 @@ CubeOctohedronOps::~CubeOctohedronOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CubeOctohedronOps::radcur1(QMap<ArgName, float> args)
+float CubeOctohedronOps::radcur1(const ShapeParameters& params)
 {
   float radcur1 = 0.0f;
   float Gvaluedist = 0.0f;
   float bestGvaluedist = 1000000.0f;
 
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
+  float omega3 = params.omega3;
+  float volcur = params.volCur;
 
   for(int i = 0; i < 41; i++)
   {
@@ -169,3 +173,36 @@ float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3com
   }
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubeOctohedronOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  // Each of the 8 corner planes is s . (p + 1) - offset, normalized by its value at the center of the shape (p = 0).
+  // The plane constants only depend on Gvalue, so they are computed once for the whole block.
+  const float signs[8][3] = {{-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1}, {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}};
+  const float low = -0.5f * Gvalue;
+  const float high = 2.0f - 0.5f * Gvalue;
+  float offsets[8];
+  float invDenominators[8];
+  for(int k = 0; k < 8; k++)
+  {
+    offsets[k] = (signs[k][0] > 0 ? high : low) + (signs[k][1] > 0 ? high : low) + (signs[k][2] > 0 ? 2.0f : 0.0f);
+    invDenominators[k] = 1.0f / (signs[k][0] + signs[k][1] + signs[k][2] - offsets[k]);
+  }
+
+  for(size_t i = 0; i < count; i++)
+  {
+    float inside = std::min(1.0f - std::fabs(axis1comps[i]), std::min(1.0f - std::fabs(axis2comps[i]), 1.0f - std::fabs(axis3comps[i])));
+    float x = axis1comps[i] + 1.0f;
+    float y = axis2comps[i] + 1.0f;
+    float z = axis3comps[i] + 1.0f;
+    for(int k = 0; k < 8; k++)
+    {
+      float plane = (signs[k][0] * x + signs[k][1] * y + signs[k][2] * z - offsets[k]) * invDenominators[k];
+      inside = plane < inside ? plane : inside;
+    }
+    values[i] = inside;
+  }
+}
@@ -35,6 +35,8 @@
 
 #include "CylinderAOps.h"
 
+#include <cmath>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 // -----------------------------------------------------------------------------
@@ -50,13 +52,13 @@ CylinderAOps::~CylinderAOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderAOps::radcur1(QMap<ArgName, float> args)
+float CylinderAOps::radcur1(const ShapeParameters& params)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = params.volCur;
+  float bovera = params.bOverA;
+  float covera = params.cOverA;
 
   // the equation for volume for an A cylinder is pi*b*c*h where b and c are semi axis lengths, but
   // h is a full axis length - meaning h = 2a. However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -83,3 +85,16 @@ float CylinderAOps::inside(float axis1comp, float axis2comp, float axis3comp)
   }
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderAOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  // Branch free so that the loop vectorizes
+  for(size_t i = 0; i < count; i++)
+  {
+    float radial = 1.0f - axis2comps[i] * axis2comps[i] - axis3comps[i] * axis3comps[i];
+    values[i] = std::fabs(axis1comps[i]) <= 1.0f ? radial : -1.0f;
+  }
+}
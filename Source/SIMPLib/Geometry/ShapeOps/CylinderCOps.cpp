@@ -35,6 +35,8 @@
 
 #include "CylinderCOps.h"
 
+#include <cmath>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 // -----------------------------------------------------------------------------
@@ -50,13 +52,13 @@ CylinderCOps::~CylinderCOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderCOps::radcur1(QMap<ArgName, float> args)
+float CylinderCOps::radcur1(const ShapeParameters& params)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = params.volCur;
+  float bovera = params.bOverA;
+  float covera = params.cOverA;
 
   // the equation for volume for a C cylinder is pi*a*b*h where a and b are semi axis lengths, but
   // h is a full axis length - meaning h = 2c.  However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -83,3 +85,16 @@ float CylinderCOps::inside(float axis1comp, float axis2comp, float axis3comp)
   }
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderCOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  // Branch free so that the loop vectorizes
+  for(size_t i = 0; i < count; i++)
+  {
+    float radial = 1.0f - axis1comps[i] * axis1comps[i] - axis2comps[i] * axis2comps[i];
+    values[i] = std::fabs(axis3comps[i]) <= 1.0f ? radial : -1.0f;
+  }
+}
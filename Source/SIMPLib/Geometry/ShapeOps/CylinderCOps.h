@@ -53,8 +53,12 @@ class SIMPLib_EXPORT CylinderCOps : public ShapeOps
 
     ~CylinderCOps() override;
 
-    float radcur1(QMap<ArgName, float> args) override;
+    using ShapeOps::inside;
+    using ShapeOps::radcur1;
+
+    float radcur1(const ShapeParameters& params) override;
     float inside(float axis1comp, float axis2comp, float axis3comp) override;
+    void inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values) override;
     void init() override {  }
 
   protected:
@@ -50,13 +50,13 @@ EllipsoidOps::~EllipsoidOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float EllipsoidOps::radcur1(QMap<ArgName, float> args)
+float EllipsoidOps::radcur1(const ShapeParameters& params)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = params.volCur;
+  float bovera = params.bOverA;
+  float covera = params.cOverA;
 
   radcur1 = (volcur * 0.75f * (SIMPLib::Constants::k_1OverPi) * (1.0f / bovera) * (1.0f / covera));
   radcur1 = powf(radcur1, 0.333333333333f);
@@ -78,3 +78,14 @@ float EllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
   inside = 1.0f - axis1comp - axis2comp - axis3comp;
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = 1.0f - axis1comps[i] * axis1comps[i] - axis2comps[i] * axis2comps[i] - axis3comps[i] * axis3comps[i];
+  }
+}
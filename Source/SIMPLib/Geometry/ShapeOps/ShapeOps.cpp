@@ -35,6 +35,8 @@
 
 #include "ShapeOps.h"
 
+#include <algorithm>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 #include "SIMPLib/Geometry/ShapeOps/CubeOctohedronOps.h"
@@ -91,11 +93,24 @@ std::vector<ShapeOps::Pointer> ShapeOps::getShapeOpsVector()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float ShapeOps::radcur1(QMap<ArgName, float> args)
+float ShapeOps::radcur1(const ShapeParameters& params)
 {
   return cube_root_of_one;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ShapeOps::radcur1(const QMap<ArgName, float>& args)
+{
+  ShapeParameters params;
+  params.omega3 = args.value(Omega3, 0.0f);
+  params.bOverA = args.value(B_OverA, 0.0f);
+  params.cOverA = args.value(C_OverA, 0.0f);
+  params.volCur = args.value(VolCur, 0.0f);
+  return radcur1(params);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -104,6 +119,35 @@ float ShapeOps::inside(float axis1comp, float axis2comp, float axis3comp)
   return -1.0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = inside(axis1comps[i], axis2comps[i], axis3comps[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::insideMask(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, bool* mask)
+{
+  const size_t k_BlockSize = 256;
+  float values[k_BlockSize];
+  for(size_t begin = 0; begin < count; begin += k_BlockSize)
+  {
+    size_t n = std::min(k_BlockSize, count - begin);
+    inside(axis1comps + begin, axis2comps + begin, axis3comps + begin, n, values);
+    for(size_t i = 0; i < n; i++)
+    {
+      mask[begin + i] = (values[i] >= 0.0f);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -64,6 +64,17 @@ class SIMPLib_EXPORT ShapeOps
       VolCur = 3
     };
 
+    /**
+     * @brief The shape parameters that radcur1() needs to compute the radius of a shape of a given volume
+     */
+    struct ShapeParameters
+    {
+      float omega3 = 1.0f;
+      float bOverA = 1.0f;
+      float cOverA = 1.0f;
+      float volCur = 0.0f;
+    };
+
     float ShapeClass2Omega[41][2];
 
     /**
@@ -80,10 +91,52 @@ class SIMPLib_EXPORT ShapeOps
     */
     static std::vector<ShapeOps::Pointer> getShapeOpsVector();
 
-    virtual float radcur1(QMap<ArgName, float> args);
+    /**
+     * @brief Returns the semi axis length 'a' of the shape with the given volume and aspect ratios. Shapes that are
+     * selected through Omega3 (SuperEllipsoidOps, CubeOctohedronOps) also store the matching shape parameter for inside().
+     * @param params
+     * @return
+     */
+    virtual float radcur1(const ShapeParameters& params);
+
+    /**
+     * @brief Convenience version of radcur1() that reads the parameters from a map. Missing entries are 0.
+     * @param args
+     * @return
+     */
+    float radcur1(const QMap<ArgName, float>& args);
 
+    /**
+     * @brief Evaluates the shape function at a point given in units of the semi axis lengths. The point lies inside
+     * of the shape if the result is >= 0.
+     * @param axis1comp
+     * @param axis2comp
+     * @param axis3comp
+     * @return
+     */
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
 
+    /**
+     * @brief Evaluates inside() for a block of points. The coordinates are passed as one array per axis so that
+     * the subclasses can evaluate several points at once with vector instructions.
+     * @param axis1comps
+     * @param axis2comps
+     * @param axis3comps
+     * @param count Number of points
+     * @param values Receives count values of the shape function
+     */
+    virtual void inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values);
+
+    /**
+     * @brief Marks the points of a block that lie inside of the shape (shape function >= 0)
+     * @param axis1comps
+     * @param axis2comps
+     * @param axis3comps
+     * @param count Number of points
+     * @param mask Receives count values
+     */
+    void insideMask(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, bool* mask);
+
     virtual void init();
 
   protected:
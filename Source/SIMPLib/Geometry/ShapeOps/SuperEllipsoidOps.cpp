@@ -35,6 +35,9 @@
 
 #include "SuperEllipsoidOps.h"
 
+#include <array>
+#include <cmath>
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 float ShapeClass2Omega3[41][2] = {{0.0f, 0.0f},  {0.0f, 0.25f}, {0.0f, 0.5f},  {0.0f, 0.75f}, {0.0f, 1.0f},  {0.0f, 1.25f}, {0.0f, 1.5f},  {0.0f, 1.75f}, {0.0f, 2.0f},  {0.0f, 2.25f}, {0.0f, 2.5f},
@@ -42,6 +45,30 @@ float ShapeClass2Omega3[41][2] = {{0.0f, 0.0f},  {0.0f, 0.25f}, {0.0f, 0.5f},  {
                                   {0.0f, 5.5f},  {0.0f, 5.75f}, {0.0f, 6.0f},  {0.0f, 6.25f}, {0.0f, 6.5f},  {0.0f, 6.75f}, {0.0f, 7.0f},  {0.0f, 7.25f}, {0.0f, 7.5f},  {0.0f, 7.75f}, {0.0f, 8.0f},
                                   {0.0f, 8.25f}, {0.0f, 8.5f},  {0.0f, 8.75f}, {0.0f, 9.0f},  {0.0f, 9.25f}, {0.0f, 9.5f},  {0.0f, 9.75f}, {0.0f, 10.0f}};
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Returns the Omega3 values of the shape parameters in ShapeClass2Omega3. They only depend on the constant
+// shape parameters, so they are computed once instead of on every call to radcur1().
+// -----------------------------------------------------------------------------
+const std::array<float, 41>& Omega3Values()
+{
+  static const std::array<float, 41> values = [] {
+    std::array<float, 41> omega3;
+    for(int i = 0; i < 41; i++)
+    {
+      float a = SIMPLibMath::Gamma(1.0f + 1.0f / ShapeClass2Omega3[i][1]);
+      float b = SIMPLibMath::Gamma(5.0f / ShapeClass2Omega3[i][1]);
+      float c = SIMPLibMath::Gamma(3.0f / ShapeClass2Omega3[i][1]);
+      float d = SIMPLibMath::Gamma(1.0f + 3.0f / ShapeClass2Omega3[i][1]);
+      omega3[i] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
+    }
+    return omega3;
+  }();
+  return values;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -66,25 +93,21 @@ void SuperEllipsoidOps::init()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
+float SuperEllipsoidOps::radcur1(const ShapeParameters& params)
 {
   float radcur1 = 0.0f;
   float Nvaluedist = 0.0f;
   float bestNvaluedist = 1000000.0f;
 
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float omega3 = params.omega3;
+  float volcur = params.volCur;
+  float bovera = params.bOverA;
+  float covera = params.cOverA;
 
+  const std::array<float, 41>& omega3Values = Omega3Values();
   for(int i = 0; i < 41; i++)
   {
-    float a = SIMPLibMath::Gamma(1.0f + 1.0f / ShapeClass2Omega3[i][1]);
-    float b = SIMPLibMath::Gamma(5.0f / ShapeClass2Omega3[i][1]);
-    float c = SIMPLibMath::Gamma(3.0f / ShapeClass2Omega3[i][1]);
-    float d = SIMPLibMath::Gamma(1.0f + 3.0f / ShapeClass2Omega3[i][1]);
-    ShapeClass2Omega3[i][0] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
-    Nvaluedist = fabsf(omega3 - ShapeClass2Omega3[i][0]);
+    Nvaluedist = fabsf(omega3 - omega3Values[i]);
     if(Nvaluedist < bestNvaluedist)
     {
       bestNvaluedist = Nvaluedist;
@@ -113,3 +136,23 @@ float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3com
   inside = 1.0f - axis1comp - axis2comp - axis3comp;
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  if(Nvalue == 2.0f)
+  {
+    // The super ellipsoid is an ellipsoid; avoid the calls to powf
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = 1.0f - axis1comps[i] * axis1comps[i] - axis2comps[i] * axis2comps[i] - axis3comps[i] * axis3comps[i];
+    }
+    return;
+  }
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = 1.0f - powf(std::fabs(axis1comps[i]), Nvalue) - powf(std::fabs(axis2comps[i]), Nvalue) - powf(std::fabs(axis3comps[i]), Nvalue);
+  }
+}
@@ -49,6 +49,11 @@ SharedEdgeList::Pointer GEOM_CLASS_NAME::CreateSharedEdgeList(int64_t numEdges,
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeEdgeList(int64_t newNumEdges)
 {
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    m_CompactEdgeList->resize(newNumEdges);
+    return;
+  }
   m_EdgeList->resize(newNumEdges);
 }
 
@@ -65,6 +70,7 @@ void GEOM_CLASS_NAME::setEdges(SharedEdgeList::Pointer edges)
     }
   }
   m_EdgeList = edges;
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,14 +78,57 @@ void GEOM_CLASS_NAME::setEdges(SharedEdgeList::Pointer edges)
 // -----------------------------------------------------------------------------
 SharedEdgeList::Pointer GEOM_CLASS_NAME::getEdges()
 {
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    // A compact list is returned as a 64 bit copy so that reading it never changes the geometry
+    return GeometryHelpers::Connectivity::ConvertList<uint32_t, int64_t>(m_CompactEdgeList);
+  }
   return m_EdgeList;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GEOM_CLASS_NAME::setCompactEdges(CompactEdgeList::Pointer edges)
+{
+  if(edges.get() != nullptr)
+  {
+    if(edges->getName().compare(SIMPL::Geometry::SharedEdgeList) != 0)
+    {
+      edges->setName(SIMPL::Geometry::SharedEdgeList);
+    }
+  }
+  m_CompactEdgeList = edges;
+  m_EdgeList = SharedEdgeList::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CompactEdgeList::Pointer GEOM_CLASS_NAME::getCompactEdges()
+{
+  return m_CompactEdgeList;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtEdge(int64_t edgeId, int64_t verts[2])
 {
+  if(m_CompactEdgeList.get() != nullptr && !GeometryHelpers::Connectivity::FitsCompactStorage(verts, 2))
+  {
+    // A vertex Id that does not fit in 32 bits moves the list back to 64 bit storage
+    GeometryHelpers::Connectivity::SetCompactStorage(false, m_EdgeList, m_CompactEdgeList);
+  }
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    uint32_t* compactEdge = m_CompactEdgeList->getTuplePointer(edgeId);
+    for(size_t i = 0; i < 2; i++)
+    {
+      compactEdge[i] = static_cast<uint32_t>(verts[i]);
+    }
+    return;
+  }
   int64_t* Edge = m_EdgeList->getTuplePointer(edgeId);
   Edge[0] = verts[0];
   Edge[1] = verts[1];
@@ -90,6 +139,15 @@ void GEOM_CLASS_NAME::setVertsAtEdge(int64_t edgeId, int64_t verts[2])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertsAtEdge(int64_t edgeId, int64_t verts[2])
 {
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    uint32_t* compactEdge = m_CompactEdgeList->getTuplePointer(edgeId);
+    for(size_t i = 0; i < 2; i++)
+    {
+      verts[i] = compactEdge[i];
+    }
+    return;
+  }
   int64_t* Edge = m_EdgeList->getTuplePointer(edgeId);
   verts[0] = Edge[0];
   verts[1] = Edge[1];
@@ -100,7 +158,8 @@ void GEOM_CLASS_NAME::getVertsAtEdge(int64_t edgeId, int64_t verts[2])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertCoordsAtEdge(int64_t edgeId, float vert1[3], float vert2[3])
 {
-  int64_t* Edge = m_EdgeList->getTuplePointer(edgeId);
+  int64_t Edge[2] = {0, 0};
+  getVertsAtEdge(edgeId, Edge);
   float* tmp1 = m_VertexList->getTuplePointer(Edge[0]);
   float* tmp2 = m_VertexList->getTuplePointer(Edge[1]);
   vert1[0] = tmp1[0];
@@ -116,6 +175,10 @@ void GEOM_CLASS_NAME::getVertCoordsAtEdge(int64_t edgeId, float vert1[3], float
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getEdgePointer(int64_t i)
 {
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    return nullptr;
+  }
   return m_EdgeList->getTuplePointer(i);
 }
 
@@ -124,5 +187,9 @@ int64_t* GEOM_CLASS_NAME::getEdgePointer(int64_t i)
 // -----------------------------------------------------------------------------
 int64_t GEOM_CLASS_NAME::getNumberOfEdges()
 {
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    return m_CompactEdgeList->getNumberOfTuples();
+  }
   return m_EdgeList->getNumberOfTuples();
 }
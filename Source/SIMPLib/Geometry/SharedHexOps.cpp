@@ -14,6 +14,11 @@ SharedHexList::Pointer GEOM_CLASS_NAME::CreateSharedHexList(int64_t numHexas, bo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeHexList(int64_t newNumHexas)
 {
+  if(m_CompactHexList.get() != nullptr)
+  {
+    m_CompactHexList->resize(newNumHexas);
+    return;
+  }
   m_HexList->resize(newNumHexas);
 }
 
@@ -30,6 +35,7 @@ void GEOM_CLASS_NAME::setHexahedra(SharedHexList::Pointer hexas)
     }
   }
   m_HexList = hexas;
+  m_CompactHexList = CompactHexList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -37,14 +43,57 @@ void GEOM_CLASS_NAME::setHexahedra(SharedHexList::Pointer hexas)
 // -----------------------------------------------------------------------------
 SharedHexList::Pointer GEOM_CLASS_NAME::getHexahedra()
 {
+  if(m_CompactHexList.get() != nullptr)
+  {
+    // A compact list is returned as a 64 bit copy so that reading it never changes the geometry
+    return GeometryHelpers::Connectivity::ConvertList<uint32_t, int64_t>(m_CompactHexList);
+  }
   return m_HexList;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GEOM_CLASS_NAME::setCompactHexahedra(CompactHexList::Pointer hexas)
+{
+  if(hexas.get() != nullptr)
+  {
+    if(hexas->getName().compare(SIMPL::Geometry::SharedHexList) != 0)
+    {
+      hexas->setName(SIMPL::Geometry::SharedHexList);
+    }
+  }
+  m_CompactHexList = hexas;
+  m_HexList = SharedHexList::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CompactHexList::Pointer GEOM_CLASS_NAME::getCompactHexahedra()
+{
+  return m_CompactHexList;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtHex(int64_t hexId, int64_t verts[8])
 {
+  if(m_CompactHexList.get() != nullptr && !GeometryHelpers::Connectivity::FitsCompactStorage(verts, 8))
+  {
+    // A vertex Id that does not fit in 32 bits moves the list back to 64 bit storage
+    GeometryHelpers::Connectivity::SetCompactStorage(false, m_HexList, m_CompactHexList);
+  }
+  if(m_CompactHexList.get() != nullptr)
+  {
+    uint32_t* compactHex = m_CompactHexList->getTuplePointer(hexId);
+    for(size_t i = 0; i < 8; i++)
+    {
+      compactHex[i] = static_cast<uint32_t>(verts[i]);
+    }
+    return;
+  }
   int64_t* hex = m_HexList->getTuplePointer(hexId);
   hex[0] = verts[0];
   hex[1] = verts[1];
@@ -61,6 +110,15 @@ void GEOM_CLASS_NAME::setVertsAtHex(int64_t hexId, int64_t verts[8])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertsAtHex(int64_t hexId, int64_t verts[8])
 {
+  if(m_CompactHexList.get() != nullptr)
+  {
+    uint32_t* compactHex = m_CompactHexList->getTuplePointer(hexId);
+    for(size_t i = 0; i < 8; i++)
+    {
+      verts[i] = compactHex[i];
+    }
+    return;
+  }
   int64_t* hex = m_HexList->getTuplePointer(hexId);
   verts[0] = hex[0];
   verts[1] = hex[1];
@@ -77,7 +135,8 @@ void GEOM_CLASS_NAME::getVertsAtHex(int64_t hexId, int64_t verts[8])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertCoordsAtHex(int64_t hexId, float vert1[3], float vert2[3], float vert3[3], float vert4[3], float vert5[3], float vert6[3], float vert7[3], float vert8[3])
 {
-  int64_t* hex = m_HexList->getTuplePointer(hexId);
+  int64_t hex[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  getVertsAtHex(hexId, hex);
   float* tmp1 = m_VertexList->getTuplePointer(hex[0]);
   float* tmp2 = m_VertexList->getTuplePointer(hex[1]);
   float* tmp3 = m_VertexList->getTuplePointer(hex[2]);
@@ -117,6 +176,10 @@ void GEOM_CLASS_NAME::getVertCoordsAtHex(int64_t hexId, float vert1[3], float ve
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getHexPointer(int64_t i)
 {
+  if(m_CompactHexList.get() != nullptr)
+  {
+    return nullptr;
+  }
   return m_HexList->getTuplePointer(i);
 }
 
@@ -125,5 +188,9 @@ int64_t* GEOM_CLASS_NAME::getHexPointer(int64_t i)
 // -----------------------------------------------------------------------------
 int64_t GEOM_CLASS_NAME::getNumberOfHexas()
 {
+  if(m_CompactHexList.get() != nullptr)
+  {
+    return m_CompactHexList->getNumberOfTuples();
+  }
   return m_HexList->getNumberOfTuples();
 }
@@ -49,6 +49,11 @@ SharedQuadList::Pointer GEOM_CLASS_NAME::CreateSharedQuadList(int64_t numQuads,
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeQuadList(int64_t newNumQuads)
 {
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    m_CompactQuadList->resize(newNumQuads);
+    return;
+  }
   m_QuadList->resize(newNumQuads);
 }
 
@@ -65,6 +70,7 @@ void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
     }
   }
   m_QuadList = quads;
+  m_CompactQuadList = CompactQuadList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,14 +78,57 @@ void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
 // -----------------------------------------------------------------------------
 SharedQuadList::Pointer GEOM_CLASS_NAME::getQuads()
 {
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    // A compact list is returned as a 64 bit copy so that reading it never changes the geometry
+    return GeometryHelpers::Connectivity::ConvertList<uint32_t, int64_t>(m_CompactQuadList);
+  }
   return m_QuadList;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GEOM_CLASS_NAME::setCompactQuads(CompactQuadList::Pointer quads)
+{
+  if(quads.get() != nullptr)
+  {
+    if(quads->getName().compare(SIMPL::Geometry::SharedQuadList) != 0)
+    {
+      quads->setName(SIMPL::Geometry::SharedQuadList);
+    }
+  }
+  m_CompactQuadList = quads;
+  m_QuadList = SharedQuadList::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CompactQuadList::Pointer GEOM_CLASS_NAME::getCompactQuads()
+{
+  return m_CompactQuadList;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtQuad(int64_t quadId, int64_t verts[4])
 {
+  if(m_CompactQuadList.get() != nullptr && !GeometryHelpers::Connectivity::FitsCompactStorage(verts, 4))
+  {
+    // A vertex Id that does not fit in 32 bits moves the list back to 64 bit storage
+    GeometryHelpers::Connectivity::SetCompactStorage(false, m_QuadList, m_CompactQuadList);
+  }
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    uint32_t* compactQuad = m_CompactQuadList->getTuplePointer(quadId);
+    for(size_t i = 0; i < 4; i++)
+    {
+      compactQuad[i] = static_cast<uint32_t>(verts[i]);
+    }
+    return;
+  }
   int64_t* Quad = m_QuadList->getTuplePointer(quadId);
   Quad[0] = verts[0];
   Quad[1] = verts[1];
@@ -92,6 +141,15 @@ void GEOM_CLASS_NAME::setVertsAtQuad(int64_t quadId, int64_t verts[4])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertsAtQuad(int64_t quadId, int64_t verts[4])
 {
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    uint32_t* compactQuad = m_CompactQuadList->getTuplePointer(quadId);
+    for(size_t i = 0; i < 4; i++)
+    {
+      verts[i] = compactQuad[i];
+    }
+    return;
+  }
   int64_t* Quad = m_QuadList->getTuplePointer(quadId);
   verts[0] = Quad[0];
   verts[1] = Quad[1];
@@ -104,7 +162,8 @@ void GEOM_CLASS_NAME::getVertsAtQuad(int64_t quadId, int64_t verts[4])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertCoordsAtQuad(int64_t quadId, float vert1[3], float vert2[3], float vert3[3], float vert4[3])
 {
-  int64_t* Quad = m_QuadList->getTuplePointer(quadId);
+  int64_t Quad[4] = {0, 0, 0, 0};
+  getVertsAtQuad(quadId, Quad);
   float* tmp1 = m_VertexList->getTuplePointer(Quad[0]);
   float* tmp2 = m_VertexList->getTuplePointer(Quad[1]);
   float* tmp3 = m_VertexList->getTuplePointer(Quad[2]);
@@ -128,6 +187,10 @@ void GEOM_CLASS_NAME::getVertCoordsAtQuad(int64_t quadId, float vert1[3], float
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getQuadPointer(int64_t i)
 {
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    return nullptr;
+  }
   return m_QuadList->getTuplePointer(i);
 }
 
@@ -136,5 +199,9 @@ int64_t* GEOM_CLASS_NAME::getQuadPointer(int64_t i)
 // -----------------------------------------------------------------------------
 int64_t GEOM_CLASS_NAME::getNumberOfQuads()
 {
+  if(m_CompactQuadList.get() != nullptr)
+  {
+    return m_CompactQuadList->getNumberOfTuples();
+  }
   return m_QuadList->getNumberOfTuples();
 }
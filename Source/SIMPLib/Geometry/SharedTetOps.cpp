@@ -49,6 +49,11 @@ SharedTetList::Pointer GEOM_CLASS_NAME::CreateSharedTetList(int64_t numTets, boo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeTetList(int64_t newNumTets)
 {
+  if(m_CompactTetList.get() != nullptr)
+  {
+    m_CompactTetList->resize(newNumTets);
+    return;
+  }
   m_TetList->resize(newNumTets);
 }
 
@@ -65,6 +70,7 @@ void GEOM_CLASS_NAME::setTetrahedra(SharedTetList::Pointer tets)
     }
   }
   m_TetList = tets;
+  m_CompactTetList = CompactTetList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,14 +78,57 @@ void GEOM_CLASS_NAME::setTetrahedra(SharedTetList::Pointer tets)
 // -----------------------------------------------------------------------------
 SharedTetList::Pointer GEOM_CLASS_NAME::getTetrahedra()
 {
+  if(m_CompactTetList.get() != nullptr)
+  {
+    // A compact list is returned as a 64 bit copy so that reading it never changes the geometry
+    return GeometryHelpers::Connectivity::ConvertList<uint32_t, int64_t>(m_CompactTetList);
+  }
   return m_TetList;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GEOM_CLASS_NAME::setCompactTetrahedra(CompactTetList::Pointer tets)
+{
+  if(tets.get() != nullptr)
+  {
+    if(tets->getName().compare(SIMPL::Geometry::SharedTetList) != 0)
+    {
+      tets->setName(SIMPL::Geometry::SharedTetList);
+    }
+  }
+  m_CompactTetList = tets;
+  m_TetList = SharedTetList::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CompactTetList::Pointer GEOM_CLASS_NAME::getCompactTetrahedra()
+{
+  return m_CompactTetList;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtTet(int64_t tetId, int64_t verts[4])
 {
+  if(m_CompactTetList.get() != nullptr && !GeometryHelpers::Connectivity::FitsCompactStorage(verts, 4))
+  {
+    // A vertex Id that does not fit in 32 bits moves the list back to 64 bit storage
+    GeometryHelpers::Connectivity::SetCompactStorage(false, m_TetList, m_CompactTetList);
+  }
+  if(m_CompactTetList.get() != nullptr)
+  {
+    uint32_t* compactTet = m_CompactTetList->getTuplePointer(tetId);
+    for(size_t i = 0; i < 4; i++)
+    {
+      compactTet[i] = static_cast<uint32_t>(verts[i]);
+    }
+    return;
+  }
   int64_t* tet = m_TetList->getTuplePointer(tetId);
   tet[0] = verts[0];
   tet[1] = verts[1];
@@ -92,6 +141,15 @@ void GEOM_CLASS_NAME::setVertsAtTet(int64_t tetId, int64_t verts[4])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertsAtTet(int64_t tetId, int64_t verts[4])
 {
+  if(m_CompactTetList.get() != nullptr)
+  {
+    uint32_t* compactTet = m_CompactTetList->getTuplePointer(tetId);
+    for(size_t i = 0; i < 4; i++)
+    {
+      verts[i] = compactTet[i];
+    }
+    return;
+  }
   int64_t* tet = m_TetList->getTuplePointer(tetId);
   verts[0] = tet[0];
   verts[1] = tet[1];
@@ -104,7 +162,8 @@ void GEOM_CLASS_NAME::getVertsAtTet(int64_t tetId, int64_t verts[4])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertCoordsAtTet(int64_t tetId, float vert1[3], float vert2[3], float vert3[3], float vert4[3])
 {
-  int64_t* tet = m_TetList->getTuplePointer(tetId);
+  int64_t tet[4] = {0, 0, 0, 0};
+  getVertsAtTet(tetId, tet);
   float* tmp1 = m_VertexList->getTuplePointer(tet[0]);
   float* tmp2 = m_VertexList->getTuplePointer(tet[1]);
   float* tmp3 = m_VertexList->getTuplePointer(tet[2]);
@@ -128,6 +187,10 @@ void GEOM_CLASS_NAME::getVertCoordsAtTet(int64_t tetId, float vert1[3], float ve
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getTetPointer(int64_t i)
 {
+  if(m_CompactTetList.get() != nullptr)
+  {
+    return nullptr;
+  }
   return m_TetList->getTuplePointer(i);
 }
 
@@ -136,5 +199,9 @@ int64_t* GEOM_CLASS_NAME::getTetPointer(int64_t i)
 // -----------------------------------------------------------------------------
 int64_t GEOM_CLASS_NAME::getNumberOfTets()
 {
+  if(m_CompactTetList.get() != nullptr)
+  {
+    return m_CompactTetList->getNumberOfTuples();
+  }
   return m_TetList->getNumberOfTuples();
 }
@@ -49,6 +49,11 @@ SharedTriList::Pointer GEOM_CLASS_NAME::CreateSharedTriList(int64_t numTris, boo
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeTriList(int64_t newNumTris)
 {
+  if(m_CompactTriList.get() != nullptr)
+  {
+    m_CompactTriList->resize(newNumTris);
+    return;
+  }
   m_TriList->resize(newNumTris);
 }
 
@@ -65,6 +70,7 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
     }
   }
   m_TriList = triangles;
+  m_CompactTriList = CompactTriList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,14 +78,57 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
 // -----------------------------------------------------------------------------
 SharedTriList::Pointer GEOM_CLASS_NAME::getTriangles()
 {
+  if(m_CompactTriList.get() != nullptr)
+  {
+    // A compact list is returned as a 64 bit copy so that reading it never changes the geometry
+    return GeometryHelpers::Connectivity::ConvertList<uint32_t, int64_t>(m_CompactTriList);
+  }
   return m_TriList;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GEOM_CLASS_NAME::setCompactTriangles(CompactTriList::Pointer triangles)
+{
+  if(triangles.get() != nullptr)
+  {
+    if(triangles->getName().compare(SIMPL::Geometry::SharedTriList) != 0)
+    {
+      triangles->setName(SIMPL::Geometry::SharedTriList);
+    }
+  }
+  m_CompactTriList = triangles;
+  m_TriList = SharedTriList::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CompactTriList::Pointer GEOM_CLASS_NAME::getCompactTriangles()
+{
+  return m_CompactTriList;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtTri(int64_t triId, int64_t verts[3])
 {
+  if(m_CompactTriList.get() != nullptr && !GeometryHelpers::Connectivity::FitsCompactStorage(verts, 3))
+  {
+    // A vertex Id that does not fit in 32 bits moves the list back to 64 bit storage
+    GeometryHelpers::Connectivity::SetCompactStorage(false, m_TriList, m_CompactTriList);
+  }
+  if(m_CompactTriList.get() != nullptr)
+  {
+    uint32_t* compactTri = m_CompactTriList->getTuplePointer(triId);
+    for(size_t i = 0; i < 3; i++)
+    {
+      compactTri[i] = static_cast<uint32_t>(verts[i]);
+    }
+    return;
+  }
   int64_t* Tri = m_TriList->getTuplePointer(triId);
   Tri[0] = verts[0];
   Tri[1] = verts[1];
@@ -91,6 +140,15 @@ void GEOM_CLASS_NAME::setVertsAtTri(int64_t triId, int64_t verts[3])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertsAtTri(int64_t triId, int64_t verts[3])
 {
+  if(m_CompactTriList.get() != nullptr)
+  {
+    uint32_t* compactTri = m_CompactTriList->getTuplePointer(triId);
+    for(size_t i = 0; i < 3; i++)
+    {
+      verts[i] = compactTri[i];
+    }
+    return;
+  }
   int64_t* Tri = m_TriList->getTuplePointer(triId);
   verts[0] = Tri[0];
   verts[1] = Tri[1];
@@ -102,7 +160,8 @@ void GEOM_CLASS_NAME::getVertsAtTri(int64_t triId, int64_t verts[3])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getVertCoordsAtTri(int64_t triId, float vert1[3], float vert2[3], float vert3[3])
 {
-  int64_t* Tri = m_TriList->getTuplePointer(triId);
+  int64_t Tri[3] = {0, 0, 0};
+  getVertsAtTri(triId, Tri);
   float* tmp1 = m_VertexList->getTuplePointer(Tri[0]);
   float* tmp2 = m_VertexList->getTuplePointer(Tri[1]);
   float* tmp3 = m_VertexList->getTuplePointer(Tri[2]);
@@ -122,6 +181,10 @@ void GEOM_CLASS_NAME::getVertCoordsAtTri(int64_t triId, float vert1[3], float ve
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getTriPointer(int64_t i)
 {
+  if(m_CompactTriList.get() != nullptr)
+  {
+    return nullptr;
+  }
   return m_TriList->getTuplePointer(i);
 }
 
@@ -130,5 +193,9 @@ int64_t* GEOM_CLASS_NAME::getTriPointer(int64_t i)
 // -----------------------------------------------------------------------------
 int64_t GEOM_CLASS_NAME::getNumberOfTris()
 {
+  if(m_CompactTriList.get() != nullptr)
+  {
+    return m_CompactTriList->getNumberOfTuples();
+  }
   return m_TriList->getNumberOfTuples();
 }
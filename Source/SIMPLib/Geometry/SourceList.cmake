@@ -12,7 +12,10 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/ImageNeighborhood.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ITransformContainer.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshReordering.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshWelding.h
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.h
@@ -25,8 +28,10 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -39,6 +44,9 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/ImageNeighborhood.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshReordering.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshWelding.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.cpp
@@ -50,8 +58,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexSpatialIndex.cpp
 )
 
 if(SIMPL_USE_EIGEN)
@@ -0,0 +1,445 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+  virtual ~GeometryHelpersTest() = default;
+
+  // Enough elements for several tasks and a partial tile at the end
+  const size_t k_NumVertices = 2000;
+  const size_t k_NumElements = 5003;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer CreateVertices(std::mt19937_64& generator)
+  {
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(k_NumVertices, QVector<size_t>(1, 3), "Vertices");
+    for(size_t i = 0; i < 3 * k_NumVertices; i++)
+    {
+      vertices->setValue(i, distribution(generator));
+    }
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int64ArrayType::Pointer CreateElements(std::mt19937_64& generator, size_t numVertsPerElem)
+  {
+    std::uniform_int_distribution<int64_t> distribution(0, static_cast<int64_t>(k_NumVertices) - 1);
+    Int64ArrayType::Pointer elems = Int64ArrayType::CreateArray(k_NumElements, QVector<size_t>(1, numVertsPerElem), "Elements");
+    for(size_t i = 0; i < numVertsPerElem * k_NumElements; i++)
+    {
+      elems->setValue(i, distribution(generator));
+    }
+    return elems;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Returns the determinant of the edge vectors of the tetrahedron (a, b, c, d) with MatrixMath
+  // -----------------------------------------------------------------------------
+  float TetDeterminant(const float* vertex, int64_t a, int64_t b, int64_t c, int64_t d)
+  {
+    float vertMatrix[3][3];
+    for(size_t r = 0; r < 3; r++)
+    {
+      vertMatrix[r][0] = vertex[3 * b + r] - vertex[3 * a + r];
+      vertMatrix[r][1] = vertex[3 * c + r] - vertex[3 * a + r];
+      vertMatrix[r][2] = vertex[3 * d + r] - vertex[3 * a + r];
+    }
+    return MatrixMath::Determinant3x3(vertMatrix);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetMeasures()
+  {
+    std::mt19937_64 generator(1234);
+    FloatArrayType::Pointer vertices = CreateVertices(generator);
+    Int64ArrayType::Pointer tets = CreateElements(generator, 4);
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(k_NumElements, "Volumes");
+    FloatArrayType::Pointer jacobians = FloatArrayType::CreateArray(k_NumElements, "Jacobians");
+    FloatArrayType::Pointer minAngles = FloatArrayType::CreateArray(k_NumElements, "MinDihedralAngles");
+
+    GeometryHelpers::Topology::FindTetVolumes<int64_t>(tets, vertices, volumes);
+    GeometryHelpers::Topology::FindTetJacobians<int64_t>(tets, vertices, jacobians);
+    GeometryHelpers::Topology::FindTetMinDihedralAngles<int64_t>(tets, vertices, minAngles);
+
+    const float* vertex = vertices->getPointer(0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      int64_t* tet = tets->getTuplePointer(i);
+      float determinant = TetDeterminant(vertex, tet[0], tet[1], tet[2], tet[3]);
+      // The tiled kernels evaluate the same expressions as MatrixMath, so the results match bit for bit
+      DREAM3D_REQUIRE_EQUAL(volumes->getValue(i), determinant / 6.0f)
+      DREAM3D_REQUIRE_EQUAL(jacobians->getValue(i), determinant)
+      float angle = minAngles->getValue(i);
+      DREAM3D_REQUIRE(std::isnan(angle) || (angle >= 0.0f && angle <= 180.0f))
+    }
+
+    // The face normals of a regular tetrahedron all meet at an angle of acos(-1/3)
+    float regular[12] = {1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, -1.0f, 1.0f};
+    FloatArrayType::Pointer regularVertices = FloatArrayType::CreateArray(4, QVector<size_t>(1, 3), "Vertices");
+    std::copy(regular, regular + 12, regularVertices->getPointer(0));
+    Int64ArrayType::Pointer regularTet = Int64ArrayType::CreateArray(1, QVector<size_t>(1, 4), "Tets");
+    for(int64_t v = 0; v < 4; v++)
+    {
+      regularTet->setValue(v, v);
+    }
+    FloatArrayType::Pointer regularAngle = FloatArrayType::CreateArray(1, "MinDihedralAngles");
+    GeometryHelpers::Topology::FindTetMinDihedralAngles<int64_t>(regularTet, regularVertices, regularAngle);
+    DREAM3D_REQUIRE(std::fabs(regularAngle->getValue(0) - SIMPLib::Constants::k_180OverPi * std::acos(-1.0 / 3.0)) < 1.0e-3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexVolumes()
+  {
+    // A unit cube, a box and a sheared box; their volumes are 1, 24 and 24
+    float corners[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+    const size_t numHexas = 3;
+    FloatArrayType::Pointer vertices = FloatArrayType::CreateArray(8 * numHexas, QVector<size_t>(1, 3), "Vertices");
+    Int64ArrayType::Pointer hexas = Int64ArrayType::CreateArray(numHexas, QVector<size_t>(1, 8), "Hexas");
+    for(size_t v = 0; v < 8; v++)
+    {
+      float* unit = vertices->getTuplePointer(v);
+      float* box = vertices->getTuplePointer(8 + v);
+      float* sheared = vertices->getTuplePointer(16 + v);
+      for(size_t d = 0; d < 3; d++)
+      {
+        unit[d] = corners[v][d];
+        box[d] = corners[v][d] * static_cast<float>(d + 2);
+        sheared[d] = box[d];
+      }
+      sheared[0] += 0.5f * box[2];
+      for(size_t h = 0; h < numHexas; h++)
+      {
+        hexas->setComponent(h, v, static_cast<int64_t>(8 * h + v));
+      }
+    }
+
+    FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(numHexas, "Volumes");
+    GeometryHelpers::Topology::FindHexVolumes<int64_t>(hexas, vertices, volumes);
+    DREAM3D_REQUIRE(std::fabs(volumes->getValue(0) - 1.0f) < 1.0e-6f)
+    DREAM3D_REQUIRE(std::fabs(volumes->getValue(1) - 24.0f) < 1.0e-5f)
+    DREAM3D_REQUIRE(std::fabs(volumes->getValue(2) - 24.0f) < 1.0e-5f)
+
+    // Arbitrary hexahedra are the sum of their 5 tetrahedra
+    std::mt19937_64 generator(5678);
+    FloatArrayType::Pointer randomVertices = CreateVertices(generator);
+    Int64ArrayType::Pointer randomHexas = CreateElements(generator, 8);
+    FloatArrayType::Pointer randomVolumes = FloatArrayType::CreateArray(k_NumElements, "Volumes");
+    GeometryHelpers::Topology::FindHexVolumes<int64_t>(randomHexas, randomVertices, randomVolumes);
+
+    const int64_t subTets[5][4] = {{0, 1, 3, 4}, {1, 4, 5, 6}, {1, 4, 6, 3}, {1, 3, 6, 2}, {3, 6, 7, 4}};
+    const float* vertex = randomVertices->getPointer(0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      int64_t* hex = randomHexas->getTuplePointer(i);
+      float volume = 0.0f;
+      for(size_t t = 0; t < 5; t++)
+      {
+        volume += TetDeterminant(vertex, hex[subTets[t][0]], hex[subTets[t][1]], hex[subTets[t][2]], hex[subTets[t][3]]) / 6.0f;
+      }
+      DREAM3D_REQUIRE_EQUAL(randomVolumes->getValue(i), volume)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleAreas()
+  {
+    std::mt19937_64 generator(91011);
+    FloatArrayType::Pointer vertices = CreateVertices(generator);
+    Int64ArrayType::Pointer triangles = CreateElements(generator, 3);
+    FloatArrayType::Pointer areas = FloatArrayType::CreateArray(k_NumElements, "Areas");
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(triangles, vertices, areas);
+
+    const float* vertex = vertices->getPointer(0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      int64_t* tri = triangles->getTuplePointer(i);
+      double a[3], b[3];
+      for(size_t d = 0; d < 3; d++)
+      {
+        a[d] = vertex[3 * tri[1] + d] - vertex[3 * tri[0] + d];
+        b[d] = vertex[3 * tri[2] + d] - vertex[3 * tri[0] + d];
+      }
+      double cross[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+      double area = 0.5 * std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+      if(area < 1.0e-3)
+      {
+        // The normal of a degenerate triangle is not defined
+        continue;
+      }
+      DREAM3D_REQUIRE(std::fabs(areas->getValue(i) - area) <= 1.0e-3 * area + 1.0e-4)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAverages()
+  {
+    std::mt19937_64 generator(121314);
+    FloatArrayType::Pointer vertices = CreateVertices(generator);
+    Int64ArrayType::Pointer quads = CreateElements(generator, 4);
+
+    const size_t numComps = 2;
+    std::uniform_int_distribution<int32_t> distribution(-1000, 1000);
+    Int32ArrayType::Pointer vertexValues = Int32ArrayType::CreateArray(k_NumVertices, QVector<size_t>(1, numComps), "VertexValues");
+    for(size_t i = 0; i < numComps * k_NumVertices; i++)
+    {
+      vertexValues->setValue(i, distribution(generator));
+    }
+
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(k_NumElements, QVector<size_t>(1, 3), "Centroids");
+    FloatArrayType::Pointer averages = FloatArrayType::CreateArray(k_NumElements, QVector<size_t>(1, numComps), "Averages");
+    FloatArrayType::Pointer weightedAverages = FloatArrayType::CreateArray(k_NumElements, QVector<size_t>(1, numComps), "WeightedAverages");
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(quads, vertices, centroids);
+    GeometryHelpers::Generic::AverageVertexArrayValues<int64_t, int32_t>(quads, vertexValues, averages);
+    GeometryHelpers::Generic::WeightedAverageVertexArrayValues<int64_t, int32_t>(quads, vertices, centroids, vertexValues, weightedAverages);
+
+    const float* vertex = vertices->getPointer(0);
+    const int32_t* values = vertexValues->getPointer(0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      int64_t* quad = quads->getTuplePointer(i);
+      float* centroid = centroids->getTuplePointer(i);
+      for(size_t d = 0; d < 3; d++)
+      {
+        float position = 0.0f;
+        for(size_t k = 0; k < 4; k++)
+        {
+          position += vertex[3 * quad[k] + d];
+        }
+        DREAM3D_REQUIRE_EQUAL(centroid[d], position / 4.0f)
+      }
+
+      float distances[4];
+      for(size_t k = 0; k < 4; k++)
+      {
+        float dist = 0.0f;
+        for(size_t d = 0; d < 3; d++)
+        {
+          dist += (vertex[3 * quad[k] + d] - centroid[d]) * (vertex[3 * quad[k] + d] - centroid[d]);
+        }
+        distances[k] = sqrtf(dist);
+      }
+
+      for(size_t c = 0; c < numComps; c++)
+      {
+        float value = 0.0f;
+        float weightedValue = 0.0f;
+        float sumDist = 0.0f;
+        for(size_t k = 0; k < 4; k++)
+        {
+          value += values[numComps * quad[k] + c];
+          weightedValue += values[numComps * quad[k] + c] * distances[k];
+          sumDist += distances[k];
+        }
+        DREAM3D_REQUIRE_EQUAL(averages->getComponent(i, c), value / 4.0f)
+        DREAM3D_REQUIRE(std::fabs(weightedAverages->getComponent(i, c) - weightedValue / sumDist) <= 1.0e-5f * std::fabs(weightedValue / sumDist) + 1.0e-5f)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompactConnectivity()
+  {
+    std::mt19937_64 generator(151617);
+    FloatArrayType::Pointer vertices = CreateVertices(generator);
+    Int64ArrayType::Pointer triangles = CreateElements(generator, 3);
+
+    TriangleGeom::Pointer wide = TriangleGeom::CreateGeometry(std::static_pointer_cast<Int64ArrayType>(triangles->deepCopy()), vertices, SIMPL::Geometry::TriangleGeometry);
+    TriangleGeom::Pointer compact = TriangleGeom::CreateGeometry(std::static_pointer_cast<Int64ArrayType>(triangles->deepCopy()), vertices, SIMPL::Geometry::TriangleGeometry);
+    DREAM3D_REQUIRE_EQUAL(compact->getCompactConnectivity(), false)
+    DREAM3D_REQUIRE_EQUAL(compact->setCompactConnectivity(true), 0)
+    DREAM3D_REQUIRE_EQUAL(compact->getCompactConnectivity(), true)
+    DREAM3D_REQUIRE_VALID_POINTER(compact->getCompactTriangles().get())
+    DREAM3D_REQUIRE_EQUAL(compact->getNumberOfTris(), static_cast<int64_t>(k_NumElements))
+
+    const uint32_t* compactTris = compact->getCompactTriangles()->getPointer(0);
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      int64_t verts[3] = {0, 0, 0};
+      compact->getVertsAtTri(static_cast<int64_t>(i), verts);
+      for(size_t k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(static_cast<int64_t>(compactTris[3 * i + k]), triangles->getComponent(i, k))
+        DREAM3D_REQUIRE_EQUAL(verts[k], triangles->getComponent(i, k))
+      }
+    }
+
+    // The topology derived from the compact list matches the 64 bit one and follows its width
+    DREAM3D_REQUIRE(wide->findElementsContainingVert() >= 0)
+    DREAM3D_REQUIRE(compact->findElementsContainingVert() >= 0)
+    ElementDynamicList::Pointer wideContaining = wide->getElementsContainingVert();
+    ElementDynamicList::Pointer compactContaining = compact->getElementsContainingVert();
+    for(size_t v = 0; v < k_NumVertices; v++)
+    {
+      DREAM3D_REQUIRE_EQUAL(wideContaining->getNumberOfElements(v), compactContaining->getNumberOfElements(v))
+      for(uint16_t k = 0; k < wideContaining->getNumberOfElements(v); k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(wideContaining->getElementListPointer(v)[k], compactContaining->getElementListPointer(v)[k])
+      }
+    }
+    DREAM3D_REQUIRE(wide->findEdges() >= 0)
+    DREAM3D_REQUIRE(compact->findEdges() >= 0)
+    DREAM3D_REQUIRE_VALID_POINTER(compact->getCompactEdges().get())
+    DREAM3D_REQUIRE_EQUAL(wide->getNumberOfEdges(), compact->getNumberOfEdges())
+
+    // The compact list is written as 32 bit Ids, declared as such in the Xdmf and read back without widening
+    QString xdmf;
+    QTextStream xdmfStream(&xdmf);
+    DREAM3D_REQUIRE(compact->writeXdmf(xdmfStream, "DataContainer", "GeometryHelpersTest.h5") >= 0)
+    xdmfStream.flush();
+    DREAM3D_REQUIRE(xdmf.contains(GeometryHelpers::GeomIO::XdmfConnectivityNumberType(true)))
+    DREAM3D_REQUIRE(xdmf.contains("NumberType=\"UInt\""))
+    {
+      hid_t fileId = QH5Utilities::createFile(m_FilePath);
+      DREAM3D_REQUIRE(fileId > 0)
+      H5ScopedFileSentinel sentinel(&fileId, false);
+      hid_t geomId = QH5Utilities::createGroup(fileId, SIMPL::Geometry::Geometry);
+      sentinel.addGroupId(&geomId);
+      DREAM3D_REQUIRE(geomId > 0)
+      DREAM3D_REQUIRE(compact->writeGeometryToHDF5(geomId, false) >= 0)
+
+      herr_t err = 0;
+      Int64ArrayType::Pointer readList = Int64ArrayType::NullPointer();
+      UInt32ArrayType::Pointer readCompactList = UInt32ArrayType::NullPointer();
+      GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedTriList, geomId, false, err, readList, readCompactList);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE_NULL_POINTER(readList.get())
+      DREAM3D_REQUIRE_VALID_POINTER(readCompactList.get())
+      DREAM3D_REQUIRE_EQUAL(readCompactList->getNumberOfTuples(), k_NumElements)
+      DREAM3D_REQUIRE_EQUAL(readCompactList->getNumberOfComponents(), 3)
+      for(size_t i = 0; i < 3 * k_NumElements; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readCompactList->getValue(i), compactTris[i])
+      }
+
+      TriangleGeom::Pointer readBack = TriangleGeom::New();
+      DREAM3D_REQUIRE(readBack->readGeometryFromHDF5(geomId, false) >= 0)
+      DREAM3D_REQUIRE_EQUAL(readBack->getCompactConnectivity(), true)
+      DREAM3D_REQUIRE_VALID_POINTER(readBack->getCompactEdges().get())
+      DREAM3D_REQUIRE_EQUAL(readBack->getNumberOfTris(), compact->getNumberOfTris())
+    }
+#if REMOVE_TEST_FILES
+    DREAM3D_REQUIRE(QFile::remove(m_FilePath))
+#endif
+
+    // Reading the 64 bit list returns a copy and leaves the compact storage untouched
+    CompactTriList::Pointer compactList = compact->getCompactTriangles();
+    Int64ArrayType::Pointer expanded = compact->getTriangles();
+    DREAM3D_REQUIRE_EQUAL(compact->getCompactConnectivity(), true)
+    DREAM3D_REQUIRE(compact->getCompactTriangles().get() == compactList.get())
+    DREAM3D_REQUIRE_NULL_POINTER(compact->getTriPointer(0))
+    DREAM3D_REQUIRE_EQUAL(expanded->getNumberOfTuples(), triangles->getNumberOfTuples())
+    for(size_t i = 0; i < 3 * k_NumElements; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(expanded->getValue(i), triangles->getValue(i))
+    }
+    expanded->setValue(0, expanded->getValue(0) + 1);
+    DREAM3D_REQUIRE_EQUAL(static_cast<int64_t>(compactList->getValue(0)), triangles->getValue(0))
+
+    // A vertex Id that fits in 32 bits is written in place, a larger one moves the list back to 64 bit storage
+    int64_t verts[3] = {2, 1, 0};
+    compact->setVertsAtTri(0, verts);
+    DREAM3D_REQUIRE(compact->getCompactTriangles().get() == compactList.get())
+    DREAM3D_REQUIRE_EQUAL(compactList->getValue(0), 2u)
+    verts[0] = static_cast<int64_t>(std::numeric_limits<uint32_t>::max()) + 1;
+    compact->setVertsAtTri(1, verts);
+    DREAM3D_REQUIRE_EQUAL(compact->getCompactConnectivity(), false)
+    DREAM3D_REQUIRE_EQUAL(compact->getTriPointer(1)[0], verts[0])
+    DREAM3D_REQUIRE_EQUAL(compact->getTriPointer(0)[0], 2)
+    DREAM3D_REQUIRE_EQUAL(compact->getTriPointer(2)[2], triangles->getComponent(2, 2))
+
+    // Vertex Ids that do not fit in 32 bits cannot be narrowed
+    triangles->setValue(0, -1);
+    DREAM3D_REQUIRE_NULL_POINTER((GeometryHelpers::Connectivity::ConvertList<int64_t, uint32_t>(triangles)).get())
+    triangles->setValue(0, static_cast<int64_t>(std::numeric_limits<uint32_t>::max()) + 1);
+    DREAM3D_REQUIRE_NULL_POINTER((GeometryHelpers::Connectivity::ConvertList<int64_t, uint32_t>(triangles)).get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestTetMeasures())
+    DREAM3D_REGISTER_TEST(TestHexVolumes())
+    DREAM3D_REGISTER_TEST(TestTriangleAreas())
+    DREAM3D_REGISTER_TEST(TestAverages())
+    DREAM3D_REGISTER_TEST(TestCompactConnectivity())
+  }
+
+private:
+  QString m_FilePath = UnitTest::TestTempDir + "/GeometryHelpersTest.h5";
+
+  GeometryHelpersTest(const GeometryHelpersTest&); // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&);      // Move assignment Not Implemented
+};
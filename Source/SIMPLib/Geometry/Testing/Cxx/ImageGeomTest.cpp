@@ -1,7 +1,9 @@
 
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 #include <QtCore/QFile>
 
@@ -91,6 +93,113 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindDerivatives()
+  {
+    // The finite differences of a linear field are exact in the interior and on the faces of the image
+    size_t dims[3] = {13, 7, 5};
+    float res[3] = {0.5f, 2.0f, 0.25f};
+    float origin[3] = {-3.0f, 1.0f, 4.0f};
+    double slopes[2][3] = {{1.5, -2.0, 0.75}, {-0.5, 3.0, 4.0}};
+
+    for(size_t zDim : {dims[2], static_cast<size_t>(1)})
+    {
+      ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+      geom->setDimensions(dims[0], dims[1], zDim);
+      geom->setResolution(res[0], res[1], res[2]);
+      geom->setOrigin(origin[0], origin[1], origin[2]);
+
+      size_t numCells = dims[0] * dims[1] * zDim;
+      DoubleArrayType::Pointer field = DoubleArrayType::CreateArray(numCells, QVector<size_t>(1, 2), "Field", true);
+      DoubleArrayType::Pointer derivatives = DoubleArrayType::CreateArray(numCells, QVector<size_t>(1, 6), "Derivatives", true);
+      for(size_t z = 0; z < zDim; z++)
+      {
+        for(size_t y = 0; y < dims[1]; y++)
+        {
+          for(size_t x = 0; x < dims[0]; x++)
+          {
+            double coords[3] = {0.0, 0.0, 0.0};
+            geom->getCoords(x, y, z, coords);
+            size_t index = (z * dims[1] + y) * dims[0] + x;
+            for(size_t c = 0; c < 2; c++)
+            {
+              field->setComponent(index, c, slopes[c][0] * coords[0] + slopes[c][1] * coords[1] + slopes[c][2] * coords[2]);
+            }
+          }
+        }
+      }
+
+      geom->findDerivatives(field, derivatives);
+
+      for(size_t i = 0; i < numCells; i++)
+      {
+        for(size_t c = 0; c < 2; c++)
+        {
+          for(size_t d = 0; d < 3; d++)
+          {
+            // A single plane has no derivative along z
+            double expected = (d == 2 && zDim == 1) ? 0.0 : slopes[c][d];
+            DREAM3D_REQUIRE(std::fabs(derivatives->getComponent(i, c * 3 + d) - expected) < 1.0E-4)
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestComputeCellIndices()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(10, 20, 30);
+    geom->setResolution(0.5f, 0.25f, 2.0f);
+    geom->setOrigin(-1.0f, 6.0f, 10.0f);
+
+    // The center of every 7th cell, the far corner of the image and points outside of each face
+    std::vector<float> coords;
+    std::vector<int64_t> expected;
+    size_t numCells = geom->getNumberOfElements();
+    for(size_t i = 0; i < numCells; i += 7)
+    {
+      double center[3] = {0.0, 0.0, 0.0};
+      geom->getCoords(i, center);
+      coords.insert(coords.end(), {static_cast<float>(center[0]), static_cast<float>(center[1]), static_cast<float>(center[2])});
+      expected.push_back(static_cast<int64_t>(i));
+    }
+    coords.insert(coords.end(), {4.0f, 11.0f, 70.0f});
+    expected.push_back(static_cast<int64_t>(numCells - 1));
+
+    const float outside[7][3] = {{-1.1f, 7.0f, 20.0f}, {4.1f, 7.0f, 20.0f}, {0.0f, 5.9f, 20.0f}, {0.0f, 11.1f, 20.0f}, {0.0f, 7.0f, 9.9f}, {0.0f, 7.0f, 70.1f}, {NAN, 7.0f, 20.0f}};
+    for(const auto& point : outside)
+    {
+      coords.insert(coords.end(), point, point + 3);
+      expected.push_back(-1);
+    }
+
+    size_t numPoints = expected.size();
+    std::vector<int64_t> indices(numPoints, 0);
+    std::vector<uint8_t> outOfBounds(numPoints, 0);
+    size_t numOutside = geom->computeCellIndices(coords.data(), numPoints, indices.data(), outOfBounds.data());
+    DREAM3D_REQUIRE_EQUAL(numOutside, 7)
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(indices[i], expected[i])
+      DREAM3D_REQUIRE_EQUAL(outOfBounds[i], (expected[i] < 0 ? 1 : 0))
+    }
+
+    // The batched lookup agrees with computeCellIndex()
+    for(size_t i = 0; i < numPoints - 8; i++)
+    {
+      size_t index = 0;
+      ImageGeom::ErrorType err = geom->computeCellIndex(coords.data() + 3 * i, index);
+      DREAM3D_REQUIRE(err == ImageGeom::ErrorType::NoError)
+      DREAM3D_REQUIRE_EQUAL(static_cast<int64_t>(index), indices[i])
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -101,6 +210,8 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestFindDerivatives());
+    DREAM3D_REGISTER_TEST(TestComputeCellIndices());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
@@ -0,0 +1,254 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/Geometry/ImageNeighborhood.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ImageNeighborhoodTest
+{
+public:
+  ImageNeighborhoodTest() = default;
+  virtual ~ImageNeighborhoodTest() = default;
+
+  using NeighborEntry = std::pair<size_t, size_t>; // Direction and linear index
+
+  const size_t k_BenchmarkDim = 128;
+
+  // -----------------------------------------------------------------------------
+  // Computes the neighbors of a cell by applying the boundary policy to each coordinate
+  // -----------------------------------------------------------------------------
+  std::vector<NeighborEntry> FindNeighbors(const size_t dims[3], const size_t cell[3], size_t numDirections, ImageNeighborhood::BoundaryPolicy policy)
+  {
+    std::vector<NeighborEntry> neighbors;
+    for(size_t d = 0; d < numDirections; d++)
+    {
+      int offset[3] = {0, 0, 0};
+      ImageNeighborhood::GetDirection(d, offset);
+      int64_t coords[3] = {0, 0, 0};
+      bool valid = true;
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        int64_t dim = static_cast<int64_t>(dims[axis]);
+        int64_t c = static_cast<int64_t>(cell[axis]) + offset[axis];
+        if(c < 0 || c >= dim)
+        {
+          if(policy == ImageNeighborhood::BoundaryPolicy::Skip)
+          {
+            valid = false;
+          }
+          else if(policy == ImageNeighborhood::BoundaryPolicy::Clamp)
+          {
+            c = std::min(std::max(c, static_cast<int64_t>(0)), dim - 1);
+          }
+          else
+          {
+            c = (c + dim) % dim;
+          }
+        }
+        coords[axis] = c;
+      }
+      if(valid)
+      {
+        size_t index = static_cast<size_t>((coords[2] * static_cast<int64_t>(dims[1]) + coords[1]) * static_cast<int64_t>(dims[0]) + coords[0]);
+        neighbors.push_back(NeighborEntry(d, index));
+      }
+    }
+    return neighbors;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDirections()
+  {
+    size_t numNonZero[3] = {0, 0, 0};
+    for(size_t d = 0; d < ImageNeighborhood::k_MaxNeighbors; d++)
+    {
+      int offset[3] = {0, 0, 0};
+      int opposite[3] = {0, 0, 0};
+      ImageNeighborhood::GetDirection(d, offset);
+      ImageNeighborhood::GetDirection(ImageNeighborhood::GetOppositeDirection(d), opposite);
+      int nonZero = 0;
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        DREAM3D_REQUIRE_EQUAL(offset[axis], -opposite[axis])
+        nonZero += (offset[axis] != 0) ? 1 : 0;
+      }
+      DREAM3D_REQUIRE(nonZero >= 1 && nonZero <= 3)
+      numNonZero[nonZero - 1]++;
+
+      // Face neighbors come first, then the edge and vertex neighbors
+      size_t expected = d < 6 ? 1 : (d < 18 ? 2 : 3);
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(nonZero), expected)
+    }
+    DREAM3D_REQUIRE_EQUAL(numNonZero[0], 6)
+    DREAM3D_REQUIRE_EQUAL(numNonZero[1], 12)
+    DREAM3D_REQUIRE_EQUAL(numNonZero[2], 8)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighbors()
+  {
+    const size_t dimensions[5][3] = {{5, 4, 3}, {6, 5, 1}, {1, 7, 1}, {2, 3, 4}, {1, 1, 1}};
+    const ImageNeighborhood::Connectivity connectivities[3] = {ImageNeighborhood::Connectivity::Face, ImageNeighborhood::Connectivity::Edge, ImageNeighborhood::Connectivity::Vertex};
+    const ImageNeighborhood::BoundaryPolicy policies[3] = {ImageNeighborhood::BoundaryPolicy::Skip, ImageNeighborhood::BoundaryPolicy::Clamp, ImageNeighborhood::BoundaryPolicy::Periodic};
+
+    for(const auto& dims : dimensions)
+    {
+      for(ImageNeighborhood::Connectivity connectivity : connectivities)
+      {
+        for(ImageNeighborhood::BoundaryPolicy policy : policies)
+        {
+          ImageNeighborhood::Pointer neighborhood = ImageNeighborhood::New(dims[0], dims[1], dims[2], connectivity, policy);
+          DREAM3D_REQUIRE_EQUAL(neighborhood->getNumberOfDirections(), static_cast<size_t>(connectivity))
+
+          size_t numElements = neighborhood->getNumberOfElements();
+          std::vector<std::vector<NeighborEntry>> found(numElements);
+          std::vector<int> visits(numElements, 0);
+          std::vector<size_t> cells(numElements * 3, 0);
+
+          // A kernel may only write to the data of its own cell
+          neighborhood->forEach([&found, &visits, &cells](const ImageNeighborhood::Neighbors& neighbors) {
+            visits[neighbors.index]++;
+            cells[3 * neighbors.index] = neighbors.x;
+            cells[3 * neighbors.index + 1] = neighbors.y;
+            cells[3 * neighbors.index + 2] = neighbors.z;
+            for(size_t k = 0; k < neighbors.size(); k++)
+            {
+              found[neighbors.index].push_back(NeighborEntry(neighbors.direction(k), neighbors[k]));
+            }
+          });
+
+          for(size_t z = 0; z < dims[2]; z++)
+          {
+            for(size_t y = 0; y < dims[1]; y++)
+            {
+              for(size_t x = 0; x < dims[0]; x++)
+              {
+                size_t cell[3] = {x, y, z};
+                size_t index = (z * dims[1] + y) * dims[0] + x;
+                DREAM3D_REQUIRE_EQUAL(visits[index], 1)
+                DREAM3D_REQUIRE_EQUAL(cells[3 * index], x)
+                DREAM3D_REQUIRE_EQUAL(cells[3 * index + 1], y)
+                DREAM3D_REQUIRE_EQUAL(cells[3 * index + 2], z)
+
+                std::vector<NeighborEntry> expected = FindNeighbors(dims, cell, neighborhood->getNumberOfDirections(), policy);
+                DREAM3D_REQUIRE(found[index] == expected)
+
+                ImageNeighborhood::Neighbors neighbors = neighborhood->getNeighbors(x, y, z);
+                DREAM3D_REQUIRE_EQUAL(neighbors.index, index)
+                DREAM3D_REQUIRE_EQUAL(neighbors.size(), expected.size())
+                for(size_t k = 0; k < neighbors.size(); k++)
+                {
+                  DREAM3D_REQUIRE_EQUAL(neighbors[k], expected[k].second)
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Averages a field over the neighbors of each cell and reports the throughput
+  // -----------------------------------------------------------------------------
+  void BenchmarkConnectivity()
+  {
+    size_t dim = k_BenchmarkDim;
+    size_t numElements = dim * dim * dim;
+    std::vector<float> field(numElements);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      field[i] = static_cast<float>(i % dim);
+    }
+    std::vector<float> average(numElements, 0.0f);
+
+    const ImageNeighborhood::Connectivity connectivities[2] = {ImageNeighborhood::Connectivity::Face, ImageNeighborhood::Connectivity::Vertex};
+    for(ImageNeighborhood::Connectivity connectivity : connectivities)
+    {
+      ImageNeighborhood::Pointer neighborhood = ImageNeighborhood::New(dim, dim, dim, connectivity, ImageNeighborhood::BoundaryPolicy::Clamp);
+      const float* data = field.data();
+      float* out = average.data();
+
+      auto start = std::chrono::steady_clock::now();
+      neighborhood->forEach([data, out](const ImageNeighborhood::Neighbors& neighbors) {
+        float sum = 0.0f;
+        for(size_t k = 0; k < neighbors.size(); k++)
+        {
+          sum += data[neighbors[k]];
+        }
+        out[neighbors.index] = sum / static_cast<float>(neighbors.size());
+      });
+      auto end = std::chrono::steady_clock::now();
+
+      double seconds = std::chrono::duration<double>(end - start).count();
+      std::cout << "  " << static_cast<int>(connectivity) << " connected average of " << numElements << " cells: " << seconds * 1000.0 << " ms, "
+                << static_cast<double>(numElements) / std::max(seconds, 1.0E-9) / 1.0E6 << " Mcells/s" << std::endl;
+
+      // The field is linear along x, so the symmetric neighborhood of an interior cell averages to the cell value
+      size_t index = (dim / 2 * dim + dim / 2) * dim + dim / 2;
+      DREAM3D_REQUIRE(std::fabs(average[index] - field[index]) < 1.0E-4f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ImageNeighborhoodTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestDirections())
+    DREAM3D_REGISTER_TEST(TestNeighbors())
+    DREAM3D_REGISTER_TEST(BenchmarkConnectivity())
+  }
+
+private:
+  ImageNeighborhoodTest(const ImageNeighborhoodTest&); // Copy Constructor Not Implemented
+  void operator=(const ImageNeighborhoodTest&);        // Move assignment Not Implemented
+};
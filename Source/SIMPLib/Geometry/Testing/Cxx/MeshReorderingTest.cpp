@@ -0,0 +1,282 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MeshReorderingTest
+{
+public:
+  MeshReorderingTest() = default;
+  virtual ~MeshReorderingTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool IsPermutation(const std::vector<int64_t>& order, size_t size)
+  {
+    if(order.size() != size)
+    {
+      return false;
+    }
+    std::vector<uint8_t> seen(size, 0);
+    for(int64_t id : order)
+    {
+      if(id < 0 || static_cast<size_t>(id) >= size || seen[id] != 0)
+      {
+        return false;
+      }
+      seen[id] = 1;
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every cell of a small grid has a unique key and consecutive keys belong to cells that share a face
+  // -----------------------------------------------------------------------------
+  void TestHilbertKey()
+  {
+    const int bits = 3;
+    const uint32_t dim = 1u << bits;
+    std::vector<int64_t> cellOfKey(dim * dim * dim, -1);
+    for(uint32_t z = 0; z < dim; z++)
+    {
+      for(uint32_t y = 0; y < dim; y++)
+      {
+        for(uint32_t x = 0; x < dim; x++)
+        {
+          uint64_t key = MeshReordering::HilbertKey(x, y, z, bits);
+          DREAM3D_REQUIRE(key < cellOfKey.size())
+          DREAM3D_REQUIRE_EQUAL(cellOfKey[key], -1)
+          cellOfKey[key] = (z * dim + y) * dim + x;
+        }
+      }
+    }
+
+    for(size_t k = 1; k < cellOfKey.size(); k++)
+    {
+      int64_t a = cellOfKey[k - 1];
+      int64_t b = cellOfKey[k];
+      int64_t distance = std::abs(a % dim - b % dim) + std::abs((a / dim) % dim - (b / dim) % dim) + std::abs(a / (dim * dim) - b / (dim * dim));
+      DREAM3D_REQUIRE_EQUAL(distance, 1)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHilbertOrder()
+  {
+    std::mt19937_64 generator(1234);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+    const size_t numPoints = 10007;
+    std::vector<float> coords(3 * numPoints);
+    for(float& c : coords)
+    {
+      c = distribution(generator);
+    }
+    coords[3 * 17 + 1] = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<int64_t> order = MeshReordering::FindHilbertOrder(coords.data(), numPoints);
+    DREAM3D_REQUIRE(IsPermutation(order, numPoints))
+
+    // Points that follow each other along the curve are much closer than random pairs of points
+    double sumDistance = 0.0;
+    for(size_t i = 1; i < numPoints; i++)
+    {
+      const float* a = coords.data() + 3 * order[i - 1];
+      const float* b = coords.data() + 3 * order[i];
+      double d = std::sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+      sumDistance += std::isnan(d) ? 0.0 : d;
+    }
+    DREAM3D_REQUIRE(sumDistance / static_cast<double>(numPoints - 1) < 2.0)
+
+    // Coincident points keep their relative order
+    std::vector<float> same(3 * 5, 1.0f);
+    std::vector<int64_t> sameOrder = MeshReordering::FindHilbertOrder(same.data(), 5);
+    for(size_t i = 0; i < 5; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(sameOrder[i], static_cast<int64_t>(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds the face neighbors of a grid of quads whose ids are shuffled, so the bandwidth of the
+  // neighbor graph is close to the number of quads
+  // -----------------------------------------------------------------------------
+  void TestReverseCuthillMcKee()
+  {
+    const int64_t dimX = 40;
+    const int64_t dimY = 25;
+    const size_t numElements = static_cast<size_t>(dimX * dimY);
+    std::vector<int64_t> ids(numElements);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      ids[i] = static_cast<int64_t>(i);
+    }
+    std::mt19937_64 generator(4321);
+    std::shuffle(ids.begin(), ids.end(), generator);
+
+    std::vector<uint16_t> counts(numElements, 0);
+    std::vector<std::vector<int64_t>> lists(numElements);
+    for(int64_t y = 0; y < dimY; y++)
+    {
+      for(int64_t x = 0; x < dimX; x++)
+      {
+        int64_t id = ids[y * dimX + x];
+        const int64_t offsets[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        for(const auto& offset : offsets)
+        {
+          int64_t nx = x + offset[0];
+          int64_t ny = y + offset[1];
+          if(nx >= 0 && nx < dimX && ny >= 0 && ny < dimY)
+          {
+            lists[id].push_back(ids[ny * dimX + nx]);
+          }
+        }
+        counts[id] = static_cast<uint16_t>(lists[id].size());
+      }
+    }
+    ElementDynamicList::Pointer neighbors = ElementDynamicList::New();
+    neighbors->allocateLists(counts);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      neighbors->setElementList(i, counts[i], lists[i].data());
+    }
+
+    std::vector<int64_t> order = MeshReordering::FindReverseCuthillMcKeeOrder(neighbors, numElements);
+    DREAM3D_REQUIRE(IsPermutation(order, numElements))
+
+    std::vector<int64_t> newIds = MeshReordering::InvertOrder(order);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(order[newIds[i]], static_cast<int64_t>(i))
+    }
+
+    int64_t bandwidth = 0;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      for(int64_t neighbor : lists[i])
+      {
+        bandwidth = std::max(bandwidth, std::abs(newIds[i] - newIds[neighbor]));
+      }
+    }
+    DREAM3D_REQUIRE(bandwidth <= 2 * dimY)
+
+    // Without neighbors the order is the identity
+    std::vector<int64_t> identity = MeshReordering::FindReverseCuthillMcKeeOrder(ElementDynamicList::NullPointer(), 3);
+    DREAM3D_REQUIRE_EQUAL(identity.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(identity[2], 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPermuteTuples()
+  {
+    const size_t numTuples = 6;
+    std::vector<int64_t> order = {3, 0, 5, 1, 4, 2};
+
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(numTuples, QVector<size_t>(1, 2), "Values");
+    NeighborList<float>::Pointer neighborList = NeighborList<float>::CreateArray(numTuples, "NeighborList");
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(numTuples, "Strings");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      values->setComponent(i, 0, static_cast<int32_t>(i));
+      values->setComponent(i, 1, static_cast<int32_t>(10 * i));
+      NeighborList<float>::SharedVectorType list(new std::vector<float>(i, static_cast<float>(i)));
+      neighborList->setList(static_cast<int>(i), list);
+      strings->setValue(i, QString::number(i));
+    }
+
+    DREAM3D_REQUIRE(MeshReordering::PermuteTuples(values, order))
+    DREAM3D_REQUIRE(MeshReordering::PermuteTuples(neighborList, order))
+    DREAM3D_REQUIRE(MeshReordering::PermuteTuples(strings, order))
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 0), order[i])
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 1), 10 * order[i])
+      DREAM3D_REQUIRE_EQUAL(neighborList->getListSize(static_cast<int>(i)), order[i])
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(i), QString::number(order[i]))
+    }
+
+    // The order must cover every tuple
+    std::vector<int64_t> shortOrder = {1, 0};
+    DREAM3D_REQUIRE_EQUAL(MeshReordering::PermuteTuples(values, shortOrder), false)
+
+    Int64ArrayType::Pointer ids = Int64ArrayType::CreateArray(3, QVector<size_t>(1, 2), "Ids");
+    const int64_t oldIds[6] = {0, 1, 2, 3, 4, 5};
+    for(size_t i = 0; i < 6; i++)
+    {
+      ids->setValue(i, oldIds[i]);
+    }
+    std::vector<int64_t> newIds = MeshReordering::InvertOrder(order);
+    MeshReordering::RenumberIds(ids, newIds);
+    for(size_t i = 0; i < 6; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ids->getValue(i), newIds[oldIds[i]])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### MeshReorderingTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestHilbertKey())
+    DREAM3D_REGISTER_TEST(TestHilbertOrder())
+    DREAM3D_REGISTER_TEST(TestReverseCuthillMcKee())
+    DREAM3D_REGISTER_TEST(TestPermuteTuples())
+  }
+
+private:
+  MeshReorderingTest(const MeshReorderingTest&); // Copy Constructor Not Implemented
+  void operator=(const MeshReorderingTest&);     // Move assignment Not Implemented
+};
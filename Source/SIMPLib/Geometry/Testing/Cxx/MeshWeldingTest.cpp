@@ -0,0 +1,348 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MeshWeldingTest
+{
+public:
+  MeshWeldingTest() = default;
+  virtual ~MeshWeldingTest() = default;
+
+  // Enough triangles for several tasks
+  const size_t k_GridSize = 60;
+
+  // -----------------------------------------------------------------------------
+  // Creates a triangle soup of a k_GridSize x k_GridSize grid of unit squares that are split into two triangles,
+  // where every triangle stores its own three vertices, as an STL file does. The copies of each vertex are moved
+  // by up to jitter along each axis.
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateTriangleSoup(float jitter, std::mt19937_64& generator)
+  {
+    std::uniform_real_distribution<float> distribution(-jitter, jitter);
+    size_t numTris = 2 * k_GridSize * k_GridSize;
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(3 * numTris));
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(static_cast<int64_t>(numTris), vertices, SIMPL::Geometry::TriangleGeometry);
+    float* coords = vertices->getPointer(0);
+    int64_t* tris = triangles->getTriPointer(0);
+    size_t vert = 0;
+    for(size_t y = 0; y < k_GridSize; y++)
+    {
+      for(size_t x = 0; x < k_GridSize; x++)
+      {
+        const size_t corners[6][2] = {{x, y}, {x + 1, y}, {x + 1, y + 1}, {x, y}, {x + 1, y + 1}, {x, y + 1}};
+        for(size_t k = 0; k < 6; k++)
+        {
+          coords[3 * vert] = static_cast<float>(corners[k][0]) + distribution(generator);
+          coords[3 * vert + 1] = static_cast<float>(corners[k][1]) + distribution(generator);
+          coords[3 * vert + 2] = distribution(generator);
+          tris[vert] = static_cast<int64_t>(vert);
+          vert++;
+        }
+      }
+    }
+    return triangles;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Every triangle of the welded grid must still span half of a unit square
+  // -----------------------------------------------------------------------------
+  void CheckWeldedGrid(TriangleGeom::Pointer triangles, float tolerance)
+  {
+    size_t numGridVerts = (k_GridSize + 1) * (k_GridSize + 1);
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfVertices(), static_cast<int64_t>(numGridVerts))
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfTris(), static_cast<int64_t>(2 * k_GridSize * k_GridSize))
+
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      int64_t verts[3] = {0, 0, 0};
+      triangles->getVertsAtTri(i, verts);
+      float* a = triangles->getVertexPointer(verts[0]);
+      float* b = triangles->getVertexPointer(verts[1]);
+      float* c = triangles->getVertexPointer(verts[2]);
+      DREAM3D_REQUIRE(verts[0] != verts[1] && verts[1] != verts[2] && verts[0] != verts[2])
+      float area = 0.5f * std::fabs((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]));
+      DREAM3D_REQUIRE(std::fabs(area - 0.5f) <= 4.0f * tolerance)
+    }
+
+    // The welded mesh is connected, so every interior edge is shared by two triangles
+    DREAM3D_REQUIRE(triangles->findElementNeighbors() >= 0)
+    ElementDynamicList::Pointer neighbors = triangles->getElementNeighbors();
+    size_t numNeighbors = 0;
+    for(int64_t i = 0; i < triangles->getNumberOfTris(); i++)
+    {
+      numNeighbors += neighbors->getNumberOfElements(i);
+    }
+    size_t numInteriorEdges = 3 * k_GridSize * k_GridSize - 2 * k_GridSize;
+    DREAM3D_REQUIRE_EQUAL(numNeighbors, 2 * numInteriorEdges)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExactWelding()
+  {
+    std::mt19937_64 generator(1234);
+    TriangleGeom::Pointer triangles = CreateTriangleSoup(0.0f, generator);
+    size_t numVerts = static_cast<size_t>(triangles->getNumberOfVertices());
+
+    size_t numWelded = 0;
+    std::vector<int64_t> newIds = MeshWelding::FindWeldedIds(triangles->getVertexPointer(0), numVerts, 0.0f, numWelded);
+    DREAM3D_REQUIRE_EQUAL(numWelded, (k_GridSize + 1) * (k_GridSize + 1))
+    DREAM3D_REQUIRE_EQUAL(newIds.size(), numVerts)
+    int64_t nextId = 0;
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      // The kept vertices keep their order and the merged ones point to an earlier vertex
+      DREAM3D_REQUIRE(newIds[i] >= 0 && newIds[i] <= nextId)
+      if(newIds[i] == nextId)
+      {
+        nextId++;
+      }
+    }
+
+    QVector<size_t> removedVertices;
+    QVector<size_t> removedElements;
+    DREAM3D_REQUIRE_EQUAL(triangles->weldVertices(0.0f, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(removedVertices.size()), numVerts - numWelded)
+    DREAM3D_REQUIRE_EQUAL(removedElements.size(), 0)
+    CheckWeldedGrid(triangles, 0.0f);
+
+    // Welding a welded mesh does not change it
+    DREAM3D_REQUIRE_EQUAL(triangles->weldVertices(0.0f, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(removedVertices.size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestToleranceWelding()
+  {
+    const float tolerance = 0.01f;
+
+    // Copies that are moved by less than half of the tolerance along each axis are within the tolerance
+    std::mt19937_64 generator(5678);
+    TriangleGeom::Pointer triangles = CreateTriangleSoup(0.25f * tolerance, generator);
+    DREAM3D_REQUIRE_EQUAL(triangles->setCompactConnectivity(true), 0)
+    QVector<size_t> removedVertices;
+    QVector<size_t> removedElements;
+    DREAM3D_REQUIRE_EQUAL(triangles->weldVertices(tolerance, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(triangles->getCompactConnectivity(), true)
+    DREAM3D_REQUIRE_EQUAL(removedElements.size(), 0)
+    CheckWeldedGrid(triangles, tolerance);
+
+    // Without a tolerance none of the moved copies are merged
+    TriangleGeom::Pointer soup = CreateTriangleSoup(0.25f * tolerance, generator);
+    size_t numWelded = 0;
+    MeshWelding::FindWeldedIds(soup->getVertexPointer(0), static_cast<size_t>(soup->getNumberOfVertices()), 0.0f, numWelded);
+    DREAM3D_REQUIRE_EQUAL(numWelded, static_cast<size_t>(soup->getNumberOfVertices()))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDegenerateElements()
+  {
+    // Triangle 1 has two vertices within the tolerance and collapses; triangle 2 is a copy of triangle 0
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(7);
+    const float coords[7][3] = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {5.0f, 5.0f, 5.0f}, {5.001f, 5.0f, 5.0f}, {6.0f, 5.0f, 5.0f}, {1.0f, 0.0f, 0.0f}};
+    for(size_t i = 0; i < 7; i++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        vertices->setComponent(i, d, coords[i][d]);
+      }
+    }
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(3, vertices, SIMPL::Geometry::TriangleGeometry);
+    const int64_t tris[3][3] = {{0, 1, 2}, {3, 4, 5}, {0, 6, 2}};
+    for(int64_t i = 0; i < 3; i++)
+    {
+      int64_t verts[3] = {tris[i][0], tris[i][1], tris[i][2]};
+      triangles->setVertsAtTri(i, verts);
+    }
+
+    QVector<size_t> removedVertices;
+    QVector<size_t> removedElements;
+    DREAM3D_REQUIRE_EQUAL(triangles->weldVertices(0.01f, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(removedVertices.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(removedVertices[0], 4)
+    DREAM3D_REQUIRE_EQUAL(removedVertices[1], 6)
+    DREAM3D_REQUIRE_EQUAL(removedElements.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(removedElements[0], 1)
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfVertices(), 5)
+    DREAM3D_REQUIRE_EQUAL(triangles->getNumberOfTris(), 2)
+
+    const int64_t expected[2][3] = {{0, 1, 2}, {0, 1, 2}};
+    for(int64_t i = 0; i < 2; i++)
+    {
+      int64_t verts[3] = {0, 0, 0};
+      triangles->getVertsAtTri(i, verts);
+      for(size_t k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(verts[k], expected[i][k])
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(triangles->getVertexPointer(4)[0], 6.0f)
+
+    UInt32ArrayType::Pointer compact = UInt32ArrayType::CreateArray(3, QVector<size_t>(1, 4), "Quads");
+    const uint32_t quads[12] = {0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 7};
+    for(size_t i = 0; i < 12; i++)
+    {
+      compact->setValue(i, quads[i]);
+    }
+    QVector<size_t> degenerate = MeshWelding::FindDegenerateElements(compact);
+    DREAM3D_REQUIRE_EQUAL(degenerate.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(degenerate[0], 1)
+    DREAM3D_REQUIRE_EQUAL(degenerate[1], 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  // Quadrilaterals and hexahedra are removed as soon as two of their vertices merge, even if the remaining
+  // vertices still span a positive area or volume, since they are no longer valid elements of their geometry
+  // -----------------------------------------------------------------------------
+  void TestDegenerateQuadsAndHexas()
+  {
+    const float corners[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+
+    // Quad 1 is a copy of quad 0 moved along X, whose last vertex lies within the tolerance of the previous one
+    SharedVertexList::Pointer quadVertices = QuadGeom::CreateSharedVertexList(8);
+    for(size_t i = 0; i < 8; i++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        quadVertices->setComponent(i, d, d == 2 ? 0.0f : corners[i % 4][d] + (d == 0 ? 2.0f * static_cast<float>(i / 4) : 0.0f));
+      }
+    }
+    quadVertices->setComponent(7, 0, 3.001f);
+    QuadGeom::Pointer quads = QuadGeom::CreateGeometry(2, quadVertices, SIMPL::Geometry::QuadGeometry);
+    for(int64_t i = 0; i < 2; i++)
+    {
+      int64_t verts[4] = {4 * i, 4 * i + 1, 4 * i + 2, 4 * i + 3};
+      quads->setVertsAtQuad(i, verts);
+    }
+    DREAM3D_REQUIRE_EQUAL(quads->findElementSizes(), 0)
+    DREAM3D_REQUIRE(quads->getElementSizes()->getValue(1) > 0.4f)
+
+    QVector<size_t> removedVertices;
+    QVector<size_t> removedElements;
+    DREAM3D_REQUIRE_EQUAL(quads->weldVertices(0.01f, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(removedVertices.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(removedVertices[0], 7)
+    DREAM3D_REQUIRE_EQUAL(removedElements.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(removedElements[0], 1)
+    DREAM3D_REQUIRE_EQUAL(quads->getNumberOfQuads(), 1)
+
+    // Hexahedron 1 is a copy of hexahedron 0 moved along X, whose top edge (6, 7) collapses
+    SharedVertexList::Pointer hexVertices = HexahedralGeom::CreateSharedVertexList(16);
+    for(size_t i = 0; i < 16; i++)
+    {
+      for(size_t d = 0; d < 3; d++)
+      {
+        hexVertices->setComponent(i, d, corners[i % 8][d] + (d == 0 ? 2.0f * static_cast<float>(i / 8) : 0.0f));
+      }
+    }
+    hexVertices->setComponent(15, 0, 3.001f);
+    HexahedralGeom::Pointer hexas = HexahedralGeom::CreateGeometry(2, hexVertices, SIMPL::Geometry::HexahedralGeometry);
+    for(int64_t i = 0; i < 2; i++)
+    {
+      int64_t verts[8] = {8 * i, 8 * i + 1, 8 * i + 2, 8 * i + 3, 8 * i + 4, 8 * i + 5, 8 * i + 6, 8 * i + 7};
+      hexas->setVertsAtHex(i, verts);
+    }
+    DREAM3D_REQUIRE_EQUAL(hexas->findElementSizes(), 0)
+    DREAM3D_REQUIRE(hexas->getElementSizes()->getValue(1) > 0.4f)
+
+    DREAM3D_REQUIRE_EQUAL(hexas->weldVertices(0.01f, removedVertices, removedElements), 0)
+    DREAM3D_REQUIRE_EQUAL(removedVertices.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(removedVertices[0], 15)
+    DREAM3D_REQUIRE_EQUAL(removedElements.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(removedElements[0], 1)
+    DREAM3D_REQUIRE_EQUAL(hexas->getNumberOfHexas(), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveTuples()
+  {
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(QVector<size_t>(1, 6), "VertexData", AttributeMatrix::Type::Vertex);
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(6, QVector<size_t>(1, 2), "Values");
+    for(size_t i = 0; i < 12; i++)
+    {
+      values->setValue(i, static_cast<int32_t>(i));
+    }
+    attrMat->addAttributeArray(values->getName(), values);
+
+    QVector<size_t> ids = {1, 4, 5};
+    DREAM3D_REQUIRE_EQUAL(MeshWelding::RemoveTuples(attrMat, ids), 0)
+    DREAM3D_REQUIRE_EQUAL(attrMat->getNumberOfTuples(), 3)
+    DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), 3)
+    const int32_t expected[6] = {0, 1, 4, 5, 6, 7};
+    for(size_t i = 0; i < 6; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values->getValue(i), expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### MeshWeldingTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestExactWelding())
+    DREAM3D_REGISTER_TEST(TestToleranceWelding())
+    DREAM3D_REGISTER_TEST(TestDegenerateElements())
+    DREAM3D_REGISTER_TEST(TestDegenerateQuadsAndHexas())
+    DREAM3D_REGISTER_TEST(TestRemoveTuples())
+  }
+
+private:
+  MeshWeldingTest(const MeshWeldingTest&); // Copy Constructor Not Implemented
+  void operator=(const MeshWeldingTest&);  // Move assignment Not Implemented
+};
@@ -0,0 +1,167 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RectGridGeomTest
+{
+public:
+  RectGridGeomTest() = default;
+  virtual ~RectGridGeomTest() = default;
+
+  const size_t k_NumPoints = 5000;
+
+  // -----------------------------------------------------------------------------
+  // Returns the cell that contains the value by testing every cell, or -1 if it is outside of the bounds
+  // -----------------------------------------------------------------------------
+  int64_t FindCell(const std::vector<float>& bounds, float value)
+  {
+    size_t numCells = bounds.size() - 1;
+    for(size_t c = 0; c < numCells; c++)
+    {
+      if(value >= bounds[c] && (value < bounds[c + 1] || (c == numCells - 1 && value <= bounds[c + 1])))
+      {
+        return static_cast<int64_t>(c);
+      }
+    }
+    return -1;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestComputeCellIndices()
+  {
+    // Quadratically, uniformly and geometrically spaced bounds
+    std::vector<float> bounds[3];
+    for(size_t i = 0; i <= 12; i++)
+    {
+      bounds[0].push_back(0.1f * static_cast<float>(i * i) - 2.0f);
+    }
+    for(size_t i = 0; i <= 7; i++)
+    {
+      bounds[1].push_back(0.5f * static_cast<float>(i));
+    }
+    float z = 1.0f;
+    for(size_t i = 0; i <= 9; i++)
+    {
+      bounds[2].push_back(z);
+      z += std::pow(1.6f, static_cast<float>(i));
+    }
+
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(bounds[0].size() - 1, bounds[1].size() - 1, bounds[2].size() - 1);
+    FloatArrayType::Pointer boundsArrays[3];
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      boundsArrays[axis] = FloatArrayType::CreateArray(bounds[axis].size(), "Bounds", true);
+      std::copy(bounds[axis].begin(), bounds[axis].end(), boundsArrays[axis]->getPointer(0));
+    }
+    geom->setXBounds(boundsArrays[0]);
+    geom->setYBounds(boundsArrays[1]);
+    geom->setZBounds(boundsArrays[2]);
+
+    // Random points in and around the grid, followed by points on every bound
+    std::mt19937 generator(5489u);
+    std::vector<float> coords;
+    for(size_t i = 0; i < k_NumPoints; i++)
+    {
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        float range = bounds[axis].back() - bounds[axis].front();
+        std::uniform_real_distribution<float> distribution(bounds[axis].front() - 0.1f * range, bounds[axis].back() + 0.1f * range);
+        coords.push_back(distribution(generator));
+      }
+    }
+    for(size_t i = 0; i < bounds[0].size(); i++)
+    {
+      coords.insert(coords.end(), {bounds[0][i], bounds[1][i % bounds[1].size()], bounds[2][i % bounds[2].size()]});
+    }
+    coords.insert(coords.end(), {NAN, bounds[1][0], bounds[2][0]});
+
+    size_t numPoints = coords.size() / 3;
+    std::vector<int64_t> indices(numPoints, 0);
+    std::vector<uint8_t> outOfBounds(numPoints, 0);
+    size_t numOutside = geom->computeCellIndices(coords.data(), numPoints, indices.data(), outOfBounds.data());
+
+    size_t expectedOutside = 0;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      int64_t cells[3] = {0, 0, 0};
+      bool inside = true;
+      for(size_t axis = 0; axis < 3; axis++)
+      {
+        cells[axis] = FindCell(bounds[axis], coords[3 * i + axis]);
+        inside = inside && cells[axis] >= 0;
+      }
+      int64_t expected = inside ? (cells[2] * static_cast<int64_t>(bounds[1].size() - 1) + cells[1]) * static_cast<int64_t>(bounds[0].size() - 1) + cells[0] : -1;
+      expectedOutside += inside ? 0 : 1;
+      DREAM3D_REQUIRE_EQUAL(indices[i], expected)
+      DREAM3D_REQUIRE_EQUAL(outOfBounds[i], (inside ? 0 : 1))
+    }
+    DREAM3D_REQUIRE_EQUAL(numOutside, expectedOutside)
+    DREAM3D_REQUIRE(numOutside > 0 && numOutside < numPoints)
+
+    // A grid without bounds contains no points
+    RectGridGeom::Pointer empty = RectGridGeom::CreateGeometry("Empty Geometry");
+    empty->setDimensions(2, 2, 2);
+    DREAM3D_REQUIRE_EQUAL(empty->computeCellIndices(coords.data(), numPoints, indices.data()), numPoints)
+    DREAM3D_REQUIRE_EQUAL(indices[0], -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### RectGridGeomTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestComputeCellIndices())
+  }
+
+private:
+  RectGridGeomTest(const RectGridGeomTest&); // Copy Constructor Not Implemented
+  void operator=(const RectGridGeomTest&);   // Move assignment Not Implemented
+};
@@ -0,0 +1,157 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QMap>
+
+#include "SIMPLib/Geometry/ShapeOps/ShapeOps.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ShapeOpsTest
+{
+public:
+  ShapeOpsTest() = default;
+  virtual ~ShapeOpsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRadcur1()
+  {
+    ShapeOps::ShapeParameters params;
+    params.omega3 = 0.85f;
+    params.bOverA = 0.7f;
+    params.cOverA = 0.5f;
+    params.volCur = 10.0f;
+
+    QMap<ShapeOps::ArgName, float> args;
+    args[ShapeOps::Omega3] = params.omega3;
+    args[ShapeOps::B_OverA] = params.bOverA;
+    args[ShapeOps::C_OverA] = params.cOverA;
+    args[ShapeOps::VolCur] = params.volCur;
+
+    std::vector<ShapeOps::Pointer> shapeOps = ShapeOps::getShapeOpsVector();
+    for(const ShapeOps::Pointer& shapeOp : shapeOps)
+    {
+      float radius = shapeOp->radcur1(params);
+      DREAM3D_REQUIRE(radius > 0.0f)
+      DREAM3D_REQUIRE_EQUAL(shapeOp->radcur1(args), radius)
+    }
+
+    // Volume of the ellipsoid with the semi axes a, b, c
+    float a = shapeOps[0]->radcur1(params);
+    float volume = 4.0f / 3.0f * static_cast<float>(M_PI) * a * (a * params.bOverA) * (a * params.cOverA);
+    DREAM3D_REQUIRE(std::abs(volume - params.volCur) < 1.0e-4f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchInside()
+  {
+    // Points on a regular grid that covers every shape and some space around it
+    const size_t n = 23;
+    std::vector<float> axis1;
+    std::vector<float> axis2;
+    std::vector<float> axis3;
+    for(size_t k = 0; k < n; k++)
+    {
+      for(size_t j = 0; j < n; j++)
+      {
+        for(size_t i = 0; i < n; i++)
+        {
+          axis1.push_back(-1.37f + 2.74f * i / (n - 1));
+          axis2.push_back(-1.29f + 2.58f * j / (n - 1));
+          axis3.push_back(-1.21f + 2.42f * k / (n - 1));
+        }
+      }
+    }
+    size_t count = axis1.size();
+
+    ShapeOps::ShapeParameters params;
+    params.bOverA = 0.8f;
+    params.cOverA = 0.6f;
+    params.volCur = 5.0f;
+    std::vector<float> omega3s = {0.5f, 0.85f, 0.95f};
+
+    std::vector<ShapeOps::Pointer> shapeOps = ShapeOps::getShapeOpsVector();
+    for(const ShapeOps::Pointer& shapeOp : shapeOps)
+    {
+      for(float omega3 : omega3s)
+      {
+        params.omega3 = omega3;
+        shapeOp->init();
+        shapeOp->radcur1(params);
+
+        std::vector<float> values(count);
+        shapeOp->inside(axis1.data(), axis2.data(), axis3.data(), count, values.data());
+        std::unique_ptr<bool[]> maskValues(new bool[count]);
+        shapeOp->insideMask(axis1.data(), axis2.data(), axis3.data(), count, maskValues.get());
+        size_t numInside = 0;
+        for(size_t i = 0; i < count; i++)
+        {
+          float expected = shapeOp->inside(axis1[i], axis2[i], axis3[i]);
+          DREAM3D_REQUIRE(std::abs(values[i] - expected) <= 1.0e-5f * std::max(1.0f, std::abs(expected)))
+          DREAM3D_REQUIRE_EQUAL(maskValues[i], values[i] >= 0.0f)
+          numInside += maskValues[i] ? 1 : 0;
+        }
+        DREAM3D_REQUIRE(numInside > 0 && numInside < count)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### ShapeOpsTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestRadcur1())
+    DREAM3D_REGISTER_TEST(TestBatchInside())
+  }
+
+private:
+  ShapeOpsTest(const ShapeOpsTest&);   // Copy Constructor Not Implemented
+  void operator=(const ShapeOpsTest&); // Move assignment Not Implemented
+};
@@ -1,6 +1,14 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  GeometryHelpersTest
   ImageGeomTest
+  ImageNeighborhoodTest
+  MeshReorderingTest
+  MeshWeldingTest
+  RectGridGeomTest
+  ShapeOpsTest
+  TriangleBVHTest
+  VertexSpatialIndexTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -0,0 +1,324 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+  virtual ~TriangleBVHTest() = default;
+
+  const float k_BoxSize = 2.0f;
+  const size_t k_Subdivisions = 8;
+
+  // -----------------------------------------------------------------------------
+  // Creates the closed surface of the box [0, k_BoxSize]^3 with every face split
+  // into k_Subdivisions x k_Subdivisions quads of two triangles each
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateBoxSurface()
+  {
+    size_t n = k_Subdivisions;
+    size_t vertsPerFace = (n + 1) * (n + 1);
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(6 * vertsPerFace));
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(static_cast<int64_t>(6 * n * n * 2), vertices, "Box");
+    float* verts = vertices->getPointer(0);
+    int64_t* tris = triangles->getTriPointer(0);
+    float step = k_BoxSize / static_cast<float>(n);
+
+    size_t vertIndex = 0;
+    size_t triIndex = 0;
+    for(int axis = 0; axis < 3; axis++)
+    {
+      int uAxis = (axis + 1) % 3;
+      int vAxis = (axis + 2) % 3;
+      for(int side = 0; side < 2; side++)
+      {
+        size_t firstVert = vertIndex;
+        for(size_t j = 0; j <= n; j++)
+        {
+          for(size_t i = 0; i <= n; i++)
+          {
+            float* coords = verts + 3 * vertIndex;
+            coords[axis] = side * k_BoxSize;
+            coords[uAxis] = i * step;
+            coords[vAxis] = j * step;
+            vertIndex++;
+          }
+        }
+        for(size_t j = 0; j < n; j++)
+        {
+          for(size_t i = 0; i < n; i++)
+          {
+            int64_t v0 = static_cast<int64_t>(firstVert + j * (n + 1) + i);
+            int64_t v1 = v0 + 1;
+            int64_t v2 = v0 + static_cast<int64_t>(n + 1);
+            int64_t v3 = v2 + 1;
+            int64_t* tri = tris + 3 * triIndex;
+            tri[0] = v0;
+            tri[1] = v1;
+            tri[2] = v3;
+            tri = tris + 3 * (triIndex + 1);
+            tri[0] = v0;
+            tri[1] = v3;
+            tri[2] = v2;
+            triIndex += 2;
+          }
+        }
+      }
+    }
+    return triangles;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Distance from the point to the surface of the box
+  // -----------------------------------------------------------------------------
+  float DistanceToBox(const float* p)
+  {
+    bool inside = true;
+    float outside = 0.0f;
+    float minInside = k_BoxSize;
+    for(int i = 0; i < 3; i++)
+    {
+      float d = 0.0f;
+      if(p[i] < 0.0f)
+      {
+        d = -p[i];
+      }
+      else if(p[i] > k_BoxSize)
+      {
+        d = p[i] - k_BoxSize;
+      }
+      if(d > 0.0f)
+      {
+        inside = false;
+      }
+      outside += d * d;
+      minInside = std::min(minInside, std::min(p[i], k_BoxSize - p[i]));
+    }
+    return inside ? minInside : std::sqrt(outside);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Query points on a lattice that is offset from the vertices of the surface
+  // -----------------------------------------------------------------------------
+  std::vector<float> CreateQueryPoints()
+  {
+    std::vector<float> points;
+    size_t numSteps = 15;
+    float step = (k_BoxSize + 1.0f) / static_cast<float>(numSteps);
+    for(size_t k = 0; k < numSteps; k++)
+    {
+      for(size_t j = 0; j < numSteps; j++)
+      {
+        for(size_t i = 0; i < numSteps; i++)
+        {
+          points.push_back(-0.5f + (i + 0.37f) * step);
+          points.push_back(-0.5f + (j + 0.51f) * step);
+          points.push_back(-0.5f + (k + 0.23f) * step);
+        }
+      }
+    }
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBuild()
+  {
+    TriangleBVH::Pointer empty = TriangleBVH::New(nullptr);
+    DREAM3D_REQUIRE(empty.get() == nullptr)
+
+    TriangleGeom::Pointer triangles = CreateBoxSurface();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(triangles.get(), 2);
+    DREAM3D_REQUIRE_VALID_POINTER(bvh.get())
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfTriangles(), static_cast<size_t>(triangles->getNumberOfTris()))
+
+    float lowerLeft[3] = {0.0f, 0.0f, 0.0f};
+    float upperRight[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(lowerLeft, upperRight);
+    for(int i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(lowerLeft[i], 0.0f)
+      DREAM3D_REQUIRE_EQUAL(upperRight[i], k_BoxSize)
+    }
+
+    // Every triangle must be referenced by exactly one leaf and every leaf must hold at most 2 triangles
+    const std::vector<TriangleBVH::Node>& nodes = bvh->getNodes();
+    size_t leafTriangles = 0;
+    for(const TriangleBVH::Node& node : nodes)
+    {
+      if(node.count == 0)
+      {
+        DREAM3D_REQUIRE(node.offset < nodes.size())
+      }
+      else
+      {
+        DREAM3D_REQUIRE(node.count <= 2)
+        leafTriangles += node.count;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(leafTriangles, bvh->getNumberOfTriangles())
+
+    // A compact geometry gives the same hierarchy and keeps its 32 bit connectivity
+    TriangleGeom::Pointer compact = CreateBoxSurface();
+    DREAM3D_REQUIRE_EQUAL(compact->setCompactConnectivity(true), 0)
+    TriangleBVH::Pointer compactBvh = TriangleBVH::New(compact.get(), 2);
+    DREAM3D_REQUIRE_VALID_POINTER(compactBvh.get())
+    DREAM3D_REQUIRE_EQUAL(compact->getCompactConnectivity(), true)
+    DREAM3D_REQUIRE_EQUAL(compactBvh->getNodes().size(), nodes.size())
+    for(size_t i = 0; i < nodes.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(compactBvh->getNodes()[i].offset, nodes[i].offset)
+      DREAM3D_REQUIRE_EQUAL(compactBvh->getNodes()[i].count, nodes[i].count)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInside()
+  {
+    TriangleGeom::Pointer triangles = CreateBoxSurface();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(triangles.get(), 2);
+    std::vector<float> points = CreateQueryPoints();
+    size_t numPoints = points.size() / 3;
+
+    std::unique_ptr<bool[]> inside(new bool[numPoints]);
+    bvh->findInside(points.data(), numPoints, inside.get());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* p = points.data() + 3 * i;
+      bool expected = (p[0] > 0.0f && p[0] < k_BoxSize && p[1] > 0.0f && p[1] < k_BoxSize && p[2] > 0.0f && p[2] < k_BoxSize);
+      DREAM3D_REQUIRE_EQUAL(inside[i], expected)
+      DREAM3D_REQUIRE_EQUAL(bvh->isInside(p), expected)
+    }
+
+    // The center lies on the lattice of the surface vertices
+    float center[3] = {0.5f * k_BoxSize, 0.5f * k_BoxSize, 0.5f * k_BoxSize};
+    DREAM3D_REQUIRE_EQUAL(bvh->isInside(center), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClosestPoint()
+  {
+    TriangleGeom::Pointer triangles = CreateBoxSurface();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(triangles.get(), 2);
+    std::vector<float> points = CreateQueryPoints();
+    size_t numPoints = points.size() / 3;
+
+    std::vector<float> closest(3 * numPoints, 0.0f);
+    std::vector<int64_t> triangleIds(numPoints, -1);
+    std::vector<float> distances(numPoints, 0.0f);
+    bvh->findClosestPoints(points.data(), numPoints, closest.data(), triangleIds.data(), distances.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* p = points.data() + 3 * i;
+      DREAM3D_REQUIRE(std::fabs(distances[i] - DistanceToBox(p)) < 1.0e-5f)
+      DREAM3D_REQUIRE(triangleIds[i] >= 0 && triangleIds[i] < triangles->getNumberOfTris())
+
+      // The closest point has to lie on the triangle that was reported
+      float a[3] = {0.0f, 0.0f, 0.0f};
+      float b[3] = {0.0f, 0.0f, 0.0f};
+      float c[3] = {0.0f, 0.0f, 0.0f};
+      triangles->getVertCoordsAtTri(triangleIds[i], a, b, c);
+      for(int j = 0; j < 3; j++)
+      {
+        float lower = std::min(a[j], std::min(b[j], c[j])) - 1.0e-5f;
+        float upper = std::max(a[j], std::max(b[j], c[j])) + 1.0e-5f;
+        DREAM3D_REQUIRE(closest[3 * i + j] >= lower && closest[3 * i + j] <= upper)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRays()
+  {
+    TriangleGeom::Pointer triangles = CreateBoxSurface();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(triangles.get(), 2);
+
+    float origins[9] = {-1.0f, 0.73f, 1.21f, 0.41f, 1.37f, 5.0f, 3.0f, 3.0f, 3.0f};
+    float directions[9] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, -2.0f, 1.0f, 1.0f, 0.0f};
+    int64_t triangleIds[3] = {-1, -1, -1};
+    float t[3] = {0.0f, 0.0f, 0.0f};
+    bvh->intersectRays(origins, directions, 3, 100.0f, triangleIds, t);
+
+    // Enters through the x = 0 face
+    DREAM3D_REQUIRE(triangleIds[0] >= 0)
+    DREAM3D_REQUIRE(std::fabs(t[0] - 1.0f) < 1.0e-5f)
+    // The direction is not normalized, so t is half of the distance to the z = k_BoxSize face
+    DREAM3D_REQUIRE(triangleIds[1] >= 0)
+    DREAM3D_REQUIRE(std::fabs(t[1] - 1.5f) < 1.0e-5f)
+    // Points away from the box
+    DREAM3D_REQUIRE_EQUAL(triangleIds[2], -1)
+
+    // The hit has to be closer than tMax
+    TriangleBVH::RayHit hit;
+    DREAM3D_REQUIRE_EQUAL(bvh->intersectRay(origins, directions, 0.5f, hit), false)
+    DREAM3D_REQUIRE_EQUAL(bvh->intersectRay(origins, directions, 2.0f, hit), true)
+    DREAM3D_REQUIRE_EQUAL(hit.triangleId, triangleIds[0])
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestBuild())
+    DREAM3D_REGISTER_TEST(TestInside())
+    DREAM3D_REGISTER_TEST(TestClosestPoint())
+    DREAM3D_REGISTER_TEST(TestRays())
+  }
+
+private:
+  TriangleBVHTest(const TriangleBVHTest&); // Copy Constructor Not Implemented
+  void operator=(const TriangleBVHTest&);  // Move assignment Not Implemented
+};
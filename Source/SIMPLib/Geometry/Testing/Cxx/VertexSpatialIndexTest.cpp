@@ -0,0 +1,278 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexSpatialIndexTest
+{
+public:
+  VertexSpatialIndexTest() = default;
+  virtual ~VertexSpatialIndexTest() = default;
+
+  const size_t k_NumPoints = 20000;
+  const size_t k_NumQueries = 200;
+
+  // -----------------------------------------------------------------------------
+  // Creates random points in [0, 10] x [0, 5] x [0, 1] with a few exact duplicates
+  // -----------------------------------------------------------------------------
+  SharedVertexList::Pointer CreatePoints()
+  {
+    SharedVertexList::Pointer vertices = VertexGeom::CreateSharedVertexList(static_cast<int64_t>(k_NumPoints));
+    float* coords = vertices->getPointer(0);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    for(size_t i = 0; i < k_NumPoints; i++)
+    {
+      coords[3 * i] = 10.0f * distribution(generator);
+      coords[3 * i + 1] = 5.0f * distribution(generator);
+      coords[3 * i + 2] = distribution(generator);
+    }
+    for(size_t i = 0; i < 10; i++)
+    {
+      std::copy(coords + 3 * i, coords + 3 * i + 3, coords + 3 * (k_NumPoints - 1 - i));
+    }
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Query points inside of and around the bounds of the points
+  // -----------------------------------------------------------------------------
+  std::vector<float> CreateQueries()
+  {
+    std::vector<float> queries(3 * k_NumQueries);
+    std::mt19937 generator(1234u);
+    std::uniform_real_distribution<float> distribution(-0.5f, 1.5f);
+    for(size_t i = 0; i < k_NumQueries; i++)
+    {
+      queries[3 * i] = 10.0f * distribution(generator);
+      queries[3 * i + 1] = 5.0f * distribution(generator);
+      queries[3 * i + 2] = distribution(generator);
+    }
+    return queries;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  float SquaredDistance(const float* a, const float* b)
+  {
+    float dx = a[0] - b[0];
+    float dy = a[1] - b[1];
+    float dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBuild()
+  {
+    VertexSpatialIndex::Pointer empty = VertexSpatialIndex::New(SharedVertexList::NullPointer());
+    DREAM3D_REQUIRE(empty.get() == nullptr)
+
+    SharedVertexList::Pointer vertices = CreatePoints();
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::New(vertices);
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfPoints(), k_NumPoints)
+
+    size_t dims[3] = {0, 0, 0};
+    index->getGridDimensions(dims);
+    DREAM3D_REQUIRE(dims[0] * dims[1] * dims[2] <= k_NumPoints)
+    DREAM3D_REQUIRE(dims[0] > dims[2])
+
+    // A cell size that would create more cells than points is enlarged
+    VertexSpatialIndex::Pointer fine = VertexSpatialIndex::New(vertices, 1.0e-6f);
+    fine->getGridDimensions(dims);
+    DREAM3D_REQUIRE(dims[0] * dims[1] * dims[2] <= k_NumPoints)
+
+    // Points in a plane and a single point
+    float plane[12] = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    VertexSpatialIndex::Pointer planeIndex = VertexSpatialIndex::New(plane, 4);
+    planeIndex->getGridDimensions(dims);
+    DREAM3D_REQUIRE_EQUAL(dims[2], 1)
+    std::vector<int64_t> ids;
+    planeIndex->findNearest(plane + 9, 2, ids);
+    DREAM3D_REQUIRE_EQUAL(ids.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(ids[0], 3)
+
+    VertexSpatialIndex::Pointer pointIndex = VertexSpatialIndex::New(plane, 1);
+    float lowerLeft[3] = {-1.0f, -1.0f, -1.0f};
+    float upperRight[3] = {1.0f, 1.0f, 1.0f};
+    pointIndex->findInBox(lowerLeft, upperRight, ids);
+    DREAM3D_REQUIRE_EQUAL(ids.size(), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoxAndRadius()
+  {
+    SharedVertexList::Pointer vertices = CreatePoints();
+    const float* coords = vertices->getPointer(0);
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::New(vertices);
+    std::vector<float> queries = CreateQueries();
+
+    std::vector<int64_t> ids;
+    std::vector<int64_t> expected;
+    for(size_t q = 0; q < k_NumQueries; q++)
+    {
+      const float* center = queries.data() + 3 * q;
+      float radius = 0.05f + 0.01f * static_cast<float>(q % 50);
+      float lowerLeft[3] = {center[0] - radius, center[1] - 2.0f * radius, center[2] - 0.5f * radius};
+      float upperRight[3] = {center[0] + radius, center[1] + 2.0f * radius, center[2] + 0.5f * radius};
+
+      expected.clear();
+      for(size_t i = 0; i < k_NumPoints; i++)
+      {
+        const float* p = coords + 3 * i;
+        if(p[0] >= lowerLeft[0] && p[0] <= upperRight[0] && p[1] >= lowerLeft[1] && p[1] <= upperRight[1] && p[2] >= lowerLeft[2] && p[2] <= upperRight[2])
+        {
+          expected.push_back(static_cast<int64_t>(i));
+        }
+      }
+      index->findInBox(lowerLeft, upperRight, ids);
+      DREAM3D_REQUIRE(ids == expected)
+
+      expected.clear();
+      for(size_t i = 0; i < k_NumPoints; i++)
+      {
+        if(SquaredDistance(center, coords + 3 * i) <= radius * radius)
+        {
+          expected.push_back(static_cast<int64_t>(i));
+        }
+      }
+      index->findInRadius(center, radius, ids);
+      DREAM3D_REQUIRE(ids == expected)
+    }
+
+    // The batched query must give the same lists
+    NeighborList<int64_t>::Pointer neighbors = NeighborList<int64_t>::CreateArray(0, "Neighbors");
+    index->findInRadius(queries.data(), k_NumQueries, 0.2f, neighbors.get());
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfTuples(), k_NumQueries)
+    for(size_t q = 0; q < k_NumQueries; q++)
+    {
+      index->findInRadius(queries.data() + 3 * q, 0.2f, ids);
+      DREAM3D_REQUIRE(*(neighbors->getList(static_cast<int>(q))) == ids)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNearest()
+  {
+    SharedVertexList::Pointer vertices = CreatePoints();
+    const float* coords = vertices->getPointer(0);
+    VertexSpatialIndex::Pointer index = VertexSpatialIndex::New(vertices);
+    std::vector<float> queries = CreateQueries();
+    const size_t k = 12;
+
+    std::vector<int64_t> batchIds(k_NumQueries * k);
+    std::vector<float> batchDistances(k_NumQueries * k);
+    index->findNearest(queries.data(), k_NumQueries, k, batchIds.data(), batchDistances.data());
+
+    std::vector<int64_t> ids;
+    std::vector<float> distances;
+    std::vector<std::pair<float, int64_t>> expected(k_NumPoints);
+    for(size_t q = 0; q < k_NumQueries; q++)
+    {
+      const float* center = queries.data() + 3 * q;
+      for(size_t i = 0; i < k_NumPoints; i++)
+      {
+        expected[i] = std::make_pair(SquaredDistance(center, coords + 3 * i), static_cast<int64_t>(i));
+      }
+      std::partial_sort(expected.begin(), expected.begin() + k, expected.end());
+
+      index->findNearest(center, k, ids, &distances);
+      DREAM3D_REQUIRE_EQUAL(ids.size(), k)
+      for(size_t j = 0; j < k; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ids[j], expected[j].second)
+        DREAM3D_REQUIRE(std::abs(distances[j] - std::sqrt(expected[j].first)) < 1.0e-6f)
+        DREAM3D_REQUIRE_EQUAL(batchIds[q * k + j], ids[j])
+        DREAM3D_REQUIRE_EQUAL(batchDistances[q * k + j], distances[j])
+      }
+    }
+
+    // Asking for more neighbors than points pads the batched output
+    float twoPoints[6] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+    VertexSpatialIndex::Pointer small = VertexSpatialIndex::New(twoPoints, 2);
+    int64_t padded[3] = {0, 0, 0};
+    small->findNearest(twoPoints + 3, 1, 3, padded, nullptr);
+    DREAM3D_REQUIRE_EQUAL(padded[0], 1)
+    DREAM3D_REQUIRE_EQUAL(padded[1], 0)
+    DREAM3D_REQUIRE_EQUAL(padded[2], -1)
+
+    // Neighbors of the indexed points never contain the point itself, even for duplicated points
+    NeighborList<int64_t>::Pointer neighbors = NeighborList<int64_t>::CreateArray(0, "Neighbors");
+    index->findNearestNeighbors(4, neighbors.get());
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfTuples(), k_NumPoints)
+    for(size_t i = 0; i < k_NumPoints; i++)
+    {
+      NeighborList<int64_t>::SharedVectorType list = neighbors->getList(static_cast<int>(i));
+      DREAM3D_REQUIRE_EQUAL(list->size(), 4)
+      DREAM3D_REQUIRE(std::find(list->begin(), list->end(), static_cast<int64_t>(i)) == list->end())
+    }
+    NeighborList<int64_t>::SharedVectorType duplicate = neighbors->getList(0);
+    DREAM3D_REQUIRE_EQUAL((*duplicate)[0], static_cast<int64_t>(k_NumPoints - 1))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### VertexSpatialIndexTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestBuild())
+    DREAM3D_REGISTER_TEST(TestBoxAndRadius())
+    DREAM3D_REGISTER_TEST(TestNearest())
+  }
+
+private:
+  VertexSpatialIndexTest(const VertexSpatialIndexTest&); // Copy Constructor Not Implemented
+  void operator=(const VertexSpatialIndexTest&);         // Move assignment Not Implemented
+};
@@ -46,15 +46,20 @@
 
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 
+#include <limits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 
 /**
  * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
@@ -135,15 +140,18 @@ TetrahedralGeom::TetrahedralGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = TetrahedralGeom::CreateSharedVertexList(0);
   m_TetList = TetrahedralGeom::CreateSharedTetList(0);
+  m_CompactTetList = CompactTetList::NullPointer();
   m_TriList = SharedTriList::NullPointer();
+  m_CompactTriList = CompactTriList::NullPointer();
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
   m_UnsharedTriList = SharedTriList::NullPointer();
   m_TetsContainingVert = ElementDynamicList::NullPointer();
   m_TetNeighbors = ElementDynamicList::NullPointer();
   m_TetCentroids = FloatArrayType::NullPointer();
   m_TetSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -194,13 +202,45 @@ TetrahedralGeom::Pointer TetrahedralGeom::CreateGeometry(SharedTetList::Pointer
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TetrahedralGeom::Pointer TetrahedralGeom::CreateGeometry(CompactTetList::Pointer tets, SharedVertexList::Pointer vertices, const QString& name)
+{
+  if(name.isEmpty() == true)
+  {
+    return NullPointer();
+  }
+  if(vertices.get() == nullptr)
+  {
+    return TetrahedralGeom::NullPointer();
+  }
+  if(tets.get() == nullptr)
+  {
+    return TetrahedralGeom::NullPointer();
+  }
+  TetrahedralGeom* d = new TetrahedralGeom();
+  d->setVertices(vertices);
+  d->setCompactTetrahedra(tets);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::initializeWithZeros()
 {
   m_VertexList->initializeWithZeros();
-  m_TetList->initializeWithZeros();
+  if(m_CompactTetList.get() != nullptr)
+  {
+    m_CompactTetList->initializeWithZeros();
+  }
+  else
+  {
+    m_TetList->initializeWithZeros();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -243,7 +283,7 @@ void TetrahedralGeom::addAttributeMatrix(const QString& name, AttributeMatrix::P
 // -----------------------------------------------------------------------------
 size_t TetrahedralGeom::getNumberOfElements()
 {
-  return m_TetList->getNumberOfTuples();
+  return static_cast<size_t>(getNumberOfTets());
 }
 
 // -----------------------------------------------------------------------------
@@ -251,7 +291,14 @@ size_t TetrahedralGeom::getNumberOfElements()
 // -----------------------------------------------------------------------------
 int TetrahedralGeom::findEdges()
 {
-  m_EdgeList = CreateSharedEdgeList(0);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    CompactEdgeList::Pointer edges = CompactEdgeList::CreateArray(0, QVector<size_t>(1, 2), SIMPL::Geometry::SharedEdgeList);
+    GeometryHelpers::Connectivity::FindTetEdges<uint32_t>(m_CompactTetList, edges);
+    setCompactEdges(edges);
+    return 1;
+  }
+  setEdges(CreateSharedEdgeList(0));
   GeometryHelpers::Connectivity::FindTetEdges<int64_t>(m_TetList, m_EdgeList);
   if(m_EdgeList.get() == nullptr)
   {
@@ -266,6 +313,7 @@ int TetrahedralGeom::findEdges()
 void TetrahedralGeom::deleteEdges()
 {
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -273,7 +321,14 @@ void TetrahedralGeom::deleteEdges()
 // -----------------------------------------------------------------------------
 int TetrahedralGeom::findFaces()
 {
-  m_TriList = CreateSharedTriList(0);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    CompactTriList::Pointer tris = CompactTriList::CreateArray(0, QVector<size_t>(1, 3), SIMPL::Geometry::SharedTriList);
+    GeometryHelpers::Connectivity::FindTetFaces<uint32_t>(m_CompactTetList, tris);
+    setCompactTriangles(tris);
+    return 1;
+  }
+  setTriangles(CreateSharedTriList(0));
   GeometryHelpers::Connectivity::FindTetFaces<int64_t>(m_TetList, m_TriList);
   if(m_TriList.get() == nullptr)
   {
@@ -288,6 +343,7 @@ int TetrahedralGeom::findFaces()
 void TetrahedralGeom::deleteFaces()
 {
   m_TriList = SharedTriList::NullPointer();
+  m_CompactTriList = CompactTriList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -296,7 +352,14 @@ void TetrahedralGeom::deleteFaces()
 int TetrahedralGeom::findElementsContainingVert()
 {
   m_TetsContainingVert = ElementDynamicList::New();
-  GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_TetList, m_TetsContainingVert, getNumberOfVertices());
+  if(m_CompactTetList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t, uint32_t>(m_CompactTetList, m_TetsContainingVert, getNumberOfVertices());
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_TetList, m_TetsContainingVert, getNumberOfVertices());
+  }
   if(m_TetsContainingVert.get() == nullptr)
   {
     return -1;
@@ -343,7 +406,14 @@ int TetrahedralGeom::findElementNeighbors()
     }
   }
   m_TetNeighbors = ElementDynamicList::New();
-  err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_TetList, m_TetsContainingVert, m_TetNeighbors, IGeometry::Type::Tetrahedral);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t, uint32_t>(m_CompactTetList, m_TetsContainingVert, m_TetNeighbors, IGeometry::Type::Tetrahedral);
+  }
+  else
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_TetList, m_TetsContainingVert, m_TetNeighbors, IGeometry::Type::Tetrahedral);
+  }
   if(m_TetNeighbors.get() == nullptr)
   {
     return -1;
@@ -382,7 +452,14 @@ int TetrahedralGeom::findElementCentroids()
 {
   QVector<size_t> cDims(1, 3);
   m_TetCentroids = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TetList, m_VertexList, m_TetCentroids);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindElementCentroids<uint32_t>(m_CompactTetList, m_VertexList, m_TetCentroids);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TetList, m_VertexList, m_TetCentroids);
+  }
   if(m_TetCentroids.get() == nullptr)
   {
     return -1;
@@ -422,7 +499,14 @@ int TetrahedralGeom::findElementSizes()
 {
   QVector<size_t> cDims(1, 1);
   m_TetSizes = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetVolumes);
-  GeometryHelpers::Topology::FindTetVolumes<int64_t>(m_TetList, m_VertexList, m_TetSizes);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindTetVolumes<uint32_t>(m_CompactTetList, m_VertexList, m_TetSizes);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindTetVolumes<int64_t>(m_TetList, m_VertexList, m_TetSizes);
+  }
   if(m_TetSizes.get() == nullptr)
   {
     return -1;
@@ -461,7 +545,14 @@ int TetrahedralGeom::findUnsharedEdges()
 {
   QVector<size_t> cDims(1, 2);
   m_UnsharedEdgeList = SharedEdgeList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedEdgeList);
-  GeometryHelpers::Connectivity::FindUnsharedTetEdges<int64_t>(m_TetList, m_UnsharedEdgeList);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<uint32_t, int64_t>(m_CompactTetList, m_UnsharedEdgeList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<int64_t>(m_TetList, m_UnsharedEdgeList);
+  }
   if(m_UnsharedEdgeList.get() == nullptr)
   {
     return -1;
@@ -500,7 +591,14 @@ int TetrahedralGeom::findUnsharedFaces()
 {
   QVector<size_t> cDims(1, 3);
   m_UnsharedTriList = SharedTriList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedFaceList);
-  GeometryHelpers::Connectivity::FindUnsharedTetFaces<int64_t>(m_TetList, m_UnsharedTriList);
+  if(m_CompactTetList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<uint32_t, int64_t>(m_CompactTetList, m_UnsharedTriList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<int64_t>(m_TetList, m_UnsharedTriList);
+  }
   if(m_UnsharedTriList.get() == nullptr)
   {
     return -1;
@@ -573,7 +671,7 @@ void TetrahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   int64_t numTets = getNumberOfTets();
 
   if(observable)
@@ -582,14 +680,13 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -599,6 +696,73 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  IDataArray::Pointer elements = (m_CompactTetList.get() != nullptr) ? IDataArray::Pointer(m_CompactTetList) : IDataArray::Pointer(m_TetList);
+  int err = MeshReordering::ReorderMesh(this, m_VertexList, elements, {m_EdgeList, m_CompactEdgeList, m_UnsharedEdgeList, m_TriList, m_CompactTriList, m_UnsharedTriList}, ordering, vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::setCompactConnectivity(bool compact)
+{
+  if(compact && getNumberOfVertices() > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    return -1;
+  }
+  if(!GeometryHelpers::Connectivity::SetCompactStorage(compact, m_TetList, m_CompactTetList))
+  {
+    return -1;
+  }
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_EdgeList, m_CompactEdgeList);
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_TriList, m_CompactTriList);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TetrahedralGeom::getCompactConnectivity()
+{
+  return (m_CompactTetList.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  IDataArray::Pointer elements = (m_CompactTetList.get() != nullptr) ? IDataArray::Pointer(m_CompactTetList) : IDataArray::Pointer(m_TetList);
+  int err = MeshWelding::WeldMesh(m_VertexList, elements, tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  // The derived lists refer to the old vertex ids and may contain collapsed entries
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteFaces();
+  deleteUnsharedFaces();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -624,6 +788,15 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
     }
   }
 
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactEdgeList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_TriList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList);
@@ -633,6 +806,15 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
     }
   }
 
+  if(m_CompactTriList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactTriList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_TetList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TetList);
@@ -642,6 +824,15 @@ int TetrahedralGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(wri
     }
   }
 
+  if(m_CompactTetList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactTetList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_UnsharedEdgeList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
@@ -719,7 +910,7 @@ int TetrahedralGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFile
   }
   out << "    <Topology TopologyType=\"Tetrahedron\" NumberOfElements=\"" << getNumberOfTets() << "\">"
       << "\n";
-  out << "      <DataItem Format=\"HDF\" NumberType=\"Int\" Dimensions=\"" << getNumberOfTets() << " 4\">"
+  out << "      <DataItem Format=\"HDF\" " << GeometryHelpers::GeomIO::XdmfConnectivityNumberType(getCompactConnectivity()) << " Dimensions=\"" << getNumberOfTets() << " 4\">"
       << "\n";
   out << "        " << hdfFileName << ":/DataContainers/" << dcName << "/" << SIMPL::Geometry::Geometry << "/" << SIMPL::Geometry::SharedTetList << "\n";
   out << "      </DataItem>"
@@ -782,14 +973,18 @@ int TetrahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
-  SharedTetList::Pointer tets = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedTetList>(SIMPL::Geometry::SharedTetList, parentId, preflight, err);
-  if(tets.get() == nullptr || vertices.get() == nullptr)
+  SharedTetList::Pointer tets = SharedTetList::NullPointer();
+  CompactTetList::Pointer compactTets = CompactTetList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedTetList, parentId, preflight, err, tets, compactTets);
+  if((tets.get() == nullptr && compactTets.get() == nullptr) || vertices.get() == nullptr)
   {
     return -1;
   }
-  size_t numTets = tets->getNumberOfTuples();
+  size_t numTets = (compactTets.get() != nullptr) ? compactTets->getNumberOfTuples() : tets->getNumberOfTuples();
   size_t numVerts = vertices->getNumberOfTuples();
-  SharedTriList::Pointer tris = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedTriList>(SIMPL::Geometry::SharedTriList, parentId, preflight, err);
+  SharedTriList::Pointer tris = SharedTriList::NullPointer();
+  CompactTriList::Pointer compactTris = CompactTriList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedTriList, parentId, preflight, err, tris, compactTris);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -799,7 +994,9 @@ int TetrahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
   {
     return -1;
   }
-  SharedEdgeList::Pointer edges = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedEdgeList>(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err);
+  SharedEdgeList::Pointer edges = SharedEdgeList::NullPointer();
+  CompactEdgeList::Pointer compactEdges = CompactEdgeList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err, edges, compactEdges);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -832,9 +1029,21 @@ int TetrahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 
   setVertices(vertices);
   setTetrahedra(tets);
+  if(compactTets.get() != nullptr)
+  {
+    setCompactTetrahedra(compactTets);
+  }
   setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    setCompactEdges(compactEdges);
+  }
   setUnsharedEdges(bEdges);
   setTriangles(tris);
+  if(compactTris.get() != nullptr)
+  {
+    setCompactTriangles(compactTris);
+  }
   setUnsharedFaces(bTris);
   setElementCentroids(tetCentroids);
   setElementSizes(tetSizes);
@@ -849,10 +1058,13 @@ int TetrahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer TetrahedralGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedTetList::Pointer tets = std::dynamic_pointer_cast<SharedTetList>((getTetrahedra().get() == nullptr) ? nullptr : getTetrahedra()->deepCopy(forceNoAllocate));
+  SharedTetList::Pointer tets = std::dynamic_pointer_cast<SharedTetList>((m_TetList.get() == nullptr) ? nullptr : m_TetList->deepCopy(forceNoAllocate));
+  CompactTetList::Pointer compactTets = std::dynamic_pointer_cast<CompactTetList>((m_CompactTetList.get() == nullptr) ? nullptr : m_CompactTetList->deepCopy(forceNoAllocate));
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((getTriangles().get() == nullptr) ? nullptr : getTriangles()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((m_TriList.get() == nullptr) ? nullptr : m_TriList->deepCopy(forceNoAllocate));
+  CompactTriList::Pointer compactTris = std::dynamic_pointer_cast<CompactTriList>((m_CompactTriList.get() == nullptr) ? nullptr : m_CompactTriList->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
+  CompactEdgeList::Pointer compactEdges = std::dynamic_pointer_cast<CompactEdgeList>((m_CompactEdgeList.get() == nullptr) ? nullptr : m_CompactEdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -860,11 +1072,19 @@ IGeometry::Pointer TetrahedralGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
-  TetrahedralGeom::Pointer copy = TetrahedralGeom::CreateGeometry(tets, verts, getName());
+  TetrahedralGeom::Pointer copy = (compactTets.get() != nullptr) ? TetrahedralGeom::CreateGeometry(compactTets, verts, getName()) : TetrahedralGeom::CreateGeometry(tets, verts, getName());
 
   copy->setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    copy->setCompactEdges(compactEdges);
+  }
   copy->setUnsharedEdges(unsharedEdges);
   copy->setTriangles(tris);
+  if(compactTris.get() != nullptr)
+  {
+    copy->setCompactTriangles(compactTris);
+  }
   copy->setUnsharedFaces(getUnsharedFaces());
   copy->setElementsContainingVert(elementsContainingVert);
   copy->setElementNeighbors(elementNeighbors);
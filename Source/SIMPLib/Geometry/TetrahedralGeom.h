@@ -69,6 +69,15 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     static Pointer CreateGeometry(SharedTetList::Pointer tets, SharedVertexList::Pointer vertices, const QString& name);
 
+    /**
+     * @brief CreateGeometry
+     * @param tets Tetrahedra with 32 bit vertex Ids
+     * @param vertices
+     * @param name
+     * @return
+     */
+    static Pointer CreateGeometry(CompactTetList::Pointer tets, SharedVertexList::Pointer vertices, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedVertexOps
 // -----------------------------------------------------------------------------
@@ -91,6 +100,19 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     static SharedEdgeList::Pointer CreateSharedEdgeList(int64_t numEdges, bool allocate = true);
 
+    /**
+     * @brief setCompactEdges Stores the edges with 32 bit vertex Ids and releases the 64 bit list.
+     * getEdges() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param edges
+     */
+    void setCompactEdges(CompactEdgeList::Pointer edges);
+
+    /**
+     * @brief getCompactEdges
+     * @return The edges if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactEdgeList::Pointer getCompactEdges();
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedTriOps
 // -----------------------------------------------------------------------------
@@ -116,12 +138,26 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
 
     /**
      * @brief getTriangles
-     * @return
+     * @return The triangles with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedTriList::Pointer getTriangles();
 
     /**
-     * @brief setVertsAtTri
+     * @brief setCompactTriangles Stores the triangles with 32 bit vertex Ids and releases the 64 bit list.
+     * getTriangles() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param triangles
+     */
+    void setCompactTriangles(CompactTriList::Pointer triangles);
+
+    /**
+     * @brief getCompactTriangles
+     * @return The triangles if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactTriList::Pointer getCompactTriangles();
+
+    /**
+     * @brief setVertsAtTri Stores the triangles with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param triId
      * @param verts
      */
@@ -146,7 +182,7 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
     /**
      * @brief getTriPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the triangles are stored with 32 bit vertex Ids
      */
     int64_t* getTriPointer(int64_t i);
 
@@ -181,12 +217,26 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
 
    /**
     * @brief getTetrahedra
-    * @return
+    * @return The tetrahedra with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+    * copy, and writing to it does not change the geometry
     */
     SharedTetList::Pointer getTetrahedra();
 
     /**
-     * @brief setVertsAtTet
+     * @brief setCompactTetrahedra Stores the tetrahedra with 32 bit vertex Ids and releases the 64 bit list.
+     * getTetrahedra() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param tets
+     */
+    void setCompactTetrahedra(CompactTetList::Pointer tets);
+
+    /**
+     * @brief getCompactTetrahedra
+     * @return The tetrahedra if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactTetList::Pointer getCompactTetrahedra();
+
+    /**
+     * @brief setVertsAtTet Stores the tetrahedra with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param tetId
      * @param verts
      */
@@ -211,7 +261,7 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
     /**
      * @brief getTetPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the tetrahedra are stored with 32 bit vertex Ids
      */
     int64_t* getTetPointer(int64_t i);
 
@@ -324,6 +374,37 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -424,12 +505,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
 
     /**
      * @brief getEdges
-     * @return
+     * @return The edges with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedEdgeList::Pointer getEdges() override;
 
     /**
-     * @brief setVerts
+     * @brief setVertsAtEdge Stores the edges with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param edgeId
      * @param verts
      */
@@ -453,7 +535,7 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
     /**
      * @brief getEdgePointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the edges are stored with 32 bit vertex Ids
      */
     int64_t* getEdgePointer(int64_t i) override;
 
@@ -566,10 +648,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
+    CompactEdgeList::Pointer m_CompactEdgeList;
     SharedEdgeList::Pointer m_UnsharedEdgeList;
     SharedTriList::Pointer m_TriList;
+    CompactTriList::Pointer m_CompactTriList;
     SharedTriList::Pointer m_UnsharedTriList;
     SharedTetList::Pointer m_TetList;
+    CompactTetList::Pointer m_CompactTetList;
     ElementDynamicList::Pointer m_TetsContainingVert;
     ElementDynamicList::Pointer m_TetNeighbors;
     FloatArrayType::Pointer m_TetCentroids;
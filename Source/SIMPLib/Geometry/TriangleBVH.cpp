@@ -0,0 +1,794 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+const int k_NumBins = 16;
+const int k_MaxDepth = 128;
+const int k_StackSize = 2 * k_MaxDepth;
+const size_t k_MinimumGrain = 64;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+const size_t k_ParallelBuildThreshold = 16384;
+#endif
+const double k_BarycentricEpsilon = 1.0e-7;
+const float k_SlabTolerance = 1.0f + 2.0f * 3.0f * std::numeric_limits<float>::epsilon();
+
+// Generic directions that are unlikely to be aligned with the edges of a mesh
+const float k_RayDirections[7][3] = {{0.539110f, 0.671845f, 0.508302f},  {-0.481234f, 0.330612f, 0.811637f}, {0.707325f, -0.577012f, 0.408452f},
+                                     {-0.267949f, -0.803848f, 0.531089f}, {0.912871f, 0.182574f, -0.365148f}, {-0.620174f, 0.496139f, -0.607595f},
+                                     {0.123091f, -0.492366f, -0.861640f}};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResetBox(float bbMin[3], float bbMax[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    bbMin[i] = std::numeric_limits<float>::max();
+    bbMax[i] = std::numeric_limits<float>::lowest();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GrowBox(float bbMin[3], float bbMax[3], const float otherMin[3], const float otherMax[3])
+{
+  for(int i = 0; i < 3; i++)
+  {
+    bbMin[i] = std::min(bbMin[i], otherMin[i]);
+    bbMax[i] = std::max(bbMax[i], otherMax[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float SurfaceArea(const float bbMin[3], const float bbMax[3])
+{
+  float dx = bbMax[0] - bbMin[0];
+  float dy = bbMax[1] - bbMin[1];
+  float dz = bbMax[2] - bbMin[2];
+  if(dx < 0.0f || dy < 0.0f || dz < 0.0f)
+  {
+    return 0.0f;
+  }
+  return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+// -----------------------------------------------------------------------------
+// Slab test of the ray against the box. Returns false if the box is missed or
+// lies entirely outside of [0, tMax].
+// -----------------------------------------------------------------------------
+bool RayHitsBox(const float origin[3], const float invDir[3], float tMax, const float bbMin[3], const float bbMax[3])
+{
+  float tNear = 0.0f;
+  float tFar = tMax;
+  for(int i = 0; i < 3; i++)
+  {
+    float t0 = (bbMin[i] - origin[i]) * invDir[i];
+    float t1 = (bbMax[i] - origin[i]) * invDir[i];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    // NaN (0 * inf) compares false and leaves the interval unchanged
+    // Widen the far distance to cover the rounding error of the slab test, otherwise rays that
+    // hit a triangle close to the boundary of its box can miss the box
+    t1 *= k_SlabTolerance;
+    tNear = t0 > tNear ? t0 : tNear;
+    tFar = t1 < tFar ? t1 : tFar;
+    if(tNear > tFar)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float PointBoxDistanceSquared(const float q[3], const float bbMin[3], const float bbMax[3])
+{
+  float distance = 0.0f;
+  for(int i = 0; i < 3; i++)
+  {
+    float d = 0.0f;
+    if(q[i] < bbMin[i])
+    {
+      d = bbMin[i] - q[i];
+    }
+    else if(q[i] > bbMax[i])
+    {
+      d = q[i] - bbMax[i];
+    }
+    distance += d * d;
+  }
+  return distance;
+}
+
+/**
+ * @brief Result of intersecting a ray with a single triangle
+ */
+enum class RayTriangleResult : int
+{
+  Miss = 0,
+  Hit = 1,
+  Degenerate = 2, //!< The ray grazes an edge or a vertex of the triangle
+  Coplanar = 3    //!< The ray lies in the plane of the triangle
+};
+
+// -----------------------------------------------------------------------------
+// Moeller-Trumbore ray/triangle intersection in double precision
+// -----------------------------------------------------------------------------
+RayTriangleResult IntersectTriangle(const float* tri, const float origin[3], const float dir[3], double& t, double& u, double& v)
+{
+  // The differences are taken in double precision as well, float differences lose the digits that
+  // decide on which side of a shared edge the ray passes
+  double v0[3] = {tri[0], tri[1], tri[2]};
+  double e1[3] = {tri[3] - v0[0], tri[4] - v0[1], tri[5] - v0[2]};
+  double e2[3] = {tri[6] - v0[0], tri[7] - v0[1], tri[8] - v0[2]};
+  double p[3] = {dir[1] * e2[2] - dir[2] * e2[1], dir[2] * e2[0] - dir[0] * e2[2], dir[0] * e2[1] - dir[1] * e2[0]};
+  double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+
+  double s[3] = {origin[0] - v0[0], origin[1] - v0[1], origin[2] - v0[2]};
+  double n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+  double nLength = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+  double dirLength = std::sqrt(double(dir[0]) * dir[0] + double(dir[1]) * dir[1] + double(dir[2]) * dir[2]);
+  if(nLength == 0.0)
+  {
+    // Zero area triangles can not be crossed
+    return RayTriangleResult::Miss;
+  }
+  if(std::fabs(det) <= k_BarycentricEpsilon * nLength * dirLength)
+  {
+    // The ray is parallel to the triangle. It only matters if it also lies in its plane.
+    double planeDistance = (s[0] * n[0] + s[1] * n[1] + s[2] * n[2]) / nLength;
+    return (std::fabs(planeDistance) <= k_BarycentricEpsilon * std::sqrt(nLength)) ? RayTriangleResult::Coplanar : RayTriangleResult::Miss;
+  }
+
+  double invDet = 1.0 / det;
+  u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+  if(u < -k_BarycentricEpsilon || u > 1.0 + k_BarycentricEpsilon)
+  {
+    return RayTriangleResult::Miss;
+  }
+  double qv[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+  v = (dir[0] * qv[0] + dir[1] * qv[1] + dir[2] * qv[2]) * invDet;
+  if(v < -k_BarycentricEpsilon || u + v > 1.0 + k_BarycentricEpsilon)
+  {
+    return RayTriangleResult::Miss;
+  }
+  t = (e2[0] * qv[0] + e2[1] * qv[1] + e2[2] * qv[2]) * invDet;
+  if(u <= k_BarycentricEpsilon || v <= k_BarycentricEpsilon || u + v >= 1.0 - k_BarycentricEpsilon)
+  {
+    return RayTriangleResult::Degenerate;
+  }
+  return RayTriangleResult::Hit;
+}
+
+// -----------------------------------------------------------------------------
+// Closest point on a triangle, see Ericson, "Real-Time Collision Detection", 5.1.5
+// -----------------------------------------------------------------------------
+void ClosestPointOnTriangle(const float* tri, const float q[3], float closest[3])
+{
+  const float* a = tri;
+  const float* b = tri + 3;
+  const float* c = tri + 6;
+  float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  float ap[3] = {q[0] - a[0], q[1] - a[1], q[2] - a[2]};
+
+  auto dot = [](const float* x, const float* y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+  auto set = [&closest](const float* origin, const float* dir1, float s, const float* dir2, float t) {
+    for(int i = 0; i < 3; i++)
+    {
+      closest[i] = origin[i] + s * dir1[i] + t * dir2[i];
+    }
+  };
+
+  float d1 = dot(ab, ap);
+  float d2 = dot(ac, ap);
+  if(d1 <= 0.0f && d2 <= 0.0f)
+  {
+    set(a, ab, 0.0f, ac, 0.0f);
+    return;
+  }
+
+  float bp[3] = {q[0] - b[0], q[1] - b[1], q[2] - b[2]};
+  float d3 = dot(ab, bp);
+  float d4 = dot(ac, bp);
+  if(d3 >= 0.0f && d4 <= d3)
+  {
+    set(b, ab, 0.0f, ac, 0.0f);
+    return;
+  }
+
+  float vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+  {
+    set(a, ab, d1 / (d1 - d3), ac, 0.0f);
+    return;
+  }
+
+  float cp[3] = {q[0] - c[0], q[1] - c[1], q[2] - c[2]};
+  float d5 = dot(ab, cp);
+  float d6 = dot(ac, cp);
+  if(d6 >= 0.0f && d5 <= d6)
+  {
+    set(c, ab, 0.0f, ac, 0.0f);
+    return;
+  }
+
+  float vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+  {
+    set(a, ab, 0.0f, ac, d2 / (d2 - d6));
+    return;
+  }
+
+  float va = d3 * d6 - d5 * d4;
+  if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+  {
+    float bc[3] = {c[0] - b[0], c[1] - b[1], c[2] - b[2]};
+    set(b, bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)), ac, 0.0f);
+    return;
+  }
+
+  float denom = 1.0f / (va + vb + vc);
+  set(a, ab, vb * denom, ac, vc * denom);
+}
+
+// -----------------------------------------------------------------------------
+// Appends a subtree that was built into its own node array, moving the child
+// indices of its internal nodes to their new position
+// -----------------------------------------------------------------------------
+void AppendSubtree(std::vector<TriangleBVH::Node>& nodes, const std::vector<TriangleBVH::Node>& subtree)
+{
+  uint32_t base = static_cast<uint32_t>(nodes.size());
+  for(TriangleBVH::Node node : subtree)
+  {
+    if(node.count == 0)
+    {
+      node.offset += base;
+    }
+    nodes.push_back(node);
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(TriangleGeom* triangles, size_t maxLeafSize)
+{
+  if(nullptr == triangles || triangles->getNumberOfTris() <= 0 || nullptr == triangles->getVertices().get())
+  {
+    return NullPointer();
+  }
+  Pointer sharedPtr(new TriangleBVH());
+  sharedPtr->build(triangles, maxLeafSize);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<TriangleBVH::Node>& TriangleBVH::getNodes() const
+{
+  return m_Nodes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfTriangles() const
+{
+  return m_TriangleIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  for(int i = 0; i < 3; i++)
+  {
+    lowerLeft[i] = m_Nodes[0].bbMin[i];
+    upperRight[i] = m_Nodes[0].bbMax[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::build(TriangleGeom* triangles, size_t maxLeafSize)
+{
+  m_MaxLeafSize = std::max(maxLeafSize, static_cast<size_t>(1));
+  size_t numTris = static_cast<size_t>(triangles->getNumberOfTris());
+  const float* verts = triangles->getVertexPointer(0);
+
+  // A compact 32 bit list is read in place; getTriPointer() is null while the list is compact
+  CompactTriList::Pointer compactTriList = triangles->getCompactTriangles();
+  const uint32_t* compactTris = (compactTriList.get() != nullptr) ? compactTriList->getPointer(0) : nullptr;
+  const int64_t* tris = (compactTris == nullptr) ? triangles->getTriPointer(0) : nullptr;
+  auto vertexCoords = [verts, compactTris, tris](size_t triId, size_t v) {
+    size_t vertId = (compactTris != nullptr) ? static_cast<size_t>(compactTris[3 * triId + v]) : static_cast<size_t>(tris[3 * triId + v]);
+    return verts + 3 * vertId;
+  };
+
+  m_TriangleIds.resize(numTris);
+  std::iota(m_TriangleIds.begin(), m_TriangleIds.end(), 0);
+
+  std::vector<BuildPrimitive> primitives(numTris);
+  GeometryHelpers::ForEachElement(numTris, k_MinimumGrain, [&primitives, &vertexCoords](size_t i) {
+    BuildPrimitive& primitive = primitives[i];
+    ResetBox(primitive.bbMin, primitive.bbMax);
+    for(size_t v = 0; v < 3; v++)
+    {
+      const float* coords = vertexCoords(i, v);
+      GrowBox(primitive.bbMin, primitive.bbMax, coords, coords);
+    }
+    for(int j = 0; j < 3; j++)
+    {
+      primitive.centroid[j] = 0.5f * (primitive.bbMin[j] + primitive.bbMax[j]);
+    }
+  });
+
+  m_Nodes.clear();
+  m_Nodes.reserve(2 * numTris / m_MaxLeafSize + 1);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel())
+  {
+    // The subtrees are spawned as tasks, so the whole build has to run inside the SIMPLib arena
+    context->execute([this, &primitives] { buildSubtree(primitives, m_Nodes, 0, m_TriangleIds.size(), 0); });
+  }
+  else
+#endif
+  {
+    buildSubtree(primitives, m_Nodes, 0, numTris, 0);
+  }
+
+  // Store the coordinates in hierarchy order so that the triangles of a leaf are next to each other in memory
+  m_Vertices.resize(9 * numTris);
+  GeometryHelpers::ForEachElement(numTris, k_MinimumGrain, [this, &vertexCoords](size_t i) {
+    size_t triId = static_cast<size_t>(m_TriangleIds[i]);
+    for(size_t v = 0; v < 3; v++)
+    {
+      const float* coords = vertexCoords(triId, v);
+      std::copy(coords, coords + 3, m_Vertices.begin() + 9 * i + 3 * v);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::buildSubtree(const std::vector<BuildPrimitive>& primitives, std::vector<Node>& nodes, size_t begin, size_t end, int depth)
+{
+  size_t nodeIndex = nodes.size();
+  nodes.push_back(Node());
+
+  float bbMin[3];
+  float bbMax[3];
+  ResetBox(bbMin, bbMax);
+  for(size_t i = begin; i < end; i++)
+  {
+    const BuildPrimitive& primitive = primitives[m_TriangleIds[i]];
+    GrowBox(bbMin, bbMax, primitive.bbMin, primitive.bbMax);
+  }
+  std::copy(bbMin, bbMin + 3, nodes[nodeIndex].bbMin);
+  std::copy(bbMax, bbMax + 3, nodes[nodeIndex].bbMax);
+
+  size_t count = end - begin;
+  if(count <= m_MaxLeafSize || depth >= k_MaxDepth)
+  {
+    nodes[nodeIndex].offset = static_cast<uint32_t>(begin);
+    nodes[nodeIndex].count = static_cast<uint32_t>(count);
+    return;
+  }
+
+  size_t mid = partition(primitives, begin, end);
+  nodes[nodeIndex].count = 0;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(count >= k_ParallelBuildThreshold && ParallelExecutionContext::Instance()->getUseParallel())
+  {
+    // The two halves touch disjoint parts of the triangle list, so they can be built concurrently
+    std::vector<Node> leftNodes;
+    std::vector<Node> rightNodes;
+    tbb::task_group group;
+    group.run([&] { buildSubtree(primitives, leftNodes, begin, mid, depth + 1); });
+    buildSubtree(primitives, rightNodes, mid, end, depth + 1);
+    group.wait();
+
+    AppendSubtree(nodes, leftNodes);
+    nodes[nodeIndex].offset = static_cast<uint32_t>(nodes.size());
+    AppendSubtree(nodes, rightNodes);
+    return;
+  }
+#endif
+
+  buildSubtree(primitives, nodes, begin, mid, depth + 1);
+  nodes[nodeIndex].offset = static_cast<uint32_t>(nodes.size());
+  buildSubtree(primitives, nodes, mid, end, depth + 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::partition(const std::vector<BuildPrimitive>& primitives, size_t begin, size_t end)
+{
+  float centroidMin[3];
+  float centroidMax[3];
+  ResetBox(centroidMin, centroidMax);
+  for(size_t i = begin; i < end; i++)
+  {
+    const float* centroid = primitives[m_TriangleIds[i]].centroid;
+    GrowBox(centroidMin, centroidMax, centroid, centroid);
+  }
+
+  int axis = 0;
+  for(int i = 1; i < 3; i++)
+  {
+    if(centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis])
+    {
+      axis = i;
+    }
+  }
+  float extent = centroidMax[axis] - centroidMin[axis];
+  size_t mid = begin + (end - begin) / 2;
+  if(extent <= 0.0f)
+  {
+    // All centroids coincide, any split is as good as another
+    return mid;
+  }
+
+  float scale = static_cast<float>(k_NumBins) / extent;
+  auto binOf = [&](int64_t triId) { return std::min(static_cast<int>((primitives[triId].centroid[axis] - centroidMin[axis]) * scale), k_NumBins - 1); };
+
+  size_t binCounts[k_NumBins] = {0};
+  float binMin[k_NumBins][3];
+  float binMax[k_NumBins][3];
+  for(int b = 0; b < k_NumBins; b++)
+  {
+    ResetBox(binMin[b], binMax[b]);
+  }
+  for(size_t i = begin; i < end; i++)
+  {
+    int64_t triId = m_TriangleIds[i];
+    int b = binOf(triId);
+    binCounts[b]++;
+    GrowBox(binMin[b], binMax[b], primitives[triId].bbMin, primitives[triId].bbMax);
+  }
+
+  // Sweep from the right to get the area and count of every right hand side
+  float rightArea[k_NumBins];
+  size_t rightCount[k_NumBins];
+  float boxMin[3];
+  float boxMax[3];
+  ResetBox(boxMin, boxMax);
+  size_t runningCount = 0;
+  for(int b = k_NumBins - 1; b > 0; b--)
+  {
+    GrowBox(boxMin, boxMax, binMin[b], binMax[b]);
+    runningCount += binCounts[b];
+    rightArea[b] = SurfaceArea(boxMin, boxMax);
+    rightCount[b] = runningCount;
+  }
+
+  // Sweep from the left and evaluate the cost of splitting after each bin
+  int bestSplit = -1;
+  float bestCost = std::numeric_limits<float>::max();
+  ResetBox(boxMin, boxMax);
+  runningCount = 0;
+  for(int b = 0; b < k_NumBins - 1; b++)
+  {
+    GrowBox(boxMin, boxMax, binMin[b], binMax[b]);
+    runningCount += binCounts[b];
+    if(runningCount == 0 || rightCount[b + 1] == 0)
+    {
+      continue;
+    }
+    float cost = SurfaceArea(boxMin, boxMax) * runningCount + rightArea[b + 1] * rightCount[b + 1];
+    if(cost < bestCost)
+    {
+      bestCost = cost;
+      bestSplit = b;
+    }
+  }
+
+  if(bestSplit >= 0)
+  {
+    auto iter = std::partition(m_TriangleIds.begin() + begin, m_TriangleIds.begin() + end, [&](int64_t triId) { return binOf(triId) <= bestSplit; });
+    size_t split = static_cast<size_t>(iter - m_TriangleIds.begin());
+    if(split > begin && split < end)
+    {
+      return split;
+    }
+  }
+
+  // Fall back to a median split along the axis
+  std::nth_element(m_TriangleIds.begin() + begin, m_TriangleIds.begin() + mid, m_TriangleIds.begin() + end,
+                   [&](int64_t a, int64_t b) { return primitives[a].centroid[axis] < primitives[b].centroid[axis]; });
+  return mid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::intersectRay(const float origin[3], const float direction[3], float tMax, RayHit& hit) const
+{
+  hit = RayHit();
+  float invDir[3] = {1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2]};
+  float closestT = tMax;
+
+  uint32_t stack[k_StackSize];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!RayHitsBox(origin, invDir, closestT, node.bbMin, node.bbMax))
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      uint32_t nodeIndex = static_cast<uint32_t>(&node - m_Nodes.data());
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = nodeIndex + 1;
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      double t = 0.0;
+      double u = 0.0;
+      double v = 0.0;
+      RayTriangleResult result = IntersectTriangle(m_Vertices.data() + 9 * i, origin, direction, t, u, v);
+      if(result == RayTriangleResult::Miss || result == RayTriangleResult::Coplanar)
+      {
+        continue;
+      }
+      // Grazing hits count for the closest hit query
+      if(t >= 0.0 && t <= closestT)
+      {
+        closestT = static_cast<float>(t);
+        hit.triangleId = m_TriangleIds[i];
+        hit.t = closestT;
+        hit.u = static_cast<float>(u);
+        hit.v = static_cast<float>(v);
+      }
+    }
+  }
+  return hit.triangleId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float TriangleBVH::findClosestPoint(const float q[3], float closest[3], int64_t& triangleId) const
+{
+  float bestDistance = std::numeric_limits<float>::max();
+  triangleId = -1;
+
+  uint32_t stack[k_StackSize];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(PointBoxDistanceSquared(q, node.bbMin, node.bbMax) > bestDistance)
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      // Visit the nearer child first so that the search radius shrinks quickly
+      uint32_t left = static_cast<uint32_t>(&node - m_Nodes.data()) + 1;
+      uint32_t right = node.offset;
+      float leftDistance = PointBoxDistanceSquared(q, m_Nodes[left].bbMin, m_Nodes[left].bbMax);
+      float rightDistance = PointBoxDistanceSquared(q, m_Nodes[right].bbMin, m_Nodes[right].bbMax);
+      if(leftDistance < rightDistance)
+      {
+        std::swap(left, right);
+      }
+      stack[stackSize++] = left;
+      stack[stackSize++] = right;
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      float point[3];
+      ClosestPointOnTriangle(m_Vertices.data() + 9 * i, q, point);
+      float distance = (point[0] - q[0]) * (point[0] - q[0]) + (point[1] - q[1]) * (point[1] - q[1]) + (point[2] - q[2]) * (point[2] - q[2]);
+      if(distance < bestDistance)
+      {
+        bestDistance = distance;
+        triangleId = m_TriangleIds[i];
+        std::copy(point, point + 3, closest);
+      }
+    }
+  }
+  return std::sqrt(bestDistance);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::countCrossings(const float q[3], const float direction[3], bool& degenerate) const
+{
+  degenerate = false;
+  size_t crossings = 0;
+  float invDir[3] = {1.0f / direction[0], 1.0f / direction[1], 1.0f / direction[2]};
+
+  uint32_t stack[k_StackSize];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize]];
+    if(!RayHitsBox(q, invDir, std::numeric_limits<float>::max(), node.bbMin, node.bbMax))
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = static_cast<uint32_t>(&node - m_Nodes.data()) + 1;
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      double t = 0.0;
+      double u = 0.0;
+      double v = 0.0;
+      RayTriangleResult result = IntersectTriangle(m_Vertices.data() + 9 * i, q, direction, t, u, v);
+      if(result == RayTriangleResult::Miss || (result != RayTriangleResult::Coplanar && t < 0.0))
+      {
+        continue;
+      }
+      if(result != RayTriangleResult::Hit)
+      {
+        degenerate = true;
+        return crossings;
+      }
+      crossings++;
+    }
+  }
+  return crossings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::isInside(const float q[3]) const
+{
+  const Node& root = m_Nodes[0];
+  if(PointBoxDistanceSquared(q, root.bbMin, root.bbMax) > 0.0f)
+  {
+    return false;
+  }
+
+  // Try the fixed directions in turn until one of them does not graze an edge or vertex. If
+  // all of them do, which only happens for points on the surface, the majority decides.
+  int insideVotes = 0;
+  int numDirections = sizeof(k_RayDirections) / sizeof(k_RayDirections[0]);
+  for(int i = 0; i < numDirections; i++)
+  {
+    bool degenerate = false;
+    size_t crossings = countCrossings(q, k_RayDirections[i], degenerate);
+    if(!degenerate)
+    {
+      return (crossings % 2) == 1;
+    }
+    insideVotes += (crossings % 2) == 1 ? 1 : 0;
+  }
+  return 2 * insideVotes > numDirections;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findInside(const float* points, size_t numPoints, bool* inside) const
+{
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, points, inside](size_t i) { inside[i] = isInside(points + 3 * i); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findClosestPoints(const float* points, size_t numPoints, float* closest, int64_t* triangleIds, float* distances) const
+{
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, points, closest, triangleIds, distances](size_t i) {
+    float point[3] = {0.0f, 0.0f, 0.0f};
+    int64_t triId = -1;
+    float distance = findClosestPoint(points + 3 * i, point, triId);
+    if(nullptr != closest)
+    {
+      std::copy(point, point + 3, closest + 3 * i);
+    }
+    if(nullptr != triangleIds)
+    {
+      triangleIds[i] = triId;
+    }
+    if(nullptr != distances)
+    {
+      distances[i] = distance;
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::intersectRays(const float* origins, const float* directions, size_t numRays, float tMax, int64_t* triangleIds, float* t) const
+{
+  GeometryHelpers::ForEachElement(numRays, k_MinimumGrain, [this, origins, directions, tMax, triangleIds, t](size_t i) {
+    RayHit hit;
+    intersectRay(origins + 3 * i, directions + 3 * i, tMax, hit);
+    triangleIds[i] = hit.triangleId;
+    if(nullptr != t)
+    {
+      t[i] = hit.t;
+    }
+  });
+}
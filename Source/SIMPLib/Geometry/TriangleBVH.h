@@ -0,0 +1,228 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+class TriangleGeom;
+
+/**
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the triangles of a TriangleGeom.
+ * The hierarchy is built once with a binned surface area heuristic (the upper levels of the tree are
+ * built in parallel) and stored as a flat, depth first array of nodes. Afterwards it answers ray,
+ * closest point and inside/outside queries in O(log(triangles)) instead of testing every triangle.
+ *
+ * The batched queries run multi-threaded over the query points through the ParallelExecutionContext.
+ * The hierarchy keeps its own copy of the triangle coordinates; it must be rebuilt if the geometry changes.
+ *
+ * The inside/outside queries assume that the triangles form one or more closed, non self intersecting surfaces.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+public:
+  SIMPL_SHARED_POINTERS(TriangleBVH)
+  SIMPL_TYPE_MACRO(TriangleBVH)
+
+  virtual ~TriangleBVH();
+
+  /**
+   * @brief A node of the hierarchy. Internal nodes have a count of 0; their left child directly follows
+   * them in the node array and 'offset' holds the index of the right child. Leaf nodes reference 'count'
+   * triangles starting at 'offset' in the reordered triangle list.
+   */
+  struct Node
+  {
+    float bbMin[3];
+    float bbMax[3];
+    uint32_t offset;
+    uint32_t count;
+  };
+
+  /**
+   * @brief The result of a ray query. triangleId is -1 if the ray did not hit any triangle.
+   */
+  struct RayHit
+  {
+    int64_t triangleId = -1;
+    float t = 0.0f; //!< Distance along the ray in units of the direction vector
+    float u = 0.0f; //!< Barycentric coordinate of the hit point with respect to the second vertex
+    float v = 0.0f; //!< Barycentric coordinate of the hit point with respect to the third vertex
+  };
+
+  /**
+   * @brief Builds the hierarchy over all triangles of the geometry
+   * @param triangles
+   * @param maxLeafSize Maximum number of triangles stored in a leaf
+   * @return A null pointer if the geometry is null or has no triangles
+   */
+  static Pointer New(TriangleGeom* triangles, size_t maxLeafSize = 4);
+
+  /**
+   * @brief Returns the flat node array. The root node is at index 0.
+   * @return
+   */
+  const std::vector<Node>& getNodes() const;
+
+  /**
+   * @brief Returns the number of triangles in the hierarchy
+   * @return
+   */
+  size_t getNumberOfTriangles() const;
+
+  /**
+   * @brief Returns the bounding box of all triangles
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief Finds the closest triangle that the ray origin + t * direction hits for 0 <= t <= tMax
+   * @param origin
+   * @param direction Does not need to be normalized
+   * @param tMax
+   * @param hit
+   * @return True if a triangle was hit
+   */
+  bool intersectRay(const float origin[3], const float direction[3], float tMax, RayHit& hit) const;
+
+  /**
+   * @brief Finds the point on the surface that is closest to the query point
+   * @param q
+   * @param closest Set to the closest point
+   * @param triangleId Set to the triangle that contains the closest point
+   * @return The distance between q and the closest point
+   */
+  float findClosestPoint(const float q[3], float closest[3], int64_t& triangleId) const;
+
+  /**
+   * @brief Determines if the point lies inside of the closed surface by counting the number of
+   * triangles that a ray from the point crosses. Rays that graze an edge or vertex are discarded and
+   * the test is repeated along a different direction.
+   * @param q
+   * @return
+   */
+  bool isInside(const float q[3]) const;
+
+  /**
+   * @brief Runs isInside() for each of the points
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param inside Receives one value per point
+   */
+  void findInside(const float* points, size_t numPoints, bool* inside) const;
+
+  /**
+   * @brief Runs findClosestPoint() for each of the points
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param closest numPoints x 3 closest points. May be nullptr.
+   * @param triangleIds One triangle id per point. May be nullptr.
+   * @param distances One distance per point. May be nullptr.
+   */
+  void findClosestPoints(const float* points, size_t numPoints, float* closest, int64_t* triangleIds, float* distances) const;
+
+  /**
+   * @brief Runs intersectRay() for each of the rays
+   * @param origins numRays x 3 ray origins
+   * @param directions numRays x 3 ray directions
+   * @param numRays
+   * @param tMax
+   * @param triangleIds Receives the triangle that was hit or -1 for each ray
+   * @param t Receives the distance along each ray. May be nullptr.
+   */
+  void intersectRays(const float* origins, const float* directions, size_t numRays, float tMax, int64_t* triangleIds, float* t) const;
+
+protected:
+  TriangleBVH();
+
+  /**
+   * @brief Bounding box and centroid of a single triangle that are used while the hierarchy is built
+   */
+  struct BuildPrimitive
+  {
+    float bbMin[3];
+    float bbMax[3];
+    float centroid[3];
+  };
+
+  /**
+   * @brief Builds the hierarchy from the triangles of the geometry
+   * @param triangles
+   * @param maxLeafSize
+   */
+  void build(TriangleGeom* triangles, size_t maxLeafSize);
+
+  /**
+   * @brief Appends the subtree over the triangles [begin, end) of the reordered triangle list to the
+   * node array in depth first order.
+   * @param primitives
+   * @param nodes
+   * @param begin
+   * @param end
+   * @param depth
+   */
+  void buildSubtree(const std::vector<BuildPrimitive>& primitives, std::vector<Node>& nodes, size_t begin, size_t end, int depth);
+
+  /**
+   * @brief Partitions the triangles [begin, end) along the best binned SAH split
+   * @param primitives
+   * @param begin
+   * @param end
+   * @return The first triangle of the right half
+   */
+  size_t partition(const std::vector<BuildPrimitive>& primitives, size_t begin, size_t end);
+
+  /**
+   * @brief Counts the triangles that the ray from q along the direction crosses
+   * @param q
+   * @param direction
+   * @param degenerate Set to true if the ray grazed an edge or vertex or lies in the plane of a triangle
+   * @return
+   */
+  size_t countCrossings(const float q[3], const float direction[3], bool& degenerate) const;
+
+private:
+  std::vector<Node> m_Nodes;
+  std::vector<int64_t> m_TriangleIds; // Original triangle id of each triangle in hierarchy order
+  std::vector<float> m_Vertices;      // 9 coordinates of each triangle in hierarchy order
+  size_t m_MaxLeafSize = 4;
+
+  TriangleBVH(const TriangleBVH&) = delete;   // Copy Constructor Not Implemented
+  void operator=(const TriangleBVH&) = delete; // Move assignment Not Implemented
+};
@@ -46,15 +46,20 @@
 
 #include "SIMPLib/Geometry/TriangleGeom.h"
 
+#include <limits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
 
 /**
  * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
@@ -135,13 +140,15 @@ TriangleGeom::TriangleGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = TriangleGeom::CreateSharedVertexList(0);
   m_TriList = TriangleGeom::CreateSharedTriList(0);
+  m_CompactTriList = CompactTriList::NullPointer();
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
   m_TrianglesContainingVert = ElementDynamicList::NullPointer();
   m_TriangleNeighbors = ElementDynamicList::NullPointer();
   m_TriangleCentroids = FloatArrayType::NullPointer();
   m_TriangleSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -192,13 +199,45 @@ TriangleGeom::Pointer TriangleGeom::CreateGeometry(SharedTriList::Pointer triang
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleGeom::Pointer TriangleGeom::CreateGeometry(CompactTriList::Pointer triangles, SharedVertexList::Pointer vertices, const QString& name)
+{
+  if(name.isEmpty() == true)
+  {
+    return NullPointer();
+  }
+  if(vertices.get() == nullptr)
+  {
+    return TriangleGeom::NullPointer();
+  }
+  if(triangles.get() == nullptr)
+  {
+    return TriangleGeom::NullPointer();
+  }
+  TriangleGeom* d = new TriangleGeom();
+  d->setVertices(vertices);
+  d->setCompactTriangles(triangles);
+  d->setName(name);
+  Pointer ptr(d);
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void TriangleGeom::initializeWithZeros()
 {
   m_VertexList->initializeWithZeros();
-  m_TriList->initializeWithZeros();
+  if(m_CompactTriList.get() != nullptr)
+  {
+    m_CompactTriList->initializeWithZeros();
+  }
+  else
+  {
+    m_TriList->initializeWithZeros();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -235,7 +274,7 @@ void TriangleGeom::addAttributeMatrix(const QString& name, AttributeMatrix::Poin
 // -----------------------------------------------------------------------------
 size_t TriangleGeom::getNumberOfElements()
 {
-  return m_TriList->getNumberOfTuples();
+  return static_cast<size_t>(getNumberOfTris());
 }
 
 // -----------------------------------------------------------------------------
@@ -243,7 +282,14 @@ size_t TriangleGeom::getNumberOfElements()
 // -----------------------------------------------------------------------------
 int TriangleGeom::findEdges()
 {
-  m_EdgeList = CreateSharedEdgeList(0);
+  if(m_CompactTriList.get() != nullptr)
+  {
+    CompactEdgeList::Pointer edges = CompactEdgeList::CreateArray(0, QVector<size_t>(1, 2), SIMPL::Geometry::SharedEdgeList);
+    GeometryHelpers::Connectivity::Find2DElementEdges<uint32_t>(m_CompactTriList, edges);
+    setCompactEdges(edges);
+    return 1;
+  }
+  setEdges(CreateSharedEdgeList(0));
   GeometryHelpers::Connectivity::Find2DElementEdges<int64_t>(m_TriList, m_EdgeList);
   if(m_EdgeList.get() == nullptr)
   {
@@ -258,6 +304,7 @@ int TriangleGeom::findEdges()
 void TriangleGeom::deleteEdges()
 {
   m_EdgeList = SharedEdgeList::NullPointer();
+  m_CompactEdgeList = CompactEdgeList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -266,7 +313,14 @@ void TriangleGeom::deleteEdges()
 int TriangleGeom::findElementsContainingVert()
 {
   m_TrianglesContainingVert = ElementDynamicList::New();
-  GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_TriList, m_TrianglesContainingVert, getNumberOfVertices());
+  if(m_CompactTriList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t, uint32_t>(m_CompactTriList, m_TrianglesContainingVert, getNumberOfVertices());
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(m_TriList, m_TrianglesContainingVert, getNumberOfVertices());
+  }
   if(m_TrianglesContainingVert.get() == nullptr)
   {
     return -1;
@@ -313,7 +367,14 @@ int TriangleGeom::findElementNeighbors()
     }
   }
   m_TriangleNeighbors = ElementDynamicList::New();
-  err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_TriList, m_TrianglesContainingVert, m_TriangleNeighbors, IGeometry::Type::Triangle);
+  if(m_CompactTriList.get() != nullptr)
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t, uint32_t>(m_CompactTriList, m_TrianglesContainingVert, m_TriangleNeighbors, IGeometry::Type::Triangle);
+  }
+  else
+  {
+    err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(m_TriList, m_TrianglesContainingVert, m_TriangleNeighbors, IGeometry::Type::Triangle);
+  }
   if(m_TriangleNeighbors.get() == nullptr)
   {
     return -1;
@@ -352,7 +413,14 @@ int TriangleGeom::findElementCentroids()
 {
   QVector<size_t> cDims(1, 3);
   m_TriangleCentroids = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TriList, m_VertexList, m_TriangleCentroids);
+  if(m_CompactTriList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::FindElementCentroids<uint32_t>(m_CompactTriList, m_VertexList, m_TriangleCentroids);
+  }
+  else
+  {
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TriList, m_VertexList, m_TriangleCentroids);
+  }
   if(m_TriangleCentroids.get() == nullptr)
   {
     return -1;
@@ -391,7 +459,14 @@ int TriangleGeom::findElementSizes()
 {
   QVector<size_t> cDims(1, 1);
   m_TriangleSizes = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleAreas);
-  GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_TriList, m_VertexList, m_TriangleSizes);
+  if(m_CompactTriList.get() != nullptr)
+  {
+    GeometryHelpers::Topology::Find2DElementAreas<uint32_t>(m_CompactTriList, m_VertexList, m_TriangleSizes);
+  }
+  else
+  {
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_TriList, m_VertexList, m_TriangleSizes);
+  }
   if(m_TriangleSizes.get() == nullptr)
   {
     return -1;
@@ -430,7 +505,14 @@ int TriangleGeom::findUnsharedEdges()
 {
   QVector<size_t> cDims(1, 2);
   m_UnsharedEdgeList = SharedEdgeList::CreateArray(0, cDims, SIMPL::Geometry::UnsharedEdgeList);
-  GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(m_TriList, m_UnsharedEdgeList);
+  if(m_CompactTriList.get() != nullptr)
+  {
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<uint32_t, int64_t>(m_CompactTriList, m_UnsharedEdgeList);
+  }
+  else
+  {
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(m_TriList, m_UnsharedEdgeList);
+  }
   if(m_UnsharedEdgeList.get() == nullptr)
   {
     return -1;
@@ -495,7 +577,7 @@ void TriangleGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
   int64_t numTris = getNumberOfTris();
 
   if(observable)
@@ -504,14 +586,13 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ParallelExecutionContext::Instance()->getUseParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTris), FindTriangleDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ParallelExecutionContext::Instance()->parallelFor(tbb::blocked_range<int64_t>(0, numTris), FindTriangleDerivativesImpl(this, field, derivatives));
   }
   else
 #endif
@@ -521,6 +602,70 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  IDataArray::Pointer elements = (m_CompactTriList.get() != nullptr) ? IDataArray::Pointer(m_CompactTriList) : IDataArray::Pointer(m_TriList);
+  int err = MeshReordering::ReorderMesh(this, m_VertexList, elements, {m_EdgeList, m_CompactEdgeList, m_UnsharedEdgeList}, ordering, vertexOrder, elementOrder);
+  if(err < 0)
+  {
+    return err;
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::setCompactConnectivity(bool compact)
+{
+  if(compact && getNumberOfVertices() > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    return -1;
+  }
+  if(!GeometryHelpers::Connectivity::SetCompactStorage(compact, m_TriList, m_CompactTriList))
+  {
+    return -1;
+  }
+  GeometryHelpers::Connectivity::SetCompactStorage(compact, m_EdgeList, m_CompactEdgeList);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleGeom::getCompactConnectivity()
+{
+  return (m_CompactTriList.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  IDataArray::Pointer elements = (m_CompactTriList.get() != nullptr) ? IDataArray::Pointer(m_CompactTriList) : IDataArray::Pointer(m_TriList);
+  int err = MeshWelding::WeldMesh(m_VertexList, elements, tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  // The derived lists refer to the old vertex ids and may contain collapsed entries
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  deleteElementCentroids();
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -546,6 +691,15 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
     }
   }
 
+  if(m_CompactEdgeList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactEdgeList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_TriList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_TriList);
@@ -555,6 +709,15 @@ int TriangleGeom::writeGeometryToHDF5(hid_t parentId, bool SIMPL_NOT_USED(writeX
     }
   }
 
+  if(m_CompactTriList.get() != nullptr)
+  {
+    err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_CompactTriList);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
   if(m_UnsharedEdgeList.get() != nullptr)
   {
     err = GeometryHelpers::GeomIO::WriteListToHDF5(parentId, m_UnsharedEdgeList);
@@ -624,7 +787,7 @@ int TriangleGeom::writeXdmf(QTextStream& out, QString dcName, QString hdfFileNam
   }
   out << "    <Topology TopologyType=\"Triangle\" NumberOfElements=\"" << getNumberOfTris() << "\">"
       << "\n";
-  out << "      <DataItem Format=\"HDF\" NumberType=\"Int\" Dimensions=\"" << getNumberOfTris() << " 3\">"
+  out << "      <DataItem Format=\"HDF\" " << GeometryHelpers::GeomIO::XdmfConnectivityNumberType(getCompactConnectivity()) << " Dimensions=\"" << getNumberOfTris() << " 3\">"
       << "\n";
   out << "        " << hdfFileName << ":/DataContainers/" << dcName << "/" << SIMPL::Geometry::Geometry << "/" << SIMPL::Geometry::SharedTriList << "\n";
   out << "      </DataItem>"
@@ -687,14 +850,18 @@ int TriangleGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 {
   herr_t err = 0;
   SharedVertexList::Pointer vertices = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedVertexList>(SIMPL::Geometry::SharedVertexList, parentId, preflight, err);
-  SharedTriList::Pointer tris = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedQuadList>(SIMPL::Geometry::SharedTriList, parentId, preflight, err);
-  if(tris.get() == nullptr || vertices.get() == nullptr)
+  SharedTriList::Pointer tris = SharedTriList::NullPointer();
+  CompactTriList::Pointer compactTris = CompactTriList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedTriList, parentId, preflight, err, tris, compactTris);
+  if((tris.get() == nullptr && compactTris.get() == nullptr) || vertices.get() == nullptr)
   {
     return -1;
   }
-  size_t numTris = tris->getNumberOfTuples();
+  size_t numTris = (compactTris.get() != nullptr) ? compactTris->getNumberOfTuples() : tris->getNumberOfTuples();
   size_t numVerts = vertices->getNumberOfTuples();
-  SharedEdgeList::Pointer edges = GeometryHelpers::GeomIO::ReadListFromHDF5<SharedEdgeList>(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err);
+  SharedEdgeList::Pointer edges = SharedEdgeList::NullPointer();
+  CompactEdgeList::Pointer compactEdges = CompactEdgeList::NullPointer();
+  GeometryHelpers::GeomIO::ReadConnectivityListFromHDF5(SIMPL::Geometry::SharedEdgeList, parentId, preflight, err, edges, compactEdges);
   if(err < 0 && err != -2)
   {
     return -1;
@@ -728,8 +895,16 @@ int TriangleGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 
   setVertices(vertices);
   setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    setCompactEdges(compactEdges);
+  }
   setUnsharedEdges(bEdges);
   setTriangles(tris);
+  if(compactTris.get() != nullptr)
+  {
+    setCompactTriangles(compactTris);
+  }
   setElementCentroids(triCentroids);
   setElementSizes(triSizes);
   setElementNeighbors(triNeighbors);
@@ -743,9 +918,11 @@ int TriangleGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer TriangleGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((getTriangles().get() == nullptr) ? nullptr : getTriangles()->deepCopy(forceNoAllocate));
+  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((m_TriList.get() == nullptr) ? nullptr : m_TriList->deepCopy(forceNoAllocate));
+  CompactTriList::Pointer compactTris = std::dynamic_pointer_cast<CompactTriList>((m_CompactTriList.get() == nullptr) ? nullptr : m_CompactTriList->deepCopy(forceNoAllocate));
   SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
+  CompactEdgeList::Pointer compactEdges = std::dynamic_pointer_cast<CompactEdgeList>((m_CompactEdgeList.get() == nullptr) ? nullptr : m_CompactEdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -753,9 +930,13 @@ IGeometry::Pointer TriangleGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
-  TriangleGeom::Pointer copy = TriangleGeom::CreateGeometry(tris, verts, getName());
+  TriangleGeom::Pointer copy = (compactTris.get() != nullptr) ? TriangleGeom::CreateGeometry(compactTris, verts, getName()) : TriangleGeom::CreateGeometry(tris, verts, getName());
 
   copy->setEdges(edges);
+  if(compactEdges.get() != nullptr)
+  {
+    copy->setCompactEdges(compactEdges);
+  }
   copy->setUnsharedEdges(unsharedEdges);
   copy->setElementsContainingVert(elementsContainingVert);
   copy->setElementNeighbors(elementNeighbors);
@@ -69,6 +69,15 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     static Pointer CreateGeometry(SharedTriList::Pointer triangles, SharedVertexList::Pointer vertices, const QString& name);
 
+    /**
+     * @brief CreateGeometry
+     * @param triangles Triangles with 32 bit vertex Ids
+     * @param vertices
+     * @param name
+     * @return
+     */
+    static Pointer CreateGeometry(CompactTriList::Pointer triangles, SharedVertexList::Pointer vertices, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedVertexOps
 // -----------------------------------------------------------------------------
@@ -91,6 +100,19 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     static SharedEdgeList::Pointer CreateSharedEdgeList(int64_t numEdges, bool allocate = true);
 
+    /**
+     * @brief setCompactEdges Stores the edges with 32 bit vertex Ids and releases the 64 bit list.
+     * getEdges() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param edges
+     */
+    void setCompactEdges(CompactEdgeList::Pointer edges);
+
+    /**
+     * @brief getCompactEdges
+     * @return The edges if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactEdgeList::Pointer getCompactEdges();
+
 // -----------------------------------------------------------------------------
 // Inherited from SharedTriOps
 // -----------------------------------------------------------------------------
@@ -116,12 +138,26 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
 
     /**
      * @brief getTriangles
-     * @return
+     * @return The triangles with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedTriList::Pointer getTriangles();
 
     /**
-     * @brief setVertsAtTri
+     * @brief setCompactTriangles Stores the triangles with 32 bit vertex Ids and releases the 64 bit list.
+     * getTriangles() returns a 64 bit copy of them and setCompactConnectivity(false) expands them in place.
+     * @param triangles
+     */
+    void setCompactTriangles(CompactTriList::Pointer triangles);
+
+    /**
+     * @brief getCompactTriangles
+     * @return The triangles if they are stored with 32 bit vertex Ids, otherwise a null pointer
+     */
+    CompactTriList::Pointer getCompactTriangles();
+
+    /**
+     * @brief setVertsAtTri Stores the triangles with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param triId
      * @param verts
      */
@@ -146,7 +182,7 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
     /**
      * @brief getPointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the triangles are stored with 32 bit vertex Ids
      */
     int64_t* getTriPointer(int64_t i);
 
@@ -259,6 +295,37 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief reorderElements
+     * @param ordering
+     * @param vertexOrder
+     * @param elementOrder
+     * @return
+     */
+    int reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder) override;
+
+    /**
+     * @brief setCompactConnectivity
+     * @param compact
+     * @return
+     */
+    int setCompactConnectivity(bool compact) override;
+
+    /**
+     * @brief getCompactConnectivity
+     * @return
+     */
+    bool getCompactConnectivity() override;
+
+    /**
+     * @brief weldVertices
+     * @param tolerance
+     * @param removedVertices
+     * @param removedElements
+     * @return
+     */
+    int weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements) override;
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -359,12 +426,13 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
 
     /**
      * @brief getEdges
-     * @return
+     * @return The edges with 64 bit vertex Ids. If they are stored with 32 bit vertex Ids this is a
+     * copy, and writing to it does not change the geometry
      */
     SharedEdgeList::Pointer getEdges() override;
 
     /**
-     * @brief setVerts
+     * @brief setVertsAtEdge Stores the edges with 64 bit vertex Ids again if a vertex Id does not fit in 32 bits
      * @param edgeId
      * @param verts
      */
@@ -388,7 +456,7 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
     /**
      * @brief getEdgePointer
      * @param i
-     * @return
+     * @return A pointer into the 64 bit list, or a null pointer if the edges are stored with 32 bit vertex Ids
      */
     int64_t* getEdgePointer(int64_t i) override;
 
@@ -468,8 +536,10 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
+    CompactEdgeList::Pointer m_CompactEdgeList;
     SharedEdgeList::Pointer m_UnsharedEdgeList;
     SharedTriList::Pointer m_TriList;
+    CompactTriList::Pointer m_CompactTriList;
     ElementDynamicList::Pointer m_TrianglesContainingVert;
     ElementDynamicList::Pointer m_TriangleNeighbors;
     FloatArrayType::Pointer m_TriangleCentroids;
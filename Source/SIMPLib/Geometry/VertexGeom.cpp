@@ -44,6 +44,9 @@
 
 #include "SIMPLib/Geometry/VertexGeom.h"
 
+#include "SIMPLib/Geometry/MeshReordering.h"
+#include "SIMPLib/Geometry/MeshWelding.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -59,7 +62,7 @@ VertexGeom::VertexGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = VertexGeom::CreateSharedVertexList(0);
   m_VertexSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_ProgressCounter.reset(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -305,6 +308,58 @@ void VertexGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType
   derivatives->initializeWithZeros();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::reorderElements(ElementOrdering ordering, std::vector<int64_t>& vertexOrder, std::vector<int64_t>& elementOrder)
+{
+  // The vertices are the elements of a vertex geometry. They have no neighbors, so both orderings sort
+  // them along the space filling curve.
+  (void)ordering;
+  if(m_VertexList.get() == nullptr)
+  {
+    return -1;
+  }
+  vertexOrder = MeshReordering::FindHilbertOrder(m_VertexList->getPointer(0), m_VertexList->getNumberOfTuples());
+  MeshReordering::PermuteTuples(m_VertexList, vertexOrder);
+  elementOrder = vertexOrder;
+  deleteElementSizes();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::setCompactConnectivity(bool compact)
+{
+  // The vertices are the elements of a vertex geometry, so there is no connectivity to compact
+  return compact ? -1 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VertexGeom::getCompactConnectivity()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::weldVertices(float tolerance, QVector<size_t>& removedVertices, QVector<size_t>& removedElements)
+{
+  // The vertices are the elements of a vertex geometry
+  int err = MeshWelding::WeldMesh(m_VertexList, IDataArray::NullPointer(), tolerance, removedVertices, removedElements);
+  if(err < 0)
+  {
+    return err;
+  }
+  removedElements = removedVertices;
+  deleteElementSizes();
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
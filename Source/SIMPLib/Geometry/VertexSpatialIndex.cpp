@@ -0,0 +1,594 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+
+namespace
+{
+const float k_PointsPerCell = 4.0f;
+const size_t k_BoundsChunkSize = 65536;
+const size_t k_MinimumGrain = 64;
+const float k_FaceTolerance = 1.0e-4f;
+
+using Candidate = std::pair<float, int64_t>; // Squared distance and point id
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float SquaredDistance(const float a[3], const float b[3])
+{
+  float dx = a[0] - b[0];
+  float dy = a[1] - b[1];
+  float dz = a[2] - b[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::~VertexSpatialIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::New(SharedVertexList::Pointer vertices, float cellSize)
+{
+  if(nullptr == vertices.get() || vertices->getNumberOfComponents() != 3)
+  {
+    return NullPointer();
+  }
+  return New(vertices->getPointer(0), vertices->getNumberOfTuples(), cellSize);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexSpatialIndex::Pointer VertexSpatialIndex::New(const float* coords, size_t numPoints, float cellSize)
+{
+  if(nullptr == coords || numPoints == 0)
+  {
+    return NullPointer();
+  }
+  Pointer sharedPtr(new VertexSpatialIndex());
+  sharedPtr->build(coords, numPoints, cellSize);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::getNumberOfPoints() const
+{
+  return m_PointIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float VertexSpatialIndex::getCellSize() const
+{
+  return m_CellSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::getGridDimensions(size_t dims[3]) const
+{
+  for(int i = 0; i < 3; i++)
+  {
+    dims[i] = static_cast<size_t>(m_Dims[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& VertexSpatialIndex::getPointOrder() const
+{
+  return m_PointIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  for(int i = 0; i < 3; i++)
+  {
+    lowerLeft[i] = m_Origin[i];
+    upperRight[i] = m_Max[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::build(const float* coords, size_t numPoints, float cellSize)
+{
+  // Bounds of the points, reduced over fixed size chunks so the result does not depend on the scheduling
+  size_t numChunks = (numPoints + k_BoundsChunkSize - 1) / k_BoundsChunkSize;
+  std::vector<float> chunkBounds(6 * numChunks);
+  GeometryHelpers::ForEachElement(numChunks, 1, [coords, numPoints, &chunkBounds](size_t chunk) {
+    float* bounds = chunkBounds.data() + 6 * chunk;
+    for(int j = 0; j < 3; j++)
+    {
+      bounds[j] = std::numeric_limits<float>::max();
+      bounds[j + 3] = std::numeric_limits<float>::lowest();
+    }
+    size_t end = std::min(numPoints, (chunk + 1) * k_BoundsChunkSize);
+    for(size_t i = chunk * k_BoundsChunkSize; i < end; i++)
+    {
+      for(int j = 0; j < 3; j++)
+      {
+        bounds[j] = std::min(bounds[j], coords[3 * i + j]);
+        bounds[j + 3] = std::max(bounds[j + 3], coords[3 * i + j]);
+      }
+    }
+  });
+  for(int j = 0; j < 3; j++)
+  {
+    m_Origin[j] = std::numeric_limits<float>::max();
+    m_Max[j] = std::numeric_limits<float>::lowest();
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      m_Origin[j] = std::min(m_Origin[j], chunkBounds[6 * chunk + j]);
+      m_Max[j] = std::max(m_Max[j], chunkBounds[6 * chunk + j + 3]);
+    }
+  }
+
+  computeGrid(numPoints, cellSize);
+  size_t numCells = static_cast<size_t>(m_Dims[0] * m_Dims[1] * m_Dims[2]);
+
+  // Counting sort of the points by cell. The slots inside of a cell are handed out with atomic counters
+  // and each cell is sorted afterwards so the order does not depend on the scheduling.
+  std::vector<size_t> pointCells(numPoints);
+  std::vector<std::atomic<int64_t>> counters(numCells);
+  GeometryHelpers::ForEachElement(numCells, k_MinimumGrain, [&counters](size_t c) { counters[c].store(0, std::memory_order_relaxed); });
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, coords, &pointCells, &counters](size_t i) {
+    const float* p = coords + 3 * i;
+    size_t cell = cellIndex(cellCoordinate(p[0], 0), cellCoordinate(p[1], 1), cellCoordinate(p[2], 2));
+    pointCells[i] = cell;
+    counters[cell].fetch_add(1, std::memory_order_relaxed);
+  });
+
+  m_CellStarts.resize(numCells + 1);
+  m_CellStarts[0] = 0;
+  for(size_t c = 0; c < numCells; c++)
+  {
+    int64_t count = counters[c].load(std::memory_order_relaxed);
+    counters[c].store(m_CellStarts[c], std::memory_order_relaxed);
+    m_CellStarts[c + 1] = m_CellStarts[c] + count;
+  }
+
+  m_PointIds.resize(numPoints);
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, &pointCells, &counters](size_t i) {
+    int64_t slot = counters[pointCells[i]].fetch_add(1, std::memory_order_relaxed);
+    m_PointIds[slot] = static_cast<int64_t>(i);
+  });
+  GeometryHelpers::ForEachElement(numCells, k_MinimumGrain, [this](size_t c) {
+    if(m_CellStarts[c + 1] - m_CellStarts[c] > 1)
+    {
+      std::sort(m_PointIds.begin() + m_CellStarts[c], m_PointIds.begin() + m_CellStarts[c + 1]);
+    }
+  });
+
+  m_Coords.resize(3 * numPoints);
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, coords](size_t i) {
+    const float* p = coords + 3 * m_PointIds[i];
+    m_Coords[3 * i] = p[0];
+    m_Coords[3 * i + 1] = p[1];
+    m_Coords[3 * i + 2] = p[2];
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::computeGrid(size_t numPoints, float cellSize)
+{
+  double extent[3] = {0.0, 0.0, 0.0};
+  double volume = 1.0;
+  int numAxes = 0;
+  for(int i = 0; i < 3; i++)
+  {
+    extent[i] = static_cast<double>(m_Max[i]) - static_cast<double>(m_Origin[i]);
+    if(extent[i] > 0.0)
+    {
+      volume *= extent[i];
+      numAxes++;
+    }
+  }
+
+  double size = static_cast<double>(cellSize);
+  if(!(size > 0.0) || !std::isfinite(size))
+  {
+    size = numAxes == 0 ? 1.0 : std::pow(volume * k_PointsPerCell / static_cast<double>(numPoints), 1.0 / numAxes);
+  }
+
+  // Never use more cells than points; very small cell sizes are enlarged until the grid fits
+  double maxCells = static_cast<double>(std::max<size_t>(numPoints, 1));
+  double numCells = 1.0;
+  do
+  {
+    numCells = 1.0;
+    for(int i = 0; i < 3; i++)
+    {
+      double dim = std::ceil(extent[i] / size);
+      m_Dims[i] = dim < 1.0 ? 1 : static_cast<int64_t>(dim);
+      numCells *= static_cast<double>(m_Dims[i]);
+    }
+    if(numCells > maxCells)
+    {
+      size *= 1.01 * std::pow(numCells / maxCells, 1.0 / std::max(numAxes, 1));
+    }
+  } while(numCells > maxCells);
+
+  m_CellSize = static_cast<float>(size);
+  m_InvCellSize = 1.0f / m_CellSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t VertexSpatialIndex::cellCoordinate(float value, int axis) const
+{
+  float c = std::floor((value - m_Origin[axis]) * m_InvCellSize);
+  if(!(c > 0.0f))
+  {
+    return 0;
+  }
+  if(c >= static_cast<float>(m_Dims[axis] - 1))
+  {
+    return m_Dims[axis] - 1;
+  }
+  return static_cast<int64_t>(c);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexSpatialIndex::cellIndex(int64_t x, int64_t y, int64_t z) const
+{
+  return static_cast<size_t>((z * m_Dims[1] + y) * m_Dims[0] + x);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VertexSpatialIndex::overlappingCells(const float lowerLeft[3], const float upperRight[3], int64_t cellMin[3], int64_t cellMax[3]) const
+{
+  for(int i = 0; i < 3; i++)
+  {
+    if(upperRight[i] < m_Origin[i] || lowerLeft[i] > m_Max[i] || lowerLeft[i] > upperRight[i])
+    {
+      return false;
+    }
+    cellMin[i] = cellCoordinate(lowerLeft[i], i);
+    cellMax[i] = cellCoordinate(upperRight[i], i);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findInBox(const float lowerLeft[3], const float upperRight[3], std::vector<int64_t>& ids) const
+{
+  ids.clear();
+  int64_t cellMin[3] = {0, 0, 0};
+  int64_t cellMax[3] = {0, 0, 0};
+  if(!overlappingCells(lowerLeft, upperRight, cellMin, cellMax))
+  {
+    return;
+  }
+  for(int64_t z = cellMin[2]; z <= cellMax[2]; z++)
+  {
+    for(int64_t y = cellMin[1]; y <= cellMax[1]; y++)
+    {
+      // The cells of a row are contiguous, so the whole row is one range of points
+      int64_t begin = m_CellStarts[cellIndex(cellMin[0], y, z)];
+      int64_t end = m_CellStarts[cellIndex(cellMax[0], y, z) + 1];
+      for(int64_t i = begin; i < end; i++)
+      {
+        const float* p = m_Coords.data() + 3 * i;
+        if(p[0] >= lowerLeft[0] && p[0] <= upperRight[0] && p[1] >= lowerLeft[1] && p[1] <= upperRight[1] && p[2] >= lowerLeft[2] && p[2] <= upperRight[2])
+        {
+          ids.push_back(m_PointIds[i]);
+        }
+      }
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findInRadius(const float q[3], float radius, std::vector<int64_t>& ids) const
+{
+  ids.clear();
+  if(radius < 0.0f)
+  {
+    return;
+  }
+  float lowerLeft[3] = {q[0] - radius, q[1] - radius, q[2] - radius};
+  float upperRight[3] = {q[0] + radius, q[1] + radius, q[2] + radius};
+  int64_t cellMin[3] = {0, 0, 0};
+  int64_t cellMax[3] = {0, 0, 0};
+  if(!overlappingCells(lowerLeft, upperRight, cellMin, cellMax))
+  {
+    return;
+  }
+  float radiusSquared = radius * radius;
+  for(int64_t z = cellMin[2]; z <= cellMax[2]; z++)
+  {
+    for(int64_t y = cellMin[1]; y <= cellMax[1]; y++)
+    {
+      int64_t begin = m_CellStarts[cellIndex(cellMin[0], y, z)];
+      int64_t end = m_CellStarts[cellIndex(cellMax[0], y, z) + 1];
+      for(int64_t i = begin; i < end; i++)
+      {
+        if(SquaredDistance(q, m_Coords.data() + 3 * i) <= radiusSquared)
+        {
+          ids.push_back(m_PointIds[i]);
+        }
+      }
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findNearest(const float q[3], size_t k, std::vector<int64_t>& ids, std::vector<float>* distances) const
+{
+  ids.clear();
+  if(nullptr != distances)
+  {
+    distances->clear();
+  }
+  k = std::min(k, m_PointIds.size());
+  if(k == 0)
+  {
+    return;
+  }
+
+  // Search shells of cells with increasing distance around the cell of the query point until no
+  // unsearched cell can hold a point that is closer than the current k-th neighbor
+  std::priority_queue<Candidate> best;
+  auto visitCell = [this, q, k, &best](int64_t x, int64_t y, int64_t z) {
+    size_t cell = cellIndex(x, y, z);
+    if(m_CellStarts[cell] == m_CellStarts[cell + 1])
+    {
+      return;
+    }
+    if(best.size() == k)
+    {
+      // Skip cells that are farther away than the current k-th neighbor
+      int64_t coords[3] = {x, y, z};
+      float gap = 0.0f;
+      for(int i = 0; i < 3; i++)
+      {
+        float cellMin = m_Origin[i] + static_cast<float>(coords[i]) * m_CellSize;
+        float d = std::max(cellMin - q[i], q[i] - (cellMin + m_CellSize));
+        if(d > 0.0f)
+        {
+          gap += d * d;
+        }
+      }
+      if(gap * (1.0f - k_FaceTolerance) > best.top().first)
+      {
+        return;
+      }
+    }
+    for(int64_t i = m_CellStarts[cell]; i < m_CellStarts[cell + 1]; i++)
+    {
+      Candidate candidate(SquaredDistance(q, m_Coords.data() + 3 * i), m_PointIds[i]);
+      if(best.size() < k)
+      {
+        best.push(candidate);
+      }
+      else if(candidate < best.top())
+      {
+        best.pop();
+        best.push(candidate);
+      }
+    }
+  };
+
+  int64_t center[3] = {cellCoordinate(q[0], 0), cellCoordinate(q[1], 1), cellCoordinate(q[2], 2)};
+  for(int64_t ring = 0;; ring++)
+  {
+    int64_t lo[3] = {0, 0, 0};
+    int64_t hi[3] = {0, 0, 0};
+    bool coversGrid = true;
+    for(int i = 0; i < 3; i++)
+    {
+      lo[i] = std::max<int64_t>(center[i] - ring, 0);
+      hi[i] = std::min<int64_t>(center[i] + ring, m_Dims[i] - 1);
+      coversGrid = coversGrid && center[i] - ring <= 0 && center[i] + ring >= m_Dims[i] - 1;
+    }
+
+    for(int64_t z = lo[2]; z <= hi[2]; z++)
+    {
+      for(int64_t y = lo[1]; y <= hi[1]; y++)
+      {
+        if(std::abs(z - center[2]) == ring || std::abs(y - center[1]) == ring)
+        {
+          for(int64_t x = lo[0]; x <= hi[0]; x++)
+          {
+            visitCell(x, y, z);
+          }
+        }
+        else
+        {
+          // Inside of the shell only the cells at both ends of the row are new
+          if(center[0] - ring >= 0)
+          {
+            visitCell(center[0] - ring, y, z);
+          }
+          if(center[0] + ring < m_Dims[0])
+          {
+            visitCell(center[0] + ring, y, z);
+          }
+        }
+      }
+    }
+
+    if(coversGrid)
+    {
+      break;
+    }
+    if(best.size() == k)
+    {
+      // Distance from q to the closest face of the searched block of cells that has unsearched cells behind it
+      float bound = std::numeric_limits<float>::max();
+      for(int i = 0; i < 3; i++)
+      {
+        if(center[i] - ring > 0)
+        {
+          bound = std::min(bound, q[i] - (m_Origin[i] + static_cast<float>(center[i] - ring) * m_CellSize));
+        }
+        if(center[i] + ring < m_Dims[i] - 1)
+        {
+          bound = std::min(bound, (m_Origin[i] + static_cast<float>(center[i] + ring + 1) * m_CellSize) - q[i]);
+        }
+      }
+      bound -= k_FaceTolerance * m_CellSize;
+      if(bound > 0.0f && best.top().first <= bound * bound)
+      {
+        break;
+      }
+    }
+  }
+
+  ids.resize(k);
+  if(nullptr != distances)
+  {
+    distances->resize(k);
+  }
+  for(size_t i = k; i > 0; i--)
+  {
+    ids[i - 1] = best.top().second;
+    if(nullptr != distances)
+    {
+      (*distances)[i - 1] = std::sqrt(best.top().first);
+    }
+    best.pop();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findInRadius(const float* points, size_t numPoints, float radius, NeighborList<int64_t>* neighbors) const
+{
+  if(nullptr == neighbors)
+  {
+    return;
+  }
+  // The lists are filled through the size_t operator[], since setList() takes an int tuple id. Clearing first gives
+  // every tuple a fresh list.
+  neighbors->resizeTotalElements(0);
+  neighbors->resizeTotalElements(numPoints);
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, points, radius, neighbors](size_t i) { findInRadius(points + 3 * i, radius, (*neighbors)[i]); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findNearest(const float* points, size_t numPoints, size_t k, int64_t* ids, float* distances) const
+{
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, points, k, ids, distances](size_t i) {
+    std::vector<int64_t> nearest;
+    std::vector<float> nearestDistances;
+    findNearest(points + 3 * i, k, nearest, nullptr != distances ? &nearestDistances : nullptr);
+    for(size_t j = 0; j < k; j++)
+    {
+      ids[i * k + j] = j < nearest.size() ? nearest[j] : -1;
+      if(nullptr != distances)
+      {
+        distances[i * k + j] = j < nearest.size() ? nearestDistances[j] : std::numeric_limits<float>::max();
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexSpatialIndex::findNearestNeighbors(size_t k, NeighborList<int64_t>* neighbors) const
+{
+  if(nullptr == neighbors)
+  {
+    return;
+  }
+  size_t numPoints = m_PointIds.size();
+  // As in findInRadius(), the lists are filled through the size_t operator[]
+  neighbors->resizeTotalElements(0);
+  neighbors->resizeTotalElements(numPoints);
+  // Walk the points in cell order so that consecutive queries touch the same cells
+  GeometryHelpers::ForEachElement(numPoints, k_MinimumGrain, [this, k, neighbors](size_t i) {
+    int64_t pointId = m_PointIds[i];
+    NeighborList<int64_t>::VectorType& ids = (*neighbors)[static_cast<size_t>(pointId)];
+    findNearest(m_Coords.data() + 3 * i, k + 1, ids);
+    // Coincident points may push the point itself out of the k + 1 closest; drop the farthest instead
+    auto self = std::find(ids.begin(), ids.end(), pointId);
+    if(self != ids.end())
+    {
+      ids.erase(self);
+    }
+    else if(ids.size() > k)
+    {
+      ids.pop_back();
+    }
+  });
+}
@@ -0,0 +1,225 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/SIMPLib.h"
+
+template <typename T> class NeighborList;
+
+/**
+ * @brief The VertexSpatialIndex class is a uniform grid over a list of points that answers box, radius and
+ * k nearest neighbor queries without testing every point. It can be built over the vertices of any geometry
+ * (VertexGeom, the nodes of a TriangleGeom, ...) or over a raw coordinate array such as the element centroids
+ * from findElementCentroids().
+ *
+ * The points are bucketed into the grid cells with a parallel counting sort and a copy of their coordinates is
+ * stored in cell order, so a query only touches contiguous memory of the cells it overlaps. By default the cell
+ * size is chosen so that each occupied cell holds a handful of points when the points are spread evenly.
+ *
+ * The index keeps its own copy of the coordinates; it must be rebuilt if the points change. The batched
+ * queries run multi-threaded over the query points through the ParallelExecutionContext.
+ */
+class SIMPLib_EXPORT VertexSpatialIndex
+{
+public:
+  SIMPL_SHARED_POINTERS(VertexSpatialIndex)
+  SIMPL_TYPE_MACRO(VertexSpatialIndex)
+
+  virtual ~VertexSpatialIndex();
+
+  /**
+   * @brief Builds the index over a shared vertex list
+   * @param vertices
+   * @param cellSize Edge length of the grid cells. A value <= 0 selects a size from the point density.
+   * @return A null pointer if the list is null, empty or does not have 3 components
+   */
+  static Pointer New(SharedVertexList::Pointer vertices, float cellSize = 0.0f);
+
+  /**
+   * @brief Builds the index over numPoints x 3 coordinates
+   * @param coords
+   * @param numPoints
+   * @param cellSize Edge length of the grid cells. A value <= 0 selects a size from the point density.
+   * @return A null pointer if there are no points
+   */
+  static Pointer New(const float* coords, size_t numPoints, float cellSize = 0.0f);
+
+  /**
+   * @brief Returns the number of indexed points
+   * @return
+   */
+  size_t getNumberOfPoints() const;
+
+  /**
+   * @brief Returns the edge length of the grid cells
+   * @return
+   */
+  float getCellSize() const;
+
+  /**
+   * @brief Returns the number of grid cells along each axis
+   * @param dims
+   */
+  void getGridDimensions(size_t dims[3]) const;
+
+  /**
+   * @brief Returns the ids of the points in the order in which they are stored in the grid. Running the
+   * queries around the indexed points in this order keeps consecutive queries in the same cells.
+   * @return
+   */
+  const std::vector<int64_t>& getPointOrder() const;
+
+  /**
+   * @brief Returns the bounding box of all points
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief Finds the points that lie inside of the axis aligned box, including its boundary
+   * @param lowerLeft
+   * @param upperRight
+   * @param ids Receives the point ids in ascending order
+   */
+  void findInBox(const float lowerLeft[3], const float upperRight[3], std::vector<int64_t>& ids) const;
+
+  /**
+   * @brief Finds the points whose distance to q is less than or equal to the radius
+   * @param q
+   * @param radius
+   * @param ids Receives the point ids in ascending order
+   */
+  void findInRadius(const float q[3], float radius, std::vector<int64_t>& ids) const;
+
+  /**
+   * @brief Finds the k points closest to q
+   * @param q
+   * @param k
+   * @param ids Receives min(k, number of points) ids sorted by increasing distance
+   * @param distances Receives the matching distances. May be nullptr.
+   */
+  void findNearest(const float q[3], size_t k, std::vector<int64_t>& ids, std::vector<float>* distances = nullptr) const;
+
+  /**
+   * @brief Runs findInRadius() for each of the points
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param radius
+   * @param neighbors Resized to numPoints tuples; tuple i receives the ids found around point i
+   */
+  void findInRadius(const float* points, size_t numPoints, float radius, NeighborList<int64_t>* neighbors) const;
+
+  /**
+   * @brief Runs findNearest() for each of the points
+   * @param points numPoints x 3 coordinates
+   * @param numPoints
+   * @param k
+   * @param ids numPoints x k ids. Entries are -1 if fewer than k points are indexed.
+   * @param distances numPoints x k distances. May be nullptr.
+   */
+  void findNearest(const float* points, size_t numPoints, size_t k, int64_t* ids, float* distances) const;
+
+  /**
+   * @brief Runs findNearest() for each indexed point and writes the k neighbors of every point, excluding the
+   * point itself, into the neighbor list. This is the usual input of neighbor based statistics.
+   * @param k
+   * @param neighbors Resized to getNumberOfPoints() tuples
+   */
+  void findNearestNeighbors(size_t k, NeighborList<int64_t>* neighbors) const;
+
+protected:
+  VertexSpatialIndex();
+
+  /**
+   * @brief Buckets the points into the grid cells
+   * @param coords
+   * @param numPoints
+   * @param cellSize
+   */
+  void build(const float* coords, size_t numPoints, float cellSize);
+
+  /**
+   * @brief Computes the number of cells along each axis for the cell size. A cell size <= 0 is replaced by
+   * one that is derived from the point density.
+   * @param numPoints
+   * @param cellSize
+   */
+  void computeGrid(size_t numPoints, float cellSize);
+
+  /**
+   * @brief Returns the cell index along the axis that contains the coordinate, clamped to the grid
+   * @param value
+   * @param axis
+   * @return
+   */
+  int64_t cellCoordinate(float value, int axis) const;
+
+  /**
+   * @brief Returns the linear index of the cell
+   * @param x
+   * @param y
+   * @param z
+   * @return
+   */
+  size_t cellIndex(int64_t x, int64_t y, int64_t z) const;
+
+  /**
+   * @brief Finds the range of cells that overlap the box along each axis
+   * @param lowerLeft
+   * @param upperRight
+   * @param cellMin
+   * @param cellMax
+   * @return False if the box does not overlap the bounds of the points
+   */
+  bool overlappingCells(const float lowerLeft[3], const float upperRight[3], int64_t cellMin[3], int64_t cellMax[3]) const;
+
+private:
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+  float m_Max[3] = {0.0f, 0.0f, 0.0f};
+  float m_CellSize = 1.0f;
+  float m_InvCellSize = 1.0f;
+  int64_t m_Dims[3] = {1, 1, 1};
+  std::vector<int64_t> m_CellStarts; // Offset of the first point of each cell; one extra entry at the end
+  std::vector<int64_t> m_PointIds;   // Original id of each point in cell order
+  std::vector<float> m_Coords;       // 3 coordinates of each point in cell order
+
+  VertexSpatialIndex(const VertexSpatialIndex&) = delete;   // Copy Constructor Not Implemented
+  void operator=(const VertexSpatialIndex&) = delete; // Move assignment Not Implemented
+};
@@ -0,0 +1,455 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLib/Math/BatchMath.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#endif
+
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+namespace
+{
+// Number of tuples that are transposed into structure of arrays form at a time. The largest kernel
+// (3x3 times 3x3) keeps 27 of these rows on the stack.
+const size_t k_BlockSize = 64;
+
+const size_t k_MinimumBlocksPerTask = 16;
+
+enum QuatComponent
+{
+  X = 0,
+  Y = 1,
+  Z = 2,
+  W = 3
+};
+
+// -----------------------------------------------------------------------------
+// Transposes n tuples of an array of structures into one row per component
+// -----------------------------------------------------------------------------
+template <size_t Components> void LoadBlock(const float* aos, size_t n, float (&soa)[Components][k_BlockSize])
+{
+  for(size_t j = 0; j < n; j++)
+  {
+    for(size_t c = 0; c < Components; c++)
+    {
+      soa[c][j] = aos[j * Components + c];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Transposes n tuples stored as one row per component back into an array of structures
+// -----------------------------------------------------------------------------
+template <size_t Components> void StoreBlock(const float (&soa)[Components][k_BlockSize], size_t n, float* aos)
+{
+  for(size_t j = 0; j < n; j++)
+  {
+    for(size_t c = 0; c < Components; c++)
+    {
+      aos[j * Components + c] = soa[c][j];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Calls kernel(firstTuple, numTuples) for consecutive blocks of at most k_BlockSize tuples,
+// in parallel if the execution context allows it
+// -----------------------------------------------------------------------------
+template <typename KernelType> void ForEachBlock(size_t count, const KernelType& kernel)
+{
+  size_t numBlocks = (count + k_BlockSize - 1) / k_BlockSize;
+  auto runBlocks = [count, &kernel](size_t firstBlock, size_t lastBlock) {
+    for(size_t b = firstBlock; b < lastBlock; b++)
+    {
+      size_t begin = b * k_BlockSize;
+      kernel(begin, std::min(k_BlockSize, count - begin));
+    }
+  };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel() && numBlocks > k_MinimumBlocksPerTask)
+  {
+    context->parallelFor(tbb::blocked_range<size_t>(0, numBlocks, context->computeGrainSize(numBlocks, k_MinimumBlocksPerTask)),
+                         [&runBlocks](const tbb::blocked_range<size_t>& r) { runBlocks(r.begin(), r.end()); });
+    return;
+  }
+#endif
+  runBlocks(0, numBlocks);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool HasComponents(FloatArrayType* array, int numComponents)
+{
+  return nullptr != array && array->getNumberOfComponents() == numComponents;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BatchMath::BatchMath() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BatchMath::~BatchMath() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::MultiplyQuaternions(const float* q1, const float* q2, float* out, size_t count)
+{
+  // The 4 components of a quaternion fill a vector register, so this kernel works on the tuples directly
+  ForEachBlock(count, [q1, q2, out](size_t begin, size_t n) {
+    for(size_t i = begin; i < begin + n; i++)
+    {
+      const float* a = q1 + i * 4;
+      const float* b = q2 + i * 4;
+      float c[4];
+      c[X] = b[X] * a[W] + b[W] * a[X] + b[Z] * a[Y] - b[Y] * a[Z];
+      c[Y] = b[Y] * a[W] + b[W] * a[Y] + b[X] * a[Z] - b[Z] * a[X];
+      c[Z] = b[Z] * a[W] + b[W] * a[Z] + b[Y] * a[X] - b[X] * a[Y];
+      c[W] = b[W] * a[W] - b[X] * a[X] - b[Y] * a[Y] - b[Z] * a[Z];
+      float* dest = out + i * 4;
+      dest[X] = c[X];
+      dest[Y] = c[Y];
+      dest[Z] = c[Z];
+      dest[W] = c[W];
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::ConjugateQuaternions(const float* in, float* out, size_t count)
+{
+  ForEachBlock(count, [in, out](size_t begin, size_t n) {
+    for(size_t i = begin; i < begin + n; i++)
+    {
+      float q[4] = {in[i * 4], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3]};
+      float* dest = out + i * 4;
+      dest[X] = -q[X];
+      dest[Y] = -q[Y];
+      dest[Z] = -q[Z];
+      dest[W] = q[W];
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::NormalizeQuaternions(const float* in, float* out, size_t count)
+{
+  ForEachBlock(count, [in, out](size_t begin, size_t n) {
+    for(size_t i = begin; i < begin + n; i++)
+    {
+      // Read the whole tuple first since the output may be the input array
+      float q[4] = {in[i * 4], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3]};
+      float norm = q[X] * q[X] + q[Y] * q[Y] + q[Z] * q[Z] + q[W] * q[W];
+      float length = norm > 0.0f ? std::sqrt(norm) : 1.0f;
+      float* dest = out + i * 4;
+      dest[X] = q[X] / length;
+      dest[Y] = q[Y] / length;
+      dest[Z] = q[Z] / length;
+      dest[W] = q[W] / length;
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::RotateVectors(const float* quats, const float* vectors, float* out, size_t count)
+{
+  ForEachBlock(count, [quats, vectors, out](size_t begin, size_t n) {
+    float q[4][k_BlockSize];
+    float v[3][k_BlockSize];
+    float r[3][k_BlockSize];
+    LoadBlock<4>(quats + begin * 4, n, q);
+    LoadBlock<3>(vectors + begin * 3, n, v);
+    for(size_t j = 0; j < n; j++)
+    {
+      float qx2 = q[X][j] * q[X][j];
+      float qy2 = q[Y][j] * q[Y][j];
+      float qz2 = q[Z][j] * q[Z][j];
+      float qw2 = q[W][j] * q[W][j];
+
+      float qxy = q[X][j] * q[Y][j];
+      float qyz = q[Y][j] * q[Z][j];
+      float qzx = q[Z][j] * q[X][j];
+
+      float qxw = q[X][j] * q[W][j];
+      float qyw = q[Y][j] * q[W][j];
+      float qzw = q[Z][j] * q[W][j];
+
+      r[0][j] = v[0][j] * (qx2 - qy2 - qz2 + qw2) + 2 * (v[1][j] * (qxy + qzw) + v[2][j] * (qzx - qyw));
+      r[1][j] = v[1][j] * (qy2 - qx2 - qz2 + qw2) + 2 * (v[2][j] * (qyz + qxw) + v[0][j] * (qxy - qzw));
+      r[2][j] = v[2][j] * (qz2 - qx2 - qy2 + qw2) + 2 * (v[0][j] * (qzx + qyw) + v[1][j] * (qyz - qxw));
+    }
+    StoreBlock<3>(r, n, out + begin * 3);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::Multiply3x3with3x3(const float* g1, const float* g2, float* out, size_t count)
+{
+  // Each output row is a linear combination of the rows of g2, which vectorizes well without a transposition
+  ForEachBlock(count, [g1, g2, out](size_t begin, size_t n) {
+    for(size_t i = begin; i < begin + n; i++)
+    {
+      float a[9];
+      float b[9];
+      float c[9];
+      std::copy(g1 + i * 9, g1 + i * 9 + 9, a);
+      std::copy(g2 + i * 9, g2 + i * 9 + 9, b);
+      for(size_t row = 0; row < 3; row++)
+      {
+        for(size_t col = 0; col < 3; col++)
+        {
+          c[row * 3 + col] = a[row * 3] * b[col] + a[row * 3 + 1] * b[3 + col] + a[row * 3 + 2] * b[6 + col];
+        }
+      }
+      std::copy(c, c + 9, out + i * 9);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::Multiply3x3with3x1(const float* g, const float* v, float* out, size_t count)
+{
+  ForEachBlock(count, [g, v, out](size_t begin, size_t n) {
+    float m[9][k_BlockSize];
+    float x[3][k_BlockSize];
+    float r[3][k_BlockSize];
+    LoadBlock<9>(g + begin * 9, n, m);
+    LoadBlock<3>(v + begin * 3, n, x);
+    for(size_t row = 0; row < 3; row++)
+    {
+      const float* m0 = m[row * 3];
+      const float* m1 = m[row * 3 + 1];
+      const float* m2 = m[row * 3 + 2];
+      float* dest = r[row];
+      for(size_t j = 0; j < n; j++)
+      {
+        dest[j] = m0[j] * x[0][j] + m1[j] * x[1][j] + m2[j] * x[2][j];
+      }
+    }
+    StoreBlock<3>(r, n, out + begin * 3);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::Invert3x3(const float* in, float* out, size_t count)
+{
+  ForEachBlock(count, [in, out](size_t begin, size_t n) {
+    float g[9][k_BlockSize];
+    float r[9][k_BlockSize];
+    LoadBlock<9>(in + begin * 9, n, g);
+    for(size_t j = 0; j < n; j++)
+    {
+      // Transposed cofactors (the adjoint) divided by the determinant
+      float c00 = g[4][j] * g[8][j] - g[7][j] * g[5][j];
+      float c01 = -(g[3][j] * g[8][j] - g[6][j] * g[5][j]);
+      float c02 = g[3][j] * g[7][j] - g[6][j] * g[4][j];
+      float oneOverDeterminant = 1.0f / (g[0][j] * c00 + g[1][j] * c01 + g[2][j] * c02);
+
+      r[0][j] = c00 * oneOverDeterminant;
+      r[1][j] = -(g[1][j] * g[8][j] - g[7][j] * g[2][j]) * oneOverDeterminant;
+      r[2][j] = (g[1][j] * g[5][j] - g[4][j] * g[2][j]) * oneOverDeterminant;
+      r[3][j] = c01 * oneOverDeterminant;
+      r[4][j] = (g[0][j] * g[8][j] - g[6][j] * g[2][j]) * oneOverDeterminant;
+      r[5][j] = -(g[0][j] * g[5][j] - g[3][j] * g[2][j]) * oneOverDeterminant;
+      r[6][j] = c02 * oneOverDeterminant;
+      r[7][j] = -(g[0][j] * g[7][j] - g[6][j] * g[1][j]) * oneOverDeterminant;
+      r[8][j] = (g[0][j] * g[4][j] - g[3][j] * g[1][j]) * oneOverDeterminant;
+    }
+    StoreBlock<9>(r, n, out + begin * 9);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BatchMath::Normalize3x1(const float* in, float* out, size_t count)
+{
+  ForEachBlock(count, [in, out](size_t begin, size_t n) {
+    for(size_t i = begin; i < begin + n; i++)
+    {
+      float v[3] = {in[i * 3], in[i * 3 + 1], in[i * 3 + 2]};
+      float denom = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+      denom = denom > 0.0f ? std::sqrt(denom) : 1.0f;
+      // MatrixMath::Normalize3x1 clamps each component to 1 to guard against round off
+      float* dest = out + i * 3;
+      dest[0] = std::min(v[0] / denom, 1.0f);
+      dest[1] = std::min(v[1] / denom, 1.0f);
+      dest[2] = std::min(v[2] / denom, 1.0f);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::MultiplyQuaternions(FloatArrayType* q1, FloatArrayType* q2, FloatArrayType* out)
+{
+  if(!HasComponents(q1, 4) || !HasComponents(q2, 4) || !HasComponents(out, 4) || q1->getNumberOfTuples() != q2->getNumberOfTuples())
+  {
+    return false;
+  }
+  size_t count = q1->getNumberOfTuples();
+  out->resize(count);
+  MultiplyQuaternions(q1->getPointer(0), q2->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::ConjugateQuaternions(FloatArrayType* in, FloatArrayType* out)
+{
+  if(!HasComponents(in, 4) || !HasComponents(out, 4))
+  {
+    return false;
+  }
+  size_t count = in->getNumberOfTuples();
+  out->resize(count);
+  ConjugateQuaternions(in->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::NormalizeQuaternions(FloatArrayType* in, FloatArrayType* out)
+{
+  if(!HasComponents(in, 4) || !HasComponents(out, 4))
+  {
+    return false;
+  }
+  size_t count = in->getNumberOfTuples();
+  out->resize(count);
+  NormalizeQuaternions(in->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::RotateVectors(FloatArrayType* quats, FloatArrayType* vectors, FloatArrayType* out)
+{
+  if(!HasComponents(quats, 4) || !HasComponents(vectors, 3) || !HasComponents(out, 3) || quats->getNumberOfTuples() != vectors->getNumberOfTuples())
+  {
+    return false;
+  }
+  size_t count = quats->getNumberOfTuples();
+  out->resize(count);
+  RotateVectors(quats->getPointer(0), vectors->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::Multiply3x3with3x3(FloatArrayType* g1, FloatArrayType* g2, FloatArrayType* out)
+{
+  if(!HasComponents(g1, 9) || !HasComponents(g2, 9) || !HasComponents(out, 9) || g1->getNumberOfTuples() != g2->getNumberOfTuples())
+  {
+    return false;
+  }
+  size_t count = g1->getNumberOfTuples();
+  out->resize(count);
+  Multiply3x3with3x3(g1->getPointer(0), g2->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::Multiply3x3with3x1(FloatArrayType* g, FloatArrayType* v, FloatArrayType* out)
+{
+  if(!HasComponents(g, 9) || !HasComponents(v, 3) || !HasComponents(out, 3) || g->getNumberOfTuples() != v->getNumberOfTuples())
+  {
+    return false;
+  }
+  size_t count = g->getNumberOfTuples();
+  out->resize(count);
+  Multiply3x3with3x1(g->getPointer(0), v->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::Invert3x3(FloatArrayType* in, FloatArrayType* out)
+{
+  if(!HasComponents(in, 9) || !HasComponents(out, 9))
+  {
+    return false;
+  }
+  size_t count = in->getNumberOfTuples();
+  out->resize(count);
+  Invert3x3(in->getPointer(0), out->getPointer(0), count);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BatchMath::Normalize3x1(FloatArrayType* in, FloatArrayType* out)
+{
+  if(!HasComponents(in, 3) || !HasComponents(out, 3))
+  {
+    return false;
+  }
+  size_t count = in->getNumberOfTuples();
+  out->resize(count);
+  Normalize3x1(in->getPointer(0), out->getPointer(0), count);
+  return true;
+}
@@ -0,0 +1,204 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The BatchMath class applies the QuaternionMath and MatrixMath operations to every tuple of an
+ * array at once. The arrays are stored tuple by tuple (array of structures) just like every other
+ * DataArray: quaternions have 4 components in x, y, z, w order, 3x3 matrices have 9 components in row
+ * major order and vectors have 3 components.
+ *
+ * Internally the tuples are processed in small blocks that are distributed over the threads of the
+ * ParallelExecutionContext. The kernels whose tuples do not map well onto vector registers (vector
+ * rotation, 3x3 inverse and matrix times vector) transpose each block into one array per component
+ * (structure of arrays) so that the compiler can vectorize the arithmetic across tuples.
+ *
+ * The output may be the same array as one of the inputs, in which case the operation is done in place.
+ * Other partial overlaps between the inputs and the output are not allowed.
+ */
+class SIMPLib_EXPORT BatchMath
+{
+public:
+  virtual ~BatchMath();
+
+  /**
+   * @brief Multiplies the quaternions q1[i] * q2[i] as QuaternionMath::Multiply does
+   * @param q1 count x 4 values
+   * @param q2 count x 4 values
+   * @param out count x 4 values
+   * @param count Number of quaternions
+   */
+  static void MultiplyQuaternions(const float* q1, const float* q2, float* out, size_t count);
+
+  /**
+   * @brief Computes the conjugate of each quaternion as QuaternionMath::Conjugate does
+   * @param in count x 4 values
+   * @param out count x 4 values
+   * @param count Number of quaternions
+   */
+  static void ConjugateQuaternions(const float* in, float* out, size_t count);
+
+  /**
+   * @brief Converts each quaternion into a unit quaternion as QuaternionMath::UnitQuaternion does.
+   * Quaternions with a length of zero are copied unchanged.
+   * @param in count x 4 values
+   * @param out count x 4 values
+   * @param count Number of quaternions
+   */
+  static void NormalizeQuaternions(const float* in, float* out, size_t count);
+
+  /**
+   * @brief Rotates each vector by its quaternion as QuaternionMath::MultiplyQuatVec does (passive rotation)
+   * @param quats count x 4 values
+   * @param vectors count x 3 values
+   * @param out count x 3 values
+   * @param count Number of quaternion/vector pairs
+   */
+  static void RotateVectors(const float* quats, const float* vectors, float* out, size_t count);
+
+  /**
+   * @brief Multiplies the matrices g1[i] * g2[i] as MatrixMath::Multiply3x3with3x3 does
+   * @param g1 count x 9 values
+   * @param g2 count x 9 values
+   * @param out count x 9 values
+   * @param count Number of matrices
+   */
+  static void Multiply3x3with3x3(const float* g1, const float* g2, float* out, size_t count);
+
+  /**
+   * @brief Multiplies each matrix with its vector as MatrixMath::Multiply3x3with3x1 does
+   * @param g count x 9 values
+   * @param v count x 3 values
+   * @param out count x 3 values
+   * @param count Number of matrix/vector pairs
+   */
+  static void Multiply3x3with3x1(const float* g, const float* v, float* out, size_t count);
+
+  /**
+   * @brief Inverts each matrix as MatrixMath::Invert3x3 does. Singular matrices produce non finite values.
+   * @param in count x 9 values
+   * @param out count x 9 values
+   * @param count Number of matrices
+   */
+  static void Invert3x3(const float* in, float* out, size_t count);
+
+  /**
+   * @brief Normalizes each vector as MatrixMath::Normalize3x1 does. Vectors with a length of zero are copied unchanged.
+   * @param in count x 3 values
+   * @param out count x 3 values
+   * @param count Number of vectors
+   */
+  static void Normalize3x1(const float* in, float* out, size_t count);
+
+  /**
+   * @brief Array version of MultiplyQuaternions. The output array is resized to the number of tuples of the inputs.
+   * @param q1
+   * @param q2
+   * @param out
+   * @return False if any array is null, does not have 4 components or if the inputs have different numbers of tuples
+   */
+  static bool MultiplyQuaternions(FloatArrayType* q1, FloatArrayType* q2, FloatArrayType* out);
+
+  /**
+   * @brief Array version of ConjugateQuaternions. The output array is resized to the number of tuples of the input.
+   * @param in
+   * @param out
+   * @return False if any array is null or does not have 4 components
+   */
+  static bool ConjugateQuaternions(FloatArrayType* in, FloatArrayType* out);
+
+  /**
+   * @brief Array version of NormalizeQuaternions. The output array is resized to the number of tuples of the input.
+   * @param in
+   * @param out
+   * @return False if any array is null or does not have 4 components
+   */
+  static bool NormalizeQuaternions(FloatArrayType* in, FloatArrayType* out);
+
+  /**
+   * @brief Array version of RotateVectors. The output array is resized to the number of tuples of the inputs.
+   * @param quats 4 component array
+   * @param vectors 3 component array
+   * @param out 3 component array
+   * @return False if any array is null, has the wrong number of components or if the inputs have different numbers of tuples
+   */
+  static bool RotateVectors(FloatArrayType* quats, FloatArrayType* vectors, FloatArrayType* out);
+
+  /**
+   * @brief Array version of Multiply3x3with3x3. The output array is resized to the number of tuples of the inputs.
+   * @param g1
+   * @param g2
+   * @param out
+   * @return False if any array is null, does not have 9 components or if the inputs have different numbers of tuples
+   */
+  static bool Multiply3x3with3x3(FloatArrayType* g1, FloatArrayType* g2, FloatArrayType* out);
+
+  /**
+   * @brief Array version of Multiply3x3with3x1. The output array is resized to the number of tuples of the inputs.
+   * @param g 9 component array
+   * @param v 3 component array
+   * @param out 3 component array
+   * @return False if any array is null, has the wrong number of components or if the inputs have different numbers of tuples
+   */
+  static bool Multiply3x3with3x1(FloatArrayType* g, FloatArrayType* v, FloatArrayType* out);
+
+  /**
+   * @brief Array version of Invert3x3. The output array is resized to the number of tuples of the input.
+   * @param in
+   * @param out
+   * @return False if any array is null or does not have 9 components
+   */
+  static bool Invert3x3(FloatArrayType* in, FloatArrayType* out);
+
+  /**
+   * @brief Array version of Normalize3x1. The output array is resized to the number of tuples of the input.
+   * @param in
+   * @param out
+   * @return False if any array is null or does not have 3 components
+   */
+  static bool Normalize3x1(FloatArrayType* in, FloatArrayType* out);
+
+protected:
+  BatchMath();
+
+private:
+  BatchMath(const BatchMath&) = delete;       // Copy Constructor Not Implemented
+  void operator=(const BatchMath&) = delete; // Move assignment Not Implemented
+};
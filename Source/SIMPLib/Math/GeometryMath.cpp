@@ -35,12 +35,10 @@
 
 #include "GeometryMath.h"
 
-#include <chrono>
-#include <random>
-
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Math/PhiloxRandom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 //#include "SIMPLib/Math/SIMPLibRandom.h"
 
@@ -279,16 +277,21 @@ float GeometryMath::LengthOfRayInBox(const float* p, const float* q, const float
 // -----------------------------------------------------------------------------
 void GeometryMath::GenerateRandomRay(float length, float ray[3])
 {
-  float w, t;
+  // Seeding a generator is far more expensive than drawing from it, so each thread seeds its own
+  // generator once instead of on every call
+  static thread_local PhiloxRandom generator(PhiloxRandom::GenerateSeed());
+  GenerateRandomRay(length, ray, generator);
+}
 
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-  std::uniform_real_distribution<> distribution(0.0, 1.0);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryMath::GenerateRandomRay(float length, float ray[3], PhiloxRandom& generator)
+{
+  float w, t;
 
-  ray[2] = (2.0f * distribution(generator)) - 1.0f;
-  t = (SIMPLib::Constants::k_2Pi * distribution(generator));
+  ray[2] = static_cast<float>(2.0 * generator.nextDouble() - 1.0);
+  t = static_cast<float>(SIMPLib::Constants::k_2Pi * generator.nextDouble());
   w = sqrtf(1.0f - (ray[2] * ray[2]));
   ray[0] = w * cosf(t);
   ray[1] = w * sinf(t);
@@ -41,6 +41,7 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DynamicListArray.hpp"
 
+class PhiloxRandom;
 class VertexGeom;
 class TriangleGeom;
 
@@ -260,6 +261,16 @@ class SIMPLib_EXPORT GeometryMath
      */
     static void GenerateRandomRay(float length, float ray[3]);
 
+    /**
+     * @brief Creates a randomly oriented ray of given length from the generator. Use this
+     * overload with a seeded generator (one stream per thread or per query) when the rays
+     * have to be reproducible.
+     * @param length float
+     * @param ray 1x3 Vector
+     * @param generator
+     */
+    static void GenerateRandomRay(float length, float ray[3], PhiloxRandom& generator);
+
     /**
      * @brief Determines the bounding box defined by the lower left and upper right corners of a set of vertices
      * @param verts pointer to vertex array
@@ -0,0 +1,229 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PhiloxRandom class is the Philox4x32-10 counter based pseudorandom number generator of
+ * Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11). Every 128 bit output block is a pure
+ * function of a 64 bit key (the seed), a 64 bit stream id and a 64 bit block counter, so any block of any
+ * stream can be computed directly without generating the ones before it.
+ *
+ * This is what makes parallel generation reproducible: when element i of an array is always drawn from block
+ * i (see the static Block() and Uniform*() functions) the result is bit for bit the same no matter how the work
+ * is split between threads. Independent streams for threads, tuples or features are obtained by giving each
+ * one its own stream id.
+ *
+ * An instance also works as a sequential generator that satisfies the UniformRandomBitGenerator requirements.
+ * Note that the distributions of the standard library are implementation defined; use the Uniform*() helpers
+ * of this class when the values have to match across platforms.
+ */
+class SIMPLib_EXPORT PhiloxRandom
+{
+public:
+  using result_type = uint32_t;
+
+  /**
+   * @brief Creates a generator that starts at block 0 of the stream
+   * @param seed
+   * @param stream
+   */
+  explicit PhiloxRandom(uint64_t seed = 0, uint64_t stream = 0);
+
+  ~PhiloxRandom();
+
+  PhiloxRandom(const PhiloxRandom&) = default;
+  PhiloxRandom& operator=(const PhiloxRandom&) = default;
+
+  static constexpr result_type min()
+  {
+    return 0;
+  }
+
+  static constexpr result_type max()
+  {
+    return 0xFFFFFFFFu;
+  }
+
+  /**
+   * @brief Returns the next 32 random bits
+   * @return
+   */
+  result_type operator()();
+
+  /**
+   * @brief Returns the next 64 random bits
+   * @return
+   */
+  uint64_t nextUInt64();
+
+  /**
+   * @brief Returns a uniform value in [0, 1) with 53 bits of resolution
+   * @return
+   */
+  double nextDouble();
+
+  /**
+   * @brief Returns a uniform value in [0, 1) with 24 bits of resolution
+   * @return
+   */
+  float nextFloat();
+
+  /**
+   * @brief Moves the generator to the start of the block
+   * @param block
+   */
+  void seek(uint64_t block);
+
+  /**
+   * @brief Moves the generator to the start of another stream
+   * @param stream
+   */
+  void setStream(uint64_t stream);
+
+  uint64_t getSeed() const;
+  uint64_t getStream() const;
+
+  /**
+   * @brief Computes one output block of the generator
+   * @param seed
+   * @param stream
+   * @param block
+   * @param output Receives 4 x 32 random bits
+   */
+  static inline void Block(uint64_t seed, uint64_t stream, uint64_t block, uint32_t output[4]);
+
+  /**
+   * @brief Returns a uniform value in [0, 1) with 53 bits of resolution that is taken from the first half of
+   * the block
+   * @param seed
+   * @param stream
+   * @param block
+   * @return
+   */
+  static inline double UniformDouble(uint64_t seed, uint64_t stream, uint64_t block);
+
+  /**
+   * @brief Converts 64 random bits into a uniform value in [0, 1) with 53 bits of resolution
+   * @param bits
+   * @return
+   */
+  static inline double ToDouble(uint64_t bits);
+
+  /**
+   * @brief Converts 32 random bits into a uniform value in [0, 1) with 24 bits of resolution
+   * @param bits
+   * @return
+   */
+  static inline float ToFloat(uint32_t bits);
+
+  /**
+   * @brief Returns a seed from the system entropy source and the clock for runs that do not need to be
+   * reproducible
+   * @return
+   */
+  static uint64_t GenerateSeed();
+
+private:
+  static const uint32_t k_Multiplier0 = 0xD2511F53u;
+  static const uint32_t k_Multiplier1 = 0xCD9E8D57u;
+  static const uint32_t k_Weyl0 = 0x9E3779B9u;
+  static const uint32_t k_Weyl1 = 0xBB67AE85u;
+  static const int k_NumRounds = 10;
+
+  uint64_t m_Seed = 0;
+  uint64_t m_Stream = 0;
+  uint64_t m_Block = 0;
+  uint32_t m_Output[4] = {0, 0, 0, 0};
+  int m_Position = 4; // Next unused word of m_Output; 4 means that the next block has to be computed
+};
+
+// The block function is defined inline because it is called once per element when arrays are filled
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PhiloxRandom::Block(uint64_t seed, uint64_t stream, uint64_t block, uint32_t output[4])
+{
+  uint32_t ctr[4] = {static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32), static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+  uint32_t key[2] = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+
+  for(int round = 0; round < k_NumRounds; round++)
+  {
+    uint64_t product0 = static_cast<uint64_t>(k_Multiplier0) * ctr[0];
+    uint64_t product1 = static_cast<uint64_t>(k_Multiplier1) * ctr[2];
+    uint32_t next[4] = {static_cast<uint32_t>(product1 >> 32) ^ ctr[1] ^ key[0], static_cast<uint32_t>(product1), static_cast<uint32_t>(product0 >> 32) ^ ctr[3] ^ key[1],
+                        static_cast<uint32_t>(product0)};
+    ctr[0] = next[0];
+    ctr[1] = next[1];
+    ctr[2] = next[2];
+    ctr[3] = next[3];
+    key[0] += k_Weyl0;
+    key[1] += k_Weyl1;
+  }
+
+  output[0] = ctr[0];
+  output[1] = ctr[1];
+  output[2] = ctr[2];
+  output[3] = ctr[3];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PhiloxRandom::UniformDouble(uint64_t seed, uint64_t stream, uint64_t block)
+{
+  uint32_t output[4];
+  Block(seed, stream, block, output);
+  return ToDouble((static_cast<uint64_t>(output[1]) << 32) | output[0]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PhiloxRandom::ToDouble(uint64_t bits)
+{
+  return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float PhiloxRandom::ToFloat(uint32_t bits)
+{
+  return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
@@ -37,11 +37,19 @@
 
 #include "math.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/combinable.h>
+#endif
+
+#include "SIMPLib/Geometry/VertexSpatialIndex.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/StatsData/StatsData.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -185,14 +193,9 @@ RadialDistributionFunction::~RadialDistributionFunction() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres)
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, size_t numSamples,
+                                                                          bool useCellList)
 {
-  std::vector<float> freq(numBins, 0);
-  std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
-  size_t largeNumber = 1000;
-  size_t numDistances = largeNumber * (largeNumber - 1);
-
   // boxdims are the dimensions of the box in microns
   // boxres is the resoultion of the box in microns
   size_t xpoints = static_cast<size_t>(boxdims[0] / boxres[0]);
@@ -200,27 +203,22 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
   size_t zpoints = static_cast<size_t>(boxdims[2] / boxres[2]);
 
   size_t totalpoints = xpoints * ypoints * zpoints;
-
-  float x, y, z;
-  float xn, yn, zn;
-  float xc, yc, zc;
-  float r;
+  if(totalpoints == 0)
+  {
+    return std::vector<float>(static_cast<size_t>(std::max(numBins, 0)), 0.0f);
+  }
 
   size_t featureOwnerIdx = 0;
   size_t column, row, plane;
 
-  float stepsize = (maxDistance - minDistance) / numBins;
   float maxBoxDistance = sqrtf((boxdims[0] * boxdims[0]) + (boxdims[1] * boxdims[1]) + (boxdims[2] * boxdims[2]));
-  size_t current_num_bins = static_cast<size_t>(ceil((maxBoxDistance - minDistance) / stepsize));
-
-  freq.resize(static_cast<size_t>(current_num_bins + 1));
 
   SIMPL_RANDOMNG_NEW();
 
-  randomCentroids.resize(largeNumber * 3);
+  std::vector<float> randomCentroids(numSamples * 3);
 
   // Generating all of the random points and storing their coordinates in randomCentroids
-  for(size_t i = 0; i < largeNumber; i++)
+  for(size_t i = 0; i < numSamples; i++)
   {
     featureOwnerIdx = static_cast<size_t>(rg.genrand_res53() * totalpoints);
 
@@ -228,62 +226,116 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
     row = (featureOwnerIdx / xpoints) % ypoints;
     plane = featureOwnerIdx / (xpoints * ypoints);
 
-    xc = static_cast<float>(column * boxres[0]);
-    yc = static_cast<float>(row * boxres[1]);
-    zc = static_cast<float>(plane * boxres[2]);
-
-    randomCentroids[3 * i] = xc;
-    randomCentroids[3 * i + 1] = yc;
-    randomCentroids[3 * i + 2] = zc;
+    randomCentroids[3 * i] = static_cast<float>(column * boxres[0]);
+    randomCentroids[3 * i + 1] = static_cast<float>(row * boxres[1]);
+    randomCentroids[3 * i + 2] = static_cast<float>(plane * boxres[2]);
   }
 
-  distancelist.resize(largeNumber);
+  return GenerateDistribution(randomCentroids, minDistance, maxDistance, numBins, maxBoxDistance, useCellList);
+}
 
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::GenerateDistribution(const std::vector<float>& points, float minDistance, float maxDistance, int numBins, float maxBoxDistance, bool useCellList)
+{
+  if(numBins <= 0 || !(maxDistance > minDistance))
   {
+    return std::vector<float>(static_cast<size_t>(std::max(numBins, 0)), 0.0f);
+  }
 
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
+  float stepsize = (maxDistance - minDistance) / numBins;
+  size_t current_num_bins = static_cast<size_t>(std::max(ceilf((maxBoxDistance - minDistance) / stepsize), 0.0f));
+  size_t numFreqs = current_num_bins + 1;
+  size_t numPoints = points.size() / 3;
+  const float* coords = points.data();
+
+  VertexSpatialIndex::Pointer index;
+  const int64_t* order = nullptr;
+  if(useCellList)
+  {
+    index = VertexSpatialIndex::New(coords, numPoints);
+    order = index->getPointOrder().data();
+  }
 
-    for(size_t j = i + 1; j < largeNumber; j++)
+  // Bins the distances from point i to all points j > i. Each pair is visited exactly once. With the cell
+  // list the rows are walked in cell order so that consecutive radius queries touch the same cells.
+  auto binRow = [=, &index](size_t row, std::vector<int64_t>& neighbors, std::vector<uint64_t>& counts) {
+    size_t i = nullptr != order ? static_cast<size_t>(order[row]) : row;
+    const float* p = coords + 3 * i;
+    auto binPair = [&](size_t j) {
+      const float* pn = coords + 3 * j;
+      float r = sqrtf((p[0] - pn[0]) * (p[0] - pn[0]) + (p[1] - pn[1]) * (p[1] - pn[1]) + (p[2] - pn[2]) * (p[2] - pn[2]));
+      if(r < minDistance)
+      {
+        counts[0]++;
+      }
+      else
+      {
+        size_t bin = static_cast<size_t>((r - minDistance) / stepsize);
+        counts[std::min(bin + 1, numFreqs - 1)]++;
+      }
+    };
+    if(nullptr != index.get())
     {
-
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
+      index->findInRadius(p, maxDistance, neighbors);
+      for(int64_t j : neighbors)
+      {
+        if(static_cast<size_t>(j) > i)
+        {
+          binPair(static_cast<size_t>(j));
+        }
+      }
     }
-  }
-
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
-  {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
+    else
     {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
+      for(size_t j = i + 1; j < numPoints; j++)
+      {
+        binPair(j);
+      }
+    }
+  };
 
-      if(distance < minDistance)
+  std::vector<uint64_t> counts(numFreqs, 0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+  if(context->getUseParallel())
+  {
+    tbb::combinable<std::vector<uint64_t>> localCounts([numFreqs] { return std::vector<uint64_t>(numFreqs, 0); });
+    context->parallelFor(tbb::blocked_range<size_t>(0, numPoints, context->computeGrainSize(numPoints, 16)), [&binRow, &localCounts](const tbb::blocked_range<size_t>& r) {
+      std::vector<uint64_t>& threadCounts = localCounts.local();
+      std::vector<int64_t> neighbors;
+      for(size_t i = r.begin(); i < r.end(); i++)
       {
-        freq[0]++;
+        binRow(i, neighbors, threadCounts);
       }
-      else
+    });
+    localCounts.combine_each([&counts](const std::vector<uint64_t>& threadCounts) {
+      for(size_t i = 0; i < threadCounts.size(); i++)
       {
-        freq[bin + 1]++;
+        counts[i] += threadCounts[i];
       }
+    });
+  }
+  else
+#endif
+  {
+    std::vector<int64_t> neighbors;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      binRow(i, neighbors, counts);
     }
   }
-  
-  // Normalize the frequencies
-  for(size_t i = 0; i < current_num_bins + 1; i++)
+
+  // Normalize the frequencies by the number of pairs
+  std::vector<float> freq(numFreqs, 0.0f);
+  double numPairs = 0.5 * static_cast<double>(numPoints) * static_cast<double>(numPoints > 0 ? numPoints - 1 : 0);
+  if(numPairs > 0.0)
   {
-    freq[i] = freq[i] / (numDistances);
+    for(size_t i = 0; i < numFreqs; i++)
+    {
+      freq[i] = static_cast<float>(static_cast<double>(counts[i]) / numPairs);
+    }
   }
 
   return freq;
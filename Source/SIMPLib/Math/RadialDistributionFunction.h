@@ -111,9 +111,31 @@ class SIMPLib_EXPORT RadialDistributionFunction
      * @param numBins The number of bins to generate
      * @param boxdims
      * @param boxres
+     * @param numSamples The number of random points that are placed in the box. The work grows with the square
+     * of this number unless useCellList is set.
+     * @param useCellList Only bin the pairs that are closer than maxDistance, see GenerateDistribution()
      * @return An array of values that are the frequency values for the histogram
      */
-    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres);
+    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, size_t numSamples = 1000,
+                                                         bool useCellList = false);
+
+    /**
+     * @brief GenerateDistribution Bins the distances between all pairs of the points and normalizes the
+     * histogram by the number of pairs. The first bin holds the distances below minDistance, the following
+     * bins have a width of (maxDistance - minDistance) / numBins and extend up to maxBoxDistance.
+     *
+     * The pairs are binned in parallel into thread local histograms. If useCellList is set the points are
+     * bucketed into a VertexSpatialIndex and only the pairs within maxDistance are visited, which bounds the
+     * work to the number of close pairs; the bins beyond maxDistance are then left at zero.
+     * @param points numPoints x 3 coordinates
+     * @param minDistance
+     * @param maxDistance
+     * @param numBins
+     * @param maxBoxDistance The largest possible distance between two points
+     * @param useCellList
+     * @return
+     */
+    static std::vector<float> GenerateDistribution(const std::vector<float>& points, float minDistance, float maxDistance, int numBins, float maxBoxDistance, bool useCellList = false);
 
   protected:
     RadialDistributionFunction();
@@ -3,16 +3,20 @@ set(SUBDIR_NAME Math)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayHelpers.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BatchMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GeometryMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MatrixMath.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhiloxRandom.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QuaternionMath.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RadialDistributionFunction.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibRandom.h
 )
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BatchMath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GeometryMath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MatrixMath.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhiloxRandom.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RadialDistributionFunction.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibMath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibRandom.cpp
@@ -0,0 +1,265 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "SIMPLib/Math/BatchMath.h"
+#include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Math/PhiloxRandom.h"
+#include "SIMPLib/Math/QuaternionMath.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BatchMathTest
+{
+public:
+  BatchMathTest() = default;
+  virtual ~BatchMathTest() = default;
+
+  // Not a multiple of the internal block size so that the last block is partially filled
+  const size_t k_Count = 5003;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> RandomValues(size_t count, uint64_t stream)
+  {
+    PhiloxRandom generator(5489, stream);
+    std::vector<float> values(count);
+    for(float& value : values)
+    {
+      value = generator.nextFloat() * 2.0f - 1.0f;
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireClose(const std::vector<float>& a, const std::vector<float>& b, float tolerance)
+  {
+    DREAM3D_REQUIRE_EQUAL(a.size(), b.size())
+    for(size_t i = 0; i < a.size(); i++)
+    {
+      DREAM3D_REQUIRE(std::abs(a[i] - b[i]) <= tolerance * std::max(1.0f, std::abs(b[i])))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQuaternions()
+  {
+    std::vector<float> q1 = RandomValues(k_Count * 4, 0);
+    std::vector<float> q2 = RandomValues(k_Count * 4, 1);
+    std::vector<float> v = RandomValues(k_Count * 3, 2);
+    // A zero quaternion must survive the normalization unchanged
+    q1[8] = q1[9] = q1[10] = q1[11] = 0.0f;
+
+    std::vector<float> product(k_Count * 4);
+    std::vector<float> conjugate(k_Count * 4);
+    std::vector<float> unit(k_Count * 4);
+    std::vector<float> rotated(k_Count * 3);
+    BatchMath::MultiplyQuaternions(q1.data(), q2.data(), product.data(), k_Count);
+    BatchMath::ConjugateQuaternions(q1.data(), conjugate.data(), k_Count);
+    BatchMath::NormalizeQuaternions(q1.data(), unit.data(), k_Count);
+    BatchMath::RotateVectors(q1.data(), v.data(), rotated.data(), k_Count);
+
+    std::vector<float> expProduct(k_Count * 4);
+    std::vector<float> expConjugate(k_Count * 4);
+    std::vector<float> expUnit(k_Count * 4);
+    std::vector<float> expRotated(k_Count * 3);
+    for(size_t i = 0; i < k_Count; i++)
+    {
+      QuatF a = QuaternionMathF::New(q1[i * 4], q1[i * 4 + 1], q1[i * 4 + 2], q1[i * 4 + 3]);
+      QuatF b = QuaternionMathF::New(q2[i * 4], q2[i * 4 + 1], q2[i * 4 + 2], q2[i * 4 + 3]);
+      QuatF c;
+      QuaternionMathF::Multiply(a, b, c);
+      expProduct[i * 4] = c.x, expProduct[i * 4 + 1] = c.y, expProduct[i * 4 + 2] = c.z, expProduct[i * 4 + 3] = c.w;
+      QuaternionMathF::Conjugate(a, c);
+      expConjugate[i * 4] = c.x, expConjugate[i * 4 + 1] = c.y, expConjugate[i * 4 + 2] = c.z, expConjugate[i * 4 + 3] = c.w;
+      QuaternionMathF::MultiplyQuatVec(a, v.data() + i * 3, expRotated.data() + i * 3);
+      if(QuaternionMathF::Norm(a) > 0.0f)
+      {
+        QuaternionMathF::UnitQuaternion(a);
+      }
+      expUnit[i * 4] = a.x, expUnit[i * 4 + 1] = a.y, expUnit[i * 4 + 2] = a.z, expUnit[i * 4 + 3] = a.w;
+    }
+
+    RequireClose(product, expProduct, 1.0e-5f);
+    RequireClose(conjugate, expConjugate, 0.0f);
+    RequireClose(unit, expUnit, 1.0e-5f);
+    RequireClose(rotated, expRotated, 1.0e-5f);
+    DREAM3D_REQUIRE_EQUAL(unit[8], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(unit[11], 0.0f)
+
+    // In place operation
+    BatchMath::MultiplyQuaternions(q1.data(), q2.data(), q1.data(), k_Count);
+    RequireClose(q1, expProduct, 1.0e-5f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMatrices()
+  {
+    std::vector<float> g1 = RandomValues(k_Count * 9, 3);
+    std::vector<float> g2 = RandomValues(k_Count * 9, 4);
+    std::vector<float> v = RandomValues(k_Count * 3, 5);
+    v[3] = v[4] = v[5] = 0.0f;
+
+    std::vector<float> product(k_Count * 9);
+    std::vector<float> matVec(k_Count * 3);
+    std::vector<float> inverse(k_Count * 9);
+    std::vector<float> unit(k_Count * 3);
+    BatchMath::Multiply3x3with3x3(g1.data(), g2.data(), product.data(), k_Count);
+    BatchMath::Multiply3x3with3x1(g1.data(), v.data(), matVec.data(), k_Count);
+    BatchMath::Invert3x3(g1.data(), inverse.data(), k_Count);
+    BatchMath::Normalize3x1(v.data(), unit.data(), k_Count);
+
+    for(size_t i = 0; i < k_Count; i++)
+    {
+      float a[3][3];
+      float b[3][3];
+      float c[3][3];
+      float x[3];
+      float y[3];
+      for(size_t k = 0; k < 9; k++)
+      {
+        a[k / 3][k % 3] = g1[i * 9 + k];
+        b[k / 3][k % 3] = g2[i * 9 + k];
+      }
+      MatrixMath::Multiply3x3with3x3(a, b, c);
+      for(size_t k = 0; k < 9; k++)
+      {
+        DREAM3D_REQUIRE(std::abs(product[i * 9 + k] - c[k / 3][k % 3]) < 1.0e-5f)
+      }
+
+      MatrixMath::Copy3x1(v.data() + i * 3, x);
+      MatrixMath::Multiply3x3with3x1(a, x, y);
+      for(size_t k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE(std::abs(matVec[i * 3 + k] - y[k]) < 1.0e-5f)
+      }
+
+      MatrixMath::Normalize3x1(x);
+      for(size_t k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE(std::abs(unit[i * 3 + k] - x[k]) < 1.0e-6f)
+      }
+
+      // Compare the inverse through the identity instead of element wise since nearly singular
+      // random matrices amplify the round off differences
+      float inv[3][3];
+      for(size_t k = 0; k < 9; k++)
+      {
+        inv[k / 3][k % 3] = inverse[i * 9 + k];
+      }
+      if(std::abs(MatrixMath::Determinant3x3(a)) > 0.05f)
+      {
+        MatrixMath::Multiply3x3with3x3(a, inv, c);
+        for(size_t k = 0; k < 9; k++)
+        {
+          float expected = (k % 4 == 0) ? 1.0f : 0.0f;
+          DREAM3D_REQUIRE(std::abs(c[k / 3][k % 3] - expected) < 1.0e-3f)
+        }
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(unit[3], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(unit[5], 0.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataArrays()
+  {
+    FloatArrayType::Pointer quats = FloatArrayType::CreateArray(100, std::vector<size_t>(1, 4), "Quats", true);
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(100, std::vector<size_t>(1, 3), "Vectors", true);
+    FloatArrayType::Pointer rotated = FloatArrayType::CreateArray(0, std::vector<size_t>(1, 3), "Rotated", true);
+    FloatArrayType::Pointer wrongCount = FloatArrayType::CreateArray(99, std::vector<size_t>(1, 3), "WrongCount", true);
+    for(size_t i = 0; i < 100; i++)
+    {
+      // 90 degree rotation about the z axis
+      quats->setComponent(i, 0, 0.0f);
+      quats->setComponent(i, 1, 0.0f);
+      quats->setComponent(i, 2, std::sqrt(0.5f));
+      quats->setComponent(i, 3, std::sqrt(0.5f));
+      vectors->setComponent(i, 0, 1.0f);
+      vectors->setComponent(i, 1, 0.0f);
+      vectors->setComponent(i, 2, 0.0f);
+    }
+
+    DREAM3D_REQUIRE_EQUAL(BatchMath::RotateVectors(quats.get(), vectors.get(), rotated.get()), true)
+    DREAM3D_REQUIRE_EQUAL(rotated->getNumberOfTuples(), 100)
+    for(size_t i = 0; i < 100; i++)
+    {
+      DREAM3D_REQUIRE(std::abs(rotated->getComponent(i, 0)) < 1.0e-6f)
+      DREAM3D_REQUIRE(std::abs(rotated->getComponent(i, 1) + 1.0f) < 1.0e-6f)
+      DREAM3D_REQUIRE(std::abs(rotated->getComponent(i, 2)) < 1.0e-6f)
+    }
+
+    DREAM3D_REQUIRE_EQUAL(BatchMath::RotateVectors(quats.get(), wrongCount.get(), rotated.get()), false)
+    DREAM3D_REQUIRE_EQUAL(BatchMath::RotateVectors(vectors.get(), vectors.get(), rotated.get()), false)
+    DREAM3D_REQUIRE_EQUAL(BatchMath::Invert3x3(quats.get(), quats.get()), false)
+    DREAM3D_REQUIRE_EQUAL(BatchMath::NormalizeQuaternions(nullptr, quats.get()), false)
+
+    // In place conjugate
+    DREAM3D_REQUIRE_EQUAL(BatchMath::ConjugateQuaternions(quats.get(), quats.get()), true)
+    DREAM3D_REQUIRE_EQUAL(quats->getComponent(7, 2), -std::sqrt(0.5f))
+    DREAM3D_REQUIRE_EQUAL(quats->getComponent(7, 3), std::sqrt(0.5f))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### BatchMathTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestQuaternions())
+    DREAM3D_REGISTER_TEST(TestMatrices())
+    DREAM3D_REGISTER_TEST(TestDataArrays())
+  }
+
+private:
+  BatchMathTest(const BatchMathTest&); // Copy Constructor Not Implemented
+  void operator=(const BatchMathTest&); // Move assignment Not Implemented
+};
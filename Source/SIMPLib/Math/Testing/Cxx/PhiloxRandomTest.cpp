@@ -0,0 +1,168 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Math/PhiloxRandom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PhiloxRandomTest
+{
+public:
+  PhiloxRandomTest() = default;
+  virtual ~PhiloxRandomTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Known answer tests of the Random123 reference implementation of Philox4x32-10
+  // -----------------------------------------------------------------------------
+  void TestKnownAnswers()
+  {
+    uint32_t output[4] = {0, 0, 0, 0};
+    PhiloxRandom::Block(0, 0, 0, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0x6627e8d5u)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0xe169c58du)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0xbc57ac4cu)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x9b00dbd8u)
+
+    PhiloxRandom::Block(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0x408f276du)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0x41c83b0eu)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0xa20bc7c6u)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x6d5451fdu)
+
+    PhiloxRandom::Block(0x299f31d0a4093822ull, 0x0370734413198a2eull, 0x85a308d3243f6a88ull, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0xd16cfe09u)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0x94fdccebu)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0x5001e420u)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x24126ea1u)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStreams()
+  {
+    const uint64_t seed = 12345;
+
+    // The sequential generator walks through the blocks of its stream in order
+    PhiloxRandom generator(seed, 7);
+    uint32_t output[4] = {0, 0, 0, 0};
+    for(uint64_t block = 0; block < 8; block++)
+    {
+      PhiloxRandom::Block(seed, 7, block, output);
+      for(int i = 0; i < 4; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(generator(), output[i])
+      }
+    }
+
+    // Seeking gives the same values as generating the skipped blocks
+    std::vector<double> values;
+    generator.seek(3);
+    for(int i = 0; i < 10; i++)
+    {
+      values.push_back(generator.nextDouble());
+    }
+    generator.setStream(7);
+    for(int i = 0; i < 6; i++)
+    {
+      generator.nextDouble();
+    }
+    for(int i = 0; i < 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(generator.nextDouble(), values[i])
+    }
+    DREAM3D_REQUIRE_EQUAL(PhiloxRandom::UniformDouble(seed, 7, 3), values[0])
+
+    // Neighboring streams and seeds are unrelated
+    size_t equal = 0;
+    for(uint64_t block = 0; block < 1000; block++)
+    {
+      equal += PhiloxRandom::UniformDouble(seed, 0, block) == PhiloxRandom::UniformDouble(seed, 1, block) ? 1 : 0;
+      equal += PhiloxRandom::UniformDouble(seed, 0, block) == PhiloxRandom::UniformDouble(seed + 1, 0, block) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(equal, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUniform()
+  {
+    DREAM3D_REQUIRE_EQUAL(PhiloxRandom::ToDouble(0), 0.0)
+    DREAM3D_REQUIRE(PhiloxRandom::ToDouble(0xFFFFFFFFFFFFFFFFull) < 1.0)
+    DREAM3D_REQUIRE_EQUAL(PhiloxRandom::ToFloat(0), 0.0f)
+    DREAM3D_REQUIRE(PhiloxRandom::ToFloat(0xFFFFFFFFu) < 1.0f)
+
+    // Mean and histogram of one million values
+    PhiloxRandom generator(2018);
+    const size_t count = 1000000;
+    std::vector<size_t> histogram(10, 0);
+    double sum = 0.0;
+    for(size_t i = 0; i < count; i++)
+    {
+      double value = generator.nextDouble();
+      DREAM3D_REQUIRE(value >= 0.0 && value < 1.0)
+      sum += value;
+      histogram[static_cast<size_t>(value * 10.0)]++;
+    }
+    DREAM3D_REQUIRE(std::abs(sum / count - 0.5) < 0.002)
+    for(size_t bin : histogram)
+    {
+      DREAM3D_REQUIRE(bin > 99000 && bin < 101000)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### PhiloxRandomTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestKnownAnswers())
+    DREAM3D_REGISTER_TEST(TestStreams())
+    DREAM3D_REGISTER_TEST(TestUniform())
+  }
+
+private:
+  PhiloxRandomTest(const PhiloxRandomTest&); // Copy Constructor Not Implemented
+  void operator=(const PhiloxRandomTest&);   // Move assignment Not Implemented
+};
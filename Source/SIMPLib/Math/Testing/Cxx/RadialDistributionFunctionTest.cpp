@@ -0,0 +1,166 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Math/RadialDistributionFunction.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RadialDistributionFunctionTest
+{
+public:
+  RadialDistributionFunctionTest() = default;
+  virtual ~RadialDistributionFunctionTest() = default;
+
+  const float k_MinDistance = 2.0f;
+  const float k_MaxDistance = 12.0f;
+  const int k_NumBins = 20;
+
+  // -----------------------------------------------------------------------------
+  // Random points in a 40 x 30 x 20 box
+  // -----------------------------------------------------------------------------
+  std::vector<float> CreatePoints(size_t numPoints)
+  {
+    std::vector<float> points(3 * numPoints);
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      points[3 * i] = 40.0f * distribution(generator);
+      points[3 * i + 1] = 30.0f * distribution(generator);
+      points[3 * i + 2] = 20.0f * distribution(generator);
+    }
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGenerateDistribution()
+  {
+    const size_t numPoints = 1500;
+    std::vector<float> points = CreatePoints(numPoints);
+    float maxBoxDistance = std::sqrt(40.0f * 40.0f + 30.0f * 30.0f + 20.0f * 20.0f);
+    float stepsize = (k_MaxDistance - k_MinDistance) / k_NumBins;
+    size_t numFreqs = static_cast<size_t>(std::ceil((maxBoxDistance - k_MinDistance) / stepsize)) + 1;
+
+    // Brute force histogram over all pairs
+    std::vector<double> expected(numFreqs, 0.0);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      for(size_t j = i + 1; j < numPoints; j++)
+      {
+        float dx = points[3 * i] - points[3 * j];
+        float dy = points[3 * i + 1] - points[3 * j + 1];
+        float dz = points[3 * i + 2] - points[3 * j + 2];
+        float r = sqrtf(dx * dx + dy * dy + dz * dz);
+        size_t bin = r < k_MinDistance ? 0 : static_cast<size_t>((r - k_MinDistance) / stepsize) + 1;
+        expected[std::min(bin, numFreqs - 1)] += 1.0;
+      }
+    }
+    double numPairs = 0.5 * numPoints * (numPoints - 1);
+
+    std::vector<float> freq = RadialDistributionFunction::GenerateDistribution(points, k_MinDistance, k_MaxDistance, k_NumBins, maxBoxDistance);
+    DREAM3D_REQUIRE_EQUAL(freq.size(), numFreqs)
+    for(size_t i = 0; i < numFreqs; i++)
+    {
+      DREAM3D_REQUIRE(std::abs(freq[i] - static_cast<float>(expected[i] / numPairs)) < 1.0e-7f)
+    }
+    double sum = std::accumulate(freq.begin(), freq.end(), 0.0);
+    DREAM3D_REQUIRE(std::abs(sum - 1.0) < 1.0e-5)
+
+    // The cell list only visits the pairs within the maximum distance; the bins up to it must match exactly
+    std::vector<float> cellFreq = RadialDistributionFunction::GenerateDistribution(points, k_MinDistance, k_MaxDistance, k_NumBins, maxBoxDistance, true);
+    DREAM3D_REQUIRE_EQUAL(cellFreq.size(), numFreqs)
+    for(size_t i = 0; i < numFreqs; i++)
+    {
+      if(i < static_cast<size_t>(k_NumBins))
+      {
+        DREAM3D_REQUIRE_EQUAL(cellFreq[i], freq[i])
+      }
+      else if(i > static_cast<size_t>(k_NumBins))
+      {
+        DREAM3D_REQUIRE_EQUAL(cellFreq[i], 0.0f)
+      }
+    }
+
+    std::vector<float> invalid = RadialDistributionFunction::GenerateDistribution(points, k_MaxDistance, k_MinDistance, k_NumBins, maxBoxDistance);
+    DREAM3D_REQUIRE_EQUAL(invalid.size(), static_cast<size_t>(k_NumBins))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGenerateRandomDistribution()
+  {
+    std::vector<float> boxDims(3, 50.0f);
+    std::vector<float> boxRes(3, 0.5f);
+    float maxBoxDistance = std::sqrt(3.0f * 50.0f * 50.0f);
+    float stepsize = (k_MaxDistance - k_MinDistance) / k_NumBins;
+    size_t numFreqs = static_cast<size_t>(std::ceil((maxBoxDistance - k_MinDistance) / stepsize)) + 1;
+
+    std::vector<float> freq = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, boxDims, boxRes, 4000);
+    DREAM3D_REQUIRE_EQUAL(freq.size(), numFreqs)
+    double sum = std::accumulate(freq.begin(), freq.end(), 0.0);
+    DREAM3D_REQUIRE(std::abs(sum - 1.0) < 1.0e-5)
+
+    std::vector<float> cellFreq = RadialDistributionFunction::GenerateRandomDistribution(k_MinDistance, k_MaxDistance, k_NumBins, boxDims, boxRes, 20000, true);
+    DREAM3D_REQUIRE_EQUAL(cellFreq.size(), numFreqs)
+    DREAM3D_REQUIRE_EQUAL(cellFreq.back(), 0.0f)
+    // For uniformly placed points the fraction of pairs grows with the area of the sphere around a point
+    DREAM3D_REQUIRE(cellFreq[k_NumBins - 1] > cellFreq[1])
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### RadialDistributionFunctionTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestGenerateDistribution())
+    DREAM3D_REGISTER_TEST(TestGenerateRandomDistribution())
+  }
+
+private:
+  RadialDistributionFunctionTest(const RadialDistributionFunctionTest&); // Copy Constructor Not Implemented
+  void operator=(const RadialDistributionFunctionTest&);                 // Move assignment Not Implemented
+};
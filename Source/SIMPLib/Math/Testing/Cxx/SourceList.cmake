@@ -1,7 +1,10 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BatchMathTest
   MatrixMathTest
+  PhiloxRandomTest
   QuaternionMathTest
+  RadialDistributionFunctionTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
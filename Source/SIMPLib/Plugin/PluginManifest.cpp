@@ -0,0 +1,233 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PluginManifest.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::PluginManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::~PluginManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PluginManifest::DefaultFilePath()
+{
+  QByteArray envPath = qgetenv("SIMPL_PLUGIN_MANIFEST");
+  if(!envPath.isEmpty())
+  {
+    return QString::fromLocal8Bit(envPath);
+  }
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/SIMPLPluginManifest.json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::PluginEntry PluginManifest::CreateEntry(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  PluginEntry entry;
+  entry.filePath = fi.absoluteFilePath();
+  entry.lastModified = fi.lastModified().toMSecsSinceEpoch();
+  entry.fileSize = fi.size();
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PluginManifest::readFile(const QString& filePath)
+{
+  QFile inputFile(filePath);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    return -1;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(inputFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError)
+  {
+    return -2;
+  }
+  return readJson(doc.object());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PluginManifest::writeFile(const QString& filePath) const
+{
+  QFileInfo fi(filePath);
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    return -1;
+  }
+
+  QJsonObject json;
+  writeJson(json);
+
+  // Several processes may start at the same time, so the file is replaced atomically
+  QSaveFile outputFile(filePath);
+  if(!outputFile.open(QIODevice::WriteOnly))
+  {
+    return -2;
+  }
+  outputFile.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+  return outputFile.commit() ? 0 : -3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PluginManifest::readJson(const QJsonObject& json)
+{
+  m_Entries.clear();
+  if(json[SIMPL::Settings::PluginManifestVersion].toString() != SIMPLib::Version::Complete())
+  {
+    return -3;
+  }
+
+  QJsonArray plugins = json[SIMPL::Settings::PluginManifestPlugins].toArray();
+  for(int i = 0; i < plugins.size(); i++)
+  {
+    QJsonObject pluginObj = plugins[i].toObject();
+    PluginEntry entry;
+    entry.filePath = pluginObj[SIMPL::Settings::PluginManifestFilePath].toString();
+    entry.lastModified = static_cast<qint64>(pluginObj[SIMPL::Settings::PluginManifestLastModified].toDouble());
+    entry.fileSize = static_cast<qint64>(pluginObj[SIMPL::Settings::PluginManifestFileSize].toDouble());
+
+    QJsonArray filters = pluginObj[SIMPL::Settings::PluginManifestFilters].toArray();
+    for(int f = 0; f < filters.size(); f++)
+    {
+      QJsonObject filterObj = filters[f].toObject();
+      FilterEntry filter;
+      filter.className = filterObj[SIMPL::Settings::PluginManifestClassName].toString();
+      filter.uuid = QUuid(filterObj[SIMPL::Settings::PluginManifestUuid].toString());
+      filter.humanLabel = filterObj[SIMPL::Settings::PluginManifestHumanLabel].toString();
+      entry.filters.push_back(filter);
+    }
+
+    if(!entry.filePath.isEmpty())
+    {
+      m_Entries[entry.filePath] = entry;
+    }
+  }
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginManifest::writeJson(QJsonObject& json) const
+{
+  QJsonArray plugins;
+  for(const PluginEntry& entry : m_Entries)
+  {
+    QJsonArray filters;
+    for(const FilterEntry& filter : entry.filters)
+    {
+      QJsonObject filterObj;
+      filterObj[SIMPL::Settings::PluginManifestClassName] = filter.className;
+      filterObj[SIMPL::Settings::PluginManifestUuid] = filter.uuid.toString();
+      filterObj[SIMPL::Settings::PluginManifestHumanLabel] = filter.humanLabel;
+      filters.append(filterObj);
+    }
+
+    QJsonObject pluginObj;
+    pluginObj[SIMPL::Settings::PluginManifestFilePath] = entry.filePath;
+    pluginObj[SIMPL::Settings::PluginManifestLastModified] = static_cast<double>(entry.lastModified);
+    pluginObj[SIMPL::Settings::PluginManifestFileSize] = static_cast<double>(entry.fileSize);
+    pluginObj[SIMPL::Settings::PluginManifestFilters] = filters;
+    plugins.append(pluginObj);
+  }
+
+  json[SIMPL::Settings::PluginManifestVersion] = SIMPLib::Version::Complete();
+  json[SIMPL::Settings::PluginManifestPlugins] = plugins;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifest::isCurrent(const QString& filePath) const
+{
+  PluginEntry current = CreateEntry(filePath);
+  QMap<QString, PluginEntry>::const_iterator iter = m_Entries.find(current.filePath);
+  if(iter == m_Entries.end())
+  {
+    return false;
+  }
+  return iter->lastModified == current.lastModified && iter->fileSize == current.fileSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::PluginEntry PluginManifest::getEntry(const QString& filePath) const
+{
+  return m_Entries.value(QFileInfo(filePath).absoluteFilePath());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginManifest::setEntry(const PluginEntry& entry)
+{
+  m_Entries[entry.filePath] = entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PluginManifest::size() const
+{
+  return m_Entries.size();
+}
@@ -0,0 +1,158 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PluginManifest class is a persistent cache of the filters that each plugin file
+ * registers. A plugin whose file has not changed since its entry was written does not need to be
+ * loaded just to learn which filters it provides, which lets the SIMPLibPluginLoader defer loading
+ * it until one of those filters is actually requested.
+ */
+class SIMPLib_EXPORT PluginManifest
+{
+public:
+  SIMPL_SHARED_POINTERS(PluginManifest)
+  SIMPL_TYPE_MACRO(PluginManifest)
+  SIMPL_STATIC_NEW_MACRO(PluginManifest)
+
+  virtual ~PluginManifest();
+
+  /**
+   * @brief The FilterEntry struct identifies one filter of a plugin
+   */
+  struct FilterEntry
+  {
+    QString className;
+    QUuid uuid;
+    QString humanLabel;
+  };
+
+  /**
+   * @brief The PluginEntry struct describes a plugin file and the filters it registers
+   */
+  struct PluginEntry
+  {
+    QString filePath;
+    qint64 lastModified = 0;
+    qint64 fileSize = 0;
+    QVector<FilterEntry> filters;
+  };
+
+  /**
+   * @brief Returns the location of the manifest file. The SIMPL_PLUGIN_MANIFEST environment variable
+   * overrides the default location in the user's cache directory.
+   * @return
+   */
+  static QString DefaultFilePath();
+
+  /**
+   * @brief Creates an entry for the plugin file with the current size and modification time of the file
+   * but without any filters
+   * @param filePath
+   * @return
+   */
+  static PluginEntry CreateEntry(const QString& filePath);
+
+  /**
+   * @brief Reads the manifest from a file. Entries written by a different version of SIMPLib are discarded.
+   * @param filePath
+   * @return Negative value on error
+   */
+  int readFile(const QString& filePath);
+
+  /**
+   * @brief Writes the manifest to a file
+   * @param filePath
+   * @return Negative value on error
+   */
+  int writeFile(const QString& filePath) const;
+
+  /**
+   * @brief Reads the manifest from a JSON object
+   * @param json
+   * @return Negative value on error
+   */
+  int readJson(const QJsonObject& json);
+
+  /**
+   * @brief Writes the manifest to a JSON object
+   * @param json
+   */
+  void writeJson(QJsonObject& json) const;
+
+  /**
+   * @brief Returns true if the manifest has an entry for the plugin file and the file has not
+   * changed since the entry was written
+   * @param filePath
+   * @return
+   */
+  bool isCurrent(const QString& filePath) const;
+
+  /**
+   * @brief Returns the entry for a plugin file. The entry is empty if the file is not in the manifest.
+   * @param filePath
+   * @return
+   */
+  PluginEntry getEntry(const QString& filePath) const;
+
+  /**
+   * @brief Adds or replaces the entry for a plugin file
+   * @param entry
+   */
+  void setEntry(const PluginEntry& entry);
+
+  /**
+   * @brief Returns the number of plugin entries
+   * @return
+   */
+  int size() const;
+
+protected:
+  PluginManifest();
+
+private:
+  QMap<QString, PluginEntry> m_Entries;
+
+  PluginManifest(const PluginManifest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PluginManifest&) = delete; // Move assignment Not Implemented
+};
@@ -42,7 +42,9 @@
 // Qt Includes
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QFileInfo>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QSet>
 #include <QtCore/QStringList>
 #include <QtCore/QtDebug>
 
@@ -63,7 +65,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+QStringList SIMPLibPluginLoader::FindPluginFilePaths(bool quiet)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -180,45 +182,109 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
     }
   }
 
+  return pluginFilePaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLibPluginLoader::LoadPlugin(const QString& pluginPath, FilterManager* filterManager, PluginManifest::PluginEntry* entry, bool quiet)
+{
+  if(!quiet) qDebug() << "Plugin Being Loaded:" << pluginPath;
+  QPluginLoader loader(pluginPath);
+  QObject* plugin = loader.instance();
+  if(!quiet) qDebug() << "    Pointer: " << plugin << "\n";
+  if(nullptr == plugin)
+  {
+    if(!quiet)
+    {
+      QString message("The plugin did not load with the following error\n");
+      message.append(loader.errorString());
+      message.append("\n\n");
+      message.append("Possible causes include missing libraries that plugin depends on.");
+      qDebug() << message;
+    }
+    return false;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin)
+  {
+    QList<QString> registeredNames = filterManager->getLoadedFactoryNames();
+    ipPlugin->registerFilters(filterManager);
+    ipPlugin->setDidLoad(true);
+    ipPlugin->setLocation(pluginPath);
+    PluginManager::Instance()->addPlugin(ipPlugin);
+
+    if(nullptr != entry)
+    {
+      *entry = PluginManifest::CreateEntry(pluginPath);
+      for(const QString& name : filterManager->getLoadedFactoryNames())
+      {
+        if(registeredNames.contains(name))
+        {
+          continue;
+        }
+        IFilterFactory::Pointer factory = filterManager->getFactoryFromClassName(name);
+        PluginManifest::FilterEntry filter;
+        filter.className = name;
+        filter.uuid = factory->getUuid();
+        filter.humanLabel = factory->getFilterHumanLabel();
+        entry->filters.push_back(filter);
+      }
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet, bool lazy)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
   filterManager->RegisterKnownFilters(filterManager);
 
-  PluginManager* pluginManager = PluginManager::Instance();
-  QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
+  PluginManifest::Pointer manifest = PluginManifest::New();
+  QString manifestPath = PluginManifest::DefaultFilePath();
+  manifest->readFile(manifestPath);
+  bool manifestChanged = false;
+  QSet<QString> pluginFileNames;
 
   // Now that we have a sorted list of plugins, go ahead and load them all from the
   // file system and add each to the toolbar and menu
   foreach(QString path, pluginFilePaths)
   {
-    if(!quiet) qDebug() << "Plugin Being Loaded:" << path;
-    QPluginLoader loader(path);
-    QFileInfo fi(path);
-    QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet) qDebug() << "    Pointer: " << plugin << "\n";
-    if(plugin && pluginFileNames.contains(fileName, Qt::CaseSensitive) == false)
+    QString fileName = QFileInfo(path).fileName();
+    if(pluginFileNames.contains(fileName))
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin)
-      {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
-      }
-      pluginFileNames += fileName;
+      continue;
+    }
+
+    bool current = manifest->isCurrent(path);
+    if(lazy && current)
+    {
+      if(!quiet) qDebug() << "Plugin Being Deferred:" << path;
+      filterManager->addDeferredPlugin(manifest->getEntry(path));
+      pluginFileNames.insert(fileName);
+      continue;
     }
-    else
+
+    PluginManifest::PluginEntry entry;
+    if(LoadPlugin(path, filterManager, &entry, quiet))
     {
-      if(!quiet) 
+      pluginFileNames.insert(fileName);
+      if(!current)
       {
-        QString message("The plugin did not load with the following error\n");
-        message.append(loader.errorString());
-        message.append("\n\n");
-        message.append("Possible causes include missing libraries that plugin depends on.");
-        qDebug() << message;
+        manifest->setEntry(entry);
+        manifestChanged = true;
       }
     }
   }
+
+  if(manifestChanged && manifest->writeFile(manifestPath) < 0)
+  {
+    if(!quiet) qDebug() << "The plugin manifest could not be written to" << manifestPath;
+  }
 }
@@ -37,6 +37,9 @@
 
 
 
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Plugin/PluginManifest.h"
 #include "SIMPLib/SIMPLib.h"
 
 class FilterManager;
@@ -58,8 +61,28 @@ class SIMPLib_EXPORT SIMPLibPluginLoader
      * @param filterManager The FilterManager object to load the filters into when
      * a plugin is loaded
      * @param quiet Dump progress to std::cout
+     * @param lazy When true, plugins that are up to date in the PluginManifest are not loaded;
+     * their filters are registered with the FilterManager as deferred filters instead and the
+     * plugin is loaded the first time one of them is requested.
+     */
+    static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false, bool lazy = false);
+
+    /**
+     * @brief FindPluginFilePaths Returns the paths of all the plugin files in the plugin directories
+     * @param quiet Dump progress to std::cout
+     * @return
+     */
+    static QStringList FindPluginFilePaths(bool quiet = false);
+
+    /**
+     * @brief LoadPlugin Loads a single plugin file and registers its filters
+     * @param pluginPath Path to the plugin file
+     * @param filterManager The FilterManager object to load the filters into
+     * @param entry If not null, receives the manifest entry that describes the plugin's filters
+     * @param quiet Dump progress to std::cout
+     * @return True if the plugin was loaded
      */
-    static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
+    static bool LoadPlugin(const QString& pluginPath, FilterManager* filterManager, PluginManifest::PluginEntry* entry = nullptr, bool quiet = false);
 
 
   protected:
@@ -0,0 +1,165 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Plugin/PluginManifest.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PluginManifestTest
+{
+public:
+  PluginManifestTest() = default;
+  virtual ~PluginManifestTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString manifestFile()
+  {
+    return UnitTest::TestTempDir + QString("/PluginManifestTest.json");
+  }
+  QString fakePluginFile()
+  {
+    return UnitTest::TestTempDir + QString("/PluginManifestTest_Fake.plugin");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(manifestFile());
+    QFile::remove(fakePluginFile());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  PluginManifest::PluginEntry CreateFakePluginEntry()
+  {
+    QFile pluginFile(fakePluginFile());
+    pluginFile.open(QIODevice::WriteOnly);
+    pluginFile.write("Not a real plugin");
+    pluginFile.close();
+
+    PluginManifest::PluginEntry entry = PluginManifest::CreateEntry(fakePluginFile());
+    PluginManifest::FilterEntry filter;
+    filter.className = "PluginManifestTestFilter";
+    filter.uuid = QUuid("{4ba07cf2-3b2f-56b5-9a2e-7c4c1e8f4e59}");
+    filter.humanLabel = "Plugin Manifest Test Filter";
+    entry.filters.push_back(filter);
+    return entry;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestManifestReadWrite()
+  {
+    PluginManifest::Pointer manifest = PluginManifest::New();
+    manifest->setEntry(CreateFakePluginEntry());
+    DREAM3D_REQUIRE(manifest->isCurrent(fakePluginFile()))
+    DREAM3D_REQUIRE_EQUAL(manifest->writeFile(manifestFile()), 0)
+
+    PluginManifest::Pointer readManifest = PluginManifest::New();
+    DREAM3D_REQUIRE_EQUAL(readManifest->readFile(manifestFile()), 1)
+    DREAM3D_REQUIRE(readManifest->isCurrent(fakePluginFile()))
+
+    PluginManifest::PluginEntry entry = readManifest->getEntry(fakePluginFile());
+    DREAM3D_REQUIRE_EQUAL(entry.filters.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(entry.filters[0].className, QString("PluginManifestTestFilter"))
+    DREAM3D_REQUIRE(entry.filters[0].uuid == QUuid("{4ba07cf2-3b2f-56b5-9a2e-7c4c1e8f4e59}"))
+    DREAM3D_REQUIRE_EQUAL(entry.filters[0].humanLabel, QString("Plugin Manifest Test Filter"))
+
+    // A changed plugin file invalidates its entry
+    QFile pluginFile(fakePluginFile());
+    pluginFile.open(QIODevice::Append);
+    pluginFile.write(" that changed size");
+    pluginFile.close();
+    DREAM3D_REQUIRE(!readManifest->isCurrent(fakePluginFile()))
+
+    // A manifest written by another version of SIMPLib is discarded
+    QJsonObject json;
+    manifest->writeJson(json);
+    json[SIMPL::Settings::PluginManifestVersion] = QString("0.0.0");
+    DREAM3D_REQUIRE(readManifest->readJson(json) < 0)
+    DREAM3D_REQUIRE_EQUAL(readManifest->size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFilterManagerLookups()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName(CreateDataContainer::ClassName());
+    DREAM3D_REQUIRE_VALID_POINTER(factory.get())
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(factory->getUuid()) == factory)
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(factory->getFilterHumanLabel()) == factory)
+
+    // Looking up a deferred filter loads its plugin, which fails for the fake plugin file
+    fm->addDeferredPlugin(CreateFakePluginEntry());
+    DREAM3D_REQUIRE_EQUAL(fm->getDeferredPluginCount(), 1)
+    DREAM3D_REQUIRE(fm->getFactoryFromHumanName(factory->getFilterHumanLabel()) == factory)
+    DREAM3D_REQUIRE_EQUAL(fm->getDeferredPluginCount(), 1)
+    DREAM3D_REQUIRE(nullptr == fm->getFactoryFromClassName("PluginManifestTestFilter").get())
+    DREAM3D_REQUIRE_EQUAL(fm->getDeferredPluginCount(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PluginManifestTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestManifestReadWrite());
+    DREAM3D_REGISTER_TEST(TestFilterManagerLookups());
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  PluginManifestTest(const PluginManifestTest&); // Copy Constructor Not Implemented
+  void operator=(const PluginManifestTest&);     // Move assignment Not Implemented
+};
@@ -0,0 +1,878 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/combinable.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+/**
+ * @brief The ArrayStatistics class computes sums, extrema, moments, histograms and quantiles directly
+ * on the buffer of a DataArray. Every function comes in two flavors: one that takes a raw buffer of
+ * numTuples x numComponents values and one that takes the DataArray itself.
+ *
+ * @li All components of each tuple are reduced unless a single component is selected.
+ * @li An optional mask with one value per tuple restricts the reduction to the tuples whose mask value is true.
+ * @li NaN values of floating point arrays are skipped.
+ *
+ * The buffer is split into fixed chunks that are reduced in parallel through the ParallelExecutionContext.
+ * The partial results of the chunks are always combined in the same order, so the results do not depend
+ * on the number of threads. Sums are accumulated in double precision with pairwise summation inside of a
+ * chunk and Kahan summation across the chunks; the variance uses a two pass algorithm per chunk and the
+ * pairwise update of Chan et al. to merge the chunks.
+ */
+class ArrayStatistics
+{
+public:
+  /**
+   * @brief The smallest and largest value and where they were found. The indices are element indices
+   * (tuple * numComponents + component) of the first occurrence. Count is the number of values that were
+   * considered; if it is 0 the other members are not valid.
+   */
+  template <typename T> struct MinMax
+  {
+    T min = T(0);
+    T max = T(0);
+    size_t minIndex = 0;
+    size_t maxIndex = 0;
+    size_t count = 0;
+  };
+
+  /**
+   * @brief Count, mean and sum of squared deviations from the mean of a set of values
+   */
+  struct Moments
+  {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    /**
+     * @brief Returns the population variance
+     * @return
+     */
+    double getVariance() const
+    {
+      return count > 0 ? m2 / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Returns the sample variance (divided by count - 1)
+     * @return
+     */
+    double getSampleVariance() const
+    {
+      return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+    }
+
+    /**
+     * @brief Returns the population standard deviation
+     * @return
+     */
+    double getStandardDeviation() const
+    {
+      return std::sqrt(getVariance());
+    }
+
+    /**
+     * @brief Combines the moments of another, disjoint set of values into these moments
+     * @param other
+     */
+    void merge(const Moments& other)
+    {
+      if(other.count == 0)
+      {
+        return;
+      }
+      if(count == 0)
+      {
+        *this = other;
+        return;
+      }
+      double n1 = static_cast<double>(count);
+      double n2 = static_cast<double>(other.count);
+      double delta = other.mean - mean;
+      count += other.count;
+      mean += delta * n2 / static_cast<double>(count);
+      m2 += other.m2 + delta * delta * n1 * n2 / static_cast<double>(count);
+    }
+  };
+
+  virtual ~ArrayStatistics() = default;
+
+  /**
+   * @brief Returns the sum of the values
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return
+   */
+  template <typename T> static double Sum(const T* data, size_t numTuples, int numComponents = 1, const bool* mask = nullptr, int component = -1)
+  {
+    Selection<T> sel(data, numTuples, numComponents, mask, component);
+    std::vector<double> partials(sel.numChunks(), 0.0);
+    ForEachChunk(sel, [&sel, &partials](size_t chunk, size_t begin, size_t end) {
+      if(sel.isContiguous())
+      {
+        partials[chunk] = PairwiseSumRange(sel.data + begin * sel.numComponents, (end - begin) * sel.numComponents, Identity());
+        return;
+      }
+      PairwiseSum sum;
+      sel.forEachValue(begin, end, [&sum](size_t, double value) { sum.add(value); });
+      partials[chunk] = sum.getSum();
+    });
+    return KahanSum(partials);
+  }
+
+  /**
+   * @brief Returns the smallest and largest value and their first positions
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return
+   */
+  template <typename T> static MinMax<T> FindMinMax(const T* data, size_t numTuples, int numComponents = 1, const bool* mask = nullptr, int component = -1)
+  {
+    Selection<T> sel(data, numTuples, numComponents, mask, component);
+    std::vector<MinMax<T>> partials(sel.numChunks());
+    ForEachChunk(sel, [&sel, &partials](size_t chunk, size_t begin, size_t end) {
+      if(sel.isContiguous())
+      {
+        partials[chunk] = FindMinMaxRange(sel.data, begin * sel.numComponents, end * sel.numComponents);
+        return;
+      }
+      MinMax<T> result;
+      sel.forEachRawValue(begin, end, [&result](size_t index, T value) {
+        if(result.count == 0 || value < result.min)
+        {
+          result.min = value;
+          result.minIndex = index;
+        }
+        if(result.count == 0 || value > result.max)
+        {
+          result.max = value;
+          result.maxIndex = index;
+        }
+        result.count++;
+      });
+      partials[chunk] = result;
+    });
+
+    // The chunks are visited in order so ties keep the first occurrence
+    MinMax<T> result;
+    for(const MinMax<T>& partial : partials)
+    {
+      if(partial.count == 0)
+      {
+        continue;
+      }
+      if(result.count == 0 || partial.min < result.min)
+      {
+        result.min = partial.min;
+        result.minIndex = partial.minIndex;
+      }
+      if(result.count == 0 || partial.max > result.max)
+      {
+        result.max = partial.max;
+        result.maxIndex = partial.maxIndex;
+      }
+      result.count += partial.count;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the count, mean and variance of the values
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return
+   */
+  template <typename T> static Moments ComputeMoments(const T* data, size_t numTuples, int numComponents = 1, const bool* mask = nullptr, int component = -1)
+  {
+    Selection<T> sel(data, numTuples, numComponents, mask, component);
+    std::vector<Moments> partials(sel.numChunks());
+    ForEachChunk(sel, [&sel, &partials](size_t chunk, size_t begin, size_t end) {
+      // Two passes over the chunk: it is still in the cache for the second one
+      if(sel.isContiguous())
+      {
+        const T* values = sel.data + begin * sel.numComponents;
+        size_t numValues = (end - begin) * sel.numComponents;
+        size_t count = CountValid(values, numValues);
+        if(count == 0)
+        {
+          return;
+        }
+        double mean = PairwiseSumRange(values, numValues, Identity()) / static_cast<double>(count);
+        partials[chunk].count = count;
+        partials[chunk].mean = mean;
+        partials[chunk].m2 = PairwiseSumRange(values, numValues, SquaredDeviation(mean));
+        return;
+      }
+      PairwiseSum sum;
+      size_t count = 0;
+      sel.forEachValue(begin, end, [&sum, &count](size_t, double value) {
+        sum.add(value);
+        count++;
+      });
+      if(count == 0)
+      {
+        return;
+      }
+      double mean = sum.getSum() / static_cast<double>(count);
+      PairwiseSum m2;
+      sel.forEachValue(begin, end, [&m2, mean](size_t, double value) { m2.add((value - mean) * (value - mean)); });
+      partials[chunk].count = count;
+      partials[chunk].mean = mean;
+      partials[chunk].m2 = m2.getSum();
+    });
+
+    Moments result;
+    for(const Moments& partial : partials)
+    {
+      result.merge(partial);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Counts the values in numBins bins of equal width between min and max. Values equal to max are
+   * counted in the last bin and values outside of [min, max] are ignored.
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param numBins
+   * @param min
+   * @param max
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return numBins counts. Empty if numBins is 0, max < min or min or max is not finite.
+   */
+  template <typename T>
+  static std::vector<uint64_t> Histogram(const T* data, size_t numTuples, int numComponents, size_t numBins, double min, double max, const bool* mask = nullptr, int component = -1)
+  {
+    if(numBins == 0 || !(max >= min) || !std::isfinite(min) || !std::isfinite(max))
+    {
+      return std::vector<uint64_t>();
+    }
+    Selection<T> sel(data, numTuples, numComponents, mask, component);
+    BinMapping bins(numBins, min, max);
+    return CountBins(sel, bins);
+  }
+
+  /**
+   * @brief Returns the quantiles of the values. Each quantile is interpolated linearly between the two closest
+   * ranks, i.e. the fraction 0.5 returns the median. The quantiles are exact: a coarse histogram locates the bins
+   * that contain the requested ranks and only the values of those bins are sorted. Infinite values take part in
+   * the quantiles; the histogram spans the finite values and counts the infinite values in its first and last bin.
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param fractions Fractions between 0 and 1
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return One value per fraction. Empty if there are no values.
+   */
+  template <typename T>
+  static std::vector<double> Quantiles(const T* data, size_t numTuples, int numComponents, const std::vector<double>& fractions, const bool* mask = nullptr, int component = -1)
+  {
+    MinMax<T> range = FindMinMax(data, numTuples, numComponents, mask, component);
+    if(range.count == 0)
+    {
+      return std::vector<double>();
+    }
+    Selection<T> sel(data, numTuples, numComponents, mask, component);
+    double lower = static_cast<double>(range.min);
+    double upper = static_cast<double>(range.max);
+    if(!std::isfinite(lower) || !std::isfinite(upper))
+    {
+      FindFiniteRange(sel, lower, upper);
+    }
+    BinMapping bins(k_QuantileBins, lower, upper);
+    std::vector<uint64_t> counts = CountBins(sel, bins, true);
+    std::vector<uint64_t> firstRank(counts.size() + 1, 0);
+    for(size_t i = 0; i < counts.size(); i++)
+    {
+      firstRank[i + 1] = firstRank[i] + counts[i];
+    }
+
+    // The two ranks around each fraction and the bins that contain them
+    std::vector<uint64_t> ranks;
+    for(double fraction : fractions)
+    {
+      double position = std::min(std::max(fraction, 0.0), 1.0) * static_cast<double>(range.count - 1);
+      ranks.push_back(static_cast<uint64_t>(std::floor(position)));
+      ranks.push_back(static_cast<uint64_t>(std::ceil(position)));
+    }
+    std::vector<int64_t> slot(counts.size(), -1);
+    std::vector<size_t> neededBins;
+    for(uint64_t rank : ranks)
+    {
+      size_t bin = static_cast<size_t>(std::upper_bound(firstRank.begin(), firstRank.end(), rank) - firstRank.begin()) - 1;
+      if(slot[bin] < 0)
+      {
+        slot[bin] = static_cast<int64_t>(neededBins.size());
+        neededBins.push_back(bin);
+      }
+    }
+
+    // Collect the values of the needed bins
+    std::vector<std::vector<double>> values(neededBins.size());
+    for(size_t i = 0; i < neededBins.size(); i++)
+    {
+      values[i].reserve(counts[neededBins[i]]);
+    }
+    sel.forEachValue(0, numTuples, [&values, &slot, &bins](size_t, double value) {
+      int64_t s = slot[bins.index(value)];
+      if(s >= 0)
+      {
+        values[s].push_back(value);
+      }
+    });
+
+    auto valueAtRank = [&](uint64_t rank) {
+      size_t bin = static_cast<size_t>(std::upper_bound(firstRank.begin(), firstRank.end(), rank) - firstRank.begin()) - 1;
+      std::vector<double>& binValues = values[slot[bin]];
+      auto nth = binValues.begin() + static_cast<std::ptrdiff_t>(rank - firstRank[bin]);
+      std::nth_element(binValues.begin(), nth, binValues.end());
+      return *nth;
+    };
+
+    std::vector<double> result;
+    for(size_t i = 0; i < fractions.size(); i++)
+    {
+      double position = std::min(std::max(fractions[i], 0.0), 1.0) * static_cast<double>(range.count - 1);
+      double lower = valueAtRank(ranks[2 * i]);
+      double upper = valueAtRank(ranks[2 * i + 1]);
+      // Infinite neighbors would turn the interpolation into NaN
+      double t = position - std::floor(position);
+      result.push_back((t == 0.0 || lower == upper) ? lower : lower + (upper - lower) * t);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the numBins + 1 edges of bins that each contain the same number of values
+   * @param data numTuples x numComponents values
+   * @param numTuples
+   * @param numComponents
+   * @param numBins
+   * @param mask One value per tuple or nullptr
+   * @param component Component to reduce or -1 for all components
+   * @return Empty if numBins is 0 or there are no values
+   */
+  template <typename T> static std::vector<double> QuantileBinEdges(const T* data, size_t numTuples, int numComponents, size_t numBins, const bool* mask = nullptr, int component = -1)
+  {
+    if(numBins == 0)
+    {
+      return std::vector<double>();
+    }
+    std::vector<double> fractions(numBins + 1);
+    for(size_t i = 0; i <= numBins; i++)
+    {
+      fractions[i] = static_cast<double>(i) / static_cast<double>(numBins);
+    }
+    return Quantiles(data, numTuples, numComponents, fractions, mask, component);
+  }
+
+  /**
+   * @brief DataArray version of Sum
+   * @param array
+   * @param mask One value per tuple of the array or nullptr
+   * @param component
+   * @return
+   */
+  template <typename T> static double Sum(DataArray<T>* array, const bool* mask = nullptr, int component = -1)
+  {
+    return Sum(array->getPointer(0), array->getNumberOfTuples(), array->getNumberOfComponents(), mask, component);
+  }
+
+  /**
+   * @brief DataArray version of FindMinMax
+   * @param array
+   * @param mask One value per tuple of the array or nullptr
+   * @param component
+   * @return
+   */
+  template <typename T> static MinMax<T> FindMinMax(DataArray<T>* array, const bool* mask = nullptr, int component = -1)
+  {
+    return FindMinMax(array->getPointer(0), array->getNumberOfTuples(), array->getNumberOfComponents(), mask, component);
+  }
+
+  /**
+   * @brief DataArray version of ComputeMoments
+   * @param array
+   * @param mask One value per tuple of the array or nullptr
+   * @param component
+   * @return
+   */
+  template <typename T> static Moments ComputeMoments(DataArray<T>* array, const bool* mask = nullptr, int component = -1)
+  {
+    return ComputeMoments(array->getPointer(0), array->getNumberOfTuples(), array->getNumberOfComponents(), mask, component);
+  }
+
+  /**
+   * @brief DataArray version of Histogram
+   * @param array
+   * @param numBins
+   * @param min
+   * @param max
+   * @param mask One value per tuple of the array or nullptr
+   * @param component
+   * @return
+   */
+  template <typename T> static std::vector<uint64_t> Histogram(DataArray<T>* array, size_t numBins, double min, double max, const bool* mask = nullptr, int component = -1)
+  {
+    return Histogram(array->getPointer(0), array->getNumberOfTuples(), array->getNumberOfComponents(), numBins, min, max, mask, component);
+  }
+
+  /**
+   * @brief DataArray version of Quantiles
+   * @param array
+   * @param fractions
+   * @param mask One value per tuple of the array or nullptr
+   * @param component
+   * @return
+   */
+  template <typename T> static std::vector<double> Quantiles(DataArray<T>* array, const std::vector<double>& fractions, const bool* mask = nullptr, int component = -1)
+  {
+    return Quantiles(array->getPointer(0), array->getNumberOfTuples(), array->getNumberOfComponents(), fractions, mask, component);
+  }
+
+  /**
+   * @brief Accumulates a stream of values with pairwise summation: blocks of values are summed directly and
+   * the block sums are combined like the carries of a binary counter, so the rounding error grows with the
+   * logarithm of the number of values instead of linearly.
+   */
+  class PairwiseSum
+  {
+  public:
+    void add(double value)
+    {
+      m_Block[m_BlockSize++] = value;
+      if(m_BlockSize == k_PairwiseBlockSize)
+      {
+        double blockSum = 0.0;
+        for(size_t i = 0; i < k_PairwiseBlockSize; i++)
+        {
+          blockSum += m_Block[i];
+        }
+        m_BlockSize = 0;
+        // Carry the block sum up through the levels like a binary counter
+        size_t level = 0;
+        while(level < m_Levels.size() && m_Occupied[level])
+        {
+          blockSum += m_Levels[level];
+          m_Occupied[level] = false;
+          level++;
+        }
+        if(level == m_Levels.size())
+        {
+          m_Levels.push_back(0.0);
+          m_Occupied.push_back(false);
+        }
+        m_Levels[level] = blockSum;
+        m_Occupied[level] = true;
+      }
+    }
+
+    double getSum() const
+    {
+      double sum = 0.0;
+      for(size_t i = 0; i < m_BlockSize; i++)
+      {
+        sum += m_Block[i];
+      }
+      for(size_t level = 0; level < m_Levels.size(); level++)
+      {
+        if(m_Occupied[level])
+        {
+          sum += m_Levels[level];
+        }
+      }
+      return sum;
+    }
+
+  private:
+    static const size_t k_PairwiseBlockSize = 128;
+    double m_Block[k_PairwiseBlockSize];
+    size_t m_BlockSize = 0;
+    std::vector<double> m_Levels;
+    std::vector<bool> m_Occupied;
+  };
+
+protected:
+  ArrayStatistics() = default;
+
+  static const size_t k_ChunkSize = 65536; // Values per parallel work item
+  static const size_t k_QuantileBins = 4096;
+
+  /**
+   * @brief The values of a buffer that take part in a reduction
+   */
+  template <typename T> struct Selection
+  {
+    const T* data;
+    size_t numTuples;
+    size_t numComponents;
+    size_t firstComponent;
+    size_t endComponent;
+    const bool* mask;
+    size_t tuplesPerChunk;
+
+    Selection(const T* d, size_t tuples, int comps, const bool* m, int component)
+    : data(d)
+    , numTuples(nullptr == d ? 0 : tuples)
+    , numComponents(static_cast<size_t>(std::max(comps, 1)))
+    , firstComponent(component < 0 ? 0 : static_cast<size_t>(component))
+    , endComponent(component < 0 ? numComponents : std::min(static_cast<size_t>(component) + 1, numComponents))
+    , mask(m)
+    , tuplesPerChunk(std::max<size_t>(k_ChunkSize / std::max<size_t>(endComponent - firstComponent, 1), 1))
+    {
+    }
+
+    /**
+     * @brief Returns true if every value of the buffer takes part in the reduction
+     */
+    bool isContiguous() const
+    {
+      return nullptr == mask && firstComponent == 0 && endComponent == numComponents;
+    }
+
+    size_t numChunks() const
+    {
+      return (numTuples + tuplesPerChunk - 1) / tuplesPerChunk;
+    }
+
+    /**
+     * @brief Calls func(elementIndex, value) for every valid value of the tuples [begin, end)
+     */
+    template <typename FuncType> void forEachRawValue(size_t begin, size_t end, const FuncType& func) const
+    {
+      for(size_t t = begin; t < end; t++)
+      {
+        if(nullptr != mask && !mask[t])
+        {
+          continue;
+        }
+        const T* tuple = data + t * numComponents;
+        for(size_t c = firstComponent; c < endComponent; c++)
+        {
+          if(IsValid(tuple[c]))
+          {
+            func(t * numComponents + c, tuple[c]);
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Calls func(elementIndex, value) with the value converted to double
+     */
+    template <typename FuncType> void forEachValue(size_t begin, size_t end, const FuncType& func) const
+    {
+      forEachRawValue(begin, end, [&func](size_t index, T value) { func(index, static_cast<double>(value)); });
+    }
+  };
+
+  /**
+   * @brief Maps values to bins of equal width
+   */
+  struct BinMapping
+  {
+    size_t numBins;
+    double min;
+    double max;
+    double scale;
+
+    BinMapping(size_t bins, double lower, double upper)
+    : numBins(bins)
+    , min(lower)
+    , max(upper)
+    , scale((upper - lower > 0.0 && std::isfinite(upper - lower)) ? static_cast<double>(bins) / (upper - lower) : 0.0)
+    {
+    }
+
+    /**
+     * @brief Returns the bin of a value. Values below min, including -inf, map to the first bin and values
+     * above max, including +inf, to the last bin.
+     */
+    size_t index(double value) const
+    {
+      double position = (value - min) * scale;
+      // NaN fails the comparison as well, so the conversion below only sees values in [0, numBins - 1)
+      if(!(position >= 0.0))
+      {
+        return 0;
+      }
+      if(position >= static_cast<double>(numBins - 1))
+      {
+        return numBins - 1;
+      }
+      return static_cast<size_t>(position);
+    }
+  };
+
+  /**
+   * @brief Returns true unless the value is NaN
+   */
+  template <typename T> static bool IsValid(T value)
+  {
+    return !std::is_floating_point<T>::value || value == value;
+  }
+
+  struct Identity
+  {
+    double operator()(double value) const
+    {
+      return value;
+    }
+  };
+
+  struct SquaredDeviation
+  {
+    double mean;
+    explicit SquaredDeviation(double m)
+    : mean(m)
+    {
+    }
+    double operator()(double value) const
+    {
+      return (value - mean) * (value - mean);
+    }
+  };
+
+  /**
+   * @brief Pairwise sum of transform(value) over a contiguous range, skipping NaN values. The leaves use several
+   * independent accumulators so that the compiler can vectorize them.
+   */
+  template <typename T, typename TransformType> static double PairwiseSumRange(const T* values, size_t count, const TransformType& transform)
+  {
+    const size_t k_LeafSize = 256;
+    if(count > k_LeafSize)
+    {
+      size_t half = (count / 2 + 7) & ~static_cast<size_t>(7);
+      return PairwiseSumRange(values, half, transform) + PairwiseSumRange(values + half, count - half, transform);
+    }
+    double acc[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+    {
+      for(size_t k = 0; k < 8; k++)
+      {
+        acc[k] += IsValid(values[i + k]) ? transform(static_cast<double>(values[i + k])) : 0.0;
+      }
+    }
+    for(; i < count; i++)
+    {
+      acc[0] += IsValid(values[i]) ? transform(static_cast<double>(values[i])) : 0.0;
+    }
+    return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+  }
+
+  /**
+   * @brief Returns the number of values in a contiguous range that are not NaN
+   */
+  template <typename T> static size_t CountValid(const T* values, size_t count)
+  {
+    if(!std::is_floating_point<T>::value)
+    {
+      return count;
+    }
+    size_t valid = 0;
+    for(size_t i = 0; i < count; i++)
+    {
+      valid += IsValid(values[i]) ? 1 : 0;
+    }
+    return valid;
+  }
+
+  /**
+   * @brief Min/max of the elements [begin, end) of a buffer that contains no masked values. The extrema are
+   * found with a branch free pass first and their indices with a second pass.
+   */
+  template <typename T> static MinMax<T> FindMinMaxRange(const T* data, size_t begin, size_t end)
+  {
+    MinMax<T> result;
+    result.count = CountValid(data + begin, end - begin);
+    if(result.count == 0)
+    {
+      return result;
+    }
+    T minValue = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    T maxValue = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+    for(size_t i = begin; i < end; i++)
+    {
+      // NaN compares false and is therefore skipped
+      minValue = data[i] < minValue ? data[i] : minValue;
+      maxValue = data[i] > maxValue ? data[i] : maxValue;
+    }
+    result.min = minValue;
+    result.max = maxValue;
+    result.minIndex = static_cast<size_t>(std::find(data + begin, data + end, minValue) - data);
+    result.maxIndex = static_cast<size_t>(std::find(data + begin, data + end, maxValue) - data);
+    return result;
+  }
+
+  /**
+   * @brief Kahan summation of a list of partial sums
+   */
+  static double KahanSum(const std::vector<double>& values)
+  {
+    double sum = 0.0;
+    double compensation = 0.0;
+    for(double value : values)
+    {
+      double adjustedValue = value - compensation;
+      double newSum = sum + adjustedValue;
+      compensation = (newSum - sum) - adjustedValue;
+      sum = newSum;
+    }
+    return sum;
+  }
+
+  /**
+   * @brief Finds the smallest and largest finite value of the selection. Both are 0 if there is no finite value.
+   */
+  template <typename T> static void FindFiniteRange(const Selection<T>& sel, double& lower, double& upper)
+  {
+    lower = std::numeric_limits<double>::infinity();
+    upper = -std::numeric_limits<double>::infinity();
+    sel.forEachValue(0, sel.numTuples, [&lower, &upper](size_t, double value) {
+      if(std::isfinite(value))
+      {
+        lower = std::min(lower, value);
+        upper = std::max(upper, value);
+      }
+    });
+    if(lower > upper)
+    {
+      lower = 0.0;
+      upper = 0.0;
+    }
+  }
+
+  /**
+   * @brief Counts the values of the selection in the bins
+   * @param sel
+   * @param bins
+   * @param clampToRange If true the values outside of [min, max] are counted in the first or last bin instead of
+   * being ignored
+   */
+  template <typename T> static std::vector<uint64_t> CountBins(const Selection<T>& sel, const BinMapping& bins, bool clampToRange = false)
+  {
+    auto countRange = [&sel, &bins, clampToRange](size_t begin, size_t end, std::vector<uint64_t>& counts) {
+      sel.forEachValue(begin, end, [&bins, &counts, clampToRange](size_t, double value) {
+        if(clampToRange || (value >= bins.min && value <= bins.max))
+        {
+          counts[bins.index(value)]++;
+        }
+      });
+    };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+    if(context->getUseParallel() && sel.numChunks() > 1)
+    {
+      tbb::combinable<std::vector<uint64_t>> localCounts([&bins] { return std::vector<uint64_t>(bins.numBins, 0); });
+      context->parallelFor(tbb::blocked_range<size_t>(0, sel.numTuples, sel.tuplesPerChunk),
+                           [&countRange, &localCounts](const tbb::blocked_range<size_t>& r) { countRange(r.begin(), r.end(), localCounts.local()); });
+      std::vector<uint64_t> counts(bins.numBins, 0);
+      localCounts.combine_each([&counts](const std::vector<uint64_t>& local) {
+        for(size_t i = 0; i < local.size(); i++)
+        {
+          counts[i] += local[i];
+        }
+      });
+      return counts;
+    }
+#endif
+    std::vector<uint64_t> counts(bins.numBins, 0);
+    countRange(0, sel.numTuples, counts);
+    return counts;
+  }
+
+  /**
+   * @brief Calls func(chunk, firstTuple, endTuple) for every chunk of the selection, in parallel if the
+   * execution context allows it
+   */
+  template <typename T, typename FuncType> static void ForEachChunk(const Selection<T>& sel, const FuncType& func)
+  {
+    size_t numChunks = sel.numChunks();
+    auto runChunk = [&sel, &func](size_t chunk) {
+      size_t begin = chunk * sel.tuplesPerChunk;
+      func(chunk, begin, std::min(begin + sel.tuplesPerChunk, sel.numTuples));
+    };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+    if(context->getUseParallel() && numChunks > 1)
+    {
+      context->parallelFor(tbb::blocked_range<size_t>(0, numChunks, 1), [&runChunk](const tbb::blocked_range<size_t>& r) {
+        for(size_t chunk = r.begin(); chunk < r.end(); chunk++)
+        {
+          runChunk(chunk);
+        }
+      });
+      return;
+    }
+#endif
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      runChunk(chunk);
+    }
+  }
+
+private:
+  ArrayStatistics(const ArrayStatistics&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ArrayStatistics&) = delete;  // Move assignment Not Implemented
+};
@@ -0,0 +1,320 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Utilities/DataContainerArrayCache.h"
+
+#include <cstdlib>
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Serializes the proxy so that two reads of the same file only share an entry if
+// they selected exactly the same arrays.
+// -----------------------------------------------------------------------------
+QString CreateProxyKey(const DataContainerArrayProxy& proxy)
+{
+  QJsonObject json;
+  proxy.writeJson(json);
+  return QString::fromUtf8(QJsonDocument(json).toJson(QJsonDocument::Compact));
+}
+} // namespace
+
+DataContainerArrayCache* DataContainerArrayCache::self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArrayCache::DataContainerArrayCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArrayCache::~DataContainerArrayCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArrayCache* DataContainerArrayCache::Instance()
+{
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    self = new DataContainerArrayCache();
+    const char* maxEntries = std::getenv("SIMPL_DCA_CACHE_SIZE");
+    if(nullptr != maxEntries)
+    {
+      self->setMaxEntries(static_cast<size_t>(std::strtoull(maxEntries, nullptr, 10)));
+    }
+    const char* memoryBudget = std::getenv("SIMPL_DCA_CACHE_MEMORY");
+    if(nullptr != memoryBudget)
+    {
+      self->setMemoryBudget(static_cast<size_t>(std::strtoull(memoryBudget, nullptr, 10)));
+    }
+  });
+  return self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::EstimateMemory(const DataContainerArray::Pointer& dca)
+{
+  size_t memory = 0;
+  if(nullptr == dca.get())
+  {
+    return memory;
+  }
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        if(nullptr != array.get())
+        {
+          memory += array->getSize() * array->getTypeSize();
+        }
+      }
+    }
+  }
+  return memory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::setMaxEntries(size_t maxEntries)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MaxEntries = maxEntries;
+  trim();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::getMaxEntries() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MaxEntries;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::setMemoryBudget(size_t megaBytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MemoryBudget = megaBytes;
+  trim();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::getMemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerArrayCache::isEnabled() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MaxEntries > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerArrayCache::find(const QString& filePath, const DataContainerArrayProxy& proxy)
+{
+  QFileInfo fi(filePath);
+  QString absolutePath = fi.absoluteFilePath();
+  QString proxyKey = CreateProxyKey(proxy);
+
+  DataContainerArray::Pointer cached;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_MaxEntries == 0)
+    {
+      return DataContainerArray::NullPointer();
+    }
+    for(auto iter = m_Entries.begin(); iter != m_Entries.end(); ++iter)
+    {
+      if(iter->filePath != absolutePath || iter->proxyKey != proxyKey)
+      {
+        continue;
+      }
+      if(!fi.exists() || iter->lastModified != fi.lastModified() || iter->fileSize != fi.size())
+      {
+        // The file changed on disk since it was cached
+        m_Memory -= iter->memory;
+        m_Entries.erase(iter);
+        break;
+      }
+      m_Entries.splice(m_Entries.begin(), m_Entries, iter);
+      cached = m_Entries.front().dca;
+      break;
+    }
+    if(nullptr == cached.get())
+    {
+      m_MissCount++;
+      return DataContainerArray::NullPointer();
+    }
+    m_HitCount++;
+  }
+
+  // The cached array is never modified, so the copy can be made without holding the lock
+  return cached->deepCopy(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::insert(const QString& filePath, const DataContainerArrayProxy& proxy, const DataContainerArray::Pointer& dca)
+{
+  if(nullptr == dca.get() || !isEnabled())
+  {
+    return;
+  }
+
+  QFileInfo fi(filePath);
+  if(!fi.exists())
+  {
+    return;
+  }
+
+  CacheEntry entry;
+  entry.filePath = fi.absoluteFilePath();
+  entry.proxyKey = CreateProxyKey(proxy);
+  entry.lastModified = fi.lastModified();
+  entry.fileSize = fi.size();
+  entry.dca = dca->deepCopy(false);
+  entry.memory = EstimateMemory(entry.dca);
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  for(auto iter = m_Entries.begin(); iter != m_Entries.end(); ++iter)
+  {
+    if(iter->filePath == entry.filePath && iter->proxyKey == entry.proxyKey)
+    {
+      m_Memory -= iter->memory;
+      m_Entries.erase(iter);
+      break;
+    }
+  }
+  m_Memory += entry.memory;
+  m_Entries.push_front(entry);
+  trim();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::remove(const QString& filePath)
+{
+  QString absolutePath = QFileInfo(filePath).absoluteFilePath();
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  for(auto iter = m_Entries.begin(); iter != m_Entries.end();)
+  {
+    if(iter->filePath == absolutePath)
+    {
+      m_Memory -= iter->memory;
+      iter = m_Entries.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Entries.clear();
+  m_Memory = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::size() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::getHitCount() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_HitCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArrayCache::getMissCount() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MissCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArrayCache::trim()
+{
+  const size_t memoryBudget = m_MemoryBudget * 1024 * 1024;
+  while(!m_Entries.empty() && (m_Entries.size() > m_MaxEntries || (memoryBudget > 0 && m_Memory > memoryBudget)))
+  {
+    m_Memory -= m_Entries.back().memory;
+    m_Entries.pop_back();
+  }
+}
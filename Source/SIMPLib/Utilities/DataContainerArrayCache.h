@@ -0,0 +1,164 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataContainerArrayCache class is a process wide, least recently used cache of
+ * the DataContainerArrays that the DataContainerReader has read from .dream3d files. It lets
+ * long running processes (e.g. the PipelineDaemon) skip the HDF5 read when several pipelines
+ * read the same file.
+ *
+ * An entry is keyed on the absolute path of the file together with the proxy that selected
+ * which arrays were read, and is only reused while the modification time and size of the file
+ * are unchanged. The cache hands out deep copies so that a pipeline can never modify the
+ * cached data.
+ *
+ * The cache is disabled (holds 0 entries) unless the SIMPL_DCA_CACHE_SIZE environment variable
+ * is set or setMaxEntries() is called. SIMPL_DCA_CACHE_MEMORY optionally limits the memory in MB
+ * that the cached arrays may use.
+ */
+class SIMPLib_EXPORT DataContainerArrayCache
+{
+public:
+  virtual ~DataContainerArrayCache();
+
+  /**
+   * @brief Returns the process wide instance, creating it from the environment on first use
+   * @return
+   */
+  static DataContainerArrayCache* Instance();
+
+  /**
+   * @brief Estimates the number of bytes that the data arrays of a DataContainerArray occupy
+   * @param dca
+   * @return
+   */
+  static size_t EstimateMemory(const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Sets the maximum number of DataContainerArrays that are kept. 0 disables the cache.
+   * @param maxEntries
+   */
+  void setMaxEntries(size_t maxEntries);
+  size_t getMaxEntries() const;
+
+  /**
+   * @brief Sets the maximum amount of memory in MB the cached arrays may use. 0 means no limit.
+   * @param megaBytes
+   */
+  void setMemoryBudget(size_t megaBytes);
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Returns true if the cache may hold any entries
+   * @return
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Returns a deep copy of the cached DataContainerArray that was read from the file with
+   * the given proxy, or a null pointer if there is no current entry.
+   * @param filePath
+   * @param proxy
+   * @return
+   */
+  DataContainerArray::Pointer find(const QString& filePath, const DataContainerArrayProxy& proxy);
+
+  /**
+   * @brief Stores a deep copy of a DataContainerArray that was read from the file with the given
+   * proxy, evicting the least recently used entries if the limits are exceeded.
+   * @param filePath
+   * @param proxy
+   * @param dca
+   */
+  void insert(const QString& filePath, const DataContainerArrayProxy& proxy, const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Removes every entry that was read from the given file
+   * @param filePath
+   */
+  void remove(const QString& filePath);
+
+  /**
+   * @brief Removes all entries
+   */
+  void clear();
+
+  size_t size() const;
+  size_t getHitCount() const;
+  size_t getMissCount() const;
+
+protected:
+  DataContainerArrayCache();
+
+  /**
+   * @brief Evicts the least recently used entries until the limits hold. The mutex must be locked.
+   */
+  void trim();
+
+private:
+  struct CacheEntry
+  {
+    QString filePath;
+    QString proxyKey;
+    QDateTime lastModified;
+    qint64 fileSize = 0;
+    size_t memory = 0;
+    DataContainerArray::Pointer dca;
+  };
+
+  static DataContainerArrayCache* self;
+
+  std::list<CacheEntry> m_Entries; // Most recently used entry first
+  size_t m_MaxEntries = 0;
+  size_t m_MemoryBudget = 0;
+  size_t m_Memory = 0;
+  size_t m_HitCount = 0;
+  size_t m_MissCount = 0;
+
+  mutable std::mutex m_Mutex;
+
+  DataContainerArrayCache(const DataContainerArrayCache&) = delete; // Copy Constructor Not Implemented
+  void operator=(const DataContainerArrayCache&) = delete;          // Move assignment Not Implemented
+};
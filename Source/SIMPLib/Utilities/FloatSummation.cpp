@@ -31,6 +31,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "SIMPLib/Utilities/FloatSummation.h"
 
+#include "SIMPLib/Utilities/ArrayStatistics.hpp"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,41 +46,17 @@ FloatSummation::~FloatSummation() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float FloatSummation::Kahanf(std::vector<float> values)
+float FloatSummation::Kahanf(const std::vector<float>& values)
 {
-  float sum = 0.0;
-  float compensation = 0.0;
-
-  for(std::vector<float>::size_type i = 0; i < values.size(); i++)
-  {
-    float adjustedValue = values.at(i) - compensation;
-    float newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
-
-    sum = newSum;
-  }
-
-  return sum;
+  return static_cast<float>(ArrayStatistics::Sum(values.data(), values.size()));
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double FloatSummation::Kahan(std::vector<double> values)
+double FloatSummation::Kahan(const std::vector<double>& values)
 {
-  double sum = 0.0;
-  double compensation = 0.0;
-
-  for(std::vector<double>::size_type i = 0; i < values.size(); i++)
-  {
-    double adjustedValue = values.at(i) - compensation;
-    double newSum = sum + adjustedValue;
-    compensation = (newSum - sum) - adjustedValue;
-
-    sum = newSum;
-  }
-
-  return sum;
+  return ArrayStatistics::Sum(values.data(), values.size());
 }
 
 // -----------------------------------------------------------------------------
@@ -47,17 +47,19 @@ public:
   virtual ~FloatSummation();
 
   /**
-  * @brief Performs a Kahan summation over a vector of floating point numbers and returns the result
+  * @brief Performs a compensated summation over a vector of floating point numbers and returns the result.
+  * Large vectors are summed in parallel through ArrayStatistics::Sum, which skips NaN values.
   * @param values The vector of floats used for the summation
-  * @returns Kahan summation of floating point numbers
+  * @returns Compensated summation of floating point numbers
   */
-  static float Kahanf(std::vector<float> values);
+  static float Kahanf(const std::vector<float>& values);
   /**
-  * @brief Performs a Kahan summation over a vector of floating point numbers and returns the result
+  * @brief Performs a compensated summation over a vector of floating point numbers and returns the result.
+  * Large vectors are summed in parallel through ArrayStatistics::Sum, which skips NaN values.
   * @param values The vector of doubles used for the summation
-  * @returns Kahan summation of floating point numbers
+  * @returns Compensated summation of floating point numbers
   */
-  static double Kahan(std::vector<double> values);
+  static double Kahan(const std::vector<double>& values);
 
   /**
   * @brief Performs a Kahan summation over a list of floating point numbers and returns the result
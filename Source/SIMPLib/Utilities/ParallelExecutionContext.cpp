@@ -0,0 +1,498 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_scheduler_observer.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace
+{
+/**
+ * @brief The SavedAffinity struct holds the affinity of a thread from before it was restricted
+ */
+struct SavedAffinity
+{
+  bool valid = false;
+#if defined(__linux__)
+  cpu_set_t cpuSet;
+#elif defined(_WIN32)
+  DWORD_PTR mask = 0;
+#endif
+};
+
+// -----------------------------------------------------------------------------
+// Restricts the calling thread to the given cores and stores its previous affinity in saved. This is a
+// no-op on platforms that do not support thread affinity (e.g. macOS).
+// -----------------------------------------------------------------------------
+void SetCurrentThreadAffinity(const std::vector<int>& cores, SavedAffinity& saved)
+{
+  saved.valid = false;
+  if(cores.empty())
+  {
+    return;
+  }
+#if defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for(int core : cores)
+  {
+    if(core >= 0 && core < CPU_SETSIZE)
+    {
+      CPU_SET(core, &cpuSet);
+    }
+  }
+  if(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved.cpuSet) != 0)
+  {
+    return;
+  }
+  saved.valid = (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0);
+#elif defined(_WIN32)
+  DWORD_PTR mask = 0;
+  for(int core : cores)
+  {
+    if(core >= 0 && core < static_cast<int>(sizeof(DWORD_PTR) * 8))
+    {
+      mask |= (static_cast<DWORD_PTR>(1) << core);
+    }
+  }
+  if(mask != 0)
+  {
+    saved.mask = SetThreadAffinityMask(GetCurrentThread(), mask);
+    saved.valid = (saved.mask != 0);
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Restores the affinity that SetCurrentThreadAffinity() replaced
+// -----------------------------------------------------------------------------
+void RestoreCurrentThreadAffinity(SavedAffinity& saved)
+{
+  if(!saved.valid)
+  {
+    return;
+  }
+#if defined(__linux__)
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved.cpuSet);
+#elif defined(_WIN32)
+  SetThreadAffinityMask(GetCurrentThread(), saved.mask);
+#endif
+  saved.valid = false;
+}
+
+/**
+ * @brief The ThreadPinning struct remembers which observer assigned a core to the thread, so that a worker
+ * that leaves and re-enters the arena is pinned to the same core again.
+ */
+struct ThreadPinning
+{
+  uint64_t observerId = 0;
+  size_t coreIndex = 0;
+  SavedAffinity saved;
+};
+
+thread_local ThreadPinning t_ThreadPinning;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HardwareThreadCount()
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  return tbb::this_task_arena::max_concurrency();
+#else
+  return static_cast<int>(std::thread::hardware_concurrency());
+#endif
+}
+} // namespace
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+/**
+ * @brief The AffinityObserver class pins every worker thread that joins the SIMPLib task arena
+ * according to the affinity policy of the context. Each worker is assigned its core once and keeps it
+ * when it re-enters the arena. The affinity a worker had before is restored when it leaves the arena.
+ * Threads that are not workers of the arena, such as the thread that calls parallelFor(), are never
+ * pinned so the affinity of the caller does not change.
+ */
+class ParallelExecutionContext::AffinityObserver : public tbb::task_scheduler_observer
+{
+public:
+  AffinityObserver(tbb::task_arena& arena, const std::vector<int>& cores, AffinityPolicy policy)
+  : tbb::task_scheduler_observer(arena)
+  , m_Cores(cores)
+  , m_Policy(policy)
+  , m_Id(s_NextId.fetch_add(1))
+  , m_NextCore(0)
+  {
+    observe(true);
+  }
+
+  ~AffinityObserver() override
+  {
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool isWorker) override
+  {
+    if(!isWorker || m_Policy == AffinityPolicy::None || m_Cores.empty())
+    {
+      return;
+    }
+    ThreadPinning& pinning = t_ThreadPinning;
+    if(pinning.observerId != m_Id)
+    {
+      pinning.observerId = m_Id;
+      pinning.coreIndex = m_NextCore.fetch_add(1) % m_Cores.size();
+    }
+    if(m_Policy == AffinityPolicy::Core)
+    {
+      SetCurrentThreadAffinity(std::vector<int>(1, m_Cores[pinning.coreIndex]), pinning.saved);
+    }
+    else
+    {
+      SetCurrentThreadAffinity(m_Cores, pinning.saved);
+    }
+  }
+
+  void on_scheduler_exit(bool isWorker) override
+  {
+    ThreadPinning& pinning = t_ThreadPinning;
+    if(isWorker && pinning.observerId == m_Id)
+    {
+      RestoreCurrentThreadAffinity(pinning.saved);
+    }
+  }
+
+private:
+  static std::atomic<uint64_t> s_NextId;
+
+  std::vector<int> m_Cores;
+  AffinityPolicy m_Policy;
+  uint64_t m_Id;
+  std::atomic<size_t> m_NextCore;
+};
+
+std::atomic<uint64_t> ParallelExecutionContext::AffinityObserver::s_NextId(1);
+#endif
+
+ParallelExecutionContext* ParallelExecutionContext::self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::ParallelExecutionContext() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::~ParallelExecutionContext()
+{
+  resetArena();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelExecutionContext* ParallelExecutionContext::Instance()
+{
+  static std::once_flag flag;
+  std::call_once(flag, [] {
+    self = new ParallelExecutionContext();
+    self->readEnvironment();
+  });
+  return self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int> ParallelExecutionContext::ParseCoreList(const std::string& coreList)
+{
+  std::vector<int> cores;
+  std::stringstream ss(coreList);
+  std::string token;
+  while(std::getline(ss, token, ','))
+  {
+    if(token.empty())
+    {
+      continue;
+    }
+    size_t dash = token.find('-');
+    char* end = nullptr;
+    if(dash == std::string::npos)
+    {
+      long core = std::strtol(token.c_str(), &end, 10);
+      if(end != token.c_str() && core >= 0)
+      {
+        cores.push_back(static_cast<int>(core));
+      }
+    }
+    else
+    {
+      std::string first = token.substr(0, dash);
+      std::string last = token.substr(dash + 1);
+      char* endLast = nullptr;
+      long firstCore = std::strtol(first.c_str(), &end, 10);
+      long lastCore = std::strtol(last.c_str(), &endLast, 10);
+      if(end == first.c_str() || endLast == last.c_str() || firstCore < 0 || lastCore < firstCore)
+      {
+        continue;
+      }
+      for(long core = firstCore; core <= lastCore; core++)
+      {
+        cores.push_back(static_cast<int>(core));
+      }
+    }
+  }
+
+  std::sort(cores.begin(), cores.end());
+  cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+  return cores;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::AffinityPolicy ParallelExecutionContext::ParseAffinityPolicy(const std::string& name)
+{
+  if(name == "none")
+  {
+    return AffinityPolicy::None;
+  }
+  if(name == "core")
+  {
+    return AffinityPolicy::Core;
+  }
+  return AffinityPolicy::Slice;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::readEnvironment()
+{
+  const char* numThreads = std::getenv("SIMPL_NUM_THREADS");
+  if(nullptr != numThreads)
+  {
+    setMaxThreads(std::atoi(numThreads));
+  }
+
+  const char* affinity = std::getenv("SIMPL_CPU_AFFINITY");
+  if(nullptr != affinity)
+  {
+    setCpuAffinity(ParseCoreList(affinity));
+  }
+
+  const char* policy = std::getenv("SIMPL_AFFINITY_POLICY");
+  if(nullptr != policy)
+  {
+    setAffinityPolicy(ParseAffinityPolicy(policy));
+  }
+
+  const char* grainSize = std::getenv("SIMPL_GRAIN_SIZE");
+  if(nullptr != grainSize)
+  {
+    setGrainSizeHint(static_cast<size_t>(std::strtoull(grainSize, nullptr, 10)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::setMaxThreads(int numThreads)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_MaxThreads = std::max(numThreads, 0);
+  }
+  resetArena();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParallelExecutionContext::getMaxThreads() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MaxThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParallelExecutionContext::getNumThreads() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  int numThreads = m_CpuAffinity.empty() ? HardwareThreadCount() : static_cast<int>(m_CpuAffinity.size());
+  if(m_MaxThreads > 0 && m_MaxThreads < numThreads)
+  {
+    numThreads = m_MaxThreads;
+  }
+  return std::max(numThreads, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::setCpuAffinity(const std::vector<int>& cores)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_CpuAffinity = cores;
+  }
+  resetArena();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int> ParallelExecutionContext::getCpuAffinity() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CpuAffinity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::setAffinityPolicy(AffinityPolicy policy)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_AffinityPolicy = policy;
+  }
+  resetArena();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelExecutionContext::AffinityPolicy ParallelExecutionContext::getAffinityPolicy() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_AffinityPolicy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::setGrainSizeHint(size_t grainSize)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_GrainSizeHint = grainSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ParallelExecutionContext::getGrainSizeHint() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_GrainSizeHint;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ParallelExecutionContext::computeGrainSize(size_t rangeSize, size_t minimum) const
+{
+  size_t hint = getGrainSizeHint();
+  size_t grain = hint;
+  if(grain == 0)
+  {
+    grain = rangeSize / static_cast<size_t>(getNumThreads());
+  }
+  return std::max(grain, std::max(minimum, static_cast<size_t>(1)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParallelExecutionContext::getUseParallel() const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  return getNumThreads() > 1;
+#else
+  return false;
+#endif
+}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+tbb::task_arena& ParallelExecutionContext::getArena()
+{
+  int numThreads = getNumThreads();
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(nullptr == m_Arena.get())
+  {
+    m_Arena.reset(new tbb::task_arena(numThreads));
+    m_Arena->initialize();
+    if(!m_CpuAffinity.empty() && m_AffinityPolicy != AffinityPolicy::None)
+    {
+      m_AffinityObserver.reset(new AffinityObserver(*m_Arena, m_CpuAffinity, m_AffinityPolicy));
+    }
+  }
+  return *m_Arena;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelExecutionContext::resetArena()
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_AffinityObserver.reset();
+  m_Arena.reset();
+#endif
+}
@@ -0,0 +1,209 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#endif
+
+/**
+ * @brief The ParallelExecutionContext class is the single, process wide place where SIMPLib
+ * decides how many threads the parallel algorithms may use, which cores those threads may
+ * run on and how coarse the work should be split. All parallel code paths should go
+ * through ParallelExecutionContext::Instance() instead of creating their own scheduler.
+ *
+ * The settings are read from the following environment variables the first time the
+ * context is used and may be overridden afterwards (e.g. from command line options):
+ * @li SIMPL_NUM_THREADS  Maximum number of threads (0 or unset means all available cores)
+ * @li SIMPL_CPU_AFFINITY Comma separated list of cores and core ranges, e.g. "0-15,64-79"
+ * @li SIMPL_AFFINITY_POLICY "none", "slice" or "core"
+ * @li SIMPL_GRAIN_SIZE   Minimum number of items each parallel task should process
+ *
+ * The settings should be applied before any parallel algorithm runs; changing them later
+ * rebuilds the task arena which is only safe while no parallel algorithm is executing.
+ */
+class SIMPLib_EXPORT ParallelExecutionContext
+{
+public:
+  /**
+   * @brief How the threads of the task arena are bound to the cores in the affinity list
+   */
+  enum class AffinityPolicy : int
+  {
+    None = 0,  //!< Threads are not pinned
+    Slice = 1, //!< Every worker thread may run on any core of the affinity list
+    Core = 2   //!< Worker threads are pinned round robin, one core each
+  };
+
+  virtual ~ParallelExecutionContext();
+
+  /**
+   * @brief Returns the process wide instance, creating it from the environment on first use
+   * @return
+   */
+  static ParallelExecutionContext* Instance();
+
+  /**
+   * @brief Parses a core list of the form "0-3,8,10-11" into the list of core indices.
+   * Malformed entries are ignored.
+   * @param coreList
+   * @return
+   */
+  static std::vector<int> ParseCoreList(const std::string& coreList);
+
+  /**
+   * @brief Parses an affinity policy name ("none", "slice" or "core")
+   * @param name
+   * @return
+   */
+  static AffinityPolicy ParseAffinityPolicy(const std::string& name);
+
+  /**
+   * @brief Re-reads all settings from the environment variables
+   */
+  void readEnvironment();
+
+  /**
+   * @brief Sets the maximum number of threads. 0 uses every available core (or every core in the affinity list).
+   * @param numThreads
+   */
+  void setMaxThreads(int numThreads);
+
+  /**
+   * @brief Returns the maximum number of threads that was requested. 0 means automatic.
+   * @return
+   */
+  int getMaxThreads() const;
+
+  /**
+   * @brief Returns the number of threads that parallel algorithms actually use
+   * @return
+   */
+  int getNumThreads() const;
+
+  /**
+   * @brief Sets the cores that the threads of the arena are allowed to run on
+   * @param cores
+   */
+  void setCpuAffinity(const std::vector<int>& cores);
+  std::vector<int> getCpuAffinity() const;
+
+  void setAffinityPolicy(AffinityPolicy policy);
+  AffinityPolicy getAffinityPolicy() const;
+
+  /**
+   * @brief Sets the minimum number of items each parallel task should process. 0 lets the algorithm decide.
+   * @param grainSize
+   */
+  void setGrainSizeHint(size_t grainSize);
+  size_t getGrainSizeHint() const;
+
+  /**
+   * @brief Computes a grain size for a range of the given size. The user supplied hint
+   * wins if it was set, otherwise the range is split evenly over the available threads.
+   * @param rangeSize Number of items in the range
+   * @param minimum The smallest grain that the caller accepts
+   * @return
+   */
+  size_t computeGrainSize(size_t rangeSize, size_t minimum = 1) const;
+
+  /**
+   * @brief Returns true if the parallel algorithms should be used at all
+   * @return
+   */
+  bool getUseParallel() const;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  /**
+   * @brief Returns the task arena that all SIMPLib parallel algorithms execute in
+   * @return
+   */
+  tbb::task_arena& getArena();
+
+  /**
+   * @brief Runs tbb::parallel_for over the range inside the SIMPLib task arena
+   * @param range
+   * @param body
+   */
+  template <typename RangeType, typename BodyType> void parallelFor(const RangeType& range, const BodyType& body)
+  {
+    getArena().execute([&range, &body] { tbb::parallel_for(range, body, tbb::auto_partitioner()); });
+  }
+
+  /**
+   * @brief Runs an arbitrary functor (e.g. a tbb::parallel_reduce or task_group) inside the SIMPLib task arena
+   * @param func
+   */
+  template <typename FunctorType> void execute(const FunctorType& func)
+  {
+    getArena().execute(func);
+  }
+#endif
+
+protected:
+  ParallelExecutionContext();
+
+  /**
+   * @brief Destroys the current task arena so that it is rebuilt with the current settings on next use
+   */
+  void resetArena();
+
+private:
+  static ParallelExecutionContext* self;
+
+  int m_MaxThreads = 0;
+  std::vector<int> m_CpuAffinity;
+  AffinityPolicy m_AffinityPolicy = AffinityPolicy::Slice;
+  size_t m_GrainSizeHint = 0;
+
+  mutable std::mutex m_Mutex;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  class AffinityObserver;
+  std::unique_ptr<tbb::task_arena> m_Arena;
+  std::unique_ptr<AffinityObserver> m_AffinityObserver;
+#endif
+
+  ParallelExecutionContext(const ParallelExecutionContext&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ParallelExecutionContext&) = delete;           // Move assignment Not Implemented
+};
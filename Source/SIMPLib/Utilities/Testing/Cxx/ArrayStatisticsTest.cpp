@@ -0,0 +1,245 @@
+/* ============================================================================
+* Copyright (c) 2009-2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-15-D-5231
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/Math/PhiloxRandom.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ArrayStatistics.hpp"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ArrayStatisticsTest
+{
+public:
+  ArrayStatisticsTest() = default;
+  virtual ~ArrayStatisticsTest() = default;
+
+  // Several chunks plus a partial one
+  const size_t k_NumTuples = 200003;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> GenerateValues(size_t count)
+  {
+    PhiloxRandom generator(1234);
+    std::vector<float> values(count);
+    for(float& value : values)
+    {
+      value = 1000.0f + generator.nextFloat() * 10.0f;
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSumAndMoments()
+  {
+    std::vector<float> values = GenerateValues(k_NumTuples * 2);
+    std::unique_ptr<bool[]> maskValues(new bool[k_NumTuples]);
+    bool* mask = maskValues.get();
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      mask[i] = (i % 3 != 0);
+    }
+    values[10] = std::numeric_limits<float>::quiet_NaN();
+
+    // Reference values for component 1 of the masked tuples, accumulated in long double
+    long double sum = 0.0L;
+    size_t count = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(mask[i])
+      {
+        sum += values[i * 2 + 1];
+        count++;
+      }
+    }
+    long double mean = sum / count;
+    long double m2 = 0.0L;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(mask[i])
+      {
+        m2 += (values[i * 2 + 1] - mean) * (values[i * 2 + 1] - mean);
+      }
+    }
+
+    double result = ArrayStatistics::Sum(values.data(), k_NumTuples, 2, mask, 1);
+    DREAM3D_REQUIRE(std::abs(result - static_cast<double>(sum)) < 1.0e-9 * static_cast<double>(sum))
+
+    ArrayStatistics::Moments moments = ArrayStatistics::ComputeMoments(values.data(), k_NumTuples, 2, mask, 1);
+    DREAM3D_REQUIRE_EQUAL(moments.count, count)
+    DREAM3D_REQUIRE(std::abs(moments.mean - static_cast<double>(mean)) < 1.0e-9)
+    DREAM3D_REQUIRE(std::abs(moments.getVariance() - static_cast<double>(m2 / count)) < 1.0e-8)
+
+    // All values: the NaN is skipped
+    ArrayStatistics::Moments all = ArrayStatistics::ComputeMoments(values.data(), k_NumTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(all.count, k_NumTuples * 2 - 1)
+    DREAM3D_REQUIRE(std::isfinite(ArrayStatistics::Sum(values.data(), k_NumTuples * 2)))
+
+    // Merging the moments of two halves gives the moments of the whole
+    ArrayStatistics::Moments first = ArrayStatistics::ComputeMoments(values.data() + 20, 1000);
+    ArrayStatistics::Moments second = ArrayStatistics::ComputeMoments(values.data() + 1020, 3000);
+    ArrayStatistics::Moments whole = ArrayStatistics::ComputeMoments(values.data() + 20, 4000);
+    first.merge(second);
+    DREAM3D_REQUIRE_EQUAL(first.count, whole.count)
+    DREAM3D_REQUIRE(std::abs(first.mean - whole.mean) < 1.0e-9)
+    DREAM3D_REQUIRE(std::abs(first.m2 - whole.m2) < 1.0e-6 * whole.m2)
+
+    // Empty input
+    DREAM3D_REQUIRE_EQUAL(ArrayStatistics::Sum(values.data(), 0), 0.0)
+    DREAM3D_REQUIRE_EQUAL(ArrayStatistics::ComputeMoments(values.data(), 0).count, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMinMax()
+  {
+    std::vector<int32_t> values(k_NumTuples * 3);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<int32_t>((i * 7919) % 100003) - 50000;
+    }
+    values[3 * 150000 + 2] = -70000;
+    values[3 * 170000 + 2] = -70000;
+    values[3 * 1000 + 2] = 90000;
+
+    ArrayStatistics::MinMax<int32_t> range = ArrayStatistics::FindMinMax(values.data(), k_NumTuples, 3, nullptr, 2);
+    DREAM3D_REQUIRE_EQUAL(range.count, k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(range.min, -70000)
+    DREAM3D_REQUIRE_EQUAL(range.minIndex, 3 * 150000 + 2)
+    DREAM3D_REQUIRE_EQUAL(range.max, 90000)
+    DREAM3D_REQUIRE_EQUAL(range.maxIndex, 3 * 1000 + 2)
+
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(k_NumTuples, QVector<size_t>(1, 3), "Values", true);
+    std::copy(values.begin(), values.end(), array->getPointer(0));
+    range = ArrayStatistics::FindMinMax(array.get());
+    DREAM3D_REQUIRE_EQUAL(range.count, k_NumTuples * 3)
+    DREAM3D_REQUIRE_EQUAL(range.min, *std::min_element(values.begin(), values.end()))
+    DREAM3D_REQUIRE_EQUAL(range.max, *std::max_element(values.begin(), values.end()))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHistogramAndQuantiles()
+  {
+    std::vector<float> values = GenerateValues(k_NumTuples);
+
+    std::vector<uint64_t> counts = ArrayStatistics::Histogram(values.data(), k_NumTuples, 1, 10, 1000.0, 1010.0);
+    DREAM3D_REQUIRE_EQUAL(counts.size(), 10)
+    std::vector<uint64_t> expected(10, 0);
+    for(float value : values)
+    {
+      expected[std::min(static_cast<size_t>((value - 1000.0) * 1.0), static_cast<size_t>(9))]++;
+    }
+    for(size_t i = 0; i < 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(counts[i], expected[i])
+    }
+    // Values outside of the range are ignored
+    counts = ArrayStatistics::Histogram(values.data(), k_NumTuples, 1, 4, 1002.0, 1004.0);
+    DREAM3D_REQUIRE_EQUAL(counts[0] + counts[1] + counts[2] + counts[3], expected[2] + expected[3] + std::count(values.begin(), values.end(), 1004.0f))
+    DREAM3D_REQUIRE(ArrayStatistics::Histogram(values.data(), k_NumTuples, 1, 0, 0.0, 1.0).empty())
+
+    std::vector<float> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<double> fractions = {0.0, 0.1, 0.25, 0.5, 0.9, 1.0};
+    std::vector<double> quantiles = ArrayStatistics::Quantiles(values.data(), k_NumTuples, 1, fractions);
+    DREAM3D_REQUIRE_EQUAL(quantiles.size(), fractions.size())
+    for(size_t i = 0; i < fractions.size(); i++)
+    {
+      double position = fractions[i] * (k_NumTuples - 1);
+      size_t lower = static_cast<size_t>(std::floor(position));
+      size_t upper = static_cast<size_t>(std::ceil(position));
+      double value = sorted[lower] + (sorted[upper] - sorted[lower]) * (position - lower);
+      DREAM3D_REQUIRE(std::abs(quantiles[i] - value) < 1.0e-9)
+    }
+
+    // Equal count bins of integers with many duplicates
+    std::vector<int8_t> bytes(1001);
+    for(size_t i = 0; i < bytes.size(); i++)
+    {
+      bytes[i] = static_cast<int8_t>(i % 5);
+    }
+    std::vector<double> edges = ArrayStatistics::QuantileBinEdges(bytes.data(), bytes.size(), 1, 4);
+    DREAM3D_REQUIRE_EQUAL(edges.size(), 5)
+    DREAM3D_REQUIRE_EQUAL(edges[0], 0.0)
+    DREAM3D_REQUIRE_EQUAL(edges[2], 2.0)
+    DREAM3D_REQUIRE_EQUAL(edges[4], 4.0)
+    DREAM3D_REQUIRE(ArrayStatistics::Quantiles(bytes.data(), 0, 1, fractions).empty())
+
+    // Infinite values take part in the quantiles, and histograms with infinite bounds are rejected
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> doubles = {3.0, inf, -inf, 1.0, 2.0, inf, 4.0, std::numeric_limits<double>::quiet_NaN()};
+    quantiles = ArrayStatistics::Quantiles(doubles.data(), doubles.size(), 1, {0.0, 0.5, 1.0});
+    DREAM3D_REQUIRE_EQUAL(quantiles.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(quantiles[0], -inf)
+    DREAM3D_REQUIRE_EQUAL(quantiles[1], 3.0)
+    DREAM3D_REQUIRE_EQUAL(quantiles[2], inf)
+    std::vector<double> infinities = {inf, -inf, inf};
+    quantiles = ArrayStatistics::Quantiles(infinities.data(), infinities.size(), 1, {0.0, 0.5, 1.0});
+    DREAM3D_REQUIRE_EQUAL(quantiles[0], -inf)
+    DREAM3D_REQUIRE_EQUAL(quantiles[1], inf)
+    DREAM3D_REQUIRE(ArrayStatistics::Histogram(doubles.data(), doubles.size(), 1, 4, -inf, 4.0).empty())
+    DREAM3D_REQUIRE(ArrayStatistics::Histogram(doubles.data(), doubles.size(), 1, 4, 0.0, inf).empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ArrayStatisticsTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestSumAndMoments())
+    DREAM3D_REGISTER_TEST(TestMinMax())
+    DREAM3D_REGISTER_TEST(TestHistogramAndQuantiles())
+  }
+
+private:
+  ArrayStatisticsTest(const ArrayStatisticsTest&); // Copy Constructor Not Implemented
+  void operator=(const ArrayStatisticsTest&);      // Move assignment Not Implemented
+};
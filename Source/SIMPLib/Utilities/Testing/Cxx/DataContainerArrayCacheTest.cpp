@@ -0,0 +1,219 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/DataContainerArrayCache.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataContainerArrayCacheTest
+{
+public:
+  DataContainerArrayCacheTest() = default;
+  virtual ~DataContainerArrayCacheTest() = default;
+
+  const size_t k_NumTuples = 100;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getTestFile(int index)
+  {
+    return UnitTest::TestTempDir + QString("/DataContainerArrayCacheTest_%1.dream3d").arg(index);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      QFile::remove(getTestFile(i));
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The cache only looks at the modification time and size of the file, so the
+  // test files do not need to hold real data
+  // -----------------------------------------------------------------------------
+  void WriteTestFile(const QString& filePath, const QByteArray& contents)
+  {
+    QFile file(filePath);
+    file.open(QIODevice::WriteOnly);
+    file.write(contents);
+    file.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray(int32_t value)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, k_NumTuples), "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(am->getName(), am);
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(k_NumTuples, "Data", true);
+    data->initializeWithValue(value);
+    am->addAttributeArray(data->getName(), data);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer GetData(const DataContainerArray::Pointer& dca)
+  {
+    return dca->getDataContainer("DataContainer")->getAttributeMatrix("CellData")->getAttributeArrayAs<Int32ArrayType>("Data");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindReturnsCopy()
+  {
+    DataContainerArrayCache* cache = DataContainerArrayCache::Instance();
+    cache->clear();
+    cache->setMaxEntries(4);
+    cache->setMemoryBudget(0);
+
+    WriteTestFile(getTestFile(0), "Version 1");
+    DataContainerArrayProxy proxy;
+    DREAM3D_REQUIRE(cache->find(getTestFile(0), proxy).get() == nullptr)
+
+    DataContainerArray::Pointer dca = CreateDataContainerArray(7);
+    cache->insert(getTestFile(0), proxy, dca);
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 1)
+    DREAM3D_REQUIRE_EQUAL(DataContainerArrayCache::EstimateMemory(dca), k_NumTuples * sizeof(int32_t))
+
+    // Changing the array after inserting it must not change the cached copy
+    GetData(dca)->initializeWithValue(1);
+
+    DataContainerArray::Pointer cached = cache->find(getTestFile(0), proxy);
+    DREAM3D_REQUIRE_VALID_POINTER(cached.get())
+    DREAM3D_REQUIRE(cached.get() != dca.get())
+    Int32ArrayType::Pointer data = GetData(cached);
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(0), 7)
+
+    // Each lookup hands out its own copy
+    data->initializeWithValue(2);
+    DREAM3D_REQUIRE_EQUAL(GetData(cache->find(getTestFile(0), proxy))->getValue(k_NumTuples - 1), 7)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 2)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 1)
+
+    // A different proxy selects different arrays and must not share the entry
+    DataContainerArrayProxy otherProxy;
+    otherProxy.dataContainers.insert("DataContainer", DataContainerProxy("DataContainer"));
+    DREAM3D_REQUIRE(cache->find(getTestFile(0), otherProxy).get() == nullptr)
+
+    // Rewriting the file invalidates the entry
+    WriteTestFile(getTestFile(0), "Version 2 of the file");
+    DREAM3D_REQUIRE(cache->find(getTestFile(0), proxy).get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 0)
+
+    cache->setMaxEntries(0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestEviction()
+  {
+    DataContainerArrayCache* cache = DataContainerArrayCache::Instance();
+    cache->clear();
+    cache->setMaxEntries(2);
+    cache->setMemoryBudget(0);
+
+    DataContainerArrayProxy proxy;
+    for(int i = 0; i < 3; i++)
+    {
+      WriteTestFile(getTestFile(i), "Data");
+    }
+
+    cache->insert(getTestFile(0), proxy, CreateDataContainerArray(0));
+    cache->insert(getTestFile(1), proxy, CreateDataContainerArray(1));
+
+    // Touch the first entry so that the second one is the least recently used
+    DREAM3D_REQUIRE_VALID_POINTER(cache->find(getTestFile(0), proxy).get())
+    cache->insert(getTestFile(2), proxy, CreateDataContainerArray(2));
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 2)
+    DREAM3D_REQUIRE_VALID_POINTER(cache->find(getTestFile(0), proxy).get())
+    DREAM3D_REQUIRE(cache->find(getTestFile(1), proxy).get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(GetData(cache->find(getTestFile(2), proxy))->getValue(0), 2)
+
+    cache->remove(getTestFile(2));
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 1)
+
+    // Disabling the cache drops every entry and stops new ones from being added
+    cache->setMaxEntries(0);
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 0)
+    DREAM3D_REQUIRE_EQUAL(cache->isEnabled(), false)
+    cache->insert(getTestFile(0), proxy, CreateDataContainerArray(0));
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    std::cout << "#### DataContainerArrayCacheTest Starting ####" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFindReturnsCopy())
+    DREAM3D_REGISTER_TEST(TestEviction())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  DataContainerArrayCacheTest(const DataContainerArrayCacheTest&); // Copy Constructor Not Implemented
+  void operator=(const DataContainerArrayCacheTest&);              // Move assignment Not Implemented
+};
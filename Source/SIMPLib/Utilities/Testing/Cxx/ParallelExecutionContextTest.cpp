@@ -0,0 +1,190 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelExecutionContext.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ParallelExecutionContextTest
+{
+public:
+  ParallelExecutionContextTest() = default;
+  virtual ~ParallelExecutionContextTest() = default;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  class SumImpl
+  {
+  public:
+    SumImpl(std::atomic<size_t>* sum)
+    : m_Sum(sum)
+    {
+    }
+
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      size_t localSum = 0;
+      for(size_t i = r.begin(); i < r.end(); i++)
+      {
+        localSum += i;
+      }
+      m_Sum->fetch_add(localSum);
+    }
+
+  private:
+    std::atomic<size_t>* m_Sum;
+  };
+#endif
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParseCoreList()
+  {
+    std::vector<int> cores = ParallelExecutionContext::ParseCoreList("0-3,8,10-11");
+    DREAM3D_REQUIRE_EQUAL(cores.size(), 7)
+    DREAM3D_REQUIRE_EQUAL(cores[0], 0)
+    DREAM3D_REQUIRE_EQUAL(cores[3], 3)
+    DREAM3D_REQUIRE_EQUAL(cores[4], 8)
+    DREAM3D_REQUIRE_EQUAL(cores[6], 11)
+
+    // Malformed and duplicate entries are dropped
+    cores = ParallelExecutionContext::ParseCoreList("2,2,x,5-4,,1");
+    DREAM3D_REQUIRE_EQUAL(cores.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(cores[0], 1)
+    DREAM3D_REQUIRE_EQUAL(cores[1], 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestThreadBudget()
+  {
+    ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+    int maxThreads = context->getMaxThreads();
+    std::vector<int> affinity = context->getCpuAffinity();
+    size_t grainHint = context->getGrainSizeHint();
+
+    context->setCpuAffinity(std::vector<int>());
+    context->setMaxThreads(1);
+    DREAM3D_REQUIRE_EQUAL(context->getNumThreads(), 1)
+    DREAM3D_REQUIRE_EQUAL(context->getUseParallel(), false)
+
+    context->setMaxThreads(0);
+    context->setCpuAffinity(ParallelExecutionContext::ParseCoreList("0-1"));
+    DREAM3D_REQUIRE(context->getNumThreads() <= 2)
+
+    context->setGrainSizeHint(0);
+    DREAM3D_REQUIRE(context->computeGrainSize(1000) >= 1000 / 2)
+    context->setGrainSizeHint(64);
+    DREAM3D_REQUIRE_EQUAL(context->computeGrainSize(1000), 64)
+    DREAM3D_REQUIRE_EQUAL(context->computeGrainSize(1000, 128), 128)
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    std::atomic<size_t> sum(0);
+    context->parallelFor(tbb::blocked_range<size_t>(0, 10000), SumImpl(&sum));
+    DREAM3D_REQUIRE_EQUAL(sum.load(), 10000 * 9999 / 2)
+#endif
+
+    context->setGrainSizeHint(grainHint);
+    context->setCpuAffinity(affinity);
+    context->setMaxThreads(maxThreads);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Only the worker threads of the arena are pinned, so the affinity of the calling thread must be the same
+  // before and after a parallel algorithm ran
+  // -----------------------------------------------------------------------------
+  void TestCallerAffinity()
+  {
+#if defined(SIMPL_USE_PARALLEL_ALGORITHMS) && defined(__linux__)
+    ParallelExecutionContext* context = ParallelExecutionContext::Instance();
+    std::vector<int> affinity = context->getCpuAffinity();
+    ParallelExecutionContext::AffinityPolicy policy = context->getAffinityPolicy();
+
+    cpu_set_t before;
+    DREAM3D_REQUIRE_EQUAL(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &before), 0)
+
+    for(ParallelExecutionContext::AffinityPolicy testPolicy : {ParallelExecutionContext::AffinityPolicy::Slice, ParallelExecutionContext::AffinityPolicy::Core})
+    {
+      context->setCpuAffinity(ParallelExecutionContext::ParseCoreList("0"));
+      context->setAffinityPolicy(testPolicy);
+      for(int i = 0; i < 3; i++)
+      {
+        std::atomic<size_t> sum(0);
+        context->parallelFor(tbb::blocked_range<size_t>(0, 100000, 100), SumImpl(&sum));
+        DREAM3D_REQUIRE_EQUAL(sum.load(), static_cast<size_t>(100000) * 99999 / 2)
+      }
+
+      cpu_set_t after;
+      DREAM3D_REQUIRE_EQUAL(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &after), 0)
+      DREAM3D_REQUIRE(CPU_EQUAL(&before, &after))
+    }
+
+    context->setAffinityPolicy(policy);
+    context->setCpuAffinity(affinity);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ParallelExecutionContextTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestParseCoreList());
+    DREAM3D_REGISTER_TEST(TestThreadBudget());
+    DREAM3D_REGISTER_TEST(TestCallerAffinity());
+  }
+
+private:
+  ParallelExecutionContextTest(const ParallelExecutionContextTest&); // Copy Constructor Not Implemented
+  void operator=(const ParallelExecutionContextTest&);               // Move assignment Not Implemented
+};
@@ -23,6 +23,7 @@ namespace
   static const QString kArgs("ARGS");
   static const QString kConst("CONST");
   static const QString kConstMethod("CONST_METHOD");
+  static const QString kReleaseGil("RELEASE_GIL");
   static const QString kSuperClass("SUPERCLASS");
   static const QString kOverload("OVERLOAD");
 
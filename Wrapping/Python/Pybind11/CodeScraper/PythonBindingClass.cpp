@@ -622,14 +622,28 @@ QString PythonBindingClass::generateMethodCode()
     QString methodName = tokens[1];
     out << TAB << "/* Class instance method " << methodName << " */" << NEWLINE_SIMPL;
     bool methodIsConst = false;
-    if(tokens.last().compare(::kConstMethod) == 0)
+    bool releaseGil = false;
+    while(tokens.last().compare(::kConstMethod) == 0 || tokens.last().compare(::kReleaseGil) == 0)
     {
-      methodIsConst = true;
+      if(tokens.last().compare(::kConstMethod) == 0)
+      {
+        methodIsConst = true;
+      }
+      else
+      {
+        releaseGil = true;
+      }
       tokens.pop_back();
     }
+    // Long running methods give up the GIL so that other Python threads can run while they execute
+    QString callGuard;
+    if(releaseGil)
+    {
+      callGuard = ", py::call_guard<py::gil_scoped_release>()";
+    }
     if(tokens.size() == 2)
     {
-      out << TAB << ".def(\"" << methodName << "\", &" << getClassName() << "::" << methodName << ")" << NEWLINE_SIMPL;
+      out << TAB << ".def(\"" << methodName << "\", &" << getClassName() << "::" << methodName << callGuard << ")" << NEWLINE_SIMPL;
     }
     else if(tokens.size() >= 3 && tokens[2] == ::kOverload)
     {
@@ -680,7 +694,7 @@ QString PythonBindingClass::generateMethodCode()
         QStringList varPair = tokens[i].split(","); // Split the var,type pair using a comma
         out << ", \n" << TAB << TAB << TAB << TAB << "py::arg(\"" << varPair[1] << "\")";
       }
-      out << NEWLINE_SIMPL << TAB << TAB << TAB << ")" << NEWLINE_SIMPL;
+      out << callGuard << NEWLINE_SIMPL << TAB << TAB << TAB << ")" << NEWLINE_SIMPL;
            
     }
     else if(tokens.size() > 3 && tokens[2] == ::kArgs)
@@ -690,7 +704,7 @@ QString PythonBindingClass::generateMethodCode()
       {
         out << ", \n" << TAB << TAB << TAB << TAB << "py::arg(\"" << tokens[i] << "\")";
       }
-      out << NEWLINE_SIMPL << TAB << TAB << TAB << ")" << NEWLINE_SIMPL;
+      out << callGuard << NEWLINE_SIMPL << TAB << TAB << TAB << ")" << NEWLINE_SIMPL;
     }
   }
   return code;
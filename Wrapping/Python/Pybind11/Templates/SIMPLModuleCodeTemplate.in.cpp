@@ -128,6 +128,37 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
  *
  ******************************************************************************/
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+
+/**
+ * @brief Describes the memory of a DataArray<T> to the Python buffer protocol so that numpy.asarray() and
+ * memoryview() can use the values without copying them. The first dimension is the number of tuples followed
+ * by the component dimensions; arrays with a single component are one dimensional. The view is only valid
+ * as long as the DataArray is not resized.
+ * @param da
+ * @return
+ */
+template <typename T> py::buffer_info DataArrayBufferInfo(DataArray<T>& da)
+{
+  std::vector<ssize_t> shape(1, static_cast<ssize_t>(da.getNumberOfTuples()));
+  QVector<size_t> cDims = da.getComponentDimensions();
+  if(cDims.size() != 1 || cDims[0] != 1)
+  {
+    for(size_t dim : cDims)
+    {
+      shape.push_back(static_cast<ssize_t>(dim));
+    }
+  }
+  std::vector<ssize_t> strides(shape.size());
+  ssize_t stride = static_cast<ssize_t>(sizeof(T));
+  for(size_t i = shape.size(); i > 0; i--)
+  {
+    strides[i - 1] = stride;
+    stride *= shape[i - 1];
+  }
+  T* ptr = da.getNumberOfTuples() > 0 ? da.getPointer(0) : nullptr;
+  return py::buffer_info(ptr, sizeof(T), py::format_descriptor<T>::format(), static_cast<ssize_t>(shape.size()), shape, strides);
+}
 
 /**
  * @brief Initializes a template specialization of DataArray<T>
@@ -155,7 +186,8 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
         .def("setValue", &DataArrayType::setValue, py::arg("index"), py::arg("value"))                                                                                                                 \
         .def("getValue", &DataArrayType::getValue, py::arg("index"))                                                                                                                                   \
         .def_property("Name", &DataArrayType::getName, &DataArrayType::setName)                                                                                                                        \
-        .def("Cleanup", []() { return DataArrayType::NullPointer(); });                                                                                                                                \
+        .def("Cleanup", []() { return DataArrayType::NullPointer(); })                                                                                                                                 \
+        .def_buffer([](DataArrayType& da) -> py::buffer_info { return DataArrayBufferInfo<T>(da); });                                                                                                  \
     ;                                                                                                                                                                                                  \
     return instance;                                                                                                                                                                                   \
   }
@@ -175,6 +207,49 @@ PYB11_DEFINE_DATAARRAY_INIT(uint64_t, UInt64ArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(float, FloatArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(double, DoubleArrayType);
 
+/**
+ * @brief Initializes a template specialization of NeighborList<T>. getList() returns the values of a single
+ * list as a numpy array that shares the memory of the list and keeps the list alive.
+ * @param T The Type
+ * @param NAME The name of the Variable
+ */
+#define PYB11_DEFINE_NEIGHBORLIST_INIT(T, NAME)                                                                                                                                                        \
+  PySharedPtrClass<NeighborList<T>> declare##NAME(py::module& m, PySharedPtrClass<IDataArray>& parent)                                                                                                 \
+  {                                                                                                                                                                                                    \
+    using NeighborListType = NeighborList<T>;                                                                                                                                                          \
+    PySharedPtrClass<NeighborListType> instance(m, #NAME, parent);                                                                                                                                     \
+    instance.def(py::init([](size_t numTuples, QString name, bool allocate) { return NeighborListType::CreateArray(numTuples, name, allocate); }))                                                      \
+        .def("getNumberOfLists", &NeighborListType::getNumberOfLists)                                                                                                                                  \
+        .def("getListSize", &NeighborListType::getListSize, py::arg("index"))                                                                                                                          \
+        .def("getList",                                                                                                                                                                                \
+             [](NeighborListType& list, int index) {                                                                                                                                                   \
+               if(index < 0 || index >= list.getNumberOfLists())                                                                                                                                       \
+               {                                                                                                                                                                                       \
+                 throw py::index_error();                                                                                                                                                              \
+               }                                                                                                                                                                                       \
+               typename NeighborListType::SharedVectorType* owner = new typename NeighborListType::SharedVectorType(list.getList(index));                                                             \
+               py::capsule base(owner, [](void* p) { delete reinterpret_cast<typename NeighborListType::SharedVectorType*>(p); });                                                                   \
+               return py::array_t<T>(static_cast<ssize_t>((*owner)->size()), (*owner)->data(), base);                                                                                                  \
+             },                                                                                                                                                                                        \
+             py::arg("index"))                                                                                                                                                                         \
+        .def("setList",                                                                                                                                                                                \
+             [](NeighborListType& list, int index, py::array_t<T, py::array::c_style | py::array::forcecast> values) {                                                                                 \
+               if(index < 0)                                                                                                                                                                           \
+               {                                                                                                                                                                                       \
+                 throw py::index_error();                                                                                                                                                              \
+               }                                                                                                                                                                                       \
+               typename NeighborListType::SharedVectorType vec(new std::vector<T>(values.data(), values.data() + values.size()));                                                                    \
+               list.setList(index, vec);                                                                                                                                                               \
+             },                                                                                                                                                                                        \
+             py::arg("index"), py::arg("values"))                                                                                                                                                      \
+        .def_property("Name", &NeighborListType::getName, &NeighborListType::setName);                                                                                                                 \
+    ;                                                                                                                                                                                                  \
+    return instance;                                                                                                                                                                                   \
+  }
+
+PYB11_DEFINE_NEIGHBORLIST_INIT(int32_t, Int32NeighborListType);
+PYB11_DEFINE_NEIGHBORLIST_INIT(float, FloatNeighborListType);
+
 
 
 //------------------------------------------------------------------------------
@@ -267,6 +342,10 @@ PYBIND11_MODULE(dream3d_py, m)
   PySharedPtrClass<FloatArrayType> @LIB_NAME@_FloatArrayType = declareFloatArrayType(mod, @LIB_NAME@_IDataArray);
   PySharedPtrClass<DoubleArrayType> @LIB_NAME@_DoubleArrayType = declareDoubleArrayType(mod, @LIB_NAME@_IDataArray);
 
+  /* Init codes for the NeighborList<T> classes */
+  PySharedPtrClass<Int32NeighborListType> @LIB_NAME@_Int32NeighborListType = declareInt32NeighborListType(mod, @LIB_NAME@_IDataArray);
+  PySharedPtrClass<FloatNeighborListType> @LIB_NAME@_FloatNeighborListType = declareFloatNeighborListType(mod, @LIB_NAME@_IDataArray);
+
   py::enum_<SIMPL::InfoStringFormat>(mod, "InfoStringFormat").value("HtmlFormat", SIMPL::InfoStringFormat::HtmlFormat).value("UnknownFormat", SIMPL::InfoStringFormat::UnknownFormat).export_values();
 
   
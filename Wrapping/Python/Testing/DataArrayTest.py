@@ -39,12 +39,14 @@ def DataArrayTest():
     # go out of scope then the SIMPL.DataArray will have garbage values since it will
     # be wrapping an invalid pointer.
     arrayList = []
+    dataArrays = []
 
     for index, item in enumerate(arrayTypes):
         # print("+++ Creating Array: %s" % item)
         z_flat, array = sc.CreateDataArray(arrayTypes[index].__name__, shape, cDims, item)
         cellAm.addAttributeArray(array.Name, array)
         arrayList.append(z_flat)
+        dataArrays.append(array)
         # Now add an array that is purely allocated on the C++/SIMPL side of things.
         # print ("  Creating Int32Array locally to the Loop.... Int32 SIMPL %s" % array.Name)
         array = simpl.Int32ArrayType(shape[0]*shape[1]*shape[2], "Int32 SIMPL " + array.Name, True)
@@ -55,6 +57,29 @@ def DataArrayTest():
         array = simpl.Int32ArrayType.Cleanup()
         # print("--- Loop Complete for %s" % item)
 
+    # DataArrays export their memory through the buffer protocol, so numpy uses it without copying
+    for index, item in enumerate(arrayTypes):
+        view = np.asarray(dataArrays[index])
+        assert view.dtype == item
+        assert view.shape == (shape[0] * shape[1] * shape[2],)
+        assert np.shares_memory(view, arrayList[index])
+
+    array = simpl.FloatArrayType(20, "Buffer Test", True)
+    for x in range(20):
+        array.setValue(x, x * 0.5)
+    view = np.asarray(array)
+    assert view[7] == 3.5
+    view[3] = 42.0
+    assert array.getValue(3) == 42.0
+
+    # The values of a NeighborList are exported one list at a time and stay valid after the list is released
+    neighbors = simpl.Int32NeighborListType(3, "Neighbors", True)
+    neighbors.setList(1, np.array([4, 5, 6], dtype=np.int32))
+    assert neighbors.getListSize(1) == 3
+    values = neighbors.getList(1)
+    neighbors = None
+    assert values.tolist() == [4, 5, 6]
+
     # Create a Geometry Object and store it in the DataContainer
     imageGeom = simpl.ImageGeom.CreateGeometry("ImageGeometry")
     imageGeom.setDimensions(shape[0], shape[1], shape[2])